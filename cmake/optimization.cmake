@@ -0,0 +1,103 @@
+
+# Link-time and profile-guided optimization of RetDec's own code.
+#
+# It has to be included after external dependencies are added so that the
+# flags are not used when building them.
+#
+# Options:
+#  - RETDEC_ENABLE_LTO=ON enables link-time optimization.
+#  - RETDEC_PGO=GENERATE builds instrumented binaries which write profiles into
+#    RETDEC_PGO_DIR when they are run.
+#  - RETDEC_PGO=USE builds binaries optimized by using profiles from
+#    RETDEC_PGO_DIR.
+#
+# The whole PGO workflow (instrumented build, training run, optimized build) is
+# automated by scripts/retdec-pgo-build.sh.
+
+set(RETDEC_PGO_STAGES "GENERATE" "USE")
+if(RETDEC_PGO AND NOT RETDEC_PGO IN_LIST RETDEC_PGO_STAGES)
+	message(FATAL_ERROR "RETDEC_PGO has to be empty, GENERATE, or USE (got '${RETDEC_PGO}').")
+endif()
+
+if(NOT RETDEC_ENABLE_LTO AND NOT RETDEC_PGO)
+	return()
+endif()
+
+if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+	set(RETDEC_COMPILER_IS_GNU ON)
+elseif(CMAKE_CXX_COMPILER_ID STREQUAL "Clang" OR
+		CMAKE_CXX_COMPILER_ID STREQUAL "AppleClang")
+	set(RETDEC_COMPILER_IS_CLANG ON)
+endif()
+
+macro(retdec_add_optimization_flags flags)
+	set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${flags}")
+	set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${flags}")
+	set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${flags}")
+	set(CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} ${flags}")
+	set(CMAKE_MODULE_LINKER_FLAGS "${CMAKE_MODULE_LINKER_FLAGS} ${flags}")
+endmacro()
+
+# Link-time optimization.
+if(RETDEC_ENABLE_LTO)
+	if(MSVC)
+		set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} /GL")
+		set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /GL")
+		set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} /LTCG")
+		set(CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} /LTCG")
+		set(CMAKE_STATIC_LINKER_FLAGS "${CMAKE_STATIC_LINKER_FLAGS} /LTCG")
+	elseif(RETDEC_COMPILER_IS_GNU)
+		retdec_add_optimization_flags("-flto -fno-fat-lto-objects")
+		# Static libraries with LTO objects need an archiver with the LTO plugin.
+		find_program(RETDEC_GCC_AR NAMES "gcc-ar-${CMAKE_CXX_COMPILER_VERSION}" "gcc-ar")
+		find_program(RETDEC_GCC_RANLIB NAMES "gcc-ranlib-${CMAKE_CXX_COMPILER_VERSION}" "gcc-ranlib")
+		if(NOT RETDEC_GCC_AR OR NOT RETDEC_GCC_RANLIB)
+			message(FATAL_ERROR "RETDEC_ENABLE_LTO requires gcc-ar and gcc-ranlib.")
+		endif()
+		set(CMAKE_AR "${RETDEC_GCC_AR}")
+		set(CMAKE_RANLIB "${RETDEC_GCC_RANLIB}")
+	elseif(RETDEC_COMPILER_IS_CLANG)
+		retdec_add_optimization_flags("-flto=thin")
+		if(NOT APPLE)
+			find_program(RETDEC_LLVM_AR NAMES "llvm-ar")
+			find_program(RETDEC_LLVM_RANLIB NAMES "llvm-ranlib")
+			if(NOT RETDEC_LLVM_AR OR NOT RETDEC_LLVM_RANLIB)
+				message(FATAL_ERROR "RETDEC_ENABLE_LTO requires llvm-ar and llvm-ranlib.")
+			endif()
+			set(CMAKE_AR "${RETDEC_LLVM_AR}")
+			set(CMAKE_RANLIB "${RETDEC_LLVM_RANLIB}")
+		endif()
+	else()
+		message(FATAL_ERROR "RETDEC_ENABLE_LTO is not supported for compiler '${CMAKE_CXX_COMPILER_ID}'.")
+	endif()
+	message(STATUS "Link-time optimization enabled.")
+endif()
+
+# Profile-guided optimization.
+if(RETDEC_PGO)
+	if(NOT RETDEC_COMPILER_IS_GNU AND NOT RETDEC_COMPILER_IS_CLANG)
+		message(FATAL_ERROR "RETDEC_PGO is not supported for compiler '${CMAKE_CXX_COMPILER_ID}'.")
+	endif()
+
+	# GCC names profiles after object files, so the instrumented and the
+	# optimized builds have to be done in the same build directory.
+	if(RETDEC_PGO STREQUAL "GENERATE")
+		file(MAKE_DIRECTORY "${RETDEC_PGO_DIR}")
+		if(RETDEC_COMPILER_IS_GNU)
+			retdec_add_optimization_flags("-fprofile-generate=${RETDEC_PGO_DIR} -fprofile-update=atomic")
+		else()
+			retdec_add_optimization_flags("-fprofile-instr-generate=${RETDEC_PGO_DIR}/retdec-%p-%m.profraw")
+		endif()
+	else()
+		if(RETDEC_COMPILER_IS_GNU)
+			retdec_add_optimization_flags("-fprofile-use=${RETDEC_PGO_DIR} -fprofile-correction -Wno-missing-profile")
+		else()
+			set(RETDEC_PGO_PROFDATA "${RETDEC_PGO_DIR}/retdec.profdata")
+			if(NOT EXISTS "${RETDEC_PGO_PROFDATA}")
+				message(FATAL_ERROR "Merged profile '${RETDEC_PGO_PROFDATA}' does not exist (use llvm-profdata merge).")
+			endif()
+			retdec_add_optimization_flags("-fprofile-instr-use=${RETDEC_PGO_PROFDATA} -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date")
+		endif()
+	endif()
+	message(STATUS "Profile-guided optimization stage: ${RETDEC_PGO} (profiles in ${RETDEC_PGO_DIR}).")
+endif()
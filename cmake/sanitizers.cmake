@@ -0,0 +1,27 @@
+# Sanitizers for RetDec's own code.
+#
+# It has to be included after external dependencies are added so that the
+# flags are not used when building them.
+#
+# Options:
+#  - RETDEC_SANITIZE_THREAD=ON builds with ThreadSanitizer, which reports data
+#    races, e.g. in tests which run several decompilations concurrently
+#    (ProviderContextTests in retdec-tests-bin2llvmir).
+
+if(NOT RETDEC_SANITIZE_THREAD)
+	return()
+endif()
+
+if(NOT CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND
+		NOT CMAKE_CXX_COMPILER_ID STREQUAL "Clang" AND
+		NOT CMAKE_CXX_COMPILER_ID STREQUAL "AppleClang")
+	message(FATAL_ERROR "RETDEC_SANITIZE_THREAD is not supported for compiler '${CMAKE_CXX_COMPILER_ID}'.")
+endif()
+
+set(RETDEC_TSAN_FLAGS "-fsanitize=thread -fno-omit-frame-pointer")
+set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${RETDEC_TSAN_FLAGS}")
+set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${RETDEC_TSAN_FLAGS}")
+set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} -fsanitize=thread")
+set(CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} -fsanitize=thread")
+set(CMAKE_MODULE_LINKER_FLAGS "${CMAKE_MODULE_LINKER_FLAGS} -fsanitize=thread")
+message(STATUS "ThreadSanitizer enabled.")
@@ -11,6 +11,7 @@
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
 #define RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <unordered_map>
@@ -107,7 +108,7 @@ class BasicBlockEntry
 
 	private:
 		unsigned id;
-	    static int newUID;
+	    static std::atomic<int> newUID;
 };
 
 class ReachingDefinitionsAnalysis
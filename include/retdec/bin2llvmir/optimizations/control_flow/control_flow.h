@@ -14,6 +14,7 @@
 #include "retdec/bin2llvmir/analyses/symbolic_tree.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
@@ -86,6 +87,8 @@ class ControlFlow : public llvm::ModulePass
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		FileImage* _image = nullptr;
+		DebugFormat* _dbgf = nullptr;
+		Lti* _lti = nullptr;
 		ReachingDefinitionsAnalysis _RDA;
 		IrModifier _irmodif;
 
@@ -19,6 +19,7 @@
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/debugformat.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/syscall_sites.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
 #include "retdec/capstone2llvmir/x86/x86.h"
@@ -330,6 +331,9 @@ class Decoder : public llvm::ModulePass
 
 		void fixMipsDelaySlots();
 
+		void recordSyscallSites(AsmInstruction first, AsmInstruction last);
+		bool isSyscallInstruction(cs_insn* insn) const;
+
 		bool isArmOrThumb() const;
 		cs_mode getUnknownMode() const;
 		cs_mode determineMode(AsmInstruction ai, retdec::utils::Address target) const;
@@ -339,6 +343,7 @@ class Decoder : public llvm::ModulePass
 		Config* _config = nullptr;
 		FileImage* _image = nullptr;
 		DebugFormat* _debug = nullptr;
+		SyscallSites* _syscalls = nullptr;
 
 		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> _c2l;
 
@@ -0,0 +1,76 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/decoder/identical_functions.h
+* @brief Fold identical decoded functions into one canonical function.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_IDENTICAL_FUNCTIONS_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_DECODER_IDENTICAL_FUNCTIONS_H
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+
+#include "retdec/utils/address.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/syscall_sites.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Statically linked and template-heavy binaries contain many functions with
+ * identical code (duplicated template instantiations, thunks, compiler
+ * generated helpers). Decoding, optimizing and emitting each of them
+ * separately is a waste of time.
+ *
+ * This class fingerprints bodies of decoded functions and folds duplicates:
+ * the function with the lowest address keeps its body, bodies of all the
+ * others are replaced by stubs that only call the canonical function.
+ * Duplicates are marked as aliases in config, stubs keep LLVM to ASM mapping
+ * of the duplicates' entries.
+ *
+ * Fingerprints are computed from the decoded LLVM IR, where PC-relative
+ * operands are already resolved to absolute addresses. Addresses that fall
+ * into the function itself (local jump targets, return addresses, LLVM to
+ * ASM mapping) are normalized relative to the function start, so the same
+ * code placed at different addresses has the same fingerprint. Addresses
+ * outside the function (callees, data) are kept, so only code that calls
+ * and accesses the same things is folded.
+ */
+class IdenticalFunctions
+{
+	public:
+		IdenticalFunctions(
+				llvm::Module* m,
+				Config* c,
+				SyscallSites* s = nullptr);
+
+		std::size_t fold();
+
+	private:
+		using Fingerprint = std::vector<std::uint64_t>;
+
+	private:
+		void findTargetsInsideFunctions();
+		bool canBeFolded(llvm::Function& f) const;
+		Fingerprint computeFingerprint(
+				llvm::Function& f,
+				const retdec::config::Function& cf) const;
+		void replaceWithStub(llvm::Function& dup, llvm::Function& canonical);
+
+	private:
+		llvm::Module* _module = nullptr;
+		Config* _config = nullptr;
+		SyscallSites* _syscalls = nullptr;
+		/// Functions with control flow targets after their start.
+		std::set<const llvm::Function*> _enteredInside;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
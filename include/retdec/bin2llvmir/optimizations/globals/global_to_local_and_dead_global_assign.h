@@ -60,7 +60,8 @@ private:
 	*/
 	class FuncInfo {
 	public:
-		FuncInfo(llvm::Function &func, StoreLoadAnalysis &storeLoadAnalysis);
+		FuncInfo(llvm::Function &func, StoreLoadAnalysis &storeLoadAnalysis,
+			Config *config);
 		~FuncInfo();
 
 		llvm::Function &getFunc();
@@ -110,6 +111,9 @@ private:
 		/// Analysis for store and load instructions.
 		StoreLoadAnalysis &storeLoadAnalysis;
 
+		/// Config of the module with the function.
+		Config *config;
+
 		/// Contains instructions that create patterns.
 		InstSet patternInsts;
 
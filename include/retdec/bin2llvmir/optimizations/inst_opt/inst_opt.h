@@ -37,6 +37,9 @@ class InstOpt : public llvm::ModulePass
 		bool run();
 		bool runGeneralOpts();
 		bool fixX86RepAnalysis();
+		llvm::Function* getLibraryFunction(
+				const std::string& name,
+				llvm::FunctionType* ft);
 
 	private:
 		llvm::Module* _module = nullptr;
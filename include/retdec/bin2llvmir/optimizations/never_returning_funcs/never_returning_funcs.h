@@ -57,7 +57,7 @@ private:
 	static const char *NAME;
 
 	/// Mapping of functions that never return.
-	static StringVecFuncMap funcNeverReturnsMap;
+	StringVecFuncMap funcNeverReturnsMap;
 
 	/// Optimized module.
 	llvm::Module *module;
@@ -7,6 +7,7 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_SIMPLE_TYPES_SIMPLE_TYPES_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_SIMPLE_TYPES_SIMPLE_TYPES_H
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
@@ -157,7 +158,7 @@ class EqSet
 
 	public:
 		/// Each instance gets its own unique ID for debug print purposes.
-		static unsigned newUID;
+		static std::atomic<unsigned> newUID;
 		const unsigned id;
 
 		/// Type of an entire equivalence set.
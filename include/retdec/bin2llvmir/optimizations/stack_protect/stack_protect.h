@@ -34,7 +34,11 @@ class StackProtect : public llvm::ModulePass
 		Config* _config = nullptr;
 
 		std::string _fncName = "__decompiler_undefined_function_";
-		static std::map<llvm::Type*, llvm::Function*> _type2fnc;
+		/// Protector functions mapped by their types. They are kept in
+		/// the provider context between the protecting and unprotecting run.
+		/// Pass' own map is used if it is run outside of such context.
+		std::map<llvm::Type*, llvm::Function*>* _type2fnc = &_ownType2fnc;
+		std::map<llvm::Type*, llvm::Function*> _ownType2fnc;
 };
 
 } // namespace bin2llvmir
@@ -7,12 +7,15 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_SYSCALLS_SYSCALLS_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_SYSCALLS_SYSCALLS_H
 
+#include <vector>
+
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/syscall_sites.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -29,13 +32,15 @@ class SyscallFixer : public llvm::ModulePass
 				llvm::Module& M,
 				Config* c,
 				FileImage* img,
-				Lti* lti);
+				Lti* lti,
+				SyscallSites* sites = nullptr);
 
 	private:
 		bool run();
 		bool runMips();
 		bool runArm();
 		bool runX86();
+		std::vector<AsmInstruction> getSyscallInstructions(unsigned insnId);
 		bool x86TransformToDummySyscall(AsmInstruction& ai);
 
 	private:
@@ -43,6 +48,7 @@ class SyscallFixer : public llvm::ModulePass
 		Config* _config = nullptr;
 		FileImage* _image = nullptr;
 		Lti* _lti = nullptr;
+		SyscallSites* _sites = nullptr;
 };
 
 } // namespace bin2llvmir
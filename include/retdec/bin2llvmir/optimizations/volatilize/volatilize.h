@@ -12,6 +12,7 @@
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 
 namespace retdec {
@@ -48,8 +49,10 @@ class Volatilize : public llvm::ModulePass
 		bool unvolatilize(llvm::Module& M);
 
 	private:
-		static bool _doVolatilization;
-		static UnorderedValSet _alreadyVolatile;
+		/// State is kept in the provider context between the runs. Pass' own
+		/// state is used if it is run outside of such context.
+		ProviderContext::VolatilizeState* _state = &_ownState;
+		ProviderContext::VolatilizeState _ownState;
 };
 
 } // namespace bin2llvmir
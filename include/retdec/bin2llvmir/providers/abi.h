@@ -111,27 +111,27 @@ class ModuleAbis
 class AbiProvider
 {
 	public:
-		static ModuleAbis* addAbis(
+		ModuleAbis* addAbis(
 				llvm::Module* module,
 				const retdec::config::Architecture& arch,
 				const retdec::config::ToolInfoContainer& tools,
 				const std::vector<std::string>& abis = std::vector<std::string>());
 
-		static ModuleAbis* getAbis(llvm::Module* module);
-		static bool getAbis(llvm::Module* module, ModuleAbis*& abis);
+		ModuleAbis* getAbis(llvm::Module* module);
+		bool getAbis(llvm::Module* module, ModuleAbis*& abis);
 
-		static Abi* getAbi(
+		Abi* getAbi(
 				llvm::Module* module,
 				retdec::config::CallingConvention cc);
-		static bool getAbi(
+		bool getAbi(
 				llvm::Module* module,
 				retdec::config::CallingConvention cc,
 				Abi*& abi);
 
-		static void clear();
+		void clear();
 
 	private:
-		static std::map<llvm::Module*, ModuleAbis> _module2abis;
+		std::map<llvm::Module*, ModuleAbis> _module2abis;
 };
 
 } // namespace bin2llvmir
@@ -342,19 +342,16 @@ class AsmInstruction
 		static retdec::utils::Address getInstructionAddress(
 				llvm::Instruction* inst);
 		static bool isLlvmToAsmInstruction(const llvm::Value* inst);
-		static void clear();
 
 	private:
-		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
-				llvm::Module* m) const;
-		bool isLlvmToAsmInstructionPrivate(llvm::Value* inst) const;
-
-	private:
-		using ModuleGlobalPair = std::pair<const llvm::Module*, const llvm::GlobalVariable*>;
+		static const llvm::GlobalVariable* findLlvmToAsmGlobalVariable(
+				const llvm::Module* m);
+		static bool isLlvmToAsmInstruction(
+				const llvm::Value* inst,
+				const llvm::GlobalVariable* gv);
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
-		static std::vector<ModuleGlobalPair> _cache;
 };
 
 } // namespace bin2llvmir
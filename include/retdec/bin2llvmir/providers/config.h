@@ -7,10 +7,15 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_CONFIG_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_CONFIG_H
 
+#include <map>
+#include <unordered_map>
+
 #include "retdec/config/config.h"
+#include "retdec/demangler/demangler.h"
 
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
 
 #include "retdec/utils/address.h"
 
@@ -156,6 +161,79 @@ class Config
 		bool isPic32() const;
 		bool isMipsOrPic32() const;
 		llvm::GlobalVariable* getGlobalDummy();
+		retdec::demangler::CDemangler* getDemangler() const;
+		void setDemangler(retdec::demangler::CDemangler* d);
+
+	private:
+		class ValueInfo;
+		using ValueInfoMap = std::unordered_map<const llvm::Value*, ValueInfo>;
+
+		/**
+		 * Classification of an LLVM value (global variable, alloca, or
+		 * function) by the config database. Config objects are found by
+		 * the value's name, so the classification is valid only while the
+		 * value keeps its name and the containers the objects were found in
+		 * keep their stamps (see @c isUpToDate()). The entry removes itself
+		 * from its map when the value is deleted.
+		 *
+		 * Register classes depend also on the architecture, which is expected
+		 * not to change once registers are classified.
+		 */
+		class ValueInfo : public llvm::CallbackVH
+		{
+			public:
+				ValueInfo(const llvm::Value* val, ValueInfoMap* infos);
+
+				virtual void deleted() override;
+
+			public:
+				std::string name;
+				/// Sum of stamps of config containers used in classification.
+				std::size_t stamp = 0;
+				/// Stamp of locals of @c function (allocas only).
+				std::size_t localsStamp = 0;
+
+				const retdec::config::Object* reg = nullptr;
+				const retdec::config::Object* global = nullptr;
+				const retdec::config::Object* local = nullptr;
+				/// Config function of a function or of an alloca's function.
+				retdec::config::Function* function = nullptr;
+
+				bool isFlagRegister = false;
+				bool isStackPointerRegister = false;
+				bool isGeneralPurposeRegister = false;
+				bool isFloatingPointRegister = false;
+
+				/// Stack offset -> stack variable (functions only).
+				std::map<int, llvm::AllocaInst*> stackVariables;
+				/// Stamp of locals @c stackVariables were indexed for.
+				std::size_t stackVariablesStamp = 0;
+
+			private:
+				ValueInfoMap* _infos = nullptr;
+		};
+
+		/**
+		 * Cache of value classifications. Copies start empty because their
+		 * entries would remove themselves from the original map.
+		 */
+		class ValueInfoCache
+		{
+			public:
+				ValueInfoCache() = default;
+				ValueInfoCache(const ValueInfoCache&) {}
+				ValueInfoCache& operator=(const ValueInfoCache&);
+
+			public:
+				ValueInfoMap infos;
+		};
+
+	private:
+		ValueInfo* getValueInfo(const llvm::Value* val);
+		bool isUpToDate(const ValueInfo& info, const llvm::Value* val);
+		void classify(const llvm::Value* val, ValueInfo& info);
+		void classifyRegister(const llvm::GlobalVariable* gv, ValueInfo& info);
+		void indexStackVariables(llvm::Function* fnc, ValueInfo& info);
 
 	private:
 		llvm::Module* _module = nullptr;
@@ -167,22 +245,24 @@ class Config
 		llvm::Function* _returnFunction = nullptr;
 		llvm::Function* _branchFunction = nullptr;
 		llvm::Function* _condBranchFunction = nullptr;
+		retdec::demangler::CDemangler* _demangler = nullptr;
+		ValueInfoCache _valueInfos;
 };
 
 class ConfigProvider
 {
 	public:
-		static Config* addConfigFile(llvm::Module* m, const std::string& path);
-		static Config* addConfigJsonString(
+		Config* addConfigFile(llvm::Module* m, const std::string& path);
+		Config* addConfigJsonString(
 				llvm::Module* m,
 				const std::string& json);
-		static Config* getConfig(llvm::Module* m);
-		static bool getConfig(llvm::Module* m, Config*& c);
-		static void doFinalization(llvm::Module* m);
-		static void clear();
+		Config* getConfig(llvm::Module* m);
+		bool getConfig(llvm::Module* m, Config*& c);
+		void doFinalization(llvm::Module* m);
+		void clear();
 
 	private:
-		static std::map<llvm::Module*, Config> _module2config;
+		std::map<llvm::Module*, Config> _module2config;
 };
 
 } // namespace bin2llvmir
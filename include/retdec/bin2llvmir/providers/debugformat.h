@@ -21,14 +21,12 @@ class DebugFormat : public debugformat::DebugFormat
 };
 
 /**
- * Completely static object -- all members and methods are static -> it can be
- * used by anywhere in bin2llvmirl. It provides mapping of modules to debug info
- * associated with them.
+ * Part of the @c ProviderContext of one decompilation. It provides mapping of
+ * modules to debug info associated with them.
  *
- * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
- * in LLVM passes' prologs to initialize pass-local demangler object. All
- * analyses, utils and other modules *MUST NOT* use it. If they need to work
- * with debug info, they should accept it in parameter.
+ * @attention Use it only in LLVM passes' prologs to initialize pass-local
+ * demangler object. All analyses, utils and other modules *MUST NOT* use it. If
+ * they need to work with debug info, they should accept it in parameter.
  */
 class DebugFormatProvider
 {
@@ -38,21 +36,21 @@ class DebugFormatProvider
 				const retdec::fileformat::Symbol*>;
 
 	public:
-		static DebugFormat* addDebugFormat(
+		DebugFormat* addDebugFormat(
 				llvm::Module* m,
 				retdec::loader::Image* objf,
 				const std::string& pdbFile,
 				const retdec::utils::Address& imageBase,
 				retdec::demangler::CDemangler* demangler);
 
-		static DebugFormat* getDebugFormat(llvm::Module* m);
-		static bool getDebugFormat(llvm::Module* m, DebugFormat*& df);
+		DebugFormat* getDebugFormat(llvm::Module* m);
+		bool getDebugFormat(llvm::Module* m, DebugFormat*& df);
 
-		static void clear();
+		void clear();
 
 	private:
 		/// Mapping of modules to debug info associated with them.
-		static std::map<llvm::Module*, DebugFormat> _module2debug;
+		std::map<llvm::Module*, DebugFormat> _module2debug;
 };
 
 } // namespace bin2llvmir
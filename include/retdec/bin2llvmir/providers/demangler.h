@@ -18,33 +18,31 @@ namespace retdec {
 namespace bin2llvmir {
 
 /**
- * Completely static object -- all members and methods are static -> it can be
- * used by anywhere in bin2llvmirl. It provides mapping of modules to demanglers
- * associated with them.
+ * Part of the @c ProviderContext of one decompilation. It provides mapping of
+ * modules to demanglers associated with them.
  *
- * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
- * in LLVM passes' prologs to initialize pass-local demangler object. All
- * analyses, utils and other modules *MUST NOT* use it. If they need to work
- * with demangler, they should accept it in parameter.
+ * @attention Use it only in LLVM passes' prologs to initialize pass-local
+ * demangler object. All analyses, utils and other modules *MUST NOT* use it. If
+ * they need to work with demangler, they should accept it in parameter.
  */
 class DemanglerProvider
 {
 	public:
-		static retdec::demangler::CDemangler* addDemangler(
+		retdec::demangler::CDemangler* addDemangler(
 				llvm::Module* m,
 				const retdec::config::ToolInfoContainer& t);
 
-		static retdec::demangler::CDemangler* getDemangler(llvm::Module* m);
-		static bool getDemangler(
+		retdec::demangler::CDemangler* getDemangler(llvm::Module* m);
+		bool getDemangler(
 				llvm::Module* m,
 				retdec::demangler::CDemangler*& d);
 
-		static void clear();
+		void clear();
 
 	private:
 		using Demangler = std::unique_ptr<retdec::demangler::CDemangler>;
 		/// Mapping of modules to demanglers associated with them.
-		static std::map<llvm::Module*, Demangler> _module2demangler;
+		std::map<llvm::Module*, Demangler> _module2demangler;
 };
 
 } // namespace bin2llvmir
@@ -78,49 +78,52 @@ class FileImage
 	public:
 		auto& getSegments() const { return _image->getSegments(); }
 
+	private:
+		const retdec::fileformat::Symbol* getPreferredSymbolAt(
+				retdec::utils::Address addr);
+
 	private:
 		llvm::Module* _module = nullptr;
+		Config* _config = nullptr;
 		std::unique_ptr<retdec::loader::Image> _image;
 };
 
 /**
- * Completely static object -- all members and methods are static -> it can be
- * used by anywhere in bin2llvmirl. It provides mapping of modules to file
- * images associated with them.
+ * Part of the @c ProviderContext of one decompilation. It provides mapping of
+ * modules to file images associated with them.
  *
- * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
- * in LLVM passes' prologs to initialize pass-local file image object. All
- * analyses, utils and other modules *MUST NOT* use it. If they need to work
- * with a file image, they should accept it in parameter.
+ * @attention Use it only in LLVM passes' prologs to initialize pass-local file
+ * image object. All analyses, utils and other modules *MUST NOT* use it. If
+ * they need to work with a file image, they should accept it in parameter.
  */
 class FileImageProvider
 {
 	public:
-		static FileImage* addFileImage(
+		FileImage* addFileImage(
 				llvm::Module* m,
 				const std::string& path,
 				Config* config);
-		static FileImage* addFileImage(
+		FileImage* addFileImage(
 				llvm::Module* m,
 				const std::shared_ptr<retdec::fileformat::FileFormat>& ff,
 				Config* config);
 
-		static FileImage* getFileImage(
+		FileImage* getFileImage(
 				llvm::Module* m);
-		static bool getFileImage(
+		bool getFileImage(
 				llvm::Module* m,
 				FileImage*& img);
 
-		static void clear();
+		void clear();
 
 	private:
-		static FileImage* addFileImage(
+		FileImage* addFileImage(
 				llvm::Module* m,
 				FileImage img);
 
 	private:
 		/// Mapping of modules to file images associated with them.
-		static std::map<llvm::Module*, FileImage> _module2image;
+		std::map<llvm::Module*, FileImage> _module2image;
 };
 
 } // namespace bin2llvmir
@@ -94,16 +94,16 @@ class Lti
 class LtiProvider
 {
 	public:
-		static Lti* addLti(
+		Lti* addLti(
 				llvm::Module* m,
 				Config* c,
 				retdec::loader::Image* objf);
-		static Lti* getLti(llvm::Module* m);
-		static bool getLti(llvm::Module* m, Lti*& lti);
-		static void clear();
+		Lti* getLti(llvm::Module* m);
+		bool getLti(llvm::Module* m, Lti*& lti);
+		void clear();
 
 	private:
-		static std::map<llvm::Module*, Lti> _module2lti;
+		std::map<llvm::Module*, Lti> _module2lti;
 };
 
 } // namespace bin2llvmir
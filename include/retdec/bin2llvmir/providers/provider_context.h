@@ -0,0 +1,122 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/provider_context.h
+ * @brief Providers and pass states of one decompilation.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+
+#include <map>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Pass.h>
+
+#include "retdec/bin2llvmir/providers/abi.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/syscall_sites.h"
+#include "retdec/bin2llvmir/utils/defs.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * All the providers of one decompilation and states which passes keep between
+ * their runs. It is owned by the caller that runs the passes and it is made
+ * available to them by adding @c ProviderContextPass to the pass manager.
+ *
+ * There is no state shared by contexts, so decompilations with different
+ * contexts (and LLVM contexts) can run concurrently in one process. A single
+ * context must not be used by more threads at once.
+ *
+ * @attention Use it only in LLVM passes' prologs (see get()). All analyses,
+ * utils and other modules *MUST NOT* use it. If they need to work with
+ * something it provides, they should accept it in parameter. The only
+ * exception are caches of providers, which get the context by getActive().
+ */
+class ProviderContext
+{
+	public:
+		/**
+		 * State of the @c Volatilize pass.
+		 */
+		struct VolatilizeState
+		{
+			/// Volatilize on the next run, unvolatilize otherwise.
+			bool doVolatilization = true;
+			/// Loads and stores that were volatile before volatilization.
+			UnorderedValSet alreadyVolatile;
+		};
+
+	public:
+		ProviderContext() = default;
+		ProviderContext(const ProviderContext&) = delete;
+		ProviderContext& operator=(const ProviderContext&) = delete;
+
+		static ProviderContext* get(const llvm::Pass& pass);
+		static ProviderContext* getActive();
+
+		void clear();
+
+	public:
+		AbiProvider abis;
+		ConfigProvider configs;
+		DebugFormatProvider debugFormats;
+		DemanglerProvider demanglers;
+		FileImageProvider fileImages;
+		LtiProvider ltis;
+		SyscallSitesProvider syscallSites;
+
+	// States which passes keep between their runs. Each run is done by a new
+	// pass object, so they can not be kept in the passes themselves.
+	//
+	public:
+		/// @c ProviderInitialization already initialized the providers.
+		bool providersInitialized = false;
+		/// @c SimpleTypesAnalysis already did its first (full) run.
+		bool simpleTypesRun = false;
+		/// Protector functions created by @c StackProtect mapped by types.
+		std::map<llvm::Type*, llvm::Function*> stackProtectors;
+		VolatilizeState volatilize;
+
+	// Caches of providers.
+	//
+	public:
+		/// LLVM to ASM mapping global variables found by @c AsmInstruction,
+		/// mapped by their modules.
+		std::map<const llvm::Module*, const llvm::GlobalVariable*> llvmToAsmGlobals;
+};
+
+/**
+ * Immutable pass which makes a @c ProviderContext available to all the other
+ * passes in its pass manager. The context is not owned by the pass. While the
+ * pass manager runs, the context is also active in the running thread (see
+ * @c ProviderContext::getActive()).
+ */
+class ProviderContextPass : public llvm::ImmutablePass
+{
+	public:
+		static char ID;
+		ProviderContextPass();
+		explicit ProviderContextPass(ProviderContext& context);
+
+		virtual bool doInitialization(llvm::Module& m) override;
+		virtual bool doFinalization(llvm::Module& m) override;
+
+		ProviderContext* getContext() const;
+
+	private:
+		ProviderContext* _context = nullptr;
+		/// Context which was active before this pass' manager started.
+		ProviderContext* _previous = nullptr;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/syscall_sites.h
+ * @brief Syscall sites provider for bin2llvmirl.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_SYSCALL_SITES_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_SYSCALL_SITES_H
+
+#include <map>
+
+#include <llvm/IR/Module.h>
+
+#include "retdec/utils/address.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Addresses of syscall instructions (e.g. @c int, @c svc, @c syscall) found
+ * in a module, together with their Capstone instruction IDs.
+ */
+class SyscallSites
+{
+	public:
+		/// Mapping of instruction addresses to Capstone instruction IDs.
+		using Sites = std::map<retdec::utils::Address, unsigned>;
+
+	public:
+		void addSite(retdec::utils::Address addr, unsigned insnId);
+		void removeSite(retdec::utils::Address addr);
+		const Sites& getSites() const;
+		std::size_t size() const;
+		bool empty() const;
+
+	private:
+		Sites _sites;
+};
+
+/**
+ * Part of the @c ProviderContext of one decompilation. It provides mapping of
+ * modules to syscall sites found in them.
+ *
+ * Sites are recorded by the decoder when instructions are translated. If there
+ * are no sites associated with a module, the module was not decoded in this
+ * run and users have to find syscall instructions on their own.
+ *
+ * @attention Use it only in LLVM passes' prologs to initialize pass-local
+ * syscall sites object. All analyses, utils and other modules *MUST NOT* use
+ * it. If they need to work with syscall sites, they should accept them in
+ * parameter.
+ */
+class SyscallSitesProvider
+{
+	public:
+		SyscallSites* addSyscallSites(llvm::Module* m);
+
+		SyscallSites* getSyscallSites(llvm::Module* m);
+		bool getSyscallSites(llvm::Module* m, SyscallSites*& sites);
+
+		void clear();
+
+	private:
+		/// Mapping of modules to syscall sites found in them.
+		std::map<llvm::Module*, SyscallSites> _module2sites;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -48,7 +48,8 @@ llvm::ReturnInst* modifyReturnInst(llvm::ReturnInst* ret, llvm::Value* val);
 llvm::CallInst* modifyCallInst(
 		llvm::CallInst* call,
 		llvm::Type* ret,
-		llvm::ArrayRef<llvm::Value*> args);
+		llvm::ArrayRef<llvm::Value*> args,
+		Config* config = nullptr);
 
 llvm::CallInst* modifyCallInst(
 		llvm::CallInst* call,
@@ -34,6 +34,12 @@ class Capstone2LlvmIrTranslatorArm : public Capstone2LlvmIrTranslator
 		virtual uint32_t getArchByteSize() override;
 		virtual uint32_t getArchBitSize() override;
 
+		virtual TranslationResult translate(
+				const std::vector<uint8_t>& bytes,
+				retdec::utils::Address a,
+				llvm::IRBuilder<>& irb,
+				bool stopOnBranch = false) override;
+
 	// Protected pure virtual methods that must be implemented in concrete
 	// classes.
 	//
@@ -100,6 +106,13 @@ class Capstone2LlvmIrTranslatorArm : public Capstone2LlvmIrTranslator
 		llvm::Value* generateInsnConditionCode(
 				llvm::IRBuilder<>& irb,
 				cs_arm* ai);
+		llvm::IRBuilder<> generateConditionalBody(
+				llvm::IRBuilder<>& irb,
+				cs_arm* ai,
+				bool reusable);
+		bool isConditionalBodyReusable(llvm::IRBuilder<>& irb, cs_arm* ai);
+		void checkConditionalBody(llvm::IRBuilder<>& body);
+		bool isSimpleConditionalMove(cs_insn* i, cs_arm* ai);
 		llvm::Value* genCarryAdd(
 				llvm::Value* add,
 				llvm::Value* op0,
@@ -185,6 +198,21 @@ class Capstone2LlvmIrTranslatorArm : public Capstone2LlvmIrTranslator
 		// methods like @c loadRegister() where it is hard to propagate it.
 		cs_insn* _insn = nullptr;
 
+		/// Number of instructions of the current Thumb IT block which were
+		/// not translated yet.
+		unsigned _itInsnsLeft = 0;
+
+		/// Guarded body generated for the last conditional instruction of an
+		/// IT block. Following instructions of the block with the same
+		/// condition are translated into it, so that the condition is
+		/// generated (and flags loaded) only once. @c nullptr if there is no
+		/// body which could be continued.
+		llvm::BasicBlock* _condBody = nullptr;
+		/// Block after @c _condBody.
+		llvm::BasicBlock* _condAfter = nullptr;
+		/// Condition of @c _condBody.
+		arm_cc _condBodyCc = ARM_CC_INVALID;
+
 	// Instruction translation methods.
 	//
 	protected:
@@ -203,6 +231,7 @@ class Capstone2LlvmIrTranslatorArm : public Capstone2LlvmIrTranslator
 		void translateMla(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
 		void translateMls(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
 		void translateMov(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
+		void translateCondMov(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
 		void translateMovt(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
 		void translateMovw(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
 		void translateMul(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb);
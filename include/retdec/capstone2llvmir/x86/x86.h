@@ -38,7 +38,15 @@ class Capstone2LlvmIrTranslatorX86 : public Capstone2LlvmIrTranslator
 		virtual uint32_t getArchByteSize() override;
 		virtual uint32_t getArchBitSize() override;
 
+		virtual TranslationResult translate(
+				const std::vector<uint8_t>& bytes,
+				retdec::utils::Address a,
+				llvm::IRBuilder<>& irb,
+				bool stopOnBranch = false) override;
+
 	public:
+		void setX87TopAtStart(unsigned top);
+
 		llvm::Function* getX87DataStoreFunction();
 		llvm::Function* getX87TagStoreFunction();
 		llvm::Function* getX87DataLoadFunction();
@@ -135,22 +143,24 @@ class Capstone2LlvmIrTranslatorX86 : public Capstone2LlvmIrTranslator
 		llvm::Value* loadX87TopIncStore(llvm::IRBuilder<>& irb);
 		llvm::Value* x87IncTop(llvm::IRBuilder<>& irb, llvm::Value* top = nullptr);
 		llvm::Value* x87DecTop(llvm::IRBuilder<>& irb, llvm::Value* top = nullptr);
+		llvm::StoreInst* storeX87Top(llvm::IRBuilder<>& irb, llvm::Value* val);
+		llvm::GlobalVariable* getX87Register(uint32_t first, llvm::Value* rNum);
 
-		llvm::CallInst* storeX87DataReg(
+		llvm::Instruction* storeX87DataReg(
 				llvm::IRBuilder<>& irb,
 				llvm::Value* rNum,
 				llvm::Value* val);
-		llvm::CallInst* storeX87TagReg(
+		llvm::Instruction* storeX87TagReg(
 				llvm::IRBuilder<>& irb,
 				llvm::Value* rNum,
 				llvm::Value* val);
-		llvm::CallInst* clearX87TagReg(
+		llvm::Instruction* clearX87TagReg(
 				llvm::IRBuilder<>& irb,
 				llvm::Value* rNum);
-		llvm::CallInst* loadX87DataReg(
+		llvm::Instruction* loadX87DataReg(
 				llvm::IRBuilder<>& irb,
 				llvm::Value* rNum);
-		llvm::CallInst* loadX87TagReg(
+		llvm::Instruction* loadX87TagReg(
 				llvm::IRBuilder<>& irb,
 				llvm::Value* rNum);
 
@@ -302,6 +312,14 @@ class Capstone2LlvmIrTranslatorX86 : public Capstone2LlvmIrTranslator
 		llvm::Function* _x87DataLoadFunction = nullptr; // fp80 (i3)
 		llvm::Function* _x87TagLoadFunction = nullptr; // i2 (i3)
 
+		/// x87 TOP value at the start of the next translation, if it is known
+		/// (see @c setX87TopAtStart()), -1 otherwise.
+		int _x87TopAtStart = -1;
+		/// x87 TOP value at the current translation point, if it is
+		/// statically known, -1 otherwise. If it is known, x87 data and tag
+		/// registers are accessed directly, not through the pseudo functions.
+		int _x87Top = -1;
+
 	// Instruction translation methods.
 	//
 	protected:
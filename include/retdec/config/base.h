@@ -8,6 +8,8 @@
 #define RETDEC_CONFIG_BASE_H
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <list>
 #include <map>
 #include <set>
@@ -278,6 +280,35 @@ class BaseSequentialContainer
 		std::list<Elem> _data;
 };
 
+//
+//=============================================================================
+// ContainerStamp
+//=============================================================================
+//
+
+/**
+ * Stamp of a container's content.
+ * A new stamp is taken whenever the content changes, including copying of
+ * the container. Stamps are unique among all containers and newer stamps are
+ * always greater than older ones. Therefore, a comparison of stamps is a cheap
+ * way to find out whether pointers to elements or other data derived from the
+ * container are still valid.
+ */
+class ContainerStamp
+{
+	public:
+		ContainerStamp()                         { renew(); }
+		ContainerStamp(const ContainerStamp&)    { renew(); }
+		ContainerStamp& operator=(const ContainerStamp&) { renew(); return *this; }
+
+		void renew()                             { _value = ++_lastValue; }
+		std::size_t getValue() const             { return _value; }
+
+	private:
+		std::size_t _value = 0;
+		static std::atomic<std::size_t> _lastValue;
+};
+
 //
 //=============================================================================
 // BaseAssociativeContainer
@@ -312,8 +343,16 @@ class BaseAssociativeContainer
 		const_iterator end() const   { return _data.end(); }
 		size_t size() const          { return _data.size(); }
 		bool empty() const           { return _data.empty(); }
-		void clear()                 { _data.clear(); }
-		size_t erase(const ID& k)    { return _data.erase(k); }
+		void clear()                 { _data.clear(); _stamp.renew(); }
+		size_t erase(const ID& k)    { _stamp.renew(); return _data.erase(k); }
+
+		/**
+		 * @return Stamp of the container's content. It changes whenever an
+		 * element is inserted or removed (see @c ContainerStamp). Changes of
+		 * elements made through iterators or returned pointers are not
+		 * reflected.
+		 */
+		std::size_t getStamp() const { return _stamp.getValue(); }
 
 		/**
 		 * This method behaves slightly different than std::map::insert().
@@ -330,6 +369,7 @@ class BaseAssociativeContainer
 		 */
 		virtual std::pair<iterator,bool> insert(const Elem& e)
 		{
+			_stamp.renew();
 			auto res = _data.emplace(e.getId(), e);
 			if (!res.second)
 			{
@@ -399,6 +439,9 @@ class BaseAssociativeContainer
 
 	protected:
 		std::map<ID, Elem> _data;
+
+	private:
+		ContainerStamp _stamp;
 };
 
 //
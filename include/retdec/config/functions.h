@@ -49,6 +49,7 @@ class Function : public retdec::utils::AddressRange
 		bool isFixed() const;
 		bool isFromDebug() const;
 		bool isWrapper() const;
+		bool isAlias() const;
 		bool isConstructor() const;
 		bool isDestructor() const;
 		bool isVirtual() const;
@@ -67,6 +68,7 @@ class Function : public retdec::utils::AddressRange
 		void setDeclarationString(const std::string& s);
 		void setSourceFileName(const std::string& n);
 		void setWrappedFunctionName(const std::string& n);
+		void setAliasedFunctionName(const std::string& n);
 		void setStartLine(const retdec::utils::Address& l);
 		void setEndLine(const retdec::utils::Address& l);
 		void setIsUserDefined();
@@ -94,6 +96,7 @@ class Function : public retdec::utils::AddressRange
 		std::string getDeclarationString() const;
 		std::string getSourceFileName() const;
 		std::string getWrappedFunctionName() const;
+		std::string getAliasedFunctionName() const;
 		LineNumber getStartLine() const;
 		LineNumber getEndLine() const;
 		/// @}
@@ -129,6 +132,7 @@ class Function : public retdec::utils::AddressRange
 		std::string _declarationString;
 		std::string _sourceFileName;
 		std::string _wrapperdFunctionName;
+		std::string _aliasedFunctionName;
 		eLinkType _linkType = USER_DEFINED;
 		LineNumber _startLine;
 		LineNumber _endLine;
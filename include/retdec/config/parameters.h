@@ -27,6 +27,7 @@ class Parameters
 		bool isVerboseOutput() const;
 		bool isKeepAllFunctions() const;
 		bool isSelectedDecodeOnly() const;
+		bool isFoldIdenticalFunctions() const;
 		bool isFrontendFunction(const std::string& funcName) const;
 		/// @}
 
@@ -35,6 +36,7 @@ class Parameters
 		void setIsVerboseOutput(bool b);
 		void setIsKeepAllFunctions(bool b);
 		void setIsSelectedDecodeOnly(bool b);
+		void setIsFoldIdenticalFunctions(bool b);
 		void setOutputFile(const std::string& n);
 		void setFrontendOutputFile(const std::string& n);
 		void setOrdinalNumbersDirectory(const std::string& n);
@@ -87,6 +89,10 @@ class Parameters
 		/// results.
 		bool _selectedDecodeOnly = false;
 
+		/// Fold identical functions found by the decoder into one canonical
+		/// function. Otherwise, each of them is decompiled separately.
+		bool _foldIdenticalFunctions = true;
+
 		std::string _outputFile;
 		std::string _frontendOutputFile;
 		std::string _ordinalNumbersDirectory;
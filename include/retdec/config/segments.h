@@ -17,7 +17,9 @@ namespace config {
 
 /**
  * Represents binary file's segment.
- * Segment is an address range plus name and comment.
+ * Segment is an address range plus name and comment. It may also carry
+ * entropy and chi-square score of its bytes, which tell whether it is likely
+ * compressed or encrypted.
  */
 class Segment : public retdec::utils::AddressRange
 {
@@ -31,17 +33,26 @@ class Segment : public retdec::utils::AddressRange
 		/// @{
 		void setName(const std::string& n);
 		void setComment(const std::string& c);
+		void setEntropy(double e);
+		void setChiSquare(double c);
 		/// @}
 
 		/// @name Segment get methods.
 		/// @{
 		std::string getName() const;
 		std::string getComment() const;
+		bool hasByteStatistics() const;
+		double getEntropy() const;
+		double getChiSquare() const;
 		/// @}
 
 	private:
 		std::string _name;
 		std::string _comment;
+		/// Entropy and chi-square score are valid only if this is set.
+		bool _hasByteStatistics = false;
+		double _entropy = 0.0;
+		double _chiSquare = 0.0;
 };
 
 /**
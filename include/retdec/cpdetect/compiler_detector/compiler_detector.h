@@ -7,6 +7,8 @@
 #ifndef RETDEC_CPDETECT_COMPILER_DETECTOR_COMPILER_DETECTOR_H
 #define RETDEC_CPDETECT_COMPILER_DETECTOR_COMPILER_DETECTOR_H
 
+#include <map>
+
 #include "retdec/utils/filesystem_path.h"
 #include "retdec/utils/non_copyable.h"
 #include "yaracpp/yara_detector/yara_detector.h"
@@ -22,9 +24,25 @@ namespace cpdetect {
 class CompilerDetector : private retdec::utils::NonCopyable
 {
 	private:
+		/**
+		 * Signature of rule prepared for similarity search
+		 */
+		struct RuleSignature
+		{
+			RuleSignature(const std::string &signPattern) : pattern(signPattern) {}
+
+			Search::SimilarityPattern pattern; ///< packed pattern without trailing semicolons
+			bool hasAbsoluteStart = false;     ///< @c true if rule has valid absolute start
+			bool validStart = true;            ///< @c false if absolute start cannot be parsed
+			std::size_t absoluteStart = 0;     ///< absolute start of searched area
+			std::size_t startShift = 0;        ///< shift of start of searched area
+			std::size_t endShift = 0;          ///< shift of end of searched area
+		};
+
 		retdec::fileformat::FileFormat &fileParser; ///< parser of input file
 		DetectParams &cpParams;                     ///< parameters for detection
 		std::vector<std::string> externalDatabase;  ///< name of external files with rules
+		std::map<const yaracpp::YaraRule*, RuleSignature> ruleSignatures; ///< signatures of loaded rules
 
 		/// @name External databases parsing
 		/// @{
@@ -33,8 +51,10 @@ class CompilerDetector : private retdec::utils::NonCopyable
 
 		/// @name Other methods
 		/// @{
+		void loadRuleSignatures(const std::vector<yaracpp::YaraRule> &rules);
 		void removeCompilersWithLessSimilarity(double ratio);
 		void removeUnusedCompilers();
+		void removeNonPackers();
 		/// @}
 
 		/// @name Detection methods
@@ -42,6 +62,7 @@ class CompilerDetector : private retdec::utils::NonCopyable
 		void getAllHeuristics();
 		ReturnCode getAllSignatures();
 		ReturnCode getAllCompilers();
+		ReturnCode getAllPackers();
 		/// @}
 
 	protected:
@@ -33,6 +33,7 @@ class ElfHeuristics : public Heuristics
 		/// @name Virtual methods
 		/// @{
 		virtual void getFormatSpecificCompilerHeuristics() override;
+		virtual void getFormatSpecificPackerHeuristics() override;
 		/// @}
 
 	public:
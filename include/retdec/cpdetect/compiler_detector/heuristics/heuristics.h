@@ -87,6 +87,7 @@ class Heuristics
 		/// @{
 		virtual void getFormatSpecificCompilerHeuristics();
 		virtual void getFormatSpecificLanguageHeuristics();
+		virtual void getFormatSpecificPackerHeuristics();
 		/// @}
 
 		/// @name Add heuristic detection methods
@@ -140,6 +141,7 @@ class Heuristics
 		/// @name Heuristics methods
 		/// @{
 		void getAllHeuristics();
+		void getPackerHeuristics();
 		/// @}
 };
 
@@ -31,6 +31,7 @@ class MachOHeuristics : public Heuristics
 		/// @name Virtual methods
 		/// @{
 		virtual void getFormatSpecificCompilerHeuristics() override;
+		virtual void getFormatSpecificPackerHeuristics() override;
 		/// @}
 
 	public:
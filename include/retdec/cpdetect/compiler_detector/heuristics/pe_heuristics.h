@@ -69,6 +69,7 @@ class PeHeuristics : public Heuristics
 		void getMewSectionHeuristics();
 		void getNsPackSectionHeuristics();
 		void getPeSectionHeuristics();
+		void getToolHeuristics(bool packersOnly);
 		/// @}
 
 	protected:
@@ -76,6 +77,7 @@ class PeHeuristics : public Heuristics
 		/// @{
 		virtual void getFormatSpecificCompilerHeuristics() override;
 		virtual void getFormatSpecificLanguageHeuristics() override;
+		virtual void getFormatSpecificPackerHeuristics() override;
 		/// @}
 
 	public:
@@ -38,6 +38,35 @@ class Search
 				std::size_t getBytesAfter() const;
 				/// @}
 		};
+
+		/**
+		 * Signature pattern prepared for repeated similarity counting.
+		 * Nibbles of pattern without slashes are packed by eight into
+		 * 64-bit words, so that they can be compared with content of file
+		 * by XOR and population count instead of one by one.
+		 */
+		class SimilarityPattern
+		{
+			private:
+				std::string pattern;                ///< original signature pattern
+				std::vector<std::uint64_t> values;  ///< packed nibbles of pattern
+				std::vector<std::uint64_t> cares;   ///< packed masks of significant nibbles
+				std::vector<std::size_t> caresFrom; ///< significant nibbles from each word to the end
+				bool packed;                        ///< @c true if pattern could be packed
+			public:
+				SimilarityPattern(const std::string &signPattern);
+				~SimilarityPattern();
+
+				/// @name Pattern getters
+				/// @{
+				const std::string& getPattern() const;
+				bool isPacked() const;
+				std::size_t getNumberOfWords() const;
+				std::uint64_t getValues(std::size_t index) const;
+				std::uint64_t getCares(std::size_t index) const;
+				std::size_t getCaresFrom(std::size_t index) const;
+				/// @}
+		};
 	private:
 		retdec::fileformat::FileFormat &parser; ///< parser of input file
 		std::string nibbles;             ///< content of file in hexadecimal string representation
@@ -50,6 +79,7 @@ class Search
 		/// @name Auxiliary methods
 		/// @{
 		bool haveSlashes() const;
+		bool countPackedSimilarity(const SimilarityPattern &signPattern, std::size_t fileIndex, unsigned long long minSame, unsigned long long &same) const;
 		std::size_t nibblesFromBytes(std::size_t nBytes) const;
 		std::size_t bytesFromNibbles(std::size_t nNibbles) const;
 		/// @}
@@ -82,6 +112,7 @@ class Search
 		unsigned long long exactComparison(const std::string &signPattern, std::size_t fileOffset, std::size_t shift = 0) const;
 		bool countSimilarity(const std::string &signPattern, Similarity &sim, std::size_t fileOffset, std::size_t shift = 0) const;
 		bool areaSimilarity(const std::string &signPattern, Similarity &sim, std::size_t startOffset, std::size_t stopOffset) const;
+		bool areaSimilarity(const SimilarityPattern &signPattern, Similarity &sim, std::size_t startOffset, std::size_t stopOffset, double minRatio = 0.0) const;
 		/// @}
 
 		/// @name Search methods based on plain-string comparison
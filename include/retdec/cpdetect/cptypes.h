@@ -113,6 +113,8 @@ struct DetectParams
 
 	std::size_t epBytesCount;
 
+	bool packersOnly;  ///< detect only packers (skip compilers, linkers, ...)
+
 	DetectParams(SearchType searchType_, bool internal_, bool external_, std::size_t epBytesCount_ = EP_BYTES_SIZE);
 	~DetectParams();
 };
@@ -29,6 +29,12 @@ const std::set<std::string> EXTERNAL_DATABASE_SUFFIXES =
 
 const std::string YARA_RULES_PATH = "../share/retdec/support/generic/yara_patterns/tools/";
 
+/*
+ * Subdirectory with compiled rule databases which contain only packer rules
+ * (e.g. pe/packers/x86.yarac next to pe/x86.yarac)
+ */
+const std::string YARA_PACKERS_DIR = "packers";
+
 } // namespace cpdetect
 } // namespace retdec
 
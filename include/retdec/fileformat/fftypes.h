@@ -7,6 +7,7 @@
 #ifndef RETDEC_FILEFORMAT_FFTYPES_H
 #define RETDEC_FILEFORMAT_FFTYPES_H
 
+#include "retdec/fileformat/types/byte_statistics/byte_statistics.h"
 #include "retdec/fileformat/types/certificate_table/certificate_table.h"
 #include "retdec/fileformat/types/dotnet_headers/clr_header.h"
 #include "retdec/fileformat/types/dotnet_headers/metadata_header.h"
@@ -27,6 +28,7 @@
 #include "retdec/fileformat/types/sec_seg/macho_section.h"
 #include "retdec/fileformat/types/sec_seg/pe_coff_section.h"
 #include "retdec/fileformat/types/sec_seg/segment.h"
+#include "retdec/fileformat/types/similarity_hash/similarity_hash.h"
 #include "retdec/fileformat/types/strings/string.h"
 #include "retdec/fileformat/types/symbol_table/macho_symbol.h"
 #include "retdec/fileformat/types/symbol_table/symbol_table.h"
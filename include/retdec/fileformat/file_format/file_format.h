@@ -60,6 +60,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::string crc32;                                                ///< CRC32 of file content
 		std::string md5;                                                  ///< MD5 of file content
 		std::string sha256;                                               ///< SHA256 of file content
+		ByteStatistics byteStatistics;                                    ///< statistics of byte values of file content
+		std::string similarityHash;                                       ///< locality-sensitive hash of file content
 		std::string sectionCrc32;                                         ///< CRC32 of section table
 		std::string sectionMd5;                                           ///< MD5 of section table
 		std::string sectionSha256;                                        ///< SHA256 of section table
@@ -175,6 +177,9 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::string getCrc32() const;
 		std::string getMd5() const;
 		std::string getSha256() const;
+		const ByteStatistics& getByteStatistics() const;
+		ByteStatistics getOverlayByteStatistics() const;
+		std::string getSimilarityHash() const;
 		std::string getSectionTableCrc32() const;
 		std::string getSectionTableMd5() const;
 		std::string getSectionTableSha256() const;
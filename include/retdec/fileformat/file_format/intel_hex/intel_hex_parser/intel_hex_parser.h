@@ -7,8 +7,10 @@
 #ifndef RETDEC_FILEFORMAT_FILE_FORMAT_INTEL_HEX_INTEL_HEX_PARSER_INTEL_HEX_PARSER_H
 #define RETDEC_FILEFORMAT_FILE_FORMAT_INTEL_HEX_INTEL_HEX_PARSER_INTEL_HEX_PARSER_H
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #include "retdec/utils/address.h"
@@ -42,7 +44,11 @@ class IntelHexSection
 class IntelHexParser
 {
 	private:
-		IntelHexTokenizer tokenizer;           ///< Tokenizer
+		std::ifstream fstr;                    ///< Input file stream (used by parseFile() only)
+		std::istream *source = nullptr;        ///< Input stream
+		std::vector<char> buffer;              ///< Block of characters read from input stream
+		std::size_t bufferPos = 0;             ///< Position of next character in buffer
+		std::size_t bufferEnd = 0;             ///< Number of valid characters in buffer
 		bool mode;                             ///< @c true when 32bit address mode, @c false when 20bit segment mode
 		bool hasEP;                            ///< @c true if entry point record is in file
 		std::uint16_t upperAddress;            ///< Upper 16bits of 32bit address
@@ -60,11 +66,14 @@ class IntelHexParser
 		/// @name Private parsing methods
 		/// @{
 		bool parse();
-		void handleData(const IntelHexToken &token);
-		void setOffset(const IntelHexToken &token);
-		void setSegment(const IntelHexToken &token);
-		void setEIP(const IntelHexToken &token);
-		void setCSIP(const IntelHexToken &token);
+		bool setInputStream(std::istream &inputStream);
+		bool fillBuffer();
+		int getChar();
+		bool readByte(std::uint8_t &byte);
+		bool skipNewlines();
+		bool parseRecord(bool &endOfFile);
+		bool failure(const std::string &description);
+		std::vector<unsigned char>::pointer startData(std::uint16_t offset, std::uint8_t byteCount);
 		/// @}
 	public:
 		IntelHexParser();
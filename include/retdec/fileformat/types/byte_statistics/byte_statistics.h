@@ -0,0 +1,70 @@
+/**
+ * @file include/retdec/fileformat/types/byte_statistics/byte_statistics.h
+ * @brief Class for statistics of byte values.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_FILEFORMAT_TYPES_BYTE_STATISTICS_BYTE_STATISTICS_H
+#define RETDEC_FILEFORMAT_TYPES_BYTE_STATISTICS_BYTE_STATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace retdec {
+namespace fileformat {
+
+/**
+ * Histogram of byte values together with Shannon entropy and chi-square
+ * score computed from it
+ *
+ * Entropy is in bits per byte (from 0 to 8), chi-square score is computed
+ * against uniform distribution of byte values. Together they give a cheap
+ * guess whether data are compressed or encrypted.
+ */
+class ByteStatistics
+{
+	public:
+		using Histogram = std::array<std::uint64_t, 256>;
+
+		/**
+		 * Likely content of data
+		 */
+		enum class Content
+		{
+			UNKNOWN,    ///< too little data to decide
+			PLAIN,      ///< code, uncompressed data, text, ...
+			COMPRESSED, ///< high entropy but byte values are not uniformly distributed
+			ENCRYPTED   ///< high entropy and uniformly distributed byte values
+		};
+	private:
+		Histogram histogram;                ///< number of occurrences of each byte value
+		std::uint64_t size;                 ///< number of counted bytes
+	public:
+		ByteStatistics();
+		~ByteStatistics();
+
+		/// @name Getters
+		/// @{
+		const Histogram& getHistogram() const;
+		std::uint64_t getSize() const;
+		double getEntropy() const;
+		double getChiSquare() const;
+		Content getLikelyContent() const;
+		/// @}
+
+		/// @name Other methods
+		/// @{
+		void update(const unsigned char *data, std::uint64_t dataSize);
+		void clear();
+		bool isEmpty() const;
+		bool isLikelyPacked() const;
+		/// @}
+};
+
+std::string contentToString(ByteStatistics::Content content);
+
+} // namespace fileformat
+} // namespace retdec
+
+#endif
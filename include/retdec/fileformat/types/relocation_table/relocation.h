@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_RELOCATION_TABLE_RELOCATION_H
 #define RETDEC_FILEFORMAT_TYPES_RELOCATION_TABLE_RELOCATION_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -15,11 +17,17 @@ namespace fileformat {
 
 /**
  * One relocation
+ *
+ * Names and masks of relocations repeat a lot, so relocation stores them
+ * as shared instances. Relocations added to one @c RelocationTable share
+ * one instance of each distinct name and mask.
  */
 class Relocation
 {
+	friend class RelocationTable;
+
 	private:
-		std::string name;                   ///< relocation name
+		std::shared_ptr<const std::string> name; ///< shared relocation name
 		unsigned long long address;         ///< address at which to apply the relocation
 		unsigned long long offsetInSection; ///< offset of relocation in section at which to apply the relocation
 		unsigned long long linkToSection;   ///< link to section at which relocation is applied
@@ -28,26 +36,26 @@ class Relocation
 		unsigned long long type;            ///< type of relocation
 		bool linkToSectionIsValid;          ///< @c true if link to section is valid
 		bool linkToSymbolIsValid;           ///< @c true if link to symbol is valid
-		std::vector<std::uint8_t> mask;     ///< relocation mask
+		std::shared_ptr<const std::vector<std::uint8_t>> mask; ///< shared relocation mask
 	public:
 		Relocation();
 		~Relocation();
 
 		/// @name Getters
 		/// @{
-		std::string getName() const;
+		const std::string& getName() const;
 		unsigned long long getAddress() const;
 		unsigned long long  getSectionOffset() const;
 		bool getLinkToSection(unsigned long long &sectionIndex) const;
 		bool getLinkToSymbol(unsigned long long &symbolIndex) const;
 		unsigned long long getAddend() const;
 		unsigned long long getType() const;
-		std::vector<std::uint8_t> getMask() const;
+		const std::vector<std::uint8_t>& getMask() const;
 		/// @}
 
 		/// @name Setters
 		/// @{
-		void setName(std::string relocationName);
+		void setName(const std::string &relocationName);
 		void setAddress(unsigned long long relocationAddress);
 		void setSectionOffset(unsigned long long relocationOffsetInSection);
 		void setLinkToSection(unsigned long long relocationLinkToSection);
@@ -7,6 +7,8 @@
 #ifndef RETDEC_FILEFORMAT_TYPES_RELOCATION_TABLE_RELOCATION_TABLE_H
 #define RETDEC_FILEFORMAT_TYPES_RELOCATION_TABLE_RELOCATION_TABLE_H
 
+#include <memory>
+#include <set>
 #include <vector>
 
 #include "retdec/fileformat/types/relocation_table/relocation.h"
@@ -16,13 +18,33 @@ namespace fileformat {
 
 /**
  * Class for relocation table
+ *
+ * Table keeps one instance of each distinct relocation name and mask and
+ * relocations added to it share these instances.
  */
 class RelocationTable
 {
 	private:
+		/**
+		 * Orders shared values by their content
+		 */
+		struct ContentLess
+		{
+			template<typename T>
+			bool operator()(const std::shared_ptr<const T> &a, const std::shared_ptr<const T> &b) const
+			{
+				return *a < *b;
+			}
+		};
+
 		using relocationsIterator = std::vector<Relocation>::const_iterator;
 		std::vector<Relocation> table; ///< stored relocations
 		unsigned long long linkToSymbolTable; ///< link to associated symbol table
+		std::set<std::shared_ptr<const std::string>, ContentLess> names; ///< distinct relocation names
+		std::set<std::shared_ptr<const std::vector<std::uint8_t>>, ContentLess> masks; ///< distinct relocation masks
+
+		template<typename T, typename Pool>
+		void intern(std::shared_ptr<const T> &value, Pool &pool);
 	public:
 		RelocationTable();
 		~RelocationTable();
@@ -12,6 +12,8 @@
 
 #include <llvm/ADT/StringRef.h>
 
+#include "retdec/fileformat/types/byte_statistics/byte_statistics.h"
+
 namespace retdec {
 namespace fileformat {
 
@@ -38,6 +40,8 @@ class SecSeg
 		std::string crc32;                ///< CRC32 of section or segment data
 		std::string md5;                  ///< MD5 of section or segment data
 		std::string sha256;               ///< SHA256 of section or segment data
+		ByteStatistics byteStatistics;    ///< statistics of byte values of section or segment data
+		std::string similarityHash;       ///< locality-sensitive hash of code section or segment data
 		std::string name;                 ///< name of section or segment
 		llvm::StringRef bytes;            ///< reference to content of section or segment
 		Type type;                        ///< type
@@ -83,6 +87,8 @@ class SecSeg
 		std::string getCrc32() const;
 		std::string getMd5() const;
 		std::string getSha256() const;
+		const ByteStatistics& getByteStatistics() const;
+		std::string getSimilarityHash() const;
 		std::string getName() const;
 		const char* getNameAsCStr() const;
 		const llvm::StringRef getBytes(unsigned long long sOffset = 0, unsigned long long sSize = 0) const;
@@ -0,0 +1,61 @@
+/**
+ * @file include/retdec/fileformat/types/similarity_hash/similarity_hash.h
+ * @brief Class for locality-sensitive hash of data.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_FILEFORMAT_TYPES_SIMILARITY_HASH_SIMILARITY_HASH_H
+#define RETDEC_FILEFORMAT_TYPES_SIMILARITY_HASH_SIMILARITY_HASH_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace retdec {
+namespace fileformat {
+
+/**
+ * Locality-sensitive hash of data in the style of TLSH
+ *
+ * Trigrams from a sliding window of five bytes are counted in 128 buckets.
+ * Digest stores quartile of each bucket together with checksum, logarithm of
+ * data length and ratios of quartiles. Similar data have digests with small
+ * distance (see similarityHashDistance()), so recompiled or repacked variants
+ * of a sample can be found without comparing the samples themselves.
+ *
+ * Digests are not interchangeable with digests of the TLSH library.
+ */
+class SimilarityHash
+{
+	public:
+		static const std::size_t BUCKETS = 128;          ///< number of buckets stored in digest
+		static const std::size_t MIN_DATA_SIZE = 50;     ///< minimal number of bytes for which digest is computed
+		static const std::size_t DIGEST_LENGTH = 70;     ///< number of characters of digest
+	private:
+		std::array<std::uint32_t, 256> buckets;   ///< counts of trigrams
+		std::array<std::uint8_t, 4> window;       ///< last four bytes, the most recent one first
+		std::uint8_t checksum;                    ///< checksum of all bytes
+		std::uint64_t size;                       ///< number of processed bytes
+	public:
+		SimilarityHash();
+		~SimilarityHash();
+
+		/// @name Getters
+		/// @{
+		std::uint64_t getSize() const;
+		std::string getDigest() const;
+		/// @}
+
+		/// @name Other methods
+		/// @{
+		void update(const unsigned char *data, std::uint64_t dataSize);
+		void clear();
+		/// @}
+};
+
+bool similarityHashDistance(const std::string &digest1, const std::string &digest2, std::size_t &distance);
+
+} // namespace fileformat
+} // namespace retdec
+
+#endif
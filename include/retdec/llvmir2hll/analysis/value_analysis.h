@@ -7,8 +7,13 @@
 #ifndef RETDEC_LLVMIR2HLL_ANALYSIS_VALUE_ANALYSIS_H
 #define RETDEC_LLVMIR2HLL_ANALYSIS_VALUE_ANALYSIS_H
 
+#include <array>
 #include <cstddef>
-#include <map>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "retdec/llvmir2hll/support/caching.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -23,19 +28,91 @@ namespace llvmir2hll {
 class AliasAnalysis;
 class Value;
 
+/**
+* @brief Dense numbering of variables.
+*
+* Variables are given consecutive numbers in the order in which they are first
+* seen. This allows ValueData to store sets of variables as small sorted
+* vectors of numbers instead of sets of shared pointers.
+*
+* Instances of this class have reference object semantics (they are shared by
+* all the ValueData computed from the same state of ValueAnalysis).
+*/
+class VarNumbering: private retdec::utils::NonCopyable {
+public:
+	/// Number of a variable.
+	using Id = std::uint32_t;
+
+public:
+	VarNumbering();
+
+	Id getId(ShPtr<Variable> var);
+	bool findId(ShPtr<Variable> var, Id &id) const;
+	const ShPtr<Variable> &getVar(Id id) const;
+
+private:
+	/// Numbered variables, indexed by their numbers.
+	VarVector vars;
+
+	/// Mapping of variables into their numbers.
+	std::unordered_map<const Variable *, Id> ids;
+};
+
 /**
 * @brief Information about a value.
 *
 * Instance of this class can be created only by using ValueAnalysis.
 *
+* Sets of variables are not exposed as @c VarSet. They are stored as sorted
+* vectors of numbers of variables (see VarNumbering), which are accessed by
+* iterator ranges (e.g. dir_read_begin() and dir_read_end()) and membership
+* queries (e.g. isDirRead()).
+*
 * Instances of this class have value object semantics.
 */
 class ValueData {
 	friend class ValueAnalysis;
 
+private:
+	/// Sorted vector of numbers of variables (see VarNumbering).
+	using VarIdVector = std::vector<VarNumbering::Id>;
+
 public:
-	/// Variables iterator.
-	using var_iterator = VarSet::const_iterator;
+	/**
+	* @brief Variables iterator.
+	*
+	* Iterates over numbers of variables and resolves them into variables
+	* upon dereference.
+	*/
+	class var_iterator {
+	public:
+		using value_type = ShPtr<Variable>;
+		using reference = const ShPtr<Variable> &;
+		using pointer = const ShPtr<Variable> *;
+		using difference_type = std::ptrdiff_t;
+		using iterator_category = std::forward_iterator_tag;
+
+	public:
+		var_iterator(const VarNumbering *numbering,
+			VarIdVector::const_iterator current):
+				numbering(numbering), current(current) {}
+
+		reference operator*() const { return numbering->getVar(*current); }
+		pointer operator->() const { return &**this; }
+		var_iterator &operator++() { ++current; return *this; }
+		var_iterator operator++(int) { auto old = *this; ++current; return old; }
+
+		bool operator==(const var_iterator &other) const {
+			return current == other.current;
+		}
+		bool operator!=(const var_iterator &other) const {
+			return !(*this == other);
+		}
+
+	private:
+		const VarNumbering *numbering;
+		VarIdVector::const_iterator current;
+	};
 
 	/// Calls iterator.
 	using call_iterator = CallVector::const_iterator;
@@ -50,9 +127,6 @@ public:
 
 	/// @name Directly Used Variables Accessors
 	/// @{
-	const VarSet &getDirReadVars() const;
-	const VarSet &getDirWrittenVars() const;
-	const VarSet &getDirAccessedVars() const;
 	std::size_t getNumOfDirReadVars() const;
 	std::size_t getNumOfDirWrittenVars() const;
 	std::size_t getNumOfDirAccessedVars() const;
@@ -74,9 +148,6 @@ public:
 	/// @name Indirectly Used Variables Accessors
 	/// @{
 	// may
-	const VarSet &getMayBeReadVars() const;
-	const VarSet &getMayBeWrittenVars() const;
-	const VarSet &getMayBeAccessedVars() const;
 	bool mayBeIndirRead(ShPtr<Variable> var) const;
 	bool mayBeIndirWritten(ShPtr<Variable> var) const;
 	bool mayBeIndirAccessed(ShPtr<Variable> var) const;
@@ -91,9 +162,6 @@ public:
 	var_iterator may_be_accessed_end() const;
 
 	// must
-	const VarSet &getMustBeReadVars() const;
-	const VarSet &getMustBeWrittenVars() const;
-	const VarSet &getMustBeAccessedVars() const;
 	bool mustBeIndirRead(ShPtr<Variable> var) const;
 	bool mustBeIndirWritten(ShPtr<Variable> var) const;
 	bool mustBeIndirAccessed(ShPtr<Variable> var) const;
@@ -140,51 +208,49 @@ public:
 	/// @}
 
 private:
-	/// Mapping of a variable into a count.
-	using VarCountMap = std::map<ShPtr<Variable>, std::size_t>;
+	/// Kinds of variable sets stored in ValueData.
+	enum VarSetKind {
+		DirRead,
+		DirWritten,
+		DirAll,
+		MayBeRead,
+		MayBeWritten,
+		MayBeAccessed,
+		MustBeRead,
+		MustBeWritten,
+		MustBeAccessed,
+		AddressTaken,
+		NumOfVarSetKinds
+	};
+
+	/// Mapping of a number of a variable into a count (sorted by numbers).
+	using VarIdCountVector = std::vector<std::pair<VarNumbering::Id, std::size_t>>;
 
 private:
-	ValueData();
+	explicit ValueData(ShPtr<VarNumbering> numbering);
 
 	void clear();
+	void addVar(VarSetKind kind, ShPtr<Variable> var);
+	void addVars(VarSetKind kind, const VarSet &vars);
+	void addDirUse(ShPtr<Variable> var);
+	void computeDirAllVars();
+	bool contains(VarSetKind kind, ShPtr<Variable> var) const;
+	var_iterator varsBegin(VarSetKind kind) const;
+	var_iterator varsEnd(VarSetKind kind) const;
 
 private:
-	/// Set of variables that are directly read.
-	VarSet dirReadVars;
-
-	/// Set of variables into which something is directly written.
-	VarSet dirWrittenVars;
+	/// Numbering of variables in which the sets below are expressed.
+	ShPtr<VarNumbering> numbering;
 
-	/// Set of all directly accessed variables (read or written).
-	VarSet dirAllVars;
+	/// Sets of variables, indexed by VarSetKind.
+	std::array<VarIdVector, NumOfVarSetKinds> varIds;
 
 	/// Number of uses of a variable in direct accesses.
-	VarCountMap dirNumOfVarUses;
-
-	/// Set of variables that may be read.
-	VarSet mayBeReadVars;
-
-	/// Set of variables into which something may be written.
-	VarSet mayBeWrittenVars;
-
-	/// Set of variables which may be accessed.
-	VarSet mayBeAccessedVars;
-
-	/// Set of variables that must be read.
-	VarSet mustBeReadVars;
-
-	/// Set of variables into which something must be written.
-	VarSet mustBeWrittenVars;
-
-	/// Set of variables which must be accessed.
-	VarSet mustBeAccessedVars;
+	VarIdCountVector dirNumOfVarUses;
 
 	/// List of function calls;
 	CallVector calls;
 
-	/// Set of variables whose address is taken.
-	VarSet addressTakenVars;
-
 	/// Are there any dereferences?
 	bool containsDerefs;
 
@@ -195,6 +261,7 @@ private:
 	bool containsStructAccesses;
 };
 
+
 /**
 * @brief An analysis for obtaining information about a value.
 *
@@ -313,6 +380,9 @@ private:
 	/// The used alias analysis.
 	ShPtr<AliasAnalysis> aliasAnalysis;
 
+	/// Numbering of variables used in the computed values.
+	ShPtr<VarNumbering> varNumbering;
+
 	/// Information about the currently computed value.
 	ShPtr<ValueData> valueData;
 
@@ -7,9 +7,12 @@
 #ifndef RETDEC_LLVMIR2HLL_EVALUATOR_ARITHM_EXPR_EVALUATOR_H
 #define RETDEC_LLVMIR2HLL_EVALUATOR_ARITHM_EXPR_EVALUATOR_H
 
-#include <stack>
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "retdec/llvmir2hll/evaluator/evaluated_value.h"
 #include "retdec/llvmir2hll/ir/cast_expr.h"
 #include "retdec/llvmir2hll/ir/const_bool.h"
 #include "retdec/llvmir2hll/ir/const_float.h"
@@ -23,6 +26,9 @@
 namespace retdec {
 namespace llvmir2hll {
 
+class BinaryOpExpr;
+class UnaryOpExpr;
+
 /**
 * @brief A base class for all evaluators.
 *
@@ -32,6 +38,15 @@ namespace llvmir2hll {
 *  - define a static <tt>ShPtr<ArithmExprEvaluator> create()</tt> function
 *  - register itself at ArithmExprEvaluatorFactory by passing the static @c
 *    create function and the concrete evaluator's ID
+*
+* Intermediate results are kept as EvaluatedValue instances on a reused stack,
+* so no constants are created during the evaluation. A constant is created only
+* for the final result.
+*
+* Results of evaluated expressions are memoized. A memoized result is used only
+* if the expression has not been modified since and its variables are
+* substituted by the same values, so callers do not need to invalidate
+* anything.
 */
 class ArithmExprEvaluator: private OrderedAllVisitor,
 		private retdec::utils::NonCopyable {
@@ -42,20 +57,8 @@ public:
 	/// Pair of @c llvm::APFloat.
 	using APFloatPair = std::pair<llvm::APFloat, llvm::APFloat>;
 
-	/// Pair of integer constants.
-	using ConstIntPair = std::pair<ShPtr<ConstInt>, ShPtr<ConstInt>>;
-
-	/// Pair of float constants.
-	using ConstFloatPair = std::pair<ShPtr<ConstFloat>, ShPtr<ConstFloat>>;
-
-	/// Pair of bool constants.
-	using ConstBoolPair = std::pair<ShPtr<ConstBool>, ShPtr<ConstBool>>;
-
-	/// Pair of constants.
-	using ConstPair = std::pair<ShPtr<Constant>, ShPtr<Constant>>;
-
-	/// Stack of constats.
-	using ConstStack = std::stack<ShPtr<Constant>>;
+	/// Stack of evaluated values.
+	using ValueStack = std::vector<EvaluatedValue>;
 
 	/// Mapping of variables to constants.
 	using VarConstMap = std::map<ShPtr<Variable>, ShPtr<Constant>>;
@@ -67,25 +70,21 @@ public:
 	* @brief Returns the ID of the optimizer.
 	*/
 	virtual std::string getId() const = 0;
-	virtual Maybe<bool> toBool(ShPtr<Expression> expr, VarConstMap
-		varValues = VarConstMap());
+	virtual Maybe<bool> toBool(ShPtr<Expression> expr, const VarConstMap
+		&varValues = VarConstMap());
 
 	ShPtr<Constant> evaluate(ShPtr<Expression> expr);
 	ShPtr<Constant> evaluate(ShPtr<Expression> expr, const VarConstMap
 		&varValues);
 
-	template<typename ConstType>
-	static Maybe<std::pair<ShPtr<ConstType>, ShPtr<ConstType>>> castConstPair(
-		const ConstPair &constPair);
-
 protected:
 	ArithmExprEvaluator();
 
-	static APSIntPair getAPSIntsFromConstants(const Maybe<ConstIntPair>
-		&constIntPair);
-	static APFloatPair getAPFloatsFromConstants(const Maybe<ConstFloatPair>
-		&ConstFloatPair);
-	static bool isConstantZero(ShPtr<Constant> constant);
+	static bool areInts(const EvaluatedValuePair &values);
+	static bool areFloats(const EvaluatedValuePair &values);
+	static bool areBools(const EvaluatedValuePair &values);
+	static APSIntPair getAPSIntsFromValues(const EvaluatedValuePair &values);
+	static APFloatPair getAPFloatsFromValues(const EvaluatedValuePair &values);
 
 protected:
 	/// Signalizes if evaluation can go on.
@@ -98,6 +97,8 @@ private:
 		const llvm::APInt &) const;
 	using LLVMAPIntAPIntOp = llvm::APInt (llvm::APInt::*)(
 		const llvm::APInt &) const;
+	using APIntAPIntFunc = llvm::APInt (*)(const llvm::APInt &,
+		const llvm::APInt &);
 	using LLVMAPFloatOp = llvm::APFloat::opStatus (llvm::APFloat::*)(
 		const llvm::APFloat &, llvm::APFloat::roundingMode);
 	// Since LLVM 3.9, APFloat::mode() and APFloat::remainder() do not accept
@@ -158,90 +159,128 @@ private:
 	/// @}
 
 	// Resolve types.
-	virtual void resolveTypesUnaryOp(ShPtr<Constant> &operand);
-	virtual void resolveTypesBinaryOp(ConstPair &constPair);
+	virtual void resolveTypesUnaryOp(EvaluatedValue &operand);
+	virtual void resolveTypesBinaryOp(EvaluatedValuePair &operands);
 
 	// Resolve operators specifications.
 	virtual void resolveOpSpecifications(ShPtr<AddOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<AndOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<BitAndOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<BitOrOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<BitShlOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<BitShrOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<BitXorOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<DivOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<EqOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<GtEqOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<GtOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<LtEqOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<LtOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<ModOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<MulOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<NegOpExpr> expr,
-		ShPtr<Constant> &constant);
+		EvaluatedValue &operand);
 	virtual void resolveOpSpecifications(ShPtr<NeqOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<NotOpExpr> expr,
-		ShPtr<Constant> &constant);
+		EvaluatedValue &operand);
 	virtual void resolveOpSpecifications(ShPtr<OrOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 	virtual void resolveOpSpecifications(ShPtr<SubOpExpr> expr,
-		ConstPair &constPair);
+		EvaluatedValuePair &operands);
 
 	// Resolve casts.
-	virtual void resolveCast(ShPtr<BitCastExpr> expr, ShPtr<Constant> &constant);
-	virtual void resolveCast(ShPtr<ExtCastExpr> expr, ShPtr<Constant> &constant);
+	virtual void resolveCast(ShPtr<BitCastExpr> expr, EvaluatedValue &operand);
+	virtual void resolveCast(ShPtr<ExtCastExpr> expr, EvaluatedValue &operand);
 	virtual void resolveCast(ShPtr<FPToIntCastExpr> expr,
-		ShPtr<Constant> &constant);
+		EvaluatedValue &operand);
 	virtual void resolveCast(ShPtr<IntToFPCastExpr> expr,
-		ShPtr<Constant> &constant);
+		EvaluatedValue &operand);
 	virtual void resolveCast(ShPtr<TruncCastExpr> expr,
-		ShPtr<Constant> &constant);
+		EvaluatedValue &operand);
 
 	// Resolve overflow.
 	virtual void resolveOverflowForAPInt(bool overflow);
 	virtual void resolveOverflowForAPFloat(llvm::APFloat::opStatus opStatus);
 
 	// Perform functions.
-	ShPtr<ConstFloat> performOperationOverApFloat(const Maybe<ConstFloatPair>
-		&constFloatPair, LLVMAPFloatOp op, llvm::APFloat::opStatus &status);
-	ShPtr<ConstFloat> performOperationOverApFloat(const Maybe<ConstFloatPair>
-		&constFloatPair, LLVMAPFloatOpNoRounding op, llvm::APFloat::opStatus &status);
-	llvm::APFloat::cmpResult performOperationOverApFloat(const Maybe<
-		ConstFloatPair> &constFloatPair);
-	ShPtr<ConstInt> performOperationOverApInt(const Maybe<ConstIntPair>
-		&constIntPair, LLVMAPIntAPIntBoolOp op, bool &overflow);
-	ShPtr<ConstInt> performOperationOverApInt(const Maybe<ConstIntPair>
-		&constIntPair, LLVMAPIntAPIntOp op);
-	ShPtr<ConstBool> performOperationOverApInt(const Maybe<ConstIntPair>
-		&constIntPair, LLVMBoolAPIntOp op);
+	EvaluatedValue performOperationOverApFloat(const EvaluatedValuePair
+		&operands, LLVMAPFloatOp op, llvm::APFloat::opStatus &status);
+	EvaluatedValue performOperationOverApFloat(const EvaluatedValuePair
+		&operands, LLVMAPFloatOpNoRounding op, llvm::APFloat::opStatus &status);
+	llvm::APFloat::cmpResult performOperationOverApFloat(
+		const EvaluatedValuePair &operands);
+	EvaluatedValue performOperationOverApInt(const EvaluatedValuePair
+		&operands, LLVMAPIntAPIntBoolOp op, bool &overflow);
+	EvaluatedValue performOperationOverApInt(const EvaluatedValuePair
+		&operands, LLVMAPIntAPIntOp op);
+	EvaluatedValue performOperationOverApInt(const EvaluatedValuePair
+		&operands, APIntAPIntFunc func);
+	EvaluatedValue performOperationOverApInt(const EvaluatedValuePair
+		&operands, LLVMBoolAPIntOp op);
 
 	// Other functions.
-	ConstPair getOperandsForBinaryOpAndResolveTypes();
-	ShPtr<Constant> getOperandForUnaryOpAndResolveTypes();
+	EvaluatedValue evaluateToValue(ShPtr<Expression> expr,
+		const VarConstMap &varValues);
+	void evaluateOperand(ShPtr<Expression> operand);
+	void evaluateOperands(ShPtr<UnaryOpExpr> expr);
+	void evaluateOperands(ShPtr<BinaryOpExpr> expr);
+	void evaluateOperands(ShPtr<CastExpr> expr);
+	EvaluatedValuePair getOperandsForBinaryOpAndResolveTypes();
+	EvaluatedValue getOperandForUnaryOpAndResolveTypes();
 	void resolveOverflows(bool overflow, llvm::APFloat::opStatus opStatus);
 
+	// Memoization.
+	bool getMemoizedResult(ShPtr<Expression> expr,
+		const VarConstMap &varValues, EvaluatedValue &result);
+	void memoizeResult(ShPtr<Expression> expr, const VarConstMap &varValues,
+		const EvaluatedValue &result);
+
+private:
+	/// Result of an evaluation of an expression.
+	struct MemoizedResult {
+		/// Copy of the expression at the time of the evaluation.
+		ShPtr<Expression> exprCopy;
+
+		/// Variables in the expression.
+		std::vector<ShPtr<Variable>> vars;
+
+		/// Copies of the values substituted for @c vars (the null pointer if
+		/// there was no value).
+		std::vector<ShPtr<Constant>> varValues;
+
+		/// Result of the evaluation (invalid if it failed).
+		EvaluatedValue result;
+	};
+
 private:
 	/// Map of constants that substitute variables in evaluation.
 	const VarConstMap *varValues;
 
 	/// Stack of results during the evaluation.
-	ConstStack stackOfResults;
+	ValueStack stackOfResults;
+
+	/// Memoized results of evaluations mapped by the evaluated expressions.
+	std::unordered_map<ShPtr<Expression>, MemoizedResult> memoizedResults;
+
+	/// Variables in the expression looked up in @c memoizedResults (the
+	/// vector is reused between the lookups).
+	std::vector<ShPtr<Variable>> varsInExpr;
 };
 
 } // namespace llvmir2hll
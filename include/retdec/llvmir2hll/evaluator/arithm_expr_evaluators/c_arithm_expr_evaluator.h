@@ -33,26 +33,26 @@ private:
 	CArithmExprEvaluator();
 
 	// Resolve types.
-	virtual void resolveTypesUnaryOp(ShPtr<Constant> &operand) override;
-	virtual void resolveTypesBinaryOp(ConstPair &constPair) override;
+	virtual void resolveTypesUnaryOp(EvaluatedValue &operand) override;
+	virtual void resolveTypesBinaryOp(EvaluatedValuePair &operands) override;
 
 	// Resolve operators specifications.
 	virtual void resolveOpSpecifications(ShPtr<DivOpExpr> expr,
-		ConstPair &constPair) override;
+		EvaluatedValuePair &operands) override;
 	virtual void resolveOpSpecifications(ShPtr<ModOpExpr> expr,
-		ConstPair &constPair) override;
+		EvaluatedValuePair &operands) override;
 
 	// Resolve casts.
 	virtual void resolveCast(ShPtr<BitCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 	virtual void resolveCast(ShPtr<ExtCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 	virtual void resolveCast(ShPtr<FPToIntCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 	virtual void resolveCast(ShPtr<IntToFPCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 	virtual void resolveCast(ShPtr<TruncCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 
 	// Resolve overflow.
 	virtual void resolveOverflowForAPFloat(
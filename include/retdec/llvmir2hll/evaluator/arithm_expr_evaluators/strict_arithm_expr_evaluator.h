@@ -33,27 +33,27 @@ private:
 	StrictArithmExprEvaluator();
 
 	// Resolve types.
-	virtual void resolveTypesBinaryOp(ConstPair &constPair) override;
+	virtual void resolveTypesBinaryOp(EvaluatedValuePair &operands) override;
 
 	// Resolve operators specifications.
 	virtual void resolveOpSpecifications(ShPtr<DivOpExpr> expr,
-		ConstPair &constPair) override;
+		EvaluatedValuePair &operands) override;
 	virtual void resolveOpSpecifications(ShPtr<ModOpExpr> expr,
-		ConstPair &constPair) override;
+		EvaluatedValuePair &operands) override;
 	virtual void resolveOpSpecifications(ShPtr<NegOpExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 
 	// Resolve casts.
 	virtual void resolveCast(ShPtr<BitCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 	virtual void resolveCast(ShPtr<ExtCastExpr> expr,
-		ShPtr<Constant> &constant) override;
-	virtual void resolveCast(ShPtr<FPToIntCastExpr> expr, ShPtr<Constant>
-		&constant) override;
-	virtual void resolveCast(ShPtr<IntToFPCastExpr> expr, ShPtr<Constant>
-		&constant) override;
+		EvaluatedValue &operand) override;
+	virtual void resolveCast(ShPtr<FPToIntCastExpr> expr, EvaluatedValue
+		&operand) override;
+	virtual void resolveCast(ShPtr<IntToFPCastExpr> expr, EvaluatedValue
+		&operand) override;
 	virtual void resolveCast(ShPtr<TruncCastExpr> expr,
-		ShPtr<Constant> &constant) override;
+		EvaluatedValue &operand) override;
 
 	// Resolve overflow.
 	virtual void resolveOverflowForAPInt(bool overflow) override;
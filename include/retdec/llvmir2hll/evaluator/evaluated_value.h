@@ -0,0 +1,101 @@
+/**
+* @file include/retdec/llvmir2hll/evaluator/evaluated_value.h
+* @brief An intermediate value computed by an evaluator.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_EVALUATOR_EVALUATED_VALUE_H
+#define RETDEC_LLVMIR2HLL_EVALUATOR_EVALUATED_VALUE_H
+
+#include <utility>
+
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APInt.h>
+#include <llvm/ADT/APSInt.h>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Constant;
+
+/**
+* @brief An intermediate value computed by an evaluator.
+*
+* It stores an integral, a floating-point or a boolean value inline, so
+* intermediate results of an evaluation do not need to be allocated as
+* constants on the heap. A constant is created only by toConstant(), which is
+* supposed to be called on the final result.
+*
+* A value created from a constant remembers that constant, and toConstant()
+* returns it as long as the value has not been replaced. Constants other than
+* integers, floats, and bools can be stored in this way only.
+*
+* A default-constructed value is invalid. It represents an expression that
+* cannot be evaluated.
+*
+* Instances of this class have value object semantics.
+*/
+class EvaluatedValue {
+public:
+	EvaluatedValue();
+	explicit EvaluatedValue(ShPtr<Constant> constant);
+	explicit EvaluatedValue(const llvm::APSInt &value);
+	explicit EvaluatedValue(const llvm::APInt &value, bool isSigned = true);
+	explicit EvaluatedValue(const llvm::APFloat &value);
+	explicit EvaluatedValue(bool value);
+
+	/// @name Value Kinds
+	/// @{
+	bool isValid() const;
+	bool isInt() const;
+	bool isFloat() const;
+	bool isBool() const;
+	/// @}
+
+	/// @name Accessors
+	/// @{
+	const llvm::APSInt &getInt() const;
+	const llvm::APFloat &getFloat() const;
+	bool getBool() const;
+	/// @}
+
+	bool isZero() const;
+	bool hasSameTypeAs(const EvaluatedValue &other) const;
+	ShPtr<Constant> toConstant() const;
+
+private:
+	/// Kind of the stored value.
+	enum class Kind {
+		Invalid,
+		Int,
+		Float,
+		Bool,
+		Other
+	};
+
+private:
+	/// Kind of the stored value.
+	Kind kind;
+
+	/// The value if it is an integer.
+	llvm::APSInt intValue;
+
+	/// The value if it is a float.
+	llvm::APFloat floatValue;
+
+	/// The value if it is a bool.
+	bool boolValue;
+
+	/// Constant from which the value has been created (if any).
+	ShPtr<Constant> constant;
+};
+
+/// Pair of evaluated values.
+using EvaluatedValuePair = std::pair<EvaluatedValue, EvaluatedValue>;
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
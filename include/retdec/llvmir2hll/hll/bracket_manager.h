@@ -7,7 +7,6 @@
 #ifndef RETDEC_LLVMIR2HLL_HLL_BRACKET_MANAGER_H
 #define RETDEC_LLVMIR2HLL_HLL_BRACKET_MANAGER_H
 
-#include <map>
 #include <stack>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -18,10 +17,7 @@ namespace retdec {
 namespace llvmir2hll {
 
 class BinaryOpExpr;
-class CastExpr;
 class Expression;
-class TernaryOpExpr;
-class UnaryOpExpr;
 
 /**
 * @brief A base class of all brackets managers.
@@ -31,7 +27,14 @@ class UnaryOpExpr;
 * In subclass is needed to add a @a Precedence table, which is generated by script
 * @a hll_prec_table_gen.py which is in @a /decompiler/scripts/. In @a C/Py/.. HLL Writer
 * need to override @c emitTargetCode(...) and call the constructor of subclass
-* BracketManager. In constructor of subclass need to place function @c init(...).
+* BracketManager.
+*
+* Nothing is computed in advance. During emission, the HLL writer calls
+* @c enterOperandOf(...) (or @c enterSecondOperandOf(...)) before it emits an
+* operand of an expression and @c leaveOperandOf(...) after it. The decision
+* made by @c areBracketsNeeded(...) then depends only on the given expression
+* and the innermost operator that the writer is currently in, so it is done in
+* constant time.
 *
 * Instances of this class have reference object semantics.
 */
@@ -110,28 +113,37 @@ protected:
 	static const int PREC_TABLE_SIZE = 29;
 
 private:
-	/// Stack of structures. Every structure contains previous operator and direction
-	/// of tree traversal.
+	/// Stack of structures. Every structure contains an operator whose operand
+	/// is being emitted and the direction of the operand.
 	std::stack<PrevOperators> prevOperatorsStack;
-	/// This map contains Expression adresses and status to write, or doesn't write
-	/// brackets.
-	std::map<ShPtr<Expression>, bool> bracketsAreNeededMap;
-	/// The module to be analyzed.
-	ShPtr<Module> module;
+	/// Operator of the last expression passed to @c determineOperator(...).
+	Operators exprOperator;
+	/// Direction of the first operand of the last expression passed to
+	/// @c determineOperator(...).
+	Direction exprOperandDirection;
+	/// Does the last expression passed to @c determineOperator(...) have an
+	/// operator?
+	bool exprHasOperator;
 
 public:
-	BracketManager(ShPtr<Module> module);
+	BracketManager();
 	virtual ~BracketManager() override;
 
-	void init();
-
 	/**
 	* @brief Returns the ID of the BracketManager.
 	*/
 	virtual std::string getId() const = 0;
 
-	bool areBracketsNeeded(ShPtr<Expression> expr);
+	virtual bool areBracketsNeeded(ShPtr<Expression> expr);
 
+	/// @name Emission Context
+	/// @{
+	void enterOperandOf(ShPtr<Expression> expr);
+	void enterSecondOperandOf(ShPtr<BinaryOpExpr> expr);
+	void leaveOperandOf(ShPtr<Expression> expr);
+	/// @}
+
+private:
 	/// @name OrderedAllVisitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
@@ -194,21 +206,11 @@ protected:
 private:
 	void addOperatorOnStackIfSupported(Operators currentOperator,
 		Direction direction);
-	void areBracketsNeededForExpr(ShPtr<Expression> expr,
-		Operators currentOperator);
 	bool areBracketsNeededPrecTable(Operators currentOperator);
+	void determineOperator(ShPtr<Expression> expr);
 	void removeOperatorFromStackIfSupported(Operators currentOperator);
-
-	void treeTraversalForBinaryOpWithStackOperations(
-		ShPtr<BinaryOpExpr> expr, Operators currentOperator);
-	void treeTraversalForCallWithStackOperations(
-		ShPtr<CallExpr> expr, Operators currentOperator);
-	void treeTraversalForCastWithStackOperations(
-		ShPtr<CastExpr> expr, Operators currentOperator);
-	void treeTraversalForTernaryOpWithStackOperations(
-		ShPtr<TernaryOpExpr> expr, Operators currentOperator);
-	void treeTraversalForUnaryOpWithStackOperations(
-		ShPtr<UnaryOpExpr> expr, Operators currentOperator);
+	void setOperator(Operators currentOperator, Direction operandDirection);
+	void setNoOperator();
 };
 
 } // namespace llvmir2hll
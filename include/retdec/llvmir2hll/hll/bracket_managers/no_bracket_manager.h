@@ -18,18 +18,18 @@ namespace llvmir2hll {
 * For this purpose need to change @a emitTargetCode(...) in chosen HLL writer.
 * Need to change there
 * @code
-* bracketsManager = ShPtr<BracketManager>(new ..BracketManager(module));
+* bracketsManager = ShPtr<BracketManager>(new ..BracketManager());
 * to
-* bracketsManager = ShPtr<BracketManager>(new NoBracketManager(module));
+* bracketsManager = ShPtr<BracketManager>(new NoBracketManager());
 * @endcode
 */
 class NoBracketManager: public BracketManager {
 public:
-	NoBracketManager(ShPtr<Module> module);
+	NoBracketManager();
 
 	virtual std::string getId() const override;
 
-	bool areBracketsNeeded(ShPtr<Expression> expr);
+	virtual bool areBracketsNeeded(ShPtr<Expression> expr) override;
 
 private:
 	virtual ItemOfPrecTable checkPrecTable(Operators currentOperator,
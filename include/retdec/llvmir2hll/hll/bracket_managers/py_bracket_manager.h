@@ -18,7 +18,7 @@ namespace llvmir2hll {
 */
 class PyBracketManager: public BracketManager {
 public:
-	PyBracketManager(ShPtr<Module> module);
+	PyBracketManager();
 
 	virtual std::string getId() const override;
 
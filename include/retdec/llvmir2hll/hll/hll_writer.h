@@ -127,6 +127,8 @@ protected:
 	virtual void emitExprWithBracketsIfNeeded(ShPtr<Expression> expr);
 	void emitUnaryOpExpr(const std::string &opRepr, ShPtr<UnaryOpExpr> expr);
 	void emitBinaryOpExpr(const std::string &opRepr, ShPtr<BinaryOpExpr> expr);
+	void emitOperandOfCompoundOp(ShPtr<Expression> operand,
+		ShPtr<Expression> rhs);
 
 	bool emitDetectedCryptoPatternForGlobalVarIfAvailable(ShPtr<Variable> var);
 	bool emitModuleNameForFuncIfAvailable(ShPtr<Function> func);
@@ -158,7 +158,8 @@ private:
 	void emitFunctionParameters(ShPtr<FunctionType> funcType);
 	void emitReturnType(ShPtr<FunctionType> funcType);
 	void emitNameOfVarIfExists(ShPtr<Variable> var);
-	void emitAssignment(ShPtr<Expression> lhs, ShPtr<Expression> rhs);
+	void emitAssignment(ShPtr<Expression> lhs, ShPtr<Expression> rhs,
+		ShPtr<AssignOpExpr> assignExpr = nullptr);
 	void emitInitVarDefWhenNeeded(ShPtr<UForLoopStmt> loop);
 	void emitConstStruct(ShPtr<ConstStruct> constant, bool emitCast = true);
 	void emitStructDeclaration(ShPtr<StructType> structType,
@@ -11,6 +11,8 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
@@ -70,7 +72,7 @@ public:
 	ShPtr<Variable> getGlobalVarByName(const std::string &varName) const;
 	bool hasGlobalVars() const;
 	bool hasGlobalVar(const std::string &name) const;
-	VarSet getGlobalVars() const;
+	const VarSet &getGlobalVars() const;
 	VarSet getExternalGlobalVars() const;
 	std::string getRegisterForGlobalVar(ShPtr<Variable> var) const;
 	std::string getDetectedCryptoPatternForGlobalVar(ShPtr<Variable> var) const;
@@ -185,6 +187,16 @@ private:
 	/// Mapping of a function into an address range.
 	using FuncAddressRangeMap = std::map<ShPtr<Function>, AddressRange>;
 
+	/// Mapping of a global variable into its definition.
+	using VarGlobalVarDefUMap = std::unordered_map<ShPtr<Variable>,
+		ShPtr<GlobalVarDef>>;
+
+	/// Mapping of a name into a global variable.
+	using StringVarUMap = std::unordered_map<std::string, ShPtr<Variable>>;
+
+	/// Mapping of a name into a function.
+	using StringFuncUMap = std::unordered_map<std::string, ShPtr<Function>>;
+
 private:
 	/// Original module from which this module has been created.
 	const llvm::Module *llvmModule;
@@ -198,16 +210,45 @@ private:
 	/// The used config.
 	ShPtr<Config> config;
 
-	/// Global variables.
+	/// Global variables (in the order in which they were added).
 	GlobalVarDefVector globalVars;
 
-	/// Functions.
+	/// Global variables (without their initializers).
+	VarSet globalVarsSet;
+
+	/// Mapping of a global variable into its definition.
+	VarGlobalVarDefUMap globalVarDefs;
+
+	/// Functions (in the order in which they were added).
 	FuncVector funcs;
 
+	/// Functions (for fast membership tests).
+	std::unordered_set<ShPtr<Function>> funcsSet;
+
+	/// @name Name Indexes
+	/// Names of variables may change without the module knowing about it, so
+	/// the indexes are rebuilt lazily when they are needed after a change of
+	/// a name of any variable.
+	/// @{
+	/// Mapping of a name into the first global variable with that name.
+	mutable StringVarUMap globalVarsByName;
+
+	/// Mapping of a name into the first function with that name.
+	mutable StringFuncUMap funcsByName;
+
+	/// Are the name indexes up to date?
+	mutable bool nameIndexesValid;
+
+	/// Value of Variable::getNumOfNameChanges() when the indexes were built.
+	mutable std::size_t nameIndexesNumOfNameChanges;
+	/// @}
+
 	/// Mapping of a variable into its name in the debug information.
 	VarStringMap debugVarNameMap;
 
 private:
+	void updateNameIndexes() const;
+
 	bool hasFuncSatisfyingPredicate(
 		std::function<bool (ShPtr<Function>)> pred
 	) const;
@@ -7,6 +7,7 @@
 #ifndef RETDEC_LLVMIR2HLL_IR_VARIABLE_H
 #define RETDEC_LLVMIR2HLL_IR_VARIABLE_H
 
+#include <cstddef>
 #include <string>
 
 #include "retdec/llvmir2hll/ir/expression.h"
@@ -49,6 +50,8 @@ public:
 	void markAsInternal();
 	void markAsExternal();
 
+	static std::size_t getNumOfNameChanges();
+
 	/// @name Visitor Interface
 	/// @{
 	virtual void accept(Visitor *v) override;
@@ -71,6 +74,9 @@ private:
 
 	/// Is the variable internal?
 	bool internal;
+
+	/// Number of changes of names of all variables.
+	static std::size_t numOfNameChanges;
 };
 
 } // namespace llvmir2hll
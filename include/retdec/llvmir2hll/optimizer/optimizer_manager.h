@@ -11,6 +11,7 @@
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvm-support/diagnostics.h"
+#include "retdec/utils/memory.h"
 #include "retdec/utils/non_copyable.h"
 
 namespace retdec {
@@ -42,6 +43,7 @@ private:
 	void printOptimization(const std::string &optName) const;
 	bool optShouldBeRun(const std::string &optName) const;
 	void runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer);
+	bool fitsIntoMemoryBudget(const std::string &optId);
 	bool shouldSecondCopyPropagationBeRun() const;
 
 	template<typename Optimization, typename... Args>
@@ -81,6 +83,9 @@ private:
 	/// Should we recover from out-of-memory errors during optimizations?
 	bool recoverFromOutOfMemory;
 
+	/// The highest stage of the memory budget that has been reported.
+	utils::MemoryBudget::Stage reportedBudgetStage;
+
 	/// Set of frontend-end optimizations that were run.
 	StringSet frontendRunOpts;
 
@@ -45,6 +45,9 @@ private:
 	/// Mapping of a function into a set of variables.
 	using FuncVarsMap = std::map<ShPtr<Function>, VarSet>;
 
+	/// Mapping of a variable into a vector of functions.
+	using VarFuncsMap = std::map<ShPtr<Variable>, FuncVector>;
+
 private:
 	virtual void doOptimization() override;
 
@@ -62,7 +65,7 @@ private:
 	void computeGlobalVarsUsedInGlobalVarDef();
 	void computeUsedGlobalVars();
 	VarSet computeUsedGlobalVarsForFunc(ShPtr<Function> func) const;
-	bool isUsedInFunc(ShPtr<Variable> var, ShPtr<Function> func);
+	const FuncVector &getFuncsUsingGlobalVar(ShPtr<Variable> var) const;
 	void computeUsefulAndUselessGlobalVars();
 	bool isUsefulInFunc(ShPtr<Variable> var, ShPtr<Function> func) const;
 	bool globalVarMayBeRemovedAsUnused(ShPtr<Variable> var);
@@ -104,6 +107,11 @@ private:
 	/// Mapping of a function into the set of global variables used in the
 	/// function.
 	FuncVarsMap funcUsedGlobalVarsMap;
+
+	/// Mapping of a global variable into the function definitions that use it
+	/// (the inverse of @c funcUsedGlobalVarsMap, restricted to definitions).
+	/// The functions are in the same order as in the module.
+	VarFuncsMap globalVarUsingFuncsMap;
 };
 
 } // namespace llvmir2hll
@@ -8,6 +8,9 @@
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_SIMPLIFY_ARITHM_EXPR_SUB_OPTIMIZER_H
 
 #include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_set>
 
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/sub_optimizer_factory.h"
@@ -20,6 +23,13 @@ namespace llvmir2hll {
 
 /**
 * @brief A base class for all simplify arithmetical expression optimizations.
+*
+* A sub-optimizer can be run in two ways. tryOptimize() optimizes the given
+* expression together with all its subexpressions. tryOptimizeRoot() optimizes
+* only the given expression, so it is up to the caller to optimize its
+* operands first. To be usable in the latter way, concrete sub-optimizers have
+* to visit operands by calling visitOperands() and register the types of
+* expressions they optimize by calling addOptimizedExprType().
 */
 class SubOptimizer: public OrderedAllVisitor, private retdec::utils::NonCopyable {
 public:
@@ -30,10 +40,36 @@ public:
 	*/
 	virtual std::string getId() const = 0;
 	virtual bool tryOptimize(ShPtr<Expression> expr);
+	ShPtr<Expression> tryOptimizeRoot(ShPtr<Expression> expr);
+
+	/// Set of types of expressions.
+	using ExprTypeSet = std::unordered_set<std::type_index>;
+
+	const ExprTypeSet &getOptimizedExprTypes() const;
 
 protected:
 	SubOptimizer(ShPtr<ArithmExprEvaluator> arithmExprEvaluator);
 
+	/**
+	* @brief Registers @c ExprType as a type of expressions optimized by this
+	*        sub-optimizer.
+	*/
+	template<typename ExprType>
+	void addOptimizedExprType() {
+		optimizedExprTypes.insert(std::type_index(typeid(ExprType)));
+	}
+
+	/**
+	* @brief Visits the operands of @a expr unless only the root expression is
+	*        being optimized (see tryOptimizeRoot()).
+	*/
+	template<typename ExprType>
+	void visitOperands(ShPtr<ExprType> expr) {
+		if (!optimizingOnlyRoot) {
+			OrderedAllVisitor::visit(expr);
+		}
+	}
+
 	bool isConstFloatOrConstInt(ShPtr<Expression> expr) const;
 	void optimizeExpr(ShPtr<Expression> oldExpr, ShPtr<Expression> newExpr);
 	bool tryOptimizeAndReturnIfCodeChanged(ShPtr<Expression> expr);
@@ -43,7 +79,17 @@ protected:
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
 
 private:
+	/// Has the code changed?
 	bool codeChanged;
+
+	/// Are we optimizing only the root expression (see tryOptimizeRoot())?
+	bool optimizingOnlyRoot;
+
+	/// Expression that has replaced the last optimized expression.
+	ShPtr<Expression> lastNewExpr;
+
+	/// Types of expressions optimized by this sub-optimizer.
+	ExprTypeSet optimizedExprTypes;
 };
 
 } // namespace llvmir2hll
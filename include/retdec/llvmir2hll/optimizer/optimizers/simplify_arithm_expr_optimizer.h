@@ -7,6 +7,11 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_SIMPLIFY_ARITHM_EXPR_OPTIMIZER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZERS_SIMPLIFY_ARITHM_EXPR_OPTIMIZER_H
 
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "retdec/llvmir2hll/optimizer/func_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/simplify_arithm_expr/sub_optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -22,6 +27,13 @@ class ArithmExprEvaluator;
 * The optimizer utilizes many sub-optimizers. They are in the @c
 * simplify_arithm_expr sub-directory.
 *
+* Expressions are simplified bottom-up in a single pass. Every expression is
+* offered only to the sub-optimizers that optimize expressions of its type,
+* after all its operands have been simplified. When an expression is replaced,
+* only the replacement is simplified again; its operands that have already been
+* simplified are skipped. The parents of a replaced expression are simplified
+* afterwards because they are visited later in the traversal.
+*
 * Instances of this class have reference object semantics.
 *
 * This is a concrete optimizer which should not be subclassed.
@@ -42,6 +54,7 @@ private:
 	/// @{
 	using OrderedAllVisitor::visit;
 		virtual void visit(ShPtr<AddOpExpr> expr) override;
+		virtual void visit(ShPtr<AndOpExpr> expr) override;
 		virtual void visit(ShPtr<SubOpExpr> expr) override;
 		virtual void visit(ShPtr<MulOpExpr> expr) override;
 		virtual void visit(ShPtr<DivOpExpr> expr) override;
@@ -61,19 +74,28 @@ private:
 		/// @}
 
 	void createSubOptimizers(ShPtr<ArithmExprEvaluator> arithmExprEvaluator);
-	void tryOptimizeInSubOptimizations(ShPtr<Expression> expr);
+	template<typename ExprType>
+	void simplify(ShPtr<ExprType> expr);
+	ShPtr<Expression> tryOptimizeInSubOptimizations(ShPtr<Expression> expr);
 
 private:
 	/// Vector of sub-optimizations.
 	using SubOptimVec = std::vector<ShPtr<SubOptimizer>>;
 
+	/// Mapping of a type of expressions into sub-optimizations that optimize
+	/// expressions of this type.
+	using SubOptimsForExprTypeMap = std::unordered_map<std::type_index,
+		SubOptimVec>;
+
 private:
 	/// Vector of sub-optimizations.
 	SubOptimVec subOptims;
 
-	/// @c true if the module was optimized in a sub/optimization, @c false
-	/// otherwise.
-	bool codeChanged;
+	/// Sub-optimizations for every type of expressions.
+	SubOptimsForExprTypeMap subOptimsForExprType;
+
+	/// Expressions that have already been simplified.
+	std::unordered_set<ShPtr<Expression>> simplifiedExprs;
 };
 
 } // namespace llvmir2hll
@@ -7,6 +7,9 @@
 #ifndef RETDEC_LLVMIR2HLL_SUPPORT_EXPR_TYPES_FIXER_H
 #define RETDEC_LLVMIR2HLL_SUPPORT_EXPR_TYPES_FIXER_H
 
+#include <cstddef>
+#include <map>
+
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
@@ -31,6 +34,9 @@ class Type;
 * We have to fix some integer types to signed because all variables are
 * unsigned before this fixation.
 *
+* The statistics are computed once, in a single traversal of the module, and
+* every tagged expression is then fixed based on them.
+*
 * We need to apply the fixer on the backend IR after it is generated. The @c
 * fixTypes() function is called in @c Decompiler.cpp, between the creation of
 * the backend IR and optimizations. This fixer have to be used on every place
@@ -61,9 +67,22 @@ public:
 
 	static void fixTypes(ShPtr<Module> module);
 
+private:
+	/// Numbers of signed and unsigned tags of an expression.
+	struct TagCounts {
+		std::size_t isSigned = 0;
+		std::size_t isUnsigned = 0;
+	};
+
+	/// Mapping of an expression into its tag counts.
+	using ExprTagCountsMap = std::map<ShPtr<Expression>, TagCounts>;
+
 private:
 	ExprTypesFixer();
 	void setProbablyTypes(ShPtr<Module> module);
+	ExprTagCountsMap computeTagCounts(ShPtr<Module> module);
+	void fixTypeOfExpr(ShPtr<Expression> expr, const TagCounts &counts,
+		ShPtr<Module> module);
 	ShPtr<Expression> exprCheckAndChange(bool isSigned, ShPtr<Expression> expr);
 
 	/// @name Visitor Interface
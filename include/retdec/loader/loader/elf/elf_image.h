@@ -7,8 +7,10 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_ELF_ELF_IMAGE_H
 #define RETDEC_LOADER_RETDEC_LOADER_ELF_ELF_IMAGE_H
 
+#include <map>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "retdec/loader/loader/image.h"
@@ -48,15 +50,47 @@ public:
 	virtual bool load() override;
 
 protected:
+	/**
+	 * Reads and writes relocated values straight in the data of segments. The last
+	 * used segment is remembered, so a batch of relocations which target the same
+	 * segment (usually all relocations of one relocation table) looks the segment
+	 * up only once instead of once per every read and write.
+	 */
+	class RelocationPatcher
+	{
+	public:
+		RelocationPatcher(ElfImage* image);
+
+		bool get(std::size_t size, std::uint64_t address, std::uint64_t& value);
+		bool set(std::size_t size, std::uint64_t address, std::uint64_t value);
+
+		/// Postponed high part relocation (MIPS and PowerPC) waiting for its low part.
+		const retdec::fileformat::Relocation* lastHi16 = nullptr;
+
+	private:
+		std::uint8_t* locate(std::uint64_t address, std::size_t size);
+
+		ElfImage* _image;
+		retdec::utils::Endianness _endianness;
+		Segment* _segment = nullptr;
+		std::uint8_t* _data = nullptr;
+		std::uint64_t _dataSize = 0;
+	};
+
 	bool loadExecutableFile();
 	bool loadRelocatableFile();
 	bool canLoadSections(const std::vector<retdec::fileformat::Section*>& sections) const;
 	void fixBssSegments();
 	void applyRelocations();
-	void resolveRelocation(const retdec::fileformat::Relocation& rel, const retdec::fileformat::Symbol& sym);
+	void resolveRelocation(const retdec::fileformat::Relocation& rel, std::uint64_t symAddress, RelocationPatcher& patcher);
 
 	SegmentToSectionsTable createSegmentToSectionsTable();
 	const Segment* addSegment(const retdec::fileformat::SecSeg* secSeg, std::uint64_t address, std::uint64_t memSize);
+	void flushRemovedSegments();
+
+private:
+	std::map<std::uint64_t, Segment*> _placedSegments; ///< Placed segments indexed by their start address. They never overlap.
+	std::unordered_set<const Segment*> _removedSegments; ///< Segments fully overlapped by later ones, removed in flushRemovedSegments().
 };
 
 } // namespace loader
@@ -8,6 +8,7 @@
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
 #include <memory>
+#include <unordered_set>
 
 #include "retdec/utils/byte_value_storage.h"
 #include "retdec/fileformat/fftypes.h"
@@ -79,6 +80,7 @@ public:
 protected:
 	Segment* insertSegment(std::unique_ptr<Segment> segment);
 	void removeSegment(Segment* segment);
+	void removeSegments(const std::unordered_set<const Segment*>& segments);
 	void nameSegment(Segment* segment);
 	void sortSegments();
 
@@ -7,6 +7,7 @@
 #ifndef RETDEC_PATTERNGEN_PATTERN_EXTRACTOR_PATTERN_EXTRACTOR_H
 #define RETDEC_PATTERNGEN_PATTERN_EXTRACTOR_PATTERN_EXTRACTOR_H
 
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -17,6 +18,7 @@
 namespace retdec {
 namespace fileformat {
 	class FileFormat;
+	class Relocation;
 	class Section;
 	class Symbol;
 } // namespace fileformat
@@ -40,6 +42,23 @@ class PatternExtractor
 		std::string groupName;               ///< Name for set of rules.
 		std::vector<SymbolPattern> patterns; ///< Vector of patterns found.
 
+		/// @brief Relocation with its position among all relocations.
+		struct RelocationEntry
+		{
+			unsigned long long offset;                       ///< Section offset.
+			std::size_t order;                               ///< Position.
+			const retdec::fileformat::Relocation *relocation; ///< Relocation.
+		};
+
+		/// @brief Lookup tables indexed by section index.
+		/// @{
+		std::map<unsigned long long, std::vector<RelocationEntry>>
+			sectionRelocations; ///< Relocations sorted by offset.
+		std::map<unsigned long long,
+			std::vector<const retdec::fileformat::Symbol*>>
+			sectionFunctions;   ///< Function symbols.
+		/// @}
+
 		/// @brief Strange PIC32 architecture files processing.
 		/// @{
 		bool isPic32DataObjectOnlyFile();
@@ -49,6 +68,8 @@ class PatternExtractor
 		/// @brief Processing methods.
 		/// @{
 		bool processFile();
+		void indexRelocations();
+		void indexFunctionSymbols();
 		bool checkPPC64Sections();
 		std::vector<const retdec::fileformat::Symbol*> filterSymbols();
 		void processSymbol(const retdec::fileformat::Symbol *symbol);
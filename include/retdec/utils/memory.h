@@ -8,14 +8,61 @@
 #define RETDEC_UTILS_MEMORY_H
 
 #include <cstdlib>
+#include <functional>
 
 namespace retdec {
 namespace utils {
 
 std::size_t getTotalSystemMemory();
+std::size_t getMemoryUsage();
 bool limitSystemMemory(std::size_t limit);
 bool limitSystemMemoryToHalfOfTotalSystemMemory();
 
+/**
+* @brief Process-wide memory budget with graceful degradation.
+*
+* A hard limit set by limitSystemMemory() kills the tool with
+* @c std::bad_alloc, no matter how much work has already been done. The budget
+* allows the tool to degrade gracefully instead. Long-running phases ask for
+* the current stage and, as the memory usage gets closer to the budget, they
+* drop optional caches, skip optional phases, and finally emit the result
+* obtained so far.
+*
+* Stages only go up. Once a stage is reached, it is kept even if the memory
+* usage drops because freed memory is seldom returned to the system.
+*
+* When no budget is set, the stage is always Stage::Normal and the memory
+* usage is not sampled at all.
+*/
+class MemoryBudget {
+public:
+	/// Stages of degradation, ordered by increasing memory pressure.
+	enum class Stage {
+		Normal,       ///< Everything runs.
+		DropCaches,   ///< Optional caches should be dropped.
+		SkipOptional, ///< Optional phases should be skipped.
+		EmitPartial   ///< The result obtained so far should be emitted.
+	};
+
+	/// Function returning the current memory usage (in bytes).
+	using UsageSampler = std::function<std::size_t ()>;
+
+public:
+	static void setLimit(std::size_t limit);
+	static std::size_t getLimit();
+	static bool isLimited();
+	static void setUsageSampler(UsageSampler sampler);
+	static void reset();
+
+	static Stage getStage();
+	static bool shouldDropCaches();
+	static bool shouldSkipOptionalPhases();
+	static bool shouldEmitPartialResult();
+
+private:
+	MemoryBudget() = delete;
+};
+
 } // namespace utils
 } // namespace retdec
 
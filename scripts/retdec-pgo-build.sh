@@ -0,0 +1,210 @@
+#!/usr/bin/env bash
+#
+# Builds RetDec with profile-guided optimization (PGO):
+#    1. builds and installs RetDec instrumented for profile generation,
+#    2. compiles the training workload from support/pgo for all available
+#       formats and architectures and decompiles it by the instrumented build,
+#    3. rebuilds and reinstalls RetDec optimized by using the gathered profiles.
+#
+# Both builds are done in the same build directory because GCC names profiles
+# after object files.
+#
+# Required arguments:
+#    * build directory
+#    * installation directory
+#
+# Optional arguments (passed after the required ones):
+#    * --lto               enable also link-time optimization
+#    * --corpus DIR        decompile also all files in DIR during training
+#    * --jobs N            number of parallel build jobs
+#    * any other arguments are passed to cmake
+#
+
+# On macOS, we want the GNU version of 'readlink', which is available under
+# 'greadlink':
+gnureadlink()
+{
+	if hash greadlink 2> /dev/null; then
+		greadlink "$@"
+	else
+		readlink "$@"
+	fi
+}
+
+SCRIPT_DIR="$(dirname "$(gnureadlink -e "$0")")"
+SOURCE_DIR="$(dirname "$SCRIPT_DIR")"
+TRAINING_SOURCES_DIR="$SOURCE_DIR/support/pgo"
+
+#
+# Print help.
+#
+print_help()
+{
+	echo "Profile-guided optimized build of RetDec."
+	echo ""
+	echo "Usage:"
+	echo "    $0 build_dir install_dir [ options ] [ cmake args ]"
+	echo ""
+	echo "Options:"
+	echo "    -h,        --help          Print this help message."
+	echo "    -l,        --lto           Enable also link-time optimization."
+	echo "    -c DIR,    --corpus DIR    Decompile also all files in DIR during training."
+	echo "    -j N,      --jobs N        Number of parallel build jobs."
+}
+
+#
+# Print error message and exit.
+#
+# 1 argument is needed:
+#    $1 error message
+#
+print_error_and_die()
+{
+	echo "Error: $1." >&2
+	exit 1
+}
+
+#
+# Configure, build, and install RetDec.
+#
+# 1 argument is needed:
+#    $1 PGO stage (GENERATE, USE)
+#
+build_retdec()
+{
+	(cd "$BUILD_DIR" && cmake "$SOURCE_DIR" \
+		-DCMAKE_BUILD_TYPE=Release \
+		-DCMAKE_INSTALL_PREFIX="$INSTALL_DIR" \
+		-DRETDEC_ENABLE_LTO="$LTO" \
+		-DRETDEC_PGO="$1" \
+		-DRETDEC_PGO_DIR="$PROFILE_DIR" \
+		"${CMAKE_ARGS[@]}") \
+		|| print_error_and_die "cmake failed in stage $1"
+	cmake --build "$BUILD_DIR" -- -j"$JOBS" \
+		|| print_error_and_die "build failed in stage $1"
+	cmake --build "$BUILD_DIR" --target install \
+		|| print_error_and_die "installation failed in stage $1"
+}
+
+#
+# Compile the training workload by all available compilers.
+#
+# 1 argument is needed:
+#    $1 output directory
+#
+# Compilers that are not installed are skipped.
+#
+compile_training_workload()
+{
+	# compiler:flags:suffix
+	local COMPILERS=(
+		"gcc::elf-x64"
+		"gcc:-m32:elf-x86"
+		"arm-linux-gnueabi-gcc::elf-arm"
+		"mips-linux-gnu-gcc::elf-mips"
+		"i686-w64-mingw32-gcc::pe-x86.exe"
+		"x86_64-w64-mingw32-gcc::pe-x64.exe"
+	)
+	for ENTRY in "${COMPILERS[@]}"; do
+		IFS=":" read -r CC CFLAGS SUFFIX <<< "$ENTRY"
+		if ! hash "$CC" 2> /dev/null; then
+			echo "Skipping $SUFFIX: $CC not found."
+			continue
+		fi
+		for SRC in "$TRAINING_SOURCES_DIR"/*.c; do
+			for OPT in O0 O2; do
+				OUT="$1/$(basename "${SRC%.c}")-$OPT-$SUFFIX"
+				# shellcheck disable=SC2086
+				"$CC" -std=c99 -"$OPT" $CFLAGS -o "$OUT" "$SRC" -lm 2> /dev/null \
+					|| echo "Skipping $OUT: compilation failed."
+			done
+		done
+	done
+}
+
+#
+# Run the installed instrumented RetDec on all files in the given directory.
+#
+# 1 argument is needed:
+#    $1 directory with binaries
+#
+run_training()
+{
+	for FILE in "$1"/*; do
+		[ -f "$FILE" ] || continue
+		echo "Training on $FILE"
+		"$INSTALL_DIR/bin/retdec-fileinfo" --json "$FILE" > /dev/null 2>&1
+		"$INSTALL_DIR/bin/retdec-decompiler.sh" "$FILE" \
+			-o "$WORK_DIR/$(basename "$FILE").c" > /dev/null 2>&1 \
+			|| echo "Warning: decompilation of $FILE failed."
+	done
+}
+
+#
+# Merge raw profiles produced by Clang-instrumented binaries.
+#
+merge_clang_profiles()
+{
+	if ! ls "$PROFILE_DIR"/*.profraw > /dev/null 2>&1; then
+		return
+	fi
+	hash llvm-profdata 2> /dev/null \
+		|| print_error_and_die "llvm-profdata is needed to merge Clang profiles"
+	llvm-profdata merge -output="$PROFILE_DIR/retdec.profdata" "$PROFILE_DIR"/*.profraw \
+		|| print_error_and_die "merging of profiles failed"
+}
+
+if [ "$1" = "-h" ] || [ "$1" = "--help" ]; then
+	print_help
+	exit 0
+fi
+
+[ $# -lt 2 ] && print_help && exit 1
+
+mkdir -p "$1" "$2" || print_error_and_die "cannot create the build or installation directory"
+BUILD_DIR="$(gnureadlink -f "$1")"
+INSTALL_DIR="$(gnureadlink -f "$2")"
+shift 2
+
+LTO=OFF
+CORPUS_DIR=""
+JOBS="$(getconf _NPROCESSORS_ONLN 2> /dev/null || echo 1)"
+CMAKE_ARGS=()
+while [ $# -gt 0 ]; do
+	case "$1" in
+		-h|--help)
+			print_help
+			exit 0;;
+		-l|--lto)
+			LTO=ON
+			shift;;
+		-c|--corpus)
+			[ -d "$2" ] || print_error_and_die "corpus directory '$2' does not exist"
+			CORPUS_DIR="$(gnureadlink -f "$2")"
+			shift 2;;
+		-j|--jobs)
+			JOBS="$2"
+			shift 2;;
+		*)
+			CMAKE_ARGS+=("$1")
+			shift;;
+	esac
+done
+
+PROFILE_DIR="$BUILD_DIR/pgo-profiles"
+WORK_DIR="$BUILD_DIR/pgo-training"
+rm -rf "$PROFILE_DIR" "$WORK_DIR"
+mkdir -p "$PROFILE_DIR" "$WORK_DIR/corpus"
+
+build_retdec GENERATE
+
+compile_training_workload "$WORK_DIR/corpus"
+run_training "$WORK_DIR/corpus"
+if [ -n "$CORPUS_DIR" ]; then
+	run_training "$CORPUS_DIR"
+fi
+merge_clang_profiles
+
+build_retdec USE
+
+echo "Profile-guided optimized RetDec installed into $INSTALL_DIR."
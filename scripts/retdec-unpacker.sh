@@ -194,6 +194,8 @@ done
 # Check arguments and set default values for unset options.
 check_arguments
 
+# The generic unpacker unpacks all the layers it knows by itself. This loop is
+# needed only when a layer unpacked by UPX hides another packed layer.
 CONTINUE=1
 FINAL_RC=-1
 while [  "$CONTINUE" = "1" ]; do
@@ -355,7 +355,7 @@ std::ostream& operator<<(std::ostream& out, const ReachingDefinitionsAnalysis& r
 //=============================================================================
 //
 
-int BasicBlockEntry::newUID = 0;
+std::atomic<int> BasicBlockEntry::newUID(0);
 
 BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b) :
 	bb(b),
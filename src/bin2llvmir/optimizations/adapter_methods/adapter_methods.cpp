@@ -16,6 +16,7 @@
 #include <llvm/Support/raw_ostream.h>
 
 #include "retdec/bin2llvmir/optimizations/adapter_methods/adapter_methods.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -49,7 +50,10 @@ void AdapterMethods::getAnalysisUsage(AnalysisUsage &AU) const
 
 bool AdapterMethods::runOnFunction(Function& F)
 {
-	config = ConfigProvider::getConfig(F.getParent());
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		config = pc->configs.getConfig(F.getParent());
+	}
 
 	searchForPattern1(F);
 	// more patterns ...
@@ -13,6 +13,7 @@
 
 #include "retdec/bin2llvmir/optimizations/asm_inst_remover/asm_inst_remover.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -40,8 +41,19 @@ AsmInstructionRemover::AsmInstructionRemover() :
 
 bool AsmInstructionRemover::runOnModule(Module& M)
 {
-	_config = ConfigProvider::getConfig(&M);
-	return run(M);
+	auto* pc = ProviderContext::get(*this);
+	if (pc)
+	{
+		_config = pc->configs.getConfig(&M);
+	}
+	bool changed = run(M);
+
+	// The LLVM to ASM mapping global variable does not exist anymore.
+	if (pc)
+	{
+		pc->llvmToAsmGlobals.erase(&M);
+	}
+	return changed;
 }
 
 bool AsmInstructionRemover::runOnModuleCustom(llvm::Module& M, Config* c)
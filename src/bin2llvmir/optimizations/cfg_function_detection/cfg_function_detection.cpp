@@ -18,6 +18,7 @@
 #include "retdec/utils/time.h"
 #include "retdec/bin2llvmir/optimizations/cfg_function_detection/cfg_function_detection.h"
 #include "retdec/llvm-support/utils.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/type.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 
@@ -46,8 +47,11 @@ CfgFunctionDetection::CfgFunctionDetection() :
 bool CfgFunctionDetection::runOnModule(Module& M)
 {
 	_module = &M;
-	_config = ConfigProvider::getConfig(_module);
-	_image = FileImageProvider::getFileImage(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_image = pc->fileImages.getFileImage(_module);
+	}
 	return run();
 }
 
@@ -8,7 +8,6 @@
 
 #include "retdec/demangler/demangler.h"
 #include "retdec/bin2llvmir/optimizations/class_hierarchy/hierarchy.h"
-#include "retdec/bin2llvmir/providers/demangler.h"
 
 namespace retdec {
 namespace bin2llvmir {
@@ -58,7 +57,7 @@ retdec::config::Class Class::getConfigClass(
 {
 	retdec::config::Class c(name);
 
-	auto* demangler = DemanglerProvider::getDemangler(m);
+	auto* demangler = config->getDemangler();
 	if (demangler)
 	{
 		c.setDemangledName(demangler->demangleToString(name));
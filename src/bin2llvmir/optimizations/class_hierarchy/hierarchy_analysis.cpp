@@ -8,7 +8,9 @@
 
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/class_hierarchy/hierarchy_analysis.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
+#include "retdec/utils/memory.h"
 
 #define debug_enabled false
 
@@ -41,7 +43,19 @@ void ClassHierarchyAnalysis::getAnalysisUsage(AnalysisUsage& AU) const
 
 bool ClassHierarchyAnalysis::runOnModule(Module& M)
 {
-	if (!ConfigProvider::getConfig(&M, config))
+	if (retdec::utils::MemoryBudget::shouldSkipOptionalPhases())
+	{
+		LOG << "[ABORT] memory budget does not allow optional phases\n";
+		return false;
+	}
+
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(&M, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
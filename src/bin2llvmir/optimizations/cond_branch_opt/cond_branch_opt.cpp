@@ -13,6 +13,7 @@
 #include "retdec/bin2llvmir/analyses/symbolic_tree.h"
 #include "retdec/bin2llvmir/optimizations/cond_branch_opt/cond_branch_opt.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/utils/type.h"
@@ -41,7 +42,10 @@ CondBranchOpt::CondBranchOpt() :
 bool CondBranchOpt::runOnModule(llvm::Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+	}
 	return run();
 }
 
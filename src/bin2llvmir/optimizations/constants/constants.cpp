@@ -23,6 +23,7 @@
 #include "retdec/bin2llvmir/analyses/symbolic_tree.h"
 #include "retdec/bin2llvmir/optimizations/constants/constants.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/global_var.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #define debug_enabled false
@@ -60,17 +61,23 @@ bool ConstantsAnalysis::runOnModule(Module &M)
 {
 	LOG << "\n[BEGIN] ======================== ConstantsAnalysis:\n" << std::endl;
 
-	if (!FileImageProvider::getFileImage(&M, objf))
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->fileImages.getFileImage(&M, objf))
 	{
 		LOG << "[ABORT] object file is not available\n";
 		return false;
 	}
-	if (!ConfigProvider::getConfig(&M, config))
+	if (!pc->configs.getConfig(&M, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
 	}
-	dbgf = DebugFormatProvider::getDebugFormat(&M);
+	dbgf = pc->debugFormats.getDebugFormat(&M);
 
 	m_module = &M;
 
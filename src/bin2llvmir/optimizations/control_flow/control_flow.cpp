@@ -12,6 +12,7 @@
 
 #include "retdec/bin2llvmir/optimizations/control_flow/control_flow.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/global_var.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/type.h"
@@ -42,8 +43,13 @@ ControlFlow::ControlFlow() :
 bool ControlFlow::runOnModule(llvm::Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
-	_image = FileImageProvider::getFileImage(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_image = pc->fileImages.getFileImage(_module);
+		_dbgf = pc->debugFormats.getDebugFormat(_module);
+		_lti = pc->ltis.getLti(_module);
+	}
 	return run();
 }
 
@@ -1262,7 +1268,7 @@ llvm::Value* ControlFlow::makeFunction(retdec::utils::Address addr)
 					_module,
 					_config,
 					_image,
-					DebugFormatProvider::getDebugFormat(_module),
+					_dbgf,
 					addr,
 					true);
 			if (ngv)
@@ -1322,10 +1328,9 @@ llvm::CallInst* ControlFlow::transformToCall(
 		}
 
 		auto* ccf = _config->getConfigFunction(dyn_cast<Function>(called));
-		auto* lti = LtiProvider::getLti(_module);
-		if (lti && ccf && ccf->isDynamicallyLinked())
+		if (_lti && ccf && ccf->isDynamicallyLinked())
 		{
-			auto p = lti->getPairFunctionFree(ccf->getName());
+			auto p = _lti->getPairFunctionFree(ccf->getName());
 			if (p.first && p.second)
 			{
 				auto llvmFnc = p.first;
@@ -1413,12 +1418,7 @@ llvm::CallInst* ControlFlow::transformToCall(
 
 llvm::GlobalVariable* ControlFlow::getReturnObject()
 {
-	static llvm::GlobalVariable* ret = nullptr;
-	if (ret)
-	{
-		return ret;
-	}
-
+	llvm::GlobalVariable* ret = nullptr;
 	if (_config->isMipsOrPic32())
 	{
 		ret = _config->getLlvmRegister("v0");
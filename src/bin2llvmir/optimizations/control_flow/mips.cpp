@@ -134,13 +134,12 @@ bool ControlFlow::runMipsDynamicStubPatter()
 			continue;
 		}
 
-		auto* lti = LtiProvider::getLti(_module);
-		if (lti == nullptr)
+		if (_lti == nullptr)
 		{
 			continue;
 		}
-		if (!(lti->hasLtiFunction(fnc.getName())
-				|| lti->hasLtiFunction(retdec::utils::removeLeadingCharacter(fnc.getName(), '_'))))
+		if (!(_lti->hasLtiFunction(fnc.getName())
+				|| _lti->hasLtiFunction(retdec::utils::removeLeadingCharacter(fnc.getName(), '_'))))
 		{
 			continue;
 		}
@@ -12,6 +12,7 @@
 
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/ctor_dtor/ctor_dtor.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/type.h"
 
@@ -88,7 +89,13 @@ bool CtorDtor::runOnModule(Module& M)
 {
 	module = &M;
 
-	if (!ConfigProvider::getConfig(module, config))
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(module, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
@@ -13,6 +13,7 @@
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/data_references/data_references.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 
 using namespace retdec::llvm_support;
@@ -52,12 +53,18 @@ void DataReferences::getAnalysisUsage(AnalysisUsage &AU) const
 
 bool DataReferences::runOnModule(Module &M)
 {
-	if (!ConfigProvider::getConfig(&M, config))
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(&M, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
 	}
-	if (!FileImageProvider::getFileImage(&M, objf))
+	if (!pc->fileImages.getFileImage(&M, objf))
 	{
 		LOG << "[ABORT] object file is not available\n";
 		return false;
@@ -12,6 +12,8 @@
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
+#include "retdec/bin2llvmir/optimizations/decoder/identical_functions.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -43,9 +45,12 @@ Decoder::Decoder() :
 bool Decoder::runOnModule(Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
-	_image = FileImageProvider::getFileImage(_module);
-	_debug = DebugFormatProvider::getDebugFormat(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_image = pc->fileImages.getFileImage(_module);
+		_debug = pc->debugFormats.getDebugFormat(_module);
+	}
 	return runCatcher();
 }
 
@@ -91,6 +96,10 @@ bool Decoder::run()
 
 	initEnvironment();
 	initRangesAndTargets();
+	// There are no syscall sites when run without a provider context (see
+	// runOnModuleCustom()).
+	auto* pc = ProviderContext::get(*this);
+	_syscalls = pc ? pc->syscallSites.addSyscallSites(_module) : nullptr;
 
 	doStaticCodeRecognition();
 	//TODO - moved after init, because next rewrites SYMBOL_FUNCTION.
@@ -120,6 +129,13 @@ bool Decoder::run()
 
 //dumpModuleToFile(_module);
 
+	// Duplicates would be optimized and emitted over and over again.
+	if (_config->getConfig().parameters.isFoldIdenticalFunctions())
+	{
+		auto folded = IdenticalFunctions(_module, _config, _syscalls).fold();
+		LOG << "\nFolded identical functions: " << folded << std::endl;
+	}
+
 	return true;
 }
 
@@ -184,7 +200,7 @@ void Decoder::removeZeroSequences(retdec::utils::AddressRangeContainer& rs)
 {
 	LOG << "\n" << "removeZeroSequences():" << std::endl;
 
-	static unsigned minSequence = 0x50; // TODO: Maybe should be smaller.
+	const unsigned minSequence = 0x50; // TODO: Maybe should be smaller.
 	retdec::utils::AddressRangeContainer toRemove;
 
 	for (auto& range : rs)
@@ -1321,6 +1337,14 @@ LOG << "===========> SWITCH MODE #2 " << _currentMode << " -> " << jt.mode << st
 	}
 }
 
+		// x87 FPU stack is empty at function entries -> TOP is known there.
+		//
+		auto* c2lX86 = dynamic_cast<Capstone2LlvmIrTranslatorX86*>(_c2l.get());
+		if (c2lX86 && functions.find(start) != functions.end())
+		{
+			c2lX86->setX87TopAtStart(0);
+		}
+
 		auto tRes = _c2l->translate(code, start, irb, true);
 		if (tRes.failed())
 		{
@@ -1352,6 +1376,7 @@ LOG << "===========> SWITCH MODE #2 " << _currentMode << " -> " << jt.mode << st
 		}
 
 		instrMap[tRange.getStart()] = {first, last};
+		recordSyscallSites(first, last);
 
 		lowest = lowest.isUndefined() ? tRange.getStart() : std::min(lowest, tRange.getStart());
 		highest = highest.isUndefined() ? tRange.getEnd() : std::max(highest, tRange.getEnd());
@@ -2617,6 +2642,63 @@ void Decoder::fixMipsDelaySlots()
 	}
 }
 
+/**
+ * Record all syscall instructions between @a first and @a last (inclusive)
+ * into syscall sites, so that later passes do not have to look for them
+ * in the whole module.
+ */
+void Decoder::recordSyscallSites(AsmInstruction first, AsmInstruction last)
+{
+	if (_syscalls == nullptr)
+	{
+		return;
+	}
+
+	for (auto ai = first; ai.isValid(); ai = ai.getNext())
+	{
+		cs_insn* insn = ai.getCapstoneInsn();
+		if (isSyscallInstruction(insn))
+		{
+			_syscalls->addSite(ai.getAddress(), insn->id);
+			LOG << "\t\tsyscall instruction @ " << ai.getAddress() << std::endl;
+		}
+
+		if (ai == last)
+		{
+			break;
+		}
+	}
+}
+
+/**
+ * @return @c True if @a insn is an instruction invoking a system call on the
+ *         decoded architecture, @c false otherwise.
+ */
+bool Decoder::isSyscallInstruction(cs_insn* insn) const
+{
+	if (insn == nullptr)
+	{
+		return false;
+	}
+
+	auto& arch = _config->getConfig().architecture;
+	if (arch.isX86())
+	{
+		return insn->id == X86_INS_INT
+				|| insn->id == X86_INS_SYSCALL
+				|| insn->id == X86_INS_SYSENTER;
+	}
+	else if (arch.isArmOrThumb())
+	{
+		return insn->id == ARM_INS_SVC;
+	}
+	else if (_config->isMipsOrPic32())
+	{
+		return insn->id == MIPS_INS_SYSCALL;
+	}
+	return false;
+}
+
 bool Decoder::isArmOrThumb() const
 {
 	return _config->getConfig().architecture.isArmOrThumb();
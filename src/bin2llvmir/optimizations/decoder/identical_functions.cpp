@@ -0,0 +1,373 @@
+/**
+* @file src/bin2llvmir/optimizations/decoder/identical_functions.cpp
+* @brief Fold identical decoded functions into one canonical function.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <iostream>
+#include <map>
+#include <unordered_map>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Instructions.h>
+
+#include "retdec/bin2llvmir/optimizations/decoder/identical_functions.h"
+#include "retdec/bin2llvmir/utils/defs.h"
+#define debug_enabled false
+
+using namespace llvm;
+using namespace retdec::utils;
+
+namespace {
+
+/**
+ * Tags of fingerprint items, so that e.g. a local value and a constant with
+ * the same number are not mistaken for each other.
+ */
+enum eFingerprintTag : std::uint64_t
+{
+	TAG_BASIC_BLOCK = 0x100000000,
+	TAG_LOCAL,
+	TAG_INSIDE_ADDRESS,
+	TAG_CONSTANT,
+	TAG_OTHER,
+};
+
+std::uint64_t pointerId(const void* p)
+{
+	return reinterpret_cast<std::uintptr_t>(p);
+}
+
+std::size_t hashFingerprint(const std::vector<std::uint64_t>& fp)
+{
+	// FNV-1a over 64-bit items.
+	std::uint64_t h = 0xcbf29ce484222325;
+	for (auto i : fp)
+	{
+		h ^= i;
+		h *= 0x100000001b3;
+	}
+	return static_cast<std::size_t>(h);
+}
+
+/**
+ * @return Constant target address of control flow pseudo call @a c, or
+ * undefined address if target is not constant.
+ */
+Address getConstantTarget(llvm::CallInst* c, unsigned argNo)
+{
+	if (c->getNumArgOperands() <= argNo)
+	{
+		return Address();
+	}
+	auto* ci = dyn_cast<ConstantInt>(c->getArgOperand(argNo));
+	return ci && ci->getBitWidth() <= 64 ? Address(ci->getZExtValue()) : Address();
+}
+
+} // anonymous namespace
+
+namespace retdec {
+namespace bin2llvmir {
+
+IdenticalFunctions::IdenticalFunctions(
+		llvm::Module* m,
+		Config* c,
+		SyscallSites* s) :
+		_module(m),
+		_config(c),
+		_syscalls(s)
+{
+
+}
+
+/**
+ * Fold all identical functions in the module.
+ * @return Number of functions that were replaced by stubs.
+ */
+std::size_t IdenticalFunctions::fold()
+{
+	LOG << "\n IdenticalFunctions::fold():" << std::endl;
+
+	if (_module == nullptr || _config == nullptr)
+	{
+		return 0;
+	}
+
+	findTargetsInsideFunctions();
+
+	// Process functions ordered by their addresses -> the one with the lowest
+	// address becomes canonical.
+	std::map<Address, std::pair<Function*, retdec::config::Function*>> ordered;
+	for (Function& f : _module->getFunctionList())
+	{
+		auto* cf = _config->getConfigFunction(&f);
+		if (cf && canBeFolded(f))
+		{
+			ordered.emplace(cf->getStart(), std::make_pair(&f, cf));
+		}
+	}
+
+	std::size_t folded = 0;
+	std::unordered_map<std::size_t, std::vector<std::pair<Function*, Fingerprint>>> canonicals;
+	for (auto& p : ordered)
+	{
+		Function* f = p.second.first;
+		auto* cf = p.second.second;
+
+		Fingerprint fp = computeFingerprint(*f, *cf);
+		auto& bucket = canonicals[hashFingerprint(fp)];
+
+		Function* canonical = nullptr;
+		for (auto& c : bucket)
+		{
+			if (c.second == fp)
+			{
+				canonical = c.first;
+				break;
+			}
+		}
+
+		if (canonical == nullptr)
+		{
+			bucket.emplace_back(f, std::move(fp));
+			continue;
+		}
+
+		LOG << "\t" << f->getName().str() << " @ " << cf->getStart()
+				<< " -> " << canonical->getName().str() << std::endl;
+
+		replaceWithStub(*f, *canonical);
+		cf->setAliasedFunctionName(canonical->getName());
+		++folded;
+	}
+
+	return folded;
+}
+
+/**
+ * Find functions whose bodies are entered from other functions at some other
+ * address than the function start. Such bodies must be kept.
+ */
+void IdenticalFunctions::findTargetsInsideFunctions()
+{
+	_enteredInside.clear();
+
+	std::map<Address, std::pair<Address, const Function*>> ranges;
+	for (Function& f : _module->getFunctionList())
+	{
+		auto* cf = _config->getConfigFunction(&f);
+		if (cf && cf->getStart().isDefined() && cf->getEnd().isDefined())
+		{
+			ranges.emplace(cf->getStart(), std::make_pair(cf->getEnd(), &f));
+		}
+	}
+
+	for (Function& f : _module->getFunctionList())
+	for (auto& i : instructions(&f))
+	{
+		Address target;
+		if (auto* c = _config->isLlvmCallPseudoFunctionCall(&i))
+		{
+			target = getConstantTarget(c, 0);
+		}
+		else if (auto* c = _config->isLlvmBranchPseudoFunctionCall(&i))
+		{
+			target = getConstantTarget(c, 0);
+		}
+		else if (auto* c = _config->isLlvmCondBranchPseudoFunctionCall(&i))
+		{
+			target = getConstantTarget(c, 1);
+		}
+		if (target.isUndefined())
+		{
+			continue;
+		}
+
+		auto it = ranges.upper_bound(target);
+		if (it == ranges.begin())
+		{
+			continue;
+		}
+		--it;
+		if (target != it->first
+				&& target <= it->second.first
+				&& it->second.second != &f)
+		{
+			_enteredInside.insert(it->second.second);
+		}
+	}
+}
+
+bool IdenticalFunctions::canBeFolded(llvm::Function& f) const
+{
+	if (f.isDeclaration() || _enteredInside.count(&f))
+	{
+		return false;
+	}
+
+	auto* cf = _config->getConfigFunction(&f);
+	return cf
+			&& cf->getStart().isDefined()
+			&& cf->getEnd().isDefined()
+			&& !cf->isDynamicallyLinked()
+			&& !cf->isStaticallyLinked()
+			&& cf->getStart() != _config->getConfig().getEntryPoint();
+}
+
+/**
+ * Compute fingerprint of function @a f with config @a cf. Two functions have
+ * the same fingerprint if and only if they have the same code, modulo
+ * addresses inside the functions themselves.
+ */
+IdenticalFunctions::Fingerprint IdenticalFunctions::computeFingerprint(
+		llvm::Function& f,
+		const retdec::config::Function& cf) const
+{
+	std::unordered_map<const Value*, std::uint64_t> locals;
+	for (auto& a : f.args())
+	{
+		locals.emplace(&a, locals.size());
+	}
+	for (auto& bb : f)
+	{
+		locals.emplace(&bb, locals.size());
+		for (auto& i : bb)
+		{
+			locals.emplace(&i, locals.size());
+		}
+	}
+
+	Fingerprint fp;
+	fp.reserve(locals.size() * 8);
+	fp.push_back(pointerId(f.getFunctionType()));
+	for (auto& bb : f)
+	{
+		fp.push_back(TAG_BASIC_BLOCK);
+		for (auto& i : bb)
+		{
+			fp.push_back(i.getOpcode());
+			fp.push_back(pointerId(i.getType()));
+			fp.push_back(i.getRawSubclassOptionalData());
+			if (auto* cmp = dyn_cast<CmpInst>(&i))
+			{
+				fp.push_back(cmp->getPredicate());
+			}
+			else if (auto* l = dyn_cast<LoadInst>(&i))
+			{
+				fp.push_back(l->isVolatile());
+				fp.push_back(l->getAlignment());
+			}
+			else if (auto* s = dyn_cast<StoreInst>(&i))
+			{
+				fp.push_back(s->isVolatile());
+				fp.push_back(s->getAlignment());
+			}
+
+			fp.push_back(i.getNumOperands());
+			for (auto& op : i.operands())
+			{
+				Value* v = op.get();
+				auto lIt = locals.find(v);
+				if (lIt != locals.end())
+				{
+					fp.push_back(TAG_LOCAL);
+					fp.push_back(lIt->second);
+				}
+				else if (auto* ci = dyn_cast<ConstantInt>(v))
+				{
+					if (ci->getBitWidth() > 64)
+					{
+						// Constants are uniqued in LLVM context.
+						fp.push_back(TAG_OTHER);
+						fp.push_back(pointerId(ci));
+						continue;
+					}
+
+					Address a = ci->getZExtValue();
+					if (cf.contains(a))
+					{
+						fp.push_back(TAG_INSIDE_ADDRESS);
+						fp.push_back(a - cf.getStart());
+					}
+					else
+					{
+						fp.push_back(TAG_CONSTANT);
+						fp.push_back(ci->getZExtValue());
+					}
+					fp.push_back(pointerId(ci->getType()));
+				}
+				else
+				{
+					// Globals and other constants (e.g. registers, pseudo
+					// functions, callees) must be the very same objects.
+					fp.push_back(TAG_OTHER);
+					fp.push_back(pointerId(v));
+				}
+			}
+		}
+	}
+
+	return fp;
+}
+
+/**
+ * Replace body of @a dup by a stub which only calls @a canonical and returns
+ * its result.
+ *
+ * The stub keeps LLVM to ASM mapping of the first instruction of @a dup, so it
+ * is still mapped to the address of @a dup. Syscall sites of the removed body
+ * are removed as well.
+ */
+void IdenticalFunctions::replaceWithStub(
+		llvm::Function& dup,
+		llvm::Function& canonical)
+{
+	StoreInst* firstMapping = nullptr;
+	for (auto& i : instructions(&dup))
+	{
+		if (!_config->isLlvmToAsmInstruction(&i))
+		{
+			continue;
+		}
+
+		auto* s = cast<StoreInst>(&i);
+		if (firstMapping == nullptr)
+		{
+			firstMapping = s;
+		}
+		auto* ci = dyn_cast<ConstantInt>(s->getValueOperand());
+		if (_syscalls && ci)
+		{
+			_syscalls->removeSite(ci->getZExtValue());
+		}
+	}
+	auto* entryMapping = firstMapping ? firstMapping->clone() : nullptr;
+
+	dup.deleteBody();
+
+	auto* bb = BasicBlock::Create(_module->getContext(), "entry", &dup);
+	IRBuilder<> irb(bb);
+	if (entryMapping)
+	{
+		irb.Insert(entryMapping);
+	}
+	std::vector<Value*> args;
+	for (auto& a : dup.args())
+	{
+		args.push_back(&a);
+	}
+	auto* call = irb.CreateCall(&canonical, args);
+	if (dup.getReturnType()->isVoidTy())
+	{
+		irb.CreateRetVoid();
+	}
+	else
+	{
+		irb.CreateRet(call);
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
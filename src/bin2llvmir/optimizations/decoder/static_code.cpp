@@ -7,6 +7,7 @@
 #include <iostream>
 
 #include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/memory.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
 #include "retdec/bin2llvmir/utils/defs.h"
@@ -337,6 +338,12 @@ void Decoder::doStaticCodeRecognition()
 {
 	LOG << "\n doStaticCodeRecognition():" << std::endl;
 
+	if (MemoryBudget::shouldSkipOptionalPhases())
+	{
+		LOG << "\t memory budget does not allow optional phases" << std::endl;
+		return;
+	}
+
 	std::set<std::string> sigPaths = selectSignaturePaths(_image, _config);
 	if (debug_enabled)
 	{
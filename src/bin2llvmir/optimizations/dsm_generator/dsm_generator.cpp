@@ -19,6 +19,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/utils/time.h"
 #include "retdec/bin2llvmir/optimizations/dsm_generator/dsm_generator.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/type.h"
 
@@ -53,8 +54,11 @@ DsmGenerator::DsmGenerator() :
 bool DsmGenerator::runOnModule(Module& m)
 {
 	_module = &m;
-	_objf = FileImageProvider::getFileImage(_module);
-	_config = ConfigProvider::getConfig(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_objf = pc->fileImages.getFileImage(_module);
+		_config = pc->configs.getConfig(_module);
+	}
 	if (_config == nullptr)
 	{
 		LOG << "[ABORT] config file is not available\n";
@@ -282,7 +286,7 @@ void DsmGenerator::generateFunction(
 
 void DsmGenerator::getAsmInstructionHex(AsmInstruction& ai, std::ostream& ret)
 {
-	static std::size_t longestHexa = _longestInst * 3 - 1;
+	const std::size_t longestHexa = _longestInst * 3 - 1;
 	const std::size_t aiHexa = ai.getByteSize() * 3 - 1;
 
 	std::vector<std::uint64_t> bytes;
@@ -18,6 +18,7 @@
 #include "retdec/bin2llvmir/optimizations/globals/dead_global_assign.h"
 #include "retdec/bin2llvmir/optimizations/globals/global_to_local.h"
 #include "retdec/bin2llvmir/optimizations/globals/global_to_local_and_dead_global_assign.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 
 #define DEBUG_TYPE "global-to-local-and-dead-global-assign"
@@ -82,12 +83,13 @@ bool canHaveAddressTaken(GlobalVariable &glob) {
 * 2. Global variable is a pointer.
 * 3. Address of global variable can be taken.
 * 4. Global variable that doesn't have private or internal linkage.
+*
+* Registers from @a config can always be optimized.
 */
-bool globalVarCanBeOptimized(GlobalVariable &glob) {
+bool globalVarCanBeOptimized(GlobalVariable &glob, Config *config) {
 	// TODO: use only this? localize all registers, do not localize anything
 	// else.
 	//
-	auto* config = ConfigProvider::getConfig(glob.getParent());
 	if (config && config->isRegister(&glob)) {
 		return true;
 	}
@@ -125,13 +127,14 @@ bool globalVarCanBeOptimized(GlobalVariable &glob) {
 * @see globVarCanBeOptimized()
 *
 * @param[in] globs Global variables to check.
+* @param[in] config Config of the module with @a globs. May be @c nullptr.
 *
 * @return Global variables that can be optimized.
 */
-GlobVarSet getGlobsToOptimize(Module::GlobalListType &globs) {
+GlobVarSet getGlobsToOptimize(Module::GlobalListType &globs, Config *config) {
 	GlobVarSet globsToOptimize;
 	for (GlobalVariable &glob : globs) {
-		if (globalVarCanBeOptimized(glob)) {
+		if (globalVarCanBeOptimized(glob, config)) {
 			globsToOptimize.insert(&glob);
 		}
 	}
@@ -279,11 +282,14 @@ bool GlobalToLocalAndDeadGlobalAssign::runOnModule(Module &module) {
 	assert(globalToLocal ^ deadGlobalAssign &&
 		"Both -global-to-local and -dead-global-assign cannot run as one optimization.");
 
-	config = ConfigProvider::getConfig(&module);
+	if (auto *pc = ProviderContext::get(*this)) {
+		config = pc->configs.getConfig(&module);
+	}
 
 	addMetadata(module);
 
-	GlobVarSet globsToOptimize(getGlobsToOptimize(module.getGlobalList()));
+	GlobVarSet globsToOptimize(getGlobsToOptimize(module.getGlobalList(),
+		config));
 	if (globsToOptimize.empty()) {
 		// Try to optimize variables without use.
 		removeGlobsWithoutUse(module.getGlobalList());
@@ -331,7 +337,7 @@ void GlobalToLocalAndDeadGlobalAssign::addMetadata(Module &module) {
 */
 void GlobalToLocalAndDeadGlobalAssign::createInfoForAllFuncs(Module &module) {
 	for (auto &item : module) {
-		FuncInfo *funcInfo = new FuncInfo(item, storeLoadAnalysis);
+		FuncInfo *funcInfo = new FuncInfo(item, storeLoadAnalysis, config);
 		funcInfoMap[&item] = funcInfo;
 	}
 }
@@ -674,10 +680,11 @@ GlobalToLocalAndDeadGlobalAssign::FuncInfo &GlobalToLocalAndDeadGlobalAssign::
 *
 * @param[in] func For this function is created info.
 * @param[in] storeLoadAnalysis Analysis for which store can reach some loads.
+* @param[in] config Config of the module with @a func. May be @c nullptr.
 */
 GlobalToLocalAndDeadGlobalAssign::FuncInfo::FuncInfo(Function &func,
-	StoreLoadAnalysis &storeLoadAnalysis): func(func),
-		storeLoadAnalysis(storeLoadAnalysis) {}
+	StoreLoadAnalysis &storeLoadAnalysis, Config *config): func(func),
+		storeLoadAnalysis(storeLoadAnalysis), config(config) {}
 
 /**
 * @brief Destructs a function info;
@@ -1107,7 +1114,7 @@ Value *GlobalToLocalAndDeadGlobalAssign::FuncInfo::getLocVarFor(
 		);
 	}
 	addMappingOfLocalVarToGlobalVarInConfig(
-		ConfigProvider::getConfig(func.getParent()),
+		config,
 		&func,
 		newVarName,
 		globValue.getName()
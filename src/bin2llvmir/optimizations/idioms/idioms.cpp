@@ -14,6 +14,8 @@
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_llvm.h"
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_owatcom.h"
 #include "retdec/bin2llvmir/optimizations/idioms/idioms_vstudio.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "retdec/utils/memory.h"
 
 using namespace llvm;
 
@@ -71,8 +73,13 @@ bool Idioms::doFinalization(Module &M) {
  * @return true if an exchange was made
  */
 bool Idioms::runOnFunction(Function & f) {
+	// Idioms only make the output nicer, so skip them when memory is scarce.
+	if (retdec::utils::MemoryBudget::shouldSkipOptionalPhases())
+		return false;
 
-	m_config = ConfigProvider::getConfig(f.getParent());
+	if (auto *pc = ProviderContext::get(*this)) {
+		m_config = pc->configs.getConfig(f.getParent());
+	}
 
 	if (!m_idioms)
 		m_idioms = getCompilerAnalysis( *f.getParent() );
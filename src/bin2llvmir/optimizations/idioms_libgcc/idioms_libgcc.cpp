@@ -13,9 +13,11 @@
 #include <llvm/IR/Instructions.h>
 
 #include "retdec/llvm-support/utils.h"
+#include "retdec/utils/memory.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/optimizations/idioms_libgcc/idioms_libgcc.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #include "retdec/bin2llvmir/utils/type.h"
@@ -1443,7 +1445,19 @@ bool IdiomsLibgcc::runOnModule(Module& M)
 {
 	_module = &M;
 
-	if (!ConfigProvider::getConfig(_module, _config))
+	if (MemoryBudget::shouldSkipOptionalPhases())
+	{
+		LOG << "[ABORT] memory budget does not allow optional phases\n";
+		return false;
+	}
+
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(_module, _config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
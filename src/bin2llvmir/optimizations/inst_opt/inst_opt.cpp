@@ -20,6 +20,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/inst_opt/inst_opt.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #define debug_enabled false
@@ -50,7 +51,10 @@ InstOpt::InstOpt() :
 bool InstOpt::runOnModule(Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+	}
 	removeInstructionNames();
 	return run();
 }
@@ -156,6 +160,35 @@ bool InstOpt::runGeneralOpts()
 	return changed;
 }
 
+/**
+ * @return Library function @a name if it has the type @a ft. Otherwise, its
+ *         variant @c _<name> of the type @a ft, which is created if it does not
+ *         exist yet. The function is looked up in each call, so that nothing
+ *         is shared between modules.
+ */
+llvm::Function* InstOpt::getLibraryFunction(
+		const std::string& name,
+		llvm::FunctionType* ft)
+{
+	auto* fnc = _module->getFunction(name);
+	if (fnc && fnc->getFunctionType() == ft)
+	{
+		return fnc;
+	}
+
+	fnc = _module->getFunction("_" + name);
+	if (fnc && fnc->getFunctionType() == ft)
+	{
+		return fnc;
+	}
+
+	return Function::Create(
+			ft,
+			GlobalValue::ExternalLinkage,
+			"_" + name,
+			_module);
+}
+
 bool InstOpt::fixX86RepAnalysis()
 {
 	if (_config == nullptr || !_config->getConfig().architecture.isX86())
@@ -206,24 +239,7 @@ bool InstOpt::fixX86RepAnalysis()
 				// types, so it can be used here directly.
 				// TODO: the same for all other functions.
 				//
-				static Function* fnc = nullptr;
-				if (fnc == nullptr)
-				{
-					fnc = _module->getFunction("memset");
-					if (fnc == nullptr || fnc->getFunctionType() != ft)
-					{
-						fnc = Function::Create(
-								ft,
-								GlobalValue::ExternalLinkage,
-								"_memset",
-								_module);
-					}
-				}
-
-				if (fnc == nullptr || fnc->getFunctionType() != ft)
-				{
-					continue;
-				}
+				auto* fnc = getLibraryFunction("memset", ft);
 
 				if (!ai.eraseInstructions())
 				{
@@ -260,24 +276,7 @@ bool InstOpt::fixX86RepAnalysis()
 						params,
 						false);
 
-				static Function* fnc = nullptr;
-				if (fnc == nullptr)
-				{
-					fnc = _module->getFunction("strncmp");
-					if (fnc == nullptr || fnc->getFunctionType() != ft)
-					{
-						fnc = Function::Create(
-								ft,
-								GlobalValue::ExternalLinkage,
-								"_strncmp",
-								_module);
-					}
-				}
-
-				if (fnc == nullptr || fnc->getFunctionType() != ft)
-				{
-					continue;
-				}
+				auto* fnc = getLibraryFunction("strncmp", ft);
 
 				if (!ai.eraseInstructions())
 				{
@@ -321,24 +320,7 @@ bool InstOpt::fixX86RepAnalysis()
 						params,
 						false);
 
-				static Function* fnc = nullptr;
-				if (fnc == nullptr)
-				{
-					fnc = _module->getFunction("memcpy");
-					if (fnc == nullptr || fnc->getFunctionType() != ft)
-					{
-						fnc = Function::Create(
-								ft,
-								GlobalValue::ExternalLinkage,
-								"_memcpy",
-								_module);
-					}
-				}
-
-				if (fnc == nullptr || fnc->getFunctionType() != ft)
-				{
-					continue;
-				}
+				auto* fnc = getLibraryFunction("memcpy", ft);
 
 				if (!ai.eraseInstructions())
 				{
@@ -373,24 +355,7 @@ bool InstOpt::fixX86RepAnalysis()
 						params,
 						false);
 
-				static Function* fnc = nullptr;
-				if (fnc == nullptr)
-				{
-					fnc = _module->getFunction("strlen");
-					if (fnc == nullptr || fnc->getFunctionType() != ft)
-					{
-						fnc = Function::Create(
-								ft,
-								GlobalValue::ExternalLinkage,
-								"_strlen",
-								_module);
-					}
-				}
-
-				if (fnc == nullptr || fnc->getFunctionType() != ft)
-				{
-					continue;
-				}
+				auto* fnc = getLibraryFunction("strlen", ft);
 
 				if (!ai.eraseInstructions())
 				{
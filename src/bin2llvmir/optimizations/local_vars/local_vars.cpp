@@ -14,6 +14,7 @@
 #include "retdec/llvm-support/utils.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/local_vars/local_vars.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 
@@ -52,7 +53,13 @@ void LocalVars::getAnalysisUsage(AnalysisUsage &AU) const
  */
 bool LocalVars::runOnModule(Module& M)
 {
-	if (!ConfigProvider::getConfig(&M, config))
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(&M, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
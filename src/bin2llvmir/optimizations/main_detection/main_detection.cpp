@@ -11,6 +11,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/main_detection/main_detection.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #define debug_enabled false
@@ -41,8 +42,11 @@ MainDetection::MainDetection() :
 bool MainDetection::runOnModule(llvm::Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
-	_image = FileImageProvider::getFileImage(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_image = pc->fileImages.getFileImage(_module);
+	}
 	return run();
 }
 
@@ -11,6 +11,7 @@
 
 #include "retdec/bin2llvmir/optimizations/never_returning_funcs/never_returning_funcs.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 #define OPTIMIZATION_NAME "never-returning-funcs"
 #define DEBUG_TYPE OPTIMIZATION_NAME
@@ -170,7 +171,6 @@ void updatePHINodesIfNeeded(TerminatorInst &termInst) {
 char NeverReturningFuncs::ID = 0;
 
 const char *NeverReturningFuncs::NAME = OPTIMIZATION_NAME;
-StringVecFuncMap NeverReturningFuncs::funcNeverReturnsMap;
 
 RegisterPass<NeverReturningFuncs> NeverReturningFuncsRegistered(
 	NeverReturningFuncs::getName(), "Never-returning-functions optimization",
@@ -194,7 +194,8 @@ void NeverReturningFuncs::visitCallInst(CallInst &callInst) {
 * @brief Initiates the optimization before analyzing the function.
 */
 void NeverReturningFuncs::initBeforeRun() {
-	auto* c = ConfigProvider::getConfig(module);
+	auto* pc = ProviderContext::get(*this);
+	auto* c = pc ? pc->configs.getConfig(module) : nullptr;
 	if (c)
 	{
 		c->getConfig().parameters.completedFrontendPasses.insert(getName());
@@ -311,6 +312,7 @@ void NeverReturningFuncs::deinitFuncNeverReturnsMap() {
 			delete func;
 		}
 	}
+	funcNeverReturnsMap.clear();
 }
 
 bool NeverReturningFuncs::doInitialization(llvm::Module &module) {
@@ -31,6 +31,7 @@
 #include "retdec/utils/container.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/param_return/param_return.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -45,13 +46,11 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
-llvm::Value* getRoot(ReachingDefinitionsAnalysis& RDA, llvm::Value* i, bool first = true)
+llvm::Value* getRoot(
+		ReachingDefinitionsAnalysis& RDA,
+		llvm::Value* i,
+		std::set<llvm::Value*>& seen)
 {
-	static std::set<llvm::Value*> seen;
-	if (first)
-	{
-		seen.clear();
-	}
 	if (seen.count(i))
 	{
 		return i;
@@ -68,7 +67,7 @@ llvm::Value* getRoot(ReachingDefinitionsAnalysis& RDA, llvm::Value* i, bool firs
 				auto* d = (*u->defs.begin())->def;
 				if (auto* s = dyn_cast<StoreInst>(d))
 				{
-					return getRoot(RDA, s->getValueOperand(), false);
+					return getRoot(RDA, s->getValueOperand(), seen);
 				}
 				else
 				{
@@ -77,7 +76,7 @@ llvm::Value* getRoot(ReachingDefinitionsAnalysis& RDA, llvm::Value* i, bool firs
 			}
 			else if (auto* l = dyn_cast<LoadInst>(ii))
 			{
-				return getRoot(RDA, l->getPointerOperand(), false);
+				return getRoot(RDA, l->getPointerOperand(), seen);
 			}
 			else
 			{
@@ -86,7 +85,7 @@ llvm::Value* getRoot(ReachingDefinitionsAnalysis& RDA, llvm::Value* i, bool firs
 		}
 		else if (auto* l = dyn_cast<LoadInst>(ii))
 		{
-			return getRoot(RDA, l->getPointerOperand(), false);
+			return getRoot(RDA, l->getPointerOperand(), seen);
 		}
 		else
 		{
@@ -97,6 +96,12 @@ llvm::Value* getRoot(ReachingDefinitionsAnalysis& RDA, llvm::Value* i, bool firs
 	return i;
 }
 
+llvm::Value* getRoot(ReachingDefinitionsAnalysis& RDA, llvm::Value* i)
+{
+	std::set<llvm::Value*> seen;
+	return getRoot(RDA, i, seen);
+}
+
 //
 //=============================================================================
 //  ParamReturn
@@ -121,10 +126,13 @@ ParamReturn::ParamReturn() :
 bool ParamReturn::runOnModule(Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
-	_image = FileImageProvider::getFileImage(_module);
-	_dbgf = DebugFormatProvider::getDebugFormat(_module);
-	_lti = LtiProvider::getLti(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_image = pc->fileImages.getFileImage(_module);
+		_dbgf = pc->debugFormats.getDebugFormat(_module);
+		_lti = pc->ltis.getLti(_module);
+	}
 	return run();
 }
 
@@ -291,7 +299,7 @@ bool registerCanBeParameterAccordingToAbi(Config* _config, llvm::Value* val)
 	}
 	else if (_config->getConfig().architecture.isPpc())
 	{
-		static std::set<std::string> names = {"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
+		static const std::set<std::string> names = {"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
 		if (names.find(val->getName()) == names.end())
 		{
 			return false;
@@ -299,7 +307,7 @@ bool registerCanBeParameterAccordingToAbi(Config* _config, llvm::Value* val)
 	}
 	else if (_config->getConfig().architecture.isArmOrThumb())
 	{
-		static std::set<std::string> names = {"r0", "r1", "r2", "r3"};
+		static const std::set<std::string> names = {"r0", "r1", "r2", "r3"};
 		if (names.find(val->getName()) == names.end())
 		{
 			return false;
@@ -307,7 +315,7 @@ bool registerCanBeParameterAccordingToAbi(Config* _config, llvm::Value* val)
 	}
 	else if (_config->getConfig().architecture.isMipsOrPic32())
 	{
-		static std::set<std::string> names = {"a0", "a1", "a2", "a3"};
+		static const std::set<std::string> names = {"a0", "a1", "a2", "a3"};
 		if (names.find(val->getName()) == names.end())
 		{
 			return false;
@@ -1044,7 +1052,7 @@ void DataFlowEntry::filter()
 	{
 		if (_config->getConfig().architecture.isArmOrThumb())
 		{
-			static std::vector<std::string> armNames =
+			static const std::vector<std::string> armNames =
 					{"r0", "r1", "r2", "r3"};
 
 			for (CallEntry& e : calls)
@@ -1121,29 +1129,26 @@ void DataFlowEntry::callsFilterCommonRegisters()
 	// If common contains r3, then it should also contain r2, r1, and r0.
 	// Example for MIPS: if contains a2, it should a1 and a0.
 	//
-	static std::vector<std::string> regNames;
-	if (regNames.empty())
+	std::vector<std::string> regNames;
+	if (_config->isMipsOrPic32())
 	{
-		if (_config->isMipsOrPic32())
-		{
-			if (_config->getConfig().tools.isPspGcc())
-			{
-				regNames = {"a0", "a1", "a2", "a3", "t0", "t1", "t2", "t3"};
-			}
-			else
-			{
-				regNames = {"a0", "a1", "a2", "a3"};
-			}
-		}
-		else if (_config->getConfig().architecture.isArmOrThumb())
+		if (_config->getConfig().tools.isPspGcc())
 		{
-			regNames = {"r0", "r1", "r2", "r3"};
+			regNames = {"a0", "a1", "a2", "a3", "t0", "t1", "t2", "t3"};
 		}
-		else if (_config->getConfig().architecture.isPpc())
+		else
 		{
-			regNames = {"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
+			regNames = {"a0", "a1", "a2", "a3"};
 		}
 	}
+	else if (_config->getConfig().architecture.isArmOrThumb())
+	{
+		regNames = {"r0", "r1", "r2", "r3"};
+	}
+	else if (_config->getConfig().architecture.isPpc())
+	{
+		regNames = {"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
+	}
 	for (auto it = regNames.rbegin(); it != regNames.rend(); ++it)
 	{
 		auto* r = _config->getLlvmRegister(*it);
@@ -1339,11 +1344,11 @@ void DataFlowEntry::applyToIrOrdinary()
 			argStores.push_back(l->getPointerOperand());
 		}
 
-		static std::vector<std::string> ppcNames =
+		static const std::vector<std::string> ppcNames =
 				{"r3", "r4", "r5", "r6", "r7", "r8", "r9"};
-		static std::vector<std::string> armNames =
+		static const std::vector<std::string> armNames =
 				{"r0", "r1", "r2", "r3"};
-		static std::vector<std::string> mipsNames =
+		std::vector<std::string> mipsNames =
 				{"a0", "a1", "a2", "a3"};
 		if (_config->getConfig().tools.isPspGcc())
 		{
@@ -1477,7 +1482,7 @@ void DataFlowEntry::applyToIrOrdinary()
 			}
 
 			auto* ret = fnc ? fnc->getReturnType() : call->getType();
-			modifyCallInst(call, ret, loads);
+			modifyCallInst(call, ret, loads, _config);
 		}
 	}
 }
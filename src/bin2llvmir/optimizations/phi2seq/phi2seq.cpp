@@ -12,6 +12,7 @@
 
 #include "retdec/bin2llvmir/optimizations/phi2seq/phi2seq.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace llvm;
 
@@ -52,7 +53,8 @@ void PHI2Seq::getAnalysisUsage(AnalysisUsage& au) const {
 }
 
 bool PHI2Seq::runOnFunction(Function &func) {
-	auto* c = ConfigProvider::getConfig(func.getParent());
+	auto* pc = ProviderContext::get(*this);
+	auto* c = pc ? pc->configs.getConfig(func.getParent()) : nullptr;
 	if (c)
 	{
 		c->getConfig().parameters.completedFrontendPasses.insert(getName());
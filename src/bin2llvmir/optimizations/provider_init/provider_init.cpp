@@ -10,13 +10,7 @@
 
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
-#include "retdec/bin2llvmir/providers/abi.h"
-#include "retdec/bin2llvmir/providers/asm_instruction.h"
-#include "retdec/bin2llvmir/providers/config.h"
-#include "retdec/bin2llvmir/providers/debugformat.h"
-#include "retdec/bin2llvmir/providers/demangler.h"
-#include "retdec/bin2llvmir/providers/fileimage.h"
-#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 
@@ -50,32 +44,35 @@ ProviderInitialization::ProviderInitialization() :
 }
 
 /**
+ * Initialize providers in the pass manager's @c ProviderContext when it is run
+ * for the first time. Nothing is done if there is no context.
  * @return Always @c false -- this pass does not modify module.
  */
 bool ProviderInitialization::runOnModule(Module& m)
 {
-	static bool firstRun = true;
+	auto* pc = ProviderContext::get(*this);
 	std::string confPath = ConfigPath;
-	if (firstRun && !confPath.empty())
+	if (pc && !pc->providersInitialized && !confPath.empty())
 	{
 		LOG << "first run" << std::endl;
 
-		auto* c = ConfigProvider::addConfigFile(&m, confPath);
+		auto* c = pc->configs.addConfigFile(&m, confPath);
 		assert(c);
 		if (c == nullptr)
 		{
 			return false;
 		}
 
-		auto* d = DemanglerProvider::addDemangler(
+		auto* d = pc->demanglers.addDemangler(
 				&m,
 				c->getConfig().tools);
 		if (d == nullptr)
 		{
 			return false;
 		}
+		c->setDemangler(d);
 
-		auto* f = FileImageProvider::addFileImage(
+		auto* f = pc->fileImages.addFileImage(
 				&m,
 				c->getConfig().getInputFile(),
 				c);
@@ -84,21 +81,19 @@ bool ProviderInitialization::runOnModule(Module& m)
 			return false;
 		}
 
-		DebugFormatProvider::addDebugFormat(
+		pc->debugFormats.addDebugFormat(
 				&m,
 				f->getImage(),
 				c->getConfig().getPdbInputFile(),
 				c->getConfig().getImageBase(),
 				d);
 
-		LtiProvider::addLti(
+		pc->ltis.addLti(
 				&m,
 				c,
 				f->getImage());
 
-		AsmInstruction::clear();
-
-		firstRun = false;
+		pc->providersInitialized = true;
 	}
 	else
 	{
@@ -113,7 +108,10 @@ bool ProviderInitialization::runOnModule(Module& m)
  */
 bool ProviderInitialization::doFinalization(Module& m)
 {
-	ConfigProvider::doFinalization(&m);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		pc->configs.doFinalization(&m);
+	}
 	return false;
 }
 
@@ -11,6 +11,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/register/register.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -65,7 +66,10 @@ RegisterAnalysis::RegisterAnalysis() :
 bool RegisterAnalysis::runOnModule(llvm::Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+	}
 	return run();
 }
 
@@ -131,9 +135,13 @@ bool getTopVal(
 	{
 		return getTopVal(top, topVal, cast<BinaryOperator>(val)->getOperand(0), ai);
 	}
+	// Constant TOP (e.g. set by FNINIT, or TOP values the decoder resolved
+	// at translation time) -- convert it to the relative value used here:
+	// 0 -> 0, 7 -> -1, 6 -> -2, ...
 	else if (auto* ci = dyn_cast<ConstantInt>(val))
 	{
-		topVal = ci->getZExtValue();
+		int tmp = ci->getZExtValue() & 7;
+		topVal = tmp ? tmp - 8 : 0;
 	}
 	// add i3 top, -4
 	// may be optimized into:
@@ -154,8 +162,8 @@ bool getTopVal(
 	}
 	else
 	{
-		LOG << "\t\t" << ai.getAddress() << std::endl;
-		assert(false && "some other pattern");
+		// Some other pattern -- the pseudo call is kept as it is.
+		LOG << "\t\t" << ai.getAddress() << " @ unknown pattern" << std::endl;
 		return false;
 	}
 
@@ -13,6 +13,7 @@
 
 #include "retdec/utils/container.h"
 #include "retdec/bin2llvmir/optimizations/select_functions/select_functions.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -40,7 +41,10 @@ SelectFunctions::SelectFunctions() :
 
 bool SelectFunctions::runOnModule(Module& M)
 {
-	_config = ConfigProvider::getConfig(&M);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(&M);
+	}
 	return run(M);
 }
 
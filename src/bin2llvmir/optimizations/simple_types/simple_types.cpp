@@ -22,6 +22,7 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/optimizations/simple_types/simple_types.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #include "retdec/bin2llvmir/utils/type.h"
@@ -71,12 +72,18 @@ void SimpleTypesAnalysis::getAnalysisUsage(AnalysisUsage& AU) const
 
 bool SimpleTypesAnalysis::runOnModule(Module& M)
 {
-	if (!ConfigProvider::getConfig(&M, config))
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(&M, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
 	}
-	if (!FileImageProvider::getFileImage(&M, objf))
+	if (!pc->fileImages.getFileImage(&M, objf))
 	{
 		LOG << "[ABORT] object file is not available\n";
 		return false;
@@ -84,9 +91,7 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	module = &M;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(module);
 
-	static bool first = true;
-
-	if (first)
+	if (!pc->simpleTypesRun)
 	{
 		RDA.runOnModule(M, config);
 		buildEqSets(M);
@@ -95,7 +100,7 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 		eqSets.apply(module, config, objf, instToErase);
 		eraseObsoleteInstructions();
 		setGlobalConstants();
-		first = false;
+		pc->simpleTypesRun = true;
 		RDA.clear();
 	}
 	else
@@ -761,7 +766,7 @@ std::ostream& operator<<(std::ostream& out, const EqSetContainer& eqs)
 //=============================================================================
 //
 
-unsigned EqSet::newUID = 0;
+std::atomic<unsigned> EqSet::newUID(0);
 
 EqSet::EqSet() :
 		id(newUID++)
@@ -1227,7 +1232,7 @@ void EqSet::apply(
 
 	LOG << "\napply BEGIN " << id << " =============================\n";
 
-	static auto &conf = config->getConfig();
+	auto &conf = config->getConfig();
 
 	for (auto& vs : valSet)
 	{
@@ -15,6 +15,7 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/optimizations/stack/stack.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #define debug_enabled false
 #include "retdec/llvm-support/utils.h"
@@ -44,8 +45,11 @@ StackAnalysis::StackAnalysis() :
 bool StackAnalysis::runOnModule(llvm::Module& m)
 {
 	_module = &m;
-	_config = ConfigProvider::getConfig(_module);
-	_dbgf = DebugFormatProvider::getDebugFormat(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_dbgf = pc->debugFormats.getDebugFormat(_module);
+	}
 	return run();
 }
 
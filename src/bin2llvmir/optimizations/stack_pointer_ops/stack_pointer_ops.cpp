@@ -15,6 +15,7 @@
 #include "retdec/llvm-support/utils.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/stack_pointer_ops/stack_pointer_ops.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 
 using namespace retdec::llvm_support;
@@ -44,7 +45,10 @@ StackPointerOpsRemove::StackPointerOpsRemove() :
 bool StackPointerOpsRemove::runOnModule(Module& M)
 {
 	_module = &M;
-	_config = ConfigProvider::getConfig(&M);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(&M);
+	}
 	return run();
 }
 
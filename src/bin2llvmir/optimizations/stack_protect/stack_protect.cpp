@@ -17,6 +17,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/stack_protect/stack_protect.h"
 #include "retdec/llvm-support/utils.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/type.h"
 
 using namespace retdec::llvm_support;
@@ -28,8 +29,6 @@ namespace bin2llvmir {
 
 char StackProtect::ID = 0;
 
-std::map<llvm::Type*, llvm::Function*> StackProtect::_type2fnc;
-
 static RegisterPass<StackProtect> X(
 		"stack-protect",
 		"Stack protection optimization",
@@ -46,7 +45,11 @@ StackProtect::StackProtect() :
 bool StackProtect::runOnModule(Module& M)
 {
 	_module = &M;
-	_config = ConfigProvider::getConfig(&M);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(&M);
+		_type2fnc = &pc->stackProtectors;
+	}
 	return run();
 }
 
@@ -70,7 +73,7 @@ bool StackProtect::run()
 
 	bool changed = false;
 
-	if (!_type2fnc.empty())
+	if (!_type2fnc->empty())
 	{
 		changed |= unprotectStack(nullptr);
 	}
@@ -108,8 +111,8 @@ bool StackProtect::protectStack()
 		Function* fnc = nullptr;
 
 		auto* t = a->getAllocatedType();
-		auto fIt = _type2fnc.find(t);
-		if (fIt != _type2fnc.end())
+		auto fIt = _type2fnc->find(t);
+		if (fIt != _type2fnc->end())
 		{
 			fnc = fIt->second;
 		}
@@ -121,10 +124,10 @@ bool StackProtect::protectStack()
 			fnc = Function::Create(
 					ft,
 					GlobalValue::ExternalLinkage,
-					_fncName + std::to_string(_type2fnc.size()),
+					_fncName + std::to_string(_type2fnc->size()),
 					_module);
 
-			_type2fnc[t] = fnc;
+			(*_type2fnc)[t] = fnc;
 		}
 
 		auto* c = CallInst::Create(fnc);
@@ -155,8 +158,8 @@ bool StackProtect::protectStack()
 				Function* fnc = nullptr;
 
 				auto* t = gv.getValueType();
-				auto fIt = _type2fnc.find(t);
-				if (fIt != _type2fnc.end())
+				auto fIt = _type2fnc->find(t);
+				if (fIt != _type2fnc->end())
 				{
 					fnc = fIt->second;
 				}
@@ -168,10 +171,10 @@ bool StackProtect::protectStack()
 					fnc = Function::Create(
 							ft,
 							GlobalValue::ExternalLinkage,
-							_fncName + std::to_string(_type2fnc.size()),
+							_fncName + std::to_string(_type2fnc->size()),
 							_module);
 
-					_type2fnc[t] = fnc;
+					(*_type2fnc)[t] = fnc;
 				}
 
 				auto it = inst_begin(&F);
@@ -193,7 +196,7 @@ bool StackProtect::protectStack()
 
 bool StackProtect::unprotectStack(llvm::Function* f)
 {
-	for (auto& p : _type2fnc)
+	for (auto& p : *_type2fnc)
 	{
 		std::set<Instruction*> toEraseUse;
 		std::set<Instruction*> toErase;
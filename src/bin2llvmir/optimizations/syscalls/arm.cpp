@@ -417,130 +417,122 @@ namespace bin2llvmir {
  */
 bool SyscallFixer::runArm()
 {
-	for (auto& F : _module->getFunctionList())
+	for (auto& ai : getSyscallInstructions(ARM_INS_SVC))
 	{
-		auto ai = AsmInstruction(&F);
-		for (; ai.isValid(); ai = ai.getNext())
-		{
-			if (ai.getCapstoneInsn()->id != ARM_INS_SVC)
-			{
-				continue;
-			}
-			LOG << "ARM syscall @ " << ai.getAddress() << std::endl;
+		LOG << "ARM syscall @ " << ai.getAddress() << std::endl;
 
-			uint64_t code = 0;
-			bool res = false;
-			if (_image->getImage()->isLittleEndian())
+		uint64_t code = 0;
+		bool res = false;
+		if (_image->getImage()->isLittleEndian())
+		{
+			if (ai.getByteSize() == 2)
 			{
-				if (ai.getByteSize() == 2)
-				{
-					res = _image->getImage()->get1Byte(ai.getAddress(), code);
-				}
-				else
-				{
-					res = _image->getImage()->get2Byte(ai.getAddress(), code);
-				}
+				res = _image->getImage()->get1Byte(ai.getAddress(), code);
 			}
 			else
 			{
-				if (ai.getByteSize() == 2)
-				{
-					res = _image->getImage()->get1Byte(ai.getAddress()+1, code);
-				}
-				else
-				{
-					res = _image->getImage()->get2Byte(ai.getAddress()+2, code);
-				}
-			}
-
-			if (!res)
-			{
-				continue;
+				res = _image->getImage()->get2Byte(ai.getAddress(), code);
 			}
-
-			LOG << "\tcode = " << std::dec << code << std::endl;
-
-			std::string callName;
-			auto fit = armSyscalls.find(code);
-			if (fit != armSyscalls.end())
+		}
+		else
+		{
+			if (ai.getByteSize() == 2)
 			{
-				callName = fit->second;
-				LOG << "\tfound in syscall map: " << callName << std::endl;
+				res = _image->getImage()->get1Byte(ai.getAddress()+1, code);
 			}
 			else
 			{
-				callName = "syscall_" + std::to_string(code);
-				LOG << "\tnot in syscall map, using: " << callName << std::endl;
+				res = _image->getImage()->get2Byte(ai.getAddress()+2, code);
 			}
+		}
+
+		if (!res)
+		{
+			continue;
+		}
 
-			auto* lf = _module->getFunction(callName);
+		LOG << "\tcode = " << std::dec << code << std::endl;
+
+		std::string callName;
+		auto fit = armSyscalls.find(code);
+		if (fit != armSyscalls.end())
+		{
+			callName = fit->second;
+			LOG << "\tfound in syscall map: " << callName << std::endl;
+		}
+		else
+		{
+			callName = "syscall_" + std::to_string(code);
+			LOG << "\tnot in syscall map, using: " << callName << std::endl;
+		}
+
+		auto* lf = _module->getFunction(callName);
+		if (lf)
+		{
+			LOG << "\thave function in LLVM IR" << std::endl;
+		}
+		else
+		{
+			LOG << "\tno function in LLVM IR" << std::endl;
+
+			lf = _lti->getLlvmFunction(callName);
 			if (lf)
 			{
-				LOG << "\thave function in LLVM IR" << std::endl;
+				LOG << "\tfunction in LTI: " << llvmObjToString(lf) << std::endl;
 			}
 			else
 			{
-				LOG << "\tno function in LLVM IR" << std::endl;
-
-				lf = _lti->getLlvmFunction(callName);
-				if (lf)
-				{
-					LOG << "\tfunction in LTI: " << llvmObjToString(lf) << std::endl;
-				}
-				else
-				{
-					LOG << "\tno function in LTI" << std::endl;
-				}
+				LOG << "\tno function in LTI" << std::endl;
 			}
+		}
 
-			ai.eraseInstructions();
+		ai.eraseInstructions();
 
-			if (lf == nullptr)
-			{
-				continue;
-			}
+		if (lf == nullptr)
+		{
+			continue;
+		}
 
-			auto* cf = _config->getConfigFunction(lf);
-			cf->setIsSyscall();
+		auto* cf = _config->getConfigFunction(lf);
+		cf->setIsSyscall();
 
-			auto* next = ai.getLlvmToAsmInstruction()->getNextNode();
-			assert(next);
+		auto* next = ai.getLlvmToAsmInstruction()->getNextNode();
+		assert(next);
 
-			std::vector<std::string> armNames = {"r0", "r1", "r2", "r3"};
+		std::vector<std::string> armNames = {"r0", "r1", "r2", "r3"};
 
-			auto rIt = armNames.begin();
-			std::vector<Value*> args;
-			for (auto& a : lf->args())
+		auto rIt = armNames.begin();
+		std::vector<Value*> args;
+		for (auto& a : lf->args())
+		{
+			if (rIt != armNames.end())
 			{
-				if (rIt != armNames.end())
-				{
-					auto* r = _module->getNamedGlobal(*rIt);
-					assert(r);
-					auto* l = new LoadInst(r, "", next);
-					args.push_back(convertValueToType(l, a.getType(), next));
-					++rIt;
-				}
-				else
-				{
-					auto* ci = ConstantInt::get(getDefaultType(_module), 0);
-					args.push_back(convertConstantToType(ci, a.getType()));
-				}
+				auto* r = _module->getNamedGlobal(*rIt);
+				assert(r);
+				auto* l = new LoadInst(r, "", next);
+				args.push_back(convertValueToType(l, a.getType(), next));
+				++rIt;
 			}
-			auto* call = CallInst::Create(lf, args, "", next);
-			LOG << "\t===> " << llvmObjToString(call) << std::endl;
-
-			if (!lf->getReturnType()->isVoidTy())
+			else
 			{
-				auto* r = _module->getNamedGlobal("r0");
-				assert(r);
-				auto* conv = convertValueToType(
-						call,
-						r->getType()->getElementType(),
-						next);
-				auto* s = new StoreInst(conv, r, next);
-				LOG << "\t===> " << llvmObjToString(s) << std::endl;
+				auto* ci = ConstantInt::get(getDefaultType(_module), 0);
+				args.push_back(convertConstantToType(ci, a.getType()));
 			}
 		}
+		auto* call = CallInst::Create(lf, args, "", next);
+		LOG << "\t===> " << llvmObjToString(call) << std::endl;
+
+		if (!lf->getReturnType()->isVoidTy())
+		{
+			auto* r = _module->getNamedGlobal("r0");
+			assert(r);
+			auto* conv = convertValueToType(
+					call,
+					r->getType()->getElementType(),
+					next);
+			auto* s = new StoreInst(conv, r, next);
+			LOG << "\t===> " << llvmObjToString(s) << std::endl;
+		}
 	}
 
 	return false;
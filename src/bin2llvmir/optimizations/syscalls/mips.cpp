@@ -250,121 +250,113 @@ namespace bin2llvmir {
  */
 bool SyscallFixer::runMips()
 {
-	for (auto& F : _module->getFunctionList())
+	for (auto& ai : getSyscallInstructions(MIPS_INS_SYSCALL))
 	{
-		auto ai = AsmInstruction(&F);
-		for (; ai.isValid(); ai = ai.getNext())
-		{
-			if (ai.getCapstoneInsn()->id != MIPS_INS_SYSCALL)
-			{
-				continue;
-			}
-			LOG << "MIPS syscall @ " << ai.getAddress() << std::endl;
+		LOG << "MIPS syscall @ " << ai.getAddress() << std::endl;
 
-			StoreInst* code = nullptr;
-			Instruction* it = ai.getLlvmToAsmInstruction()->getPrevNode();
-			for (; it != nullptr; it = it->getPrevNode())
+		StoreInst* code = nullptr;
+		Instruction* it = ai.getLlvmToAsmInstruction()->getPrevNode();
+		for (; it != nullptr; it = it->getPrevNode())
+		{
+			if (auto* s = dyn_cast<StoreInst>(it))
 			{
-				if (auto* s = dyn_cast<StoreInst>(it))
+				auto* r = s->getPointerOperand();
+				if (_config->isRegister(r) && r->getName() == "v0")
 				{
-					auto* r = s->getPointerOperand();
-					if (_config->isRegister(r) && r->getName() == "v0")
-					{
-						code = s;
-						break;
-					}
+					code = s;
+					break;
 				}
 			}
+		}
 
-			if (code == nullptr || !isa<ConstantInt>(code->getValueOperand()))
-			{
-				LOG << "\tsyscall code not found" << std::endl;
-				continue;
-			}
-			auto* ci = cast<ConstantInt>(code->getValueOperand());
-			LOG << "\tcode instruction: " << llvmObjToString(code) << std::endl;
-			LOG << "\tcode: " << std::dec << ci->getZExtValue() << std::endl;
+		if (code == nullptr || !isa<ConstantInt>(code->getValueOperand()))
+		{
+			LOG << "\tsyscall code not found" << std::endl;
+			continue;
+		}
+		auto* ci = cast<ConstantInt>(code->getValueOperand());
+		LOG << "\tcode instruction: " << llvmObjToString(code) << std::endl;
+		LOG << "\tcode: " << std::dec << ci->getZExtValue() << std::endl;
 
-			std::string callName;
-			auto fit = mipsSyscalls.find(ci->getZExtValue());
-			if (fit != mipsSyscalls.end())
-			{
-				callName = fit->second;
-				LOG << "\tfound in syscall map: " << callName << std::endl;
-			}
-			else
-			{
-				callName = "syscall_" + std::to_string(ci->getZExtValue());
-				LOG << "\tnot in syscall map, using: " << callName << std::endl;
-			}
+		std::string callName;
+		auto fit = mipsSyscalls.find(ci->getZExtValue());
+		if (fit != mipsSyscalls.end())
+		{
+			callName = fit->second;
+			LOG << "\tfound in syscall map: " << callName << std::endl;
+		}
+		else
+		{
+			callName = "syscall_" + std::to_string(ci->getZExtValue());
+			LOG << "\tnot in syscall map, using: " << callName << std::endl;
+		}
+
+		auto* lf = _module->getFunction(callName);
+		if (lf)
+		{
+			LOG << "\thave function in LLVM IR" << std::endl;
+		}
+		else
+		{
+			LOG << "\tno function in LLVM IR" << std::endl;
 
-			auto* lf = _module->getFunction(callName);
+			lf = _lti->getLlvmFunction(callName);
 			if (lf)
 			{
-				LOG << "\thave function in LLVM IR" << std::endl;
+				LOG << "\tfunction in LTI: " << llvmObjToString(lf) << std::endl;
 			}
 			else
 			{
-				LOG << "\tno function in LLVM IR" << std::endl;
-
-				lf = _lti->getLlvmFunction(callName);
-				if (lf)
-				{
-					LOG << "\tfunction in LTI: " << llvmObjToString(lf) << std::endl;
-				}
-				else
-				{
-					LOG << "\tno function in LTI" << std::endl;
-				}
+				LOG << "\tno function in LTI" << std::endl;
 			}
+		}
 
-			ai.eraseInstructions();
+		ai.eraseInstructions();
 
-			if (lf == nullptr)
-			{
-				continue;
-			}
+		if (lf == nullptr)
+		{
+			continue;
+		}
 
-			auto* cf = _config->getConfigFunction(lf);
-			cf->setIsSyscall();
+		auto* cf = _config->getConfigFunction(lf);
+		cf->setIsSyscall();
 
-			auto* next = ai.getLlvmToAsmInstruction()->getNextNode();
-			assert(next);
-			std::vector<std::string> mipsNames = {"a0", "a1", "a2", "a3"};
+		auto* next = ai.getLlvmToAsmInstruction()->getNextNode();
+		assert(next);
+		std::vector<std::string> mipsNames = {"a0", "a1", "a2", "a3"};
 
-			auto rIt = mipsNames.begin();
-			std::vector<Value*> args;
-			for (auto& a : lf->args())
+		auto rIt = mipsNames.begin();
+		std::vector<Value*> args;
+		for (auto& a : lf->args())
+		{
+			if (rIt != mipsNames.end())
 			{
-				if (rIt != mipsNames.end())
-				{
-					auto* r = _module->getNamedGlobal(*rIt);
-					assert(r);
-					auto* l = new LoadInst(r, "", next);
-					args.push_back(convertValueToType(l, a.getType(), next));
-					++rIt;
-				}
-				else
-				{
-					auto* ci = ConstantInt::get(getDefaultType(_module), 0);
-					args.push_back(convertConstantToType(ci, a.getType()));
-				}
+				auto* r = _module->getNamedGlobal(*rIt);
+				assert(r);
+				auto* l = new LoadInst(r, "", next);
+				args.push_back(convertValueToType(l, a.getType(), next));
+				++rIt;
 			}
-			auto* call = CallInst::Create(lf, args, "", next);
-			LOG << "\t===> " << llvmObjToString(call) << std::endl;
-
-			if (!lf->getReturnType()->isVoidTy())
+			else
 			{
-				auto* r = _module->getNamedGlobal("v0");
-				assert(r);
-				auto* conv = convertValueToType(
-						call,
-						r->getType()->getElementType(),
-						next);
-				auto* s = new StoreInst(conv, r, next);
-				LOG << "\t===> " << llvmObjToString(s) << std::endl;
+				auto* ci = ConstantInt::get(getDefaultType(_module), 0);
+				args.push_back(convertConstantToType(ci, a.getType()));
 			}
 		}
+		auto* call = CallInst::Create(lf, args, "", next);
+		LOG << "\t===> " << llvmObjToString(call) << std::endl;
+
+		if (!lf->getReturnType()->isVoidTy())
+		{
+			auto* r = _module->getNamedGlobal("v0");
+			assert(r);
+			auto* conv = convertValueToType(
+					call,
+					r->getType()->getElementType(),
+					next);
+			auto* s = new StoreInst(conv, r, next);
+			LOG << "\t===> " << llvmObjToString(s) << std::endl;
+		}
 	}
 
 	return false;
@@ -6,6 +6,8 @@
 
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/syscalls/syscalls.h"
+#include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace retdec::llvm_support;
 using namespace llvm;
@@ -31,9 +33,13 @@ SyscallFixer::SyscallFixer() :
 bool SyscallFixer::runOnModule(llvm::Module& M)
 {
 	_module = &M;
-	_config = ConfigProvider::getConfig(_module);
-	_image = FileImageProvider::getFileImage(_module);
-	_lti = LtiProvider::getLti(_module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_config = pc->configs.getConfig(_module);
+		_image = pc->fileImages.getFileImage(_module);
+		_lti = pc->ltis.getLti(_module);
+		_sites = pc->syscallSites.getSyscallSites(_module);
+	}
 	return run();
 }
 
@@ -41,12 +47,14 @@ bool SyscallFixer::runOnModuleCustom(
 		llvm::Module& M,
 		Config* c,
 		FileImage* img,
-		Lti* lti)
+		Lti* lti,
+		SyscallSites* sites)
 {
 	_module = &M;
 	_config = c;
 	_image = img;
 	_lti = lti;
+	_sites = sites;
 	return run();
 }
 
@@ -75,5 +83,48 @@ bool SyscallFixer::run()
 	}
 }
 
+/**
+ * Get all instructions with Capstone ID @a insnId in the module.
+ *
+ * If the decoder recorded syscall sites, only these sites are checked.
+ * Otherwise, all instructions in all functions are searched.
+ */
+std::vector<AsmInstruction> SyscallFixer::getSyscallInstructions(
+		unsigned insnId)
+{
+	std::vector<AsmInstruction> ret;
+
+	if (_sites)
+	{
+		for (auto& p : _sites->getSites())
+		{
+			if (p.second != insnId)
+			{
+				continue;
+			}
+
+			AsmInstruction ai(_module, p.first);
+			if (ai.isValid() && ai.getCapstoneInsn()->id == insnId)
+			{
+				ret.push_back(ai);
+			}
+		}
+		return ret;
+	}
+
+	for (auto& F : _module->getFunctionList())
+	{
+		auto ai = AsmInstruction(&F);
+		for (; ai.isValid(); ai = ai.getNext())
+		{
+			if (ai.getCapstoneInsn()->id == insnId)
+			{
+				ret.push_back(ai);
+			}
+		}
+	}
+	return ret;
+}
+
 } // namespace bin2llvmir
 } // namespace retdec
@@ -443,7 +443,7 @@ bool SyscallFixer::x86TransformToDummySyscall(AsmInstruction& ai)
 
 	auto* aType = Type::getInt32Ty(_module->getContext());
 	std::string dummyName = "int80_syscall";
-	static Function* lf = nullptr;
+	auto* lf = _module->getFunction(dummyName);
 	if (lf == nullptr)
 	{
 		std::vector<Type*> params = {aType};
@@ -485,130 +485,120 @@ bool SyscallFixer::x86TransformToDummySyscall(AsmInstruction& ai)
 
 bool SyscallFixer::runX86()
 {
-	for (auto& F : _module->getFunctionList())
+	for (auto& ai : getSyscallInstructions(X86_INS_INT))
 	{
-		auto ai = AsmInstruction(&F);
-		for (; ai.isValid(); ai = ai.getNext())
+		uint64_t intCode = 0;
+		if (!_image->getImage()->get1Byte(ai.getAddress()+1, intCode) || intCode != 0x80)
 		{
-			cs_insn* capstoneI = ai.getCapstoneInsn();
-			if (capstoneI->id != X86_INS_INT)
-			{
-				continue;
-			}
-
-			uint64_t intCode = 0;
-			if (!_image->getImage()->get1Byte(ai.getAddress()+1, intCode) || intCode != 0x80)
-			{
-				continue;
-			}
-			LOG << "x86 syscall @ " << ai.getAddress() << ", code = " << std::hex << intCode << std::endl;
+			continue;
+		}
+		LOG << "x86 syscall @ " << ai.getAddress() << ", code = " << std::hex << intCode << std::endl;
 
-			StoreInst* eaxStore = nullptr;
-			Instruction* it = ai.getLlvmToAsmInstruction()->getPrevNode();
-			for (; it != nullptr; it = it->getPrevNode())
+		StoreInst* eaxStore = nullptr;
+		Instruction* it = ai.getLlvmToAsmInstruction()->getPrevNode();
+		for (; it != nullptr; it = it->getPrevNode())
+		{
+			if (auto* s = dyn_cast<StoreInst>(it))
 			{
-				if (auto* s = dyn_cast<StoreInst>(it))
+				auto* r = s->getPointerOperand();
+				if (_config->isRegister(r) && r->getName() == "eax")
 				{
-					auto* r = s->getPointerOperand();
-					if (_config->isRegister(r) && r->getName() == "eax")
-					{
-						eaxStore = s;
-						break;
-					}
+					eaxStore = s;
+					break;
 				}
 			}
+		}
 
-			if (eaxStore == nullptr || !isa<ConstantInt>(eaxStore->getValueOperand()))
-			{
-				x86TransformToDummySyscall(ai);
-				continue;
-			}
+		if (eaxStore == nullptr || !isa<ConstantInt>(eaxStore->getValueOperand()))
+		{
+			x86TransformToDummySyscall(ai);
+			continue;
+		}
 
-			auto* ci = cast<ConstantInt>(eaxStore->getValueOperand());
-			LOG << "\teax store    : " << llvmObjToString(eaxStore) << std::endl;
-			LOG << "\tsyscall code : " << std::dec << ci->getZExtValue() << std::endl;
+		auto* ci = cast<ConstantInt>(eaxStore->getValueOperand());
+		LOG << "\teax store    : " << llvmObjToString(eaxStore) << std::endl;
+		LOG << "\tsyscall code : " << std::dec << ci->getZExtValue() << std::endl;
 
-			std::string callName;
-			auto fit = x86Syscalls.find(ci->getZExtValue());
-			if (fit == x86Syscalls.end())
-			{
-				x86TransformToDummySyscall(ai);
-				continue;
-			}
-			else
-			{
-				callName = fit->second;
-				LOG << "\tsyscall name : " << callName << std::endl;
-			}
+		std::string callName;
+		auto fit = x86Syscalls.find(ci->getZExtValue());
+		if (fit == x86Syscalls.end())
+		{
+			x86TransformToDummySyscall(ai);
+			continue;
+		}
+		else
+		{
+			callName = fit->second;
+			LOG << "\tsyscall name : " << callName << std::endl;
+		}
+
+		auto* lf = _module->getFunction(callName);
+		if (lf)
+		{
+			LOG << "\thave function in LLVM IR" << std::endl;
+		}
+		else
+		{
+			LOG << "\tno function in LLVM IR" << std::endl;
 
-			auto* lf = _module->getFunction(callName);
+			lf = _lti->getLlvmFunction(callName);
 			if (lf)
 			{
-				LOG << "\thave function in LLVM IR" << std::endl;
+				LOG << "\tfunction in LTI: " << llvmObjToString(lf) << std::endl;
 			}
 			else
 			{
-				LOG << "\tno function in LLVM IR" << std::endl;
-
-				lf = _lti->getLlvmFunction(callName);
-				if (lf)
-				{
-					LOG << "\tfunction in LTI: " << llvmObjToString(lf) << std::endl;
-				}
-				else
-				{
-					LOG << "\tno function in LTI" << std::endl;
-				}
+				LOG << "\tno function in LTI" << std::endl;
 			}
+		}
 
-			ai.eraseInstructions();
+		ai.eraseInstructions();
 
-			if (lf == nullptr)
-			{
-				x86TransformToDummySyscall(ai);
-				continue;
-			}
+		if (lf == nullptr)
+		{
+			x86TransformToDummySyscall(ai);
+			continue;
+		}
 
-			auto* cf = _config->getConfigFunction(lf);
-			cf->setIsSyscall();
+		auto* cf = _config->getConfigFunction(lf);
+		cf->setIsSyscall();
 
-			auto* next = ai.getLlvmToAsmInstruction()->getNextNode();
-			assert(next);
-			std::vector<std::string> x86Names = {"ebx", "ecx", "edx", "esi", "edi", "ebp"};
+		auto* next = ai.getLlvmToAsmInstruction()->getNextNode();
+		assert(next);
+		std::vector<std::string> x86Names = {"ebx", "ecx", "edx", "esi", "edi", "ebp"};
 
-			auto rIt = x86Names.begin();
-			std::vector<Value*> args;
-			for (auto& a : lf->args())
+		auto rIt = x86Names.begin();
+		std::vector<Value*> args;
+		for (auto& a : lf->args())
+		{
+			if (rIt != x86Names.end())
 			{
-				if (rIt != x86Names.end())
-				{
-					auto* r = _module->getNamedGlobal(*rIt);
-					assert(r);
-					auto* l = new LoadInst(r, "", next);
-					args.push_back(convertValueToType(l, a.getType(), next));
-					++rIt;
-				}
-				else
-				{
-					auto* ci = ConstantInt::get(getDefaultType(_module), 0);
-					args.push_back(convertConstantToType(ci, a.getType()));
-				}
+				auto* r = _module->getNamedGlobal(*rIt);
+				assert(r);
+				auto* l = new LoadInst(r, "", next);
+				args.push_back(convertValueToType(l, a.getType(), next));
+				++rIt;
 			}
-			auto* call = CallInst::Create(lf, args, "", next);
-			LOG << "\t===> " << llvmObjToString(call) << std::endl;
-
-			if (!lf->getReturnType()->isVoidTy())
+			else
 			{
-				auto* r = _module->getNamedGlobal("eax");
-				assert(r);
-				auto* conv = convertValueToType(
-						call,
-						r->getType()->getElementType(),
-						next);
-				auto* s = new StoreInst(conv, r, next);
-				LOG << "\t===> " << llvmObjToString(s) << std::endl;
+				auto* ci = ConstantInt::get(getDefaultType(_module), 0);
+				args.push_back(convertConstantToType(ci, a.getType()));
 			}
 		}
+		auto* call = CallInst::Create(lf, args, "", next);
+		LOG << "\t===> " << llvmObjToString(call) << std::endl;
+
+		if (!lf->getReturnType()->isVoidTy())
+		{
+			auto* r = _module->getNamedGlobal("eax");
+			assert(r);
+			auto* conv = convertValueToType(
+					call,
+					r->getType()->getElementType(),
+					next);
+			auto* s = new StoreInst(conv, r, next);
+			LOG << "\t===> " << llvmObjToString(s) << std::endl;
+		}
 	}
 
 	return false;
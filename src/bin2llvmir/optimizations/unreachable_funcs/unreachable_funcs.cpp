@@ -15,6 +15,7 @@
 #include "retdec/utils/container.h"
 #include "retdec/bin2llvmir/analyses/reachable_funcs_analysis.h"
 #include "retdec/bin2llvmir/optimizations/unreachable_funcs/unreachable_funcs.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 
 #define OPTIMIZATION_NAME "unreachable-funcs"
@@ -111,7 +112,10 @@ void UnreachableFuncs::getAnalysisUsage(AnalysisUsage &au) const {
 }
 
 bool UnreachableFuncs::runOnModule(Module &module) {
-	config = ConfigProvider::getConfig(&module);
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		config = pc->configs.getConfig(&module);
+	}
 	if (config)
 	{
 		config->getConfig().parameters.completedFrontendPasses.insert(getName());
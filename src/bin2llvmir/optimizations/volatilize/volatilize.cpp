@@ -23,8 +23,6 @@ namespace retdec {
 namespace bin2llvmir {
 
 char Volatilize::ID = 0;
-bool Volatilize::_doVolatilization = true;
-UnorderedValSet Volatilize::_alreadyVolatile;
 
 static RegisterPass<Volatilize> X(
 		"volatilize",
@@ -45,8 +43,13 @@ Volatilize::Volatilize() :
  */
 bool Volatilize::runOnModule(Module& M)
 {
+	if (auto* pc = ProviderContext::get(*this))
+	{
+		_state = &pc->volatilize;
+	}
+
 	bool changed = false;
-	if (_doVolatilization)
+	if (_state->doVolatilization)
 	{
 		changed |= volatilize(M);
 	}
@@ -63,7 +66,7 @@ bool Volatilize::volatilize(Module& M)
 	LOG << "\n*** Volatilize::volatilize()" << std::endl;
 
 	bool changed = false;
-	_alreadyVolatile.clear();
+	_state->alreadyVolatile.clear();
 
 	for (auto& F : M.getFunctionList())
 	for (auto& B : F)
@@ -73,7 +76,7 @@ bool Volatilize::volatilize(Module& M)
 		{
 			if (l->isVolatile())
 			{
-				_alreadyVolatile.insert(l);
+				_state->alreadyVolatile.insert(l);
 				LOG << "\t[ALREADY VOL]: " << llvmObjToString(l) << std::endl;
 			}
 			else
@@ -87,7 +90,7 @@ bool Volatilize::volatilize(Module& M)
 		{
 			if (s->isVolatile())
 			{
-				_alreadyVolatile.insert(s);
+				_state->alreadyVolatile.insert(s);
 				LOG << "\t[ALREADY VOL]: " << llvmObjToString(s) << std::endl;
 			}
 			else
@@ -99,7 +102,7 @@ bool Volatilize::volatilize(Module& M)
 		}
 	}
 
-	_doVolatilization = false;
+	_state->doVolatilization = false;
 	return changed;
 }
 
@@ -115,7 +118,7 @@ bool Volatilize::unvolatilize(Module& M)
 	{
 		if (LoadInst* l = dyn_cast<LoadInst>(&I))
 		{
-			if (_alreadyVolatile.count(l))
+			if (_state->alreadyVolatile.count(l))
 			{
 				LOG << "\t[ALREADY VOL ]: " << llvmObjToString(l) << std::endl;
 			}
@@ -128,7 +131,7 @@ bool Volatilize::unvolatilize(Module& M)
 		}
 		else if (StoreInst* s = dyn_cast<StoreInst>(&I))
 		{
-			if (_alreadyVolatile.count(s))
+			if (_state->alreadyVolatile.count(s))
 			{
 				LOG << "\t[ALREADY VOL ]: " << llvmObjToString(s) << std::endl;
 			}
@@ -141,7 +144,7 @@ bool Volatilize::unvolatilize(Module& M)
 		}
 	}
 
-	_doVolatilization = true;
+	_state->doVolatilization = true;
 	return changed;
 }
 
@@ -17,6 +17,7 @@
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/optimizations/vtable/vtable.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/defs.h"
 #include "retdec/bin2llvmir/utils/type.h"
 
@@ -65,12 +66,18 @@ void VtableAnalysis::getAnalysisUsage(AnalysisUsage &AU) const
 
 bool VtableAnalysis::runOnModule(Module &M)
 {
-	if (!ConfigProvider::getConfig(&M, config))
+	auto* pc = ProviderContext::get(*this);
+	if (pc == nullptr)
+	{
+		LOG << "[ABORT] provider context is not available\n";
+		return false;
+	}
+	if (!pc->configs.getConfig(&M, config))
 	{
 		LOG << "[ABORT] config file is not available\n";
 		return false;
 	}
-	if (!FileImageProvider::getFileImage(&M, objf))
+	if (!pc->fileImages.getFileImage(&M, objf))
 	{
 		LOG << "[ABORT] object file is not available\n";
 		return false;
@@ -633,8 +633,6 @@ bool ModuleAbis::getAbi(retdec::config::CallingConvention cc, Abi*& abi)
 //=============================================================================
 //
 
-std::map<llvm::Module*, ModuleAbis> AbiProvider::_module2abis;
-
 ModuleAbis* AbiProvider::addAbis(
 		llvm::Module* module,
 		const retdec::config::Architecture& arch,
@@ -11,6 +11,7 @@
 #include "retdec/utils/container.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/type.h"
 
 using namespace retdec::llvm_support;
@@ -19,8 +20,6 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
-std::vector<std::pair<const llvm::Module*, const llvm::GlobalVariable*>> AsmInstruction::_cache;
-
 AsmInstruction::AsmInstruction()
 {
 
@@ -33,8 +32,9 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 		return;
 	}
 
+	auto* gv = getLlvmToAsmGlobalVariable(inst->getModule());
 	auto* bb = inst->getParent();
-	while (inst && !isLlvmToAsmInstructionPrivate(inst))
+	while (inst && !isLlvmToAsmInstruction(inst, gv))
 	{
 		if (&bb->front() == inst)
 		{
@@ -55,7 +55,7 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 	}
 
 	auto* s = dyn_cast_or_null<StoreInst>(inst);
-	_llvmToAsmInstr = isLlvmToAsmInstructionPrivate(s) ? s : nullptr;
+	_llvmToAsmInstr = isLlvmToAsmInstruction(s, gv) ? s : nullptr;
 }
 
 AsmInstruction::AsmInstruction(llvm::BasicBlock* bb)
@@ -75,10 +75,11 @@ AsmInstruction::AsmInstruction(llvm::Function* f)
 		return;
 	}
 
+	auto* gv = getLlvmToAsmGlobalVariable(f->getParent());
 	for (auto it = inst_begin(f), e = inst_end(f); it != e; ++it)
 	{
 		Instruction* i = &(*it);
-		if (isLlvmToAsmInstructionPrivate(i))
+		if (isLlvmToAsmInstruction(i, gv))
 		{
 			_llvmToAsmInstr = dyn_cast_or_null<StoreInst>(i);
 			return;
@@ -102,9 +103,10 @@ AsmInstruction::AsmInstruction(llvm::Module* m, retdec::utils::Address addr)
 		return;
 	}
 
+	auto* gv = getLlvmToAsmGlobalVariable(m);
 	for (auto* u : ci->users())
 	{
-		if (isLlvmToAsmInstructionPrivate(u))
+		if (isLlvmToAsmInstruction(u, gv))
 		{
 			_llvmToAsmInstr = dyn_cast_or_null<StoreInst>(u);
 			return;
@@ -168,19 +170,15 @@ AsmInstruction::const_reverse_iterator AsmInstruction::rend() const
 	return const_reverse_iterator(begin());
 }
 
-const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariablePrivate(
-		llvm::Module* m) const
-{
-	if (_llvmToAsmInstr)
-	{
-		return cast<GlobalVariable>(_llvmToAsmInstr->getPointerOperand());
-	}
-	else
-	{
-		return getLlvmToAsmGlobalVariable(m);
-	}
-}
-
+/**
+ * @return Global variable stores to which mark ASM instructions in the given
+ *         module @a m, or @c nullptr if there is no such variable.
+ *
+ * The variable is cached per module in the active @c ProviderContext, so it
+ * is looked up in the module's metadata only once per decompilation. It is
+ * not cached if it does not exist yet (it is created by the decoder) and it
+ * is looked up on each call if there is no active context.
+ */
 const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
 		const llvm::Module* m)
 {
@@ -188,13 +186,32 @@ const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
 	{
 		return nullptr;
 	}
-	for (auto& p : _cache)
+
+	auto* pc = ProviderContext::getActive();
+	if (pc)
 	{
-		if (p.first == m)
+		auto fIt = pc->llvmToAsmGlobals.find(m);
+		if (fIt != pc->llvmToAsmGlobals.end())
 		{
-			return p.second;
+			return fIt->second;
 		}
 	}
+
+	auto* gv = findLlvmToAsmGlobalVariable(m);
+	if (pc && gv)
+	{
+		pc->llvmToAsmGlobals[m] = gv;
+	}
+	return gv;
+}
+
+/**
+ * @return Global variable stores to which mark ASM instructions in the given
+ *         module @a m, looked up in the module's metadata.
+ */
+const llvm::GlobalVariable* AsmInstruction::findLlvmToAsmGlobalVariable(
+		const llvm::Module* m)
+{
 	auto* nmd = m->getNamedMetadata("llvmToAsmGlobalVariableName");
 	if (nmd == nullptr || nmd->getNumOperands() != 1)
 	{
@@ -208,9 +225,7 @@ const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
 		return nullptr;
 	}
 	auto* ms = cast<MDString>(md->getOperand(0));
-	auto* gv = m->getNamedGlobal(ms->getString());
-	_cache.push_back(std::make_pair(m, gv));
-	return gv;
+	return m->getNamedGlobal(ms->getString());
 }
 
 retdec::utils::Address AsmInstruction::getInstructionAddress(
@@ -225,17 +240,6 @@ retdec::utils::Address AsmInstruction::getInstructionAddress(
 	return ret;
 }
 
-bool AsmInstruction::isLlvmToAsmInstructionPrivate(llvm::Value* inst) const
-{
-	auto* s = dyn_cast_or_null<StoreInst>(inst);
-	if (s == nullptr)
-	{
-		return false;
-	}
-	auto* m = s->getModule();
-	return s->getPointerOperand() == getLlvmToAsmGlobalVariablePrivate(m);
-}
-
 bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 {
 	auto* s = dyn_cast_or_null<StoreInst>(inst);
@@ -243,13 +247,19 @@ bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 	{
 		return false;
 	}
-	auto* m = s->getModule();
-	return s->getPointerOperand() == getLlvmToAsmGlobalVariable(m);
+	return isLlvmToAsmInstruction(s, getLlvmToAsmGlobalVariable(s->getModule()));
 }
 
-void AsmInstruction::clear()
+/**
+ * @return @c True if @a inst is a store to the given LLVM to ASM global
+ *         variable @a gv, @c false otherwise.
+ */
+bool AsmInstruction::isLlvmToAsmInstruction(
+		const llvm::Value* inst,
+		const llvm::GlobalVariable* gv)
 {
-	_cache.clear();
+	auto* s = dyn_cast_or_null<StoreInst>(inst);
+	return s && gv && s->getPointerOperand() == gv;
 }
 
 bool AsmInstruction::isValid() const
@@ -374,8 +384,9 @@ AsmInstruction AsmInstruction::getNext() const
 	}
 
 	Instruction* i = _llvmToAsmInstr;
+	auto* gv = cast<GlobalVariable>(_llvmToAsmInstr->getPointerOperand());
 	auto* bb = i->getParent();
-	while (i && (i == _llvmToAsmInstr || !isLlvmToAsmInstructionPrivate(i)))
+	while (i && (i == _llvmToAsmInstr || !isLlvmToAsmInstruction(i, gv)))
 	{
 		if (&bb->back() == i)
 		{
@@ -410,8 +421,9 @@ AsmInstruction AsmInstruction::getPrev() const
 	}
 
 	Instruction* i = _llvmToAsmInstr;
+	auto* gv = cast<GlobalVariable>(_llvmToAsmInstr->getPointerOperand());
 	auto* bb = i->getParent();
-	while (i && (i == _llvmToAsmInstr || !isLlvmToAsmInstructionPrivate(i)))
+	while (i && (i == _llvmToAsmInstr || !isLlvmToAsmInstruction(i, gv)))
 	{
 		if (&bb->front() == i)
 		{
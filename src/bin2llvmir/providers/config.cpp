@@ -12,7 +12,6 @@
 #include "retdec/llvm-support/utils.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
-#include "retdec/bin2llvmir/providers/demangler.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #include "retdec/bin2llvmir/utils/type.h"
 
@@ -102,7 +101,8 @@ retdec::utils::Address Config::getFunctionAddress(
 retdec::config::Function* Config::getConfigFunction(
 		const llvm::Function* fnc)
 {
-	return fnc ? _configDB.functions.getFunctionByName(fnc->getName()) : nullptr;
+	auto* info = getValueInfo(fnc);
+	return info ? info->function : nullptr;
 }
 
 retdec::config::Function* Config::getConfigFunction(
@@ -114,7 +114,8 @@ retdec::config::Function* Config::getConfigFunction(
 const retdec::config::Object* Config::getConfigGlobalVariable(
 		const llvm::GlobalVariable* gv)
 {
-	return gv ? _configDB.globals.getObjectByName(gv->getName()) : nullptr;
+	auto* info = getValueInfo(gv);
+	return info ? info->global : nullptr;
 }
 
 const retdec::config::Object* Config::getConfigGlobalVariable(
@@ -156,86 +157,72 @@ retdec::utils::Address Config::getGlobalAddress(
 		const llvm::GlobalVariable* gv)
 {
 	assert(gv);
-	auto* cgv = gv ? _configDB.globals.getObjectByName(gv->getName()) : nullptr;
+	auto* cgv = getConfigGlobalVariable(gv);
 	return cgv ? cgv->getStorage().getAddress() : retdec::utils::Address();
 }
 
 bool Config::isGlobalVariable(const llvm::Value* val)
 {
-	auto* gv = dyn_cast<GlobalVariable>(val);
-	return getConfigGlobalVariable(gv) != nullptr;
+	auto* info = getValueInfo(val);
+	return info && info->global;
 }
 
 const retdec::config::Object* Config::getConfigLocalVariable(
 		const llvm::Value* val)
 {
-	auto* a = dyn_cast_or_null<AllocaInst>(val);
-	if (a == nullptr)
-	{
-		return nullptr;
-	}
-	auto* cf = getConfigFunction(a->getFunction());
-	if (cf == nullptr)
-	{
-		return nullptr;
-	}
-	auto* cl = cf->locals.getObjectByName(a->getName());
+	auto* info = getValueInfo(val);
+	auto* cl = info ? info->local : nullptr;
 	return cl && cl->getStorage().isUndefined() ? cl : nullptr;
 }
 
 retdec::config::Object* Config::getConfigStackVariable(
 		const llvm::Value* val)
 {
-	auto* a = dyn_cast_or_null<AllocaInst>(val);
-	if (a == nullptr)
-	{
-		return nullptr;
-	}
-	auto* cf = getConfigFunction(a->getFunction());
-	if (cf == nullptr)
-	{
-		return nullptr;
-	}
+	auto* info = getValueInfo(val);
 	auto* cl = const_cast<retdec::config::Object*>(
-			cf->locals.getObjectByName(a->getName()));
+			info ? info->local : nullptr);
 	return cl && cl->getStorage().isStack() ? cl : nullptr;
 }
 
 /**
  * @return LLVM alloca instruction for stack variable with offset @a offset in
  *         function @a fnc. @c nullptr if such variable does not exist.
+ *
+ * If there are more such variables, the one with the lowest name is returned.
  */
 llvm::AllocaInst* Config::getLlvmStackVariable(
 		llvm::Function* fnc,
 		int offset)
 {
-	auto* cf = getConfigFunction(fnc);
-	if (cf == nullptr)
+	auto* info = getValueInfo(fnc);
+	if (info == nullptr || info->function == nullptr)
 	{
 		return nullptr;
 	}
 
-	for (auto& p: cf->locals)
+	if (info->stackVariablesStamp != info->function->locals.getStamp())
 	{
-		auto& l = p.second;
-		int off = 0;
-		if (l.getStorage().isStack(off) && off == offset)
-		{
-			for (auto& b : *fnc)
-			for (auto& i : b)
-			{
-				if (AllocaInst* a = dyn_cast<AllocaInst>(&i))
-				{
-					if (a->getName() == l.getName())
-					{
-						return a;
-					}
-				}
-			}
-		}
+		indexStackVariables(fnc, *info);
+	}
+	auto it = info->stackVariables.find(offset);
+	if (it == info->stackVariables.end())
+	{
+		return nullptr;
 	}
 
-	return nullptr;
+	// The alloca might have been deleted or renamed since it was indexed.
+	// Deleted values have no classifications.
+	auto* a = it->second;
+	if (_valueInfos.infos.count(a) == 0
+			|| a->getFunction() != fnc
+			|| getStackVariableOffset(a).isUndefined()
+			|| getStackVariableOffset(a).getValue() != offset)
+	{
+		indexStackVariables(fnc, *info);
+		it = info->stackVariables.find(offset);
+		a = it != info->stackVariables.end() ? it->second : nullptr;
+	}
+	return a;
 }
 
 /**
@@ -329,10 +316,9 @@ retdec::config::Function* Config::insertFunction(
 
 	if (cf.getDemangledName().empty())
 	{
-		retdec::demangler::CDemangler* d = DemanglerProvider::getDemangler(_module);
-		if (d)
+		if (_demangler)
 		{
-			auto s = d->demangleToString(fnc->getName());
+			auto s = _demangler->demangleToString(fnc->getName());
 			if (!s.empty())
 			{
 				cf.setDemangledName(s);
@@ -353,10 +339,9 @@ retdec::config::Function* Config::renameFunction(
 
 	if (cf.getDemangledName().empty())
 	{
-		retdec::demangler::CDemangler* d = DemanglerProvider::getDemangler(_module);
-		if (d)
+		if (_demangler)
 		{
-			auto s = d->demangleToString(fnc->getName());
+			auto s = _demangler->demangleToString(fnc->getName());
 			if (!s.empty())
 			{
 				cf.setDemangledName(s);
@@ -372,8 +357,8 @@ retdec::config::Function* Config::renameFunction(
 const retdec::config::Object* Config::getConfigRegister(
 		const llvm::Value* val)
 {
-	auto* gv = dyn_cast_or_null<GlobalVariable>(val);
-	return gv ? _configDB.registers.getObjectByName(gv->getName()) : nullptr;
+	auto* info = getValueInfo(val);
+	return info ? info->reg : nullptr;
 }
 
 retdec::utils::Maybe<unsigned> Config::getConfigRegisterNumber(
@@ -412,93 +397,26 @@ bool Config::isRegister(const llvm::Value* val)
  */
 bool Config::isFlagRegister(const llvm::Value* val)
 {
-	return isRegister(val) && isBoolType(val->getType()->getPointerElementType());
+	auto* info = getValueInfo(val);
+	return info && info->isFlagRegister;
 }
 
-/**
- * TODO: Right now this is based on name comparisons with known stack
- * pointer register names. We should use info from ABI or config instead.
- */
 bool Config::isStackPointerRegister(const llvm::Value* val)
 {
-	if (!isRegister(val))
-	{
-		return false;
-	}
-
-	auto& arch = getConfig().architecture;
-
-	std::string n = val->getName();
-	return n == "esp"
-			|| (n == "r1" && arch.isPpc())
-			|| n == "sp"
-			|| n == "rsp";
+	auto* info = getValueInfo(val);
+	return info && info->isStackPointerRegister;
 }
 
 bool Config::isGeneralPurposeRegister(const llvm::Value* val)
 {
-	auto* r = getConfigRegister(val);
-	if (r == nullptr)
-	{
-		return false;
-	}
-	if (isPic32() || getConfig().architecture.isMips())
-	{
-		// TODO
-//		return r->getStorage().getRegisterClass() == "gpregs";
-		auto rn = r->getStorage().getRegisterNumber();
-		return MIPS_REG_0 <= rn && rn <= MIPS_REG_31;
-	}
-	else if (getConfig().architecture.isArmOrThumb())
-	{
-		// TODO
-//		return r->getStorage().getRegisterClass() == "regs";
-		auto rn = r->getStorage().getRegisterNumber();
-		return ARM_REG_R0 <= rn && rn <= ARM_REG_R12;
-	}
-	else if (getConfig().architecture.isPpc())
-	{
-		// TODO
-//		return r->getStorage().getRegisterClass() == "gpregs";
-		auto rn = r->getStorage().getRegisterNumber();
-		return PPC_REG_R0 <= rn && rn <= PPC_REG_R31;
-	}
-	else if (getConfig().architecture.isX86())
-	{
-		// TODO: this whole thif is bad
-//		return r->getStorage().getRegisterClass() == "gpr";
-		auto n = r->getName();
-		return n == "eax" || n == "ebx" || n == "ecx" || n == "edx"
-				|| n == "esp" || n == "ebp" || n == "esi" || n == "edi";
-	}
-	else
-	{
-		return false;
-	}
+	auto* info = getValueInfo(val);
+	return info && info->isGeneralPurposeRegister;
 }
 
-/**
- * TODO: bad, fix/remove.
- */
 bool Config::isFloatingPointRegister(const llvm::Value* val)
 {
-	auto* gv = dyn_cast_or_null<GlobalVariable>(val);
-	auto* r = getConfigRegister(val);
-	if (r == nullptr || gv == nullptr)
-	{
-		return false;
-	}
-
-	if (isMipsOrPic32())
-	{
-		return gv->getValueType()->isFloatingPointTy();
-//		return r->getStorage().getRegisterClass() == "fpuregs_s"
-//				|| r->getStorage().getRegisterClass() == "fpuregs_d";
-	}
-	else
-	{
-		return false;
-	}
+	auto* info = getValueInfo(val);
+	return info && info->isFloatingPointRegister;
 }
 
 /**
@@ -572,6 +490,20 @@ llvm::GlobalVariable* Config::getGlobalDummy()
 	return _globalDummy;
 }
 
+retdec::demangler::CDemangler* Config::getDemangler() const
+{
+	return _demangler;
+}
+
+/**
+ * Set demangler used to get demangled names of inserted and renamed functions.
+ * There is no demangling if it is not set.
+ */
+void Config::setDemangler(retdec::demangler::CDemangler* d)
+{
+	_demangler = d;
+}
+
 void Config::setLlvmCallPseudoFunction(llvm::Function* f)
 {
 	_callFunction = f;
@@ -663,11 +595,224 @@ llvm::CallInst* Config::isLlvmAnyUncondBranchPseudoFunctionCall(llvm::Value* c)
 
 //
 //=============================================================================
-//  ConfigProvider
+//  Config - value classification
 //=============================================================================
 //
 
-std::map<llvm::Module*, Config> ConfigProvider::_module2config;
+Config::ValueInfo::ValueInfo(const llvm::Value* val, ValueInfoMap* infos) :
+		CallbackVH(const_cast<llvm::Value*>(val)),
+		_infos(infos)
+{
+
+}
+
+/**
+ * Removes the classification of the deleted value. It destroys this object.
+ */
+void Config::ValueInfo::deleted()
+{
+	_infos->erase(getValPtr());
+}
+
+Config::ValueInfoCache& Config::ValueInfoCache::operator=(
+		const ValueInfoCache&)
+{
+	infos.clear();
+	return *this;
+}
+
+/**
+ * @return Up-to-date classification of value @a val, or @c nullptr if @a val
+ *         is not a global variable, alloca, or function, i.e. it can not be
+ *         any object in the config.
+ *
+ * Classifications are cached, so this is a single hash lookup for values that
+ * have already been classified (and whose classification is still valid).
+ */
+Config::ValueInfo* Config::getValueInfo(const llvm::Value* val)
+{
+	if (val == nullptr
+			|| !(isa<GlobalVariable>(val)
+			|| isa<AllocaInst>(val)
+			|| isa<Function>(val)))
+	{
+		return nullptr;
+	}
+
+	auto& infos = _valueInfos.infos;
+	auto it = infos.find(val);
+	if (it == infos.end())
+	{
+		it = infos.emplace(
+				std::piecewise_construct,
+				std::forward_as_tuple(val),
+				std::forward_as_tuple(val, &infos)).first;
+	}
+	else if (isUpToDate(it->second, val))
+	{
+		return &it->second;
+	}
+
+	// References to elements of unordered maps stay valid even if other values
+	// get classified during the classification of this one.
+	classify(val, it->second);
+	return &it->second;
+}
+
+/**
+ * @return @c True if classification @a info of value @a val is still valid,
+ *         @c false otherwise.
+ */
+bool Config::isUpToDate(const ValueInfo& info, const llvm::Value* val)
+{
+	if (val->getName() != info.name)
+	{
+		return false;
+	}
+
+	if (isa<GlobalVariable>(val))
+	{
+		return info.stamp == _configDB.registers.getStamp()
+				+ _configDB.globals.getStamp();
+	}
+	else if (auto* a = dyn_cast<AllocaInst>(val))
+	{
+		// The function itself might have been renamed or its config function
+		// replaced, so it is checked through its own classification.
+		auto* cf = getConfigFunction(a->getFunction());
+		return cf == info.function
+				&& (cf == nullptr || info.localsStamp == cf->locals.getStamp());
+	}
+	else
+	{
+		return info.stamp == _configDB.functions.getStamp();
+	}
+}
+
+void Config::classify(const llvm::Value* val, ValueInfo& info)
+{
+	info.name = val->getName().str();
+	info.stamp = 0;
+	info.localsStamp = 0;
+	info.reg = nullptr;
+	info.global = nullptr;
+	info.local = nullptr;
+	info.function = nullptr;
+	info.isFlagRegister = false;
+	info.isStackPointerRegister = false;
+	info.isGeneralPurposeRegister = false;
+	info.isFloatingPointRegister = false;
+	info.stackVariables.clear();
+	info.stackVariablesStamp = 0;
+
+	if (auto* gv = dyn_cast<GlobalVariable>(val))
+	{
+		info.stamp = _configDB.registers.getStamp()
+				+ _configDB.globals.getStamp();
+		info.reg = _configDB.registers.getObjectByName(info.name);
+		info.global = _configDB.globals.getObjectByName(info.name);
+		if (info.reg)
+		{
+			classifyRegister(gv, info);
+		}
+	}
+	else if (auto* a = dyn_cast<AllocaInst>(val))
+	{
+		info.function = getConfigFunction(a->getFunction());
+		if (info.function)
+		{
+			info.localsStamp = info.function->locals.getStamp();
+			info.local = info.function->locals.getObjectByName(info.name);
+		}
+	}
+	else
+	{
+		info.stamp = _configDB.functions.getStamp();
+		info.function = _configDB.functions.getFunctionByName(info.name);
+	}
+}
+
+/**
+ * TODO: Right now stack pointers are based on name comparisons with known
+ * stack pointer register names. We should use info from ABI or config instead.
+ * The same holds for other register classes.
+ */
+void Config::classifyRegister(const llvm::GlobalVariable* gv, ValueInfo& info)
+{
+	auto* r = info.reg;
+	auto& arch = getConfig().architecture;
+	const std::string& n = info.name;
+
+	info.isFlagRegister = isBoolType(gv->getValueType());
+
+	info.isStackPointerRegister = n == "esp"
+			|| (n == "r1" && arch.isPpc())
+			|| n == "sp"
+			|| n == "rsp";
+
+	if (isPic32() || arch.isMips())
+	{
+		auto rn = r->getStorage().getRegisterNumber();
+		info.isGeneralPurposeRegister = rn.isDefined()
+				&& MIPS_REG_0 <= rn && rn <= MIPS_REG_31;
+	}
+	else if (arch.isArmOrThumb())
+	{
+		auto rn = r->getStorage().getRegisterNumber();
+		info.isGeneralPurposeRegister = rn.isDefined()
+				&& ARM_REG_R0 <= rn && rn <= ARM_REG_R12;
+	}
+	else if (arch.isPpc())
+	{
+		auto rn = r->getStorage().getRegisterNumber();
+		info.isGeneralPurposeRegister = rn.isDefined()
+				&& PPC_REG_R0 <= rn && rn <= PPC_REG_R31;
+	}
+	else if (arch.isX86())
+	{
+		info.isGeneralPurposeRegister = n == "eax" || n == "ebx"
+				|| n == "ecx" || n == "edx" || n == "esp" || n == "ebp"
+				|| n == "esi" || n == "edi";
+	}
+
+	if (isMipsOrPic32())
+	{
+		info.isFloatingPointRegister = gv->getValueType()->isFloatingPointTy();
+	}
+}
+
+/**
+ * Index stack variables of function @a fnc by their offsets. @a info is the
+ * up-to-date classification of @a fnc.
+ */
+void Config::indexStackVariables(llvm::Function* fnc, ValueInfo& info)
+{
+	info.stackVariables.clear();
+	info.stackVariablesStamp = info.function->locals.getStamp();
+
+	for (auto& b : *fnc)
+	for (auto& i : b)
+	{
+		auto* a = dyn_cast<AllocaInst>(&i);
+		auto off = a ? getStackVariableOffset(a) : Maybe<int>();
+		if (off.isUndefined())
+		{
+			continue;
+		}
+
+		auto p = info.stackVariables.emplace(off.getValue(), a);
+		if (!p.second && a->getName() < p.first->second->getName())
+		{
+			p.first->second = a;
+		}
+	}
+}
+
+//
+//=============================================================================
+//  ConfigProvider
+//=============================================================================
+//
 
 Config* ConfigProvider::addConfigFile(llvm::Module* m, const std::string& path)
 {
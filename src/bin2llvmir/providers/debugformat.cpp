@@ -23,8 +23,6 @@ namespace bin2llvmir {
 //=============================================================================
 //
 
-std::map<Module*, DebugFormat> DebugFormatProvider::_module2debug;
-
 /**
  * Create and add to provider a debug info for the given module @a m, file
  * image @a objf, pdb file path @a pdbFile, possible PE image base @a imageBase
@@ -11,8 +11,6 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
-std::map<Module*, DemanglerProvider::Demangler> DemanglerProvider::_module2demangler;
-
 /**
  * Create and add to provider a demangler for the given module @a m
  * and tools @a t.
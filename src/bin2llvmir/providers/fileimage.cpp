@@ -54,6 +54,7 @@ FileImage::FileImage(
 		Config* config)
 		:
 		_module(m),
+		_config(config),
 		_image(std::move(img))
 {
 	if (_image == nullptr)
@@ -475,7 +476,7 @@ llvm::Constant* FileImage::getConstant(
 			refGvs.push_back(newGv);
 			addr += getDefaultTypeByteSize(_module);
 
-			static auto& conf = config->getConfig();
+			auto& conf = config->getConfig();
 			if (conf.globals.getObjectByAddress(addr))
 			{
 				break;
@@ -543,6 +544,21 @@ llvm::Constant* FileImage::getConstant(
  */
 const retdec::fileformat::Symbol* FileImage::getPreferredSymbol(
 		retdec::utils::Address addr)
+{
+	auto* ret = getPreferredSymbolAt(addr);
+	if (ret == nullptr && _config->getConfig().architecture.isArmOrThumb())
+	{
+		ret = getPreferredSymbolAt(addr - 1);
+	}
+	return ret;
+}
+
+/**
+ * Get preferred symbol on the given address @a addr. Unlike
+ * getPreferredSymbol(), symbols on nearby addresses are not considered.
+ */
+const retdec::fileformat::Symbol* FileImage::getPreferredSymbolAt(
+		retdec::utils::Address addr)
 {
 	std::set<const retdec::fileformat::Symbol*> syms;
 
@@ -577,21 +593,6 @@ const retdec::fileformat::Symbol* FileImage::getPreferredSymbol(
 		}
 	}
 
-	// TODO: direct config provider usage + ugly statis.
-	//
-	static bool lowered = false;
-	auto* c = ConfigProvider::getConfig(_module);
-	if (c && ret == nullptr && c->getConfig().architecture.isArmOrThumb())
-	{
-		if (!lowered)
-		{
-			lowered = true;
-			ret = getPreferredSymbol(addr - 1);
-			lowered = false;
-			return ret;
-		}
-	}
-
 	return ret;
 }
 
@@ -601,8 +602,6 @@ const retdec::fileformat::Symbol* FileImage::getPreferredSymbol(
 //=============================================================================
 //
 
-std::map<llvm::Module*, FileImage> FileImageProvider::_module2image;
-
 /**
  * Create and add to provider a file image created from file at @a path for
  * the given module @a m and architecture @a a.
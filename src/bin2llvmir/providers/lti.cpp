@@ -290,7 +290,7 @@ void Lti::loadLtiFile(const std::string& filePath)
 {
 	// This could/should be derived from architecture or LLVM module.
 	//
-	static ctypesparser::JSONCTypesParser::TypeWidths typeWidths
+	static const ctypesparser::JSONCTypesParser::TypeWidths typeWidths
 	{
 		{"bool", 1},
 		{"char", 8},
@@ -449,8 +449,6 @@ llvm::Type* Lti::getLlvmType(std::shared_ptr<retdec::ctypes::Type> type)
 //=============================================================================
 //
 
-std::map<llvm::Module*, Lti> LtiProvider::_module2lti;
-
 Lti* LtiProvider::addLti(
 		llvm::Module* m,
 		Config* c,
@@ -0,0 +1,131 @@
+/**
+ * @file src/bin2llvmir/providers/provider_context.cpp
+ * @brief Providers and pass states of one decompilation.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/bin2llvmir/providers/provider_context.h"
+
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+
+namespace {
+
+/// Context of the pass manager run by this thread.
+thread_local ProviderContext* activeContext = nullptr;
+
+} // anonymous namespace
+
+//
+//=============================================================================
+//  ProviderContext
+//=============================================================================
+//
+
+/**
+ * @return Context made available to the given @a pass by @c ProviderContextPass
+ *         in its pass manager, or @c nullptr if there is no such context (e.g.
+ *         the pass is run directly, outside of any pass manager).
+ */
+ProviderContext* ProviderContext::get(const llvm::Pass& pass)
+{
+	if (pass.getResolver() == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto* p = pass.getAnalysisIfAvailable<ProviderContextPass>();
+	return p ? p->getContext() : nullptr;
+}
+
+/**
+ * @return Context of the pass manager which is currently run by this thread,
+ *         or @c nullptr if there is no such context.
+ */
+ProviderContext* ProviderContext::getActive()
+{
+	return activeContext;
+}
+
+/**
+ * Clear all stored data.
+ */
+void ProviderContext::clear()
+{
+	syscallSites.clear();
+	ltis.clear();
+	debugFormats.clear();
+	fileImages.clear();
+	demanglers.clear();
+	configs.clear();
+	abis.clear();
+
+	providersInitialized = false;
+	simpleTypesRun = false;
+	stackProtectors.clear();
+	volatilize = VolatilizeState();
+
+	llvmToAsmGlobals.clear();
+}
+
+//
+//=============================================================================
+//  ProviderContextPass
+//=============================================================================
+//
+
+char ProviderContextPass::ID = 0;
+
+static RegisterPass<ProviderContextPass> X(
+		"provider-context",
+		"Provider context",
+		 false, // Only looks at CFG
+		 true // Analysis Pass
+);
+
+/**
+ * Pass without any context. It exists only because LLVM requires passes to be
+ * default constructible. Passes in its manager get no context.
+ */
+ProviderContextPass::ProviderContextPass() :
+		ImmutablePass(ID)
+{
+
+}
+
+ProviderContextPass::ProviderContextPass(ProviderContext& context) :
+		ImmutablePass(ID),
+		_context(&context)
+{
+
+}
+
+/**
+ * Activate the context in the running thread before the other passes run.
+ */
+bool ProviderContextPass::doInitialization(llvm::Module& m)
+{
+	_previous = activeContext;
+	activeContext = _context;
+	return false;
+}
+
+/**
+ * Restore the context which was active before the pass manager started.
+ */
+bool ProviderContextPass::doFinalization(llvm::Module& m)
+{
+	activeContext = _previous;
+	_previous = nullptr;
+	return false;
+}
+
+ProviderContext* ProviderContextPass::getContext() const
+{
+	return _context;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,109 @@
+/**
+ * @file src/bin2llvmir/providers/syscall_sites.cpp
+ * @brief Syscall sites provider for bin2llvmirl.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/bin2llvmir/providers/syscall_sites.h"
+
+using namespace llvm;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace bin2llvmir {
+
+//
+//=============================================================================
+//  SyscallSites
+//=============================================================================
+//
+
+/**
+ * Record syscall instruction with Capstone ID @a insnId at address @a addr.
+ * If there already is a site at @a addr, it is replaced.
+ */
+void SyscallSites::addSite(Address addr, unsigned insnId)
+{
+	_sites[addr] = insnId;
+}
+
+/**
+ * Remove syscall site at address @a addr, if there is any.
+ */
+void SyscallSites::removeSite(Address addr)
+{
+	_sites.erase(addr);
+}
+
+/**
+ * @return All recorded sites ordered by their addresses.
+ */
+const SyscallSites::Sites& SyscallSites::getSites() const
+{
+	return _sites;
+}
+
+std::size_t SyscallSites::size() const
+{
+	return _sites.size();
+}
+
+bool SyscallSites::empty() const
+{
+	return _sites.empty();
+}
+
+//
+//=============================================================================
+//  SyscallSitesProvider
+//=============================================================================
+//
+
+/**
+ * Create and add to provider empty syscall sites for the given module @a m.
+ * If there already are sites for @a m, they are cleared.
+ * @return Created and added syscall sites.
+ */
+SyscallSites* SyscallSitesProvider::addSyscallSites(llvm::Module* m)
+{
+	auto& sites = _module2sites[m];
+	sites = SyscallSites();
+	return &sites;
+}
+
+/**
+ * @return Get syscall sites associated with the given module @a m or
+ *         @c nullptr if there are no associated sites.
+ */
+SyscallSites* SyscallSitesProvider::getSyscallSites(llvm::Module* m)
+{
+	auto f = _module2sites.find(m);
+	return f != _module2sites.end() ? &f->second : nullptr;
+}
+
+/**
+ * Get syscall sites @a sites associated with the module @a m.
+ * @param[in]  m     Module for which to get syscall sites.
+ * @param[out] sites Set to syscall sites associated with @a m module, or
+ *                   @c nullptr if there are no associated sites.
+ * @return @c True if syscall sites @a sites were set ok and can be used.
+ *         @c False otherwise.
+ */
+bool SyscallSitesProvider::getSyscallSites(
+		llvm::Module* m,
+		SyscallSites*& sites)
+{
+	sites = getSyscallSites(m);
+	return sites != nullptr;
+}
+
+/**
+ * Clear all stored data.
+ */
+void SyscallSitesProvider::clear()
+{
+	_module2sites.clear();
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -214,11 +214,16 @@ llvm::ReturnInst* modifyReturnInst(llvm::ReturnInst* ret, llvm::Value* val)
  * Maybe, it would be possible to modify call operands (arguments) inplace
  * as implemented in @c PHINode::growOperands(). However, this looks very
  * hackish and dangerous.
+ *
+ * If the new call returns no value, stores of the old call's value store
+ * @a config's global dummy instead (or an undefined value if there is no
+ * @a config).
  */
 llvm::CallInst* _modifyCallInst(
 		llvm::CallInst* call,
 		llvm::Value* calledVal,
-		llvm::ArrayRef<llvm::Value*> args)
+		llvm::ArrayRef<llvm::Value*> args,
+		Config* config = nullptr)
 {
 	std::set<Instruction*> toEraseCast;
 	auto* newCall = CallInst::Create(calledVal, args, "", call);
@@ -260,11 +265,10 @@ llvm::CallInst* _modifyCallInst(
 				// used somewhere else -- e.g. entries in param_return analysis.
 				//
 //				i->eraseFromParent();
-				auto* conf = ConfigProvider::getConfig(call->getModule());
-				auto* c = convertValueToType(
-						conf->getGlobalDummy(),
-						i->getValueOperand()->getType(),
-						i);
+				auto* t = i->getValueOperand()->getType();
+				auto* c = config
+						? convertValueToType(config->getGlobalDummy(), t, i)
+						: UndefValue::get(t);
 				i->replaceUsesOfWith(i->getValueOperand(), c);
 			}
 		}
@@ -290,13 +294,15 @@ llvm::CallInst* _modifyCallInst(
  *   - If @a ret is nullptr, call's return value is left unchanged.
  *     Pass @c void type in @c ret if you want the call to return no value.
  *   - If @a args is empty, call will have zero arguments.
+ *   - @a config is used only if @a ret is @c void.
  * @return New call instruction which replaced the old @c call.
  *         See @c _modifyCallInst() comment for details.
  */
 llvm::CallInst* modifyCallInst(
 		llvm::CallInst* call,
 		llvm::Type* ret,
-		llvm::ArrayRef<llvm::Value*> args)
+		llvm::ArrayRef<llvm::Value*> args,
+		Config* config)
 {
 	ret = ret ? ret : call->getType();
 	std::vector<llvm::Type*> argTypes;
@@ -312,7 +318,7 @@ llvm::CallInst* modifyCallInst(
 			0);
 	auto* conv = convertValueToType(call->getCalledValue(), t, call);
 
-	return _modifyCallInst(call, conv, args);
+	return _modifyCallInst(call, conv, args, config);
 }
 
 /**
@@ -690,7 +696,8 @@ FunctionPair modifyFunction(
 			auto* nc = _modifyCallInst(
 					call,
 					nf,
-					args);
+					args,
+					config);
 
 			if (!ret->isVoidTy() && retVal)
 			{
@@ -14,6 +14,7 @@
 #include <iostream>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/CallGraph.h>
@@ -52,6 +53,7 @@
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/llvm-support/diagnostics.h"
 #include "retdec/utils/memory.h"
 #include "retdec/utils/conversion.h"
@@ -248,22 +250,64 @@ std::string ModulePassPrinter::LastPhase = std::string();
 const std::string ModulePassPrinter::LlvmAggregatePhaseName = "LLVM";
 
 /**
- * Add the pass to the pass manager + possible verification.
+ * Pass from the command line together with the name of its phase.
  */
-static inline void addPassWithPossibleVerification(
-		legacy::PassManagerBase &PM,
+struct ScheduledPass
+{
+	std::string phaseName;
+	std::unique_ptr<Pass> pass;
+};
+
+/**
+ * Schedule the pass to be run by runScheduledPasses().
+ */
+static inline void schedulePass(
+		std::vector<ScheduledPass> &passes,
 		Pass *P,
 		const std::string& phaseName = std::string())
 {
 	std::string pn = phaseName.empty() ? P->getPassName() : phaseName;
+	passes.push_back(ScheduledPass{pn, std::unique_ptr<Pass>(P)});
+}
 
-	PM.add(new ModulePassPrinter(pn));
-	PM.add(P);
-
-	// If we are verifying all of the intermediate steps, add the verifier...
-	if (VerifyEach)
+/**
+ * Run the scheduled passes on the module @a M in their order.
+ *
+ * Each phase is run by its own pass manager, so the memory budget can be
+ * checked between the phases. Once it gets exhausted, no other phase is run and
+ * the module obtained so far is written as a partial result. Passes keep their
+ * states between the phases in @a Providers.
+ */
+void runScheduledPasses(
+		Module &M,
+		std::vector<ScheduledPass> &passes,
+		const TargetLibraryInfoImpl &TLII,
+		retdec::bin2llvmir::ProviderContext &Providers)
+{
+	for (auto& sp : passes)
 	{
-		PM.add(createVerifierPass());
+		if (retdec::utils::MemoryBudget::shouldEmitPartialResult())
+		{
+			retdec::llvm_support::printWarningMessage(
+					"memory budget exhausted before phase " + sp.phaseName
+					+ ", writing partial result");
+			return;
+		}
+
+		legacy::PassManager PM;
+		PM.add(new retdec::bin2llvmir::ProviderContextPass(Providers));
+		PM.add(new TargetLibraryInfoWrapperPass(TLII));
+		PM.add(createTargetTransformInfoWrapperPass(TargetIRAnalysis()));
+		PM.add(new ModulePassPrinter(sp.phaseName));
+		PM.add(sp.pass.release());
+
+		// If we are verifying all of the intermediate steps, add the verifier...
+		if (VerifyEach)
+		{
+			PM.add(createVerifierPass());
+		}
+
+		PM.run(M);
 	}
 }
 
@@ -283,26 +327,39 @@ static inline void addPassWithoutVerification(
 
 /**
 * Limits the maximal memory of the tool based on the command-line parameters.
+*
+* The same amount of memory is also set as the memory budget, so optional
+* phases are skipped and a partial result is written before the hard limit is
+* hit. If the hard limit cannot be set, only the budget is used. If the amount
+* of memory cannot be determined, it fails.
 */
 void limitMaximalMemoryIfRequested()
 {
+	std::size_t limit = 0;
 	if (MaxMemoryLimitHalfRAM)
 	{
-		auto limitationSucceeded = retdec::utils::limitSystemMemoryToHalfOfTotalSystemMemory();
-		if (!limitationSucceeded)
+		limit = retdec::utils::getTotalSystemMemory() / 2;
+		if (limit == 0)
 		{
 			throw std::runtime_error("failed to limit maximal memory to half of system RAM");
 		}
 	}
 	else if (MaxMemoryLimit > 0)
 	{
-		auto limitationSucceeded = retdec::utils::limitSystemMemory(MaxMemoryLimit);
-		if (!limitationSucceeded)
-		{
-			throw std::runtime_error(
-				"failed to limit maximal memory to " + std::to_string(MaxMemoryLimit)
-			);
-		}
+		limit = MaxMemoryLimit;
+	}
+	else
+	{
+		return;
+	}
+
+	retdec::utils::MemoryBudget::setLimit(limit);
+	if (!retdec::utils::limitSystemMemory(limit))
+	{
+		retdec::llvm_support::printWarningMessage(
+				"failed to limit maximal memory to "
+				+ std::to_string(limit)
+				+ ", relying on the memory budget");
 	}
 }
 
@@ -436,23 +493,18 @@ int _main(int argc, char **argv)
 	Triple ModuleTriple(M->getTargetTriple());
 	TargetLibraryInfoImpl TLII(ModuleTriple);
 
-	// Create a PassManager to hold and optimize the collection of passes we are
-	// about to build.
-	legacy::PassManager Passes;
+	// Providers and pass states of this decompilation. It has to outlive all
+	// the pass managers which make it available to the passes.
+	retdec::bin2llvmir::ProviderContext Providers;
 
 	// The -disable-simplify-libcalls flag actually disables all builtin optzns.
 	if (DisableSimplifyLibCalls)
 	{
 		TLII.disableAllFunctions();
 	}
-	addPassWithoutVerification(Passes, new TargetLibraryInfoWrapperPass(TLII));
-
-	// Add internal analysis passes from the target machine.
-	addPassWithoutVerification(
-			Passes,
-			createTargetTransformInfoWrapperPass(TargetIRAnalysis()));
 
 	// Create a new optimization pass for each one specified on the command line
+	std::vector<ScheduledPass> Passes;
 	for (unsigned i = 0; i < PassList.size(); ++i)
 	{
 		const PassInfo *PassInf = PassList[i];
@@ -473,22 +525,26 @@ int _main(int argc, char **argv)
 
 		if (P)
 		{
-			addPassWithPossibleVerification(Passes, P);
+			schedulePass(Passes, P);
 		}
 	}
 
 	// Check that the module is well formed on completion of optimization
 	if (!NoVerify && !VerifyEach)
 	{
-		addPassWithoutVerification(Passes, createVerifierPass());
+		schedulePass(Passes, createVerifierPass());
 	}
 
+	// Outputs are written by a separate pass manager, so they are written even
+	// if the memory budget gets exhausted and the scheduled passes are not run.
+	legacy::PassManager WriterPasses;
+
 	// Write bitcode to the output as the last step.
 	std::unique_ptr<tool_output_file> bcOut = createBitcodeOutputFile();
 	raw_ostream *bcOs = &bcOut->os();
 	bool PreserveBitcodeUseListOrder = true;
 	addPassWithoutVerification(
-			Passes,
+			WriterPasses,
 			createBitcodeWriterPass(*bcOs, PreserveBitcodeUseListOrder));
 
 	// Write assembly to the output as the last step.
@@ -496,7 +552,7 @@ int _main(int argc, char **argv)
 	raw_ostream *llOs = &llOut->os();
 	bool PreserveAssemblyUseListOrder = true;
 	addPassWithoutVerification(
-			Passes,
+			WriterPasses,
 			createPrintModulePass(*llOs, "", PreserveAssemblyUseListOrder),
 			"Assembly Writer"); // original name = "Print module to stderr"
 
@@ -504,7 +560,8 @@ int _main(int argc, char **argv)
 	cl::PrintOptionValues();
 
 	// Now that we have all of the passes ready, run them.
-	Passes.run(*M);
+	runScheduledPasses(*M, Passes, TLII, Providers);
+	WriterPasses.run(*M);
 
 	// Declare success.
 	retdec::llvm_support::printPhase("Cleanup");
@@ -4,8 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <set>
 
 #include "retdec/capstone2llvmir/arm/arm.h"
 
@@ -98,6 +100,24 @@ uint32_t Capstone2LlvmIrTranslatorArm::getArchBitSize()
 	return getArchByteSize() * 8;
 }
 
+/**
+ * Same as @c Capstone2LlvmIrTranslator::translate(), but IT blocks and shared
+ * conditional bodies never span more translations.
+ */
+Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslatorArm::translate(
+		const std::vector<uint8_t>& bytes,
+		retdec::utils::Address a,
+		llvm::IRBuilder<>& irb,
+		bool stopOnBranch)
+{
+	_itInsnsLeft = 0;
+	_condBody = nullptr;
+	_condAfter = nullptr;
+	_condBodyCc = ARM_CC_INVALID;
+
+	return Capstone2LlvmIrTranslator::translate(bytes, a, irb, stopOnBranch);
+}
+
 void Capstone2LlvmIrTranslatorArm::generateEnvironmentArchSpecific()
 {
 	// Nothing.
@@ -1134,6 +1154,122 @@ llvm::Value* Capstone2LlvmIrTranslatorArm::generateInsnConditionCode(
 	}
 }
 
+/**
+ * Generate body guarded by the condition of instruction @p ai at the current
+ * insert point of @p irb. If possible (see @c isConditionalBodyReusable()),
+ * the body generated for the previous instruction is used instead, and the
+ * special LLVM to ASM mapping instruction of the current instruction is moved
+ * into it.
+ * @param irb      Reference to IR builder. After the body is generated,
+ *                 irb's insert point is set to first instruction after it.
+ * @param ai       Conditional instruction.
+ * @param reusable If @c true, the generated body can be reused by the next
+ *                 instructions. Use it only inside IT blocks -- jumps into
+ *                 their middle are not allowed, so no one needs to split the
+ *                 body at the following instructions later.
+ * @return IR builder whose insert point is set to the body's terminator.
+ */
+llvm::IRBuilder<> Capstone2LlvmIrTranslatorArm::generateConditionalBody(
+		llvm::IRBuilder<>& irb,
+		cs_arm* ai,
+		bool reusable)
+{
+	if (isConditionalBodyReusable(irb, ai))
+	{
+		_condAfter->front().moveBefore(_condBody->getTerminator());
+		return llvm::IRBuilder<>(_condBody->getTerminator());
+	}
+
+	auto* cond = generateInsnConditionCode(irb, ai);
+	auto body = generateIfThen(cond, irb);
+
+	if (reusable && body.GetInsertBlock() != irb.GetInsertBlock())
+	{
+		_condBody = body.GetInsertBlock();
+		_condAfter = irb.GetInsertBlock();
+		_condBodyCc = ai->cc;
+	}
+	else
+	{
+		_condBody = nullptr;
+	}
+
+	return body;
+}
+
+/**
+ * @return @c True if instruction @p ai can be translated into the conditional
+ *         body of the previous instruction, i.e. the body has the same
+ *         condition and nothing but the special LLVM to ASM mapping
+ *         instruction of @p ai was generated after it.
+ */
+bool Capstone2LlvmIrTranslatorArm::isConditionalBodyReusable(
+		llvm::IRBuilder<>& irb,
+		cs_arm* ai)
+{
+	if (_condBody == nullptr
+			|| _condBodyCc != ai->cc
+			|| irb.GetInsertBlock() != _condAfter)
+	{
+		return false;
+	}
+
+	auto ip = irb.GetInsertPoint();
+	return ip != _condAfter->begin() && std::prev(ip) == _condAfter->begin();
+}
+
+/**
+ * Stop reusing the current conditional body if the last instruction
+ * translated into it changed condition flags or control flow.
+ * @param body IR builder used to translate the last instruction.
+ */
+void Capstone2LlvmIrTranslatorArm::checkConditionalBody(llvm::IRBuilder<>& body)
+{
+	if (_condBody == nullptr)
+	{
+		return;
+	}
+
+	// Body was split (e.g. by nested if-then) or it ends by a branch.
+	if (body.GetInsertBlock() != _condBody
+			|| (_branchGenerated && _branchGenerated->getParent() == _condBody))
+	{
+		_condBody = nullptr;
+		return;
+	}
+
+	std::set<llvm::Value*> flags = {
+			getRegister(ARM_REG_CPSR_N),
+			getRegister(ARM_REG_CPSR_Z),
+			getRegister(ARM_REG_CPSR_C),
+			getRegister(ARM_REG_CPSR_V)};
+	for (auto& i : *_condBody)
+	{
+		auto* s = llvm::dyn_cast<llvm::StoreInst>(&i);
+		if (s && flags.count(s->getPointerOperand()))
+		{
+			_condBody = nullptr;
+			return;
+		}
+	}
+}
+
+/**
+ * @return @c True if @p i is a conditional move which does not update flags
+ *         nor write PC. Such move can be translated without branches, see
+ *         @c translateCondMov().
+ */
+bool Capstone2LlvmIrTranslatorArm::isSimpleConditionalMove(
+		cs_insn* i,
+		cs_arm* ai)
+{
+	return (i->id == ARM_INS_MOV || i->id == ARM_INS_MVN)
+			&& ai->op_count == 2
+			&& !ai->update_flags
+			&& ai->operands[0].type == ARM_OP_REG
+			&& ai->operands[0].reg != ARM_REG_PC;
+}
+
 void Capstone2LlvmIrTranslatorArm::translateInstruction(
 		cs_insn* i,
 		llvm::IRBuilder<>& irb)
@@ -1145,6 +1281,20 @@ void Capstone2LlvmIrTranslatorArm::translateInstruction(
 
 //std::cout << std::hex << i->address << " @ " << i->mnemonic << " " << i->op_str << std::endl;
 
+	if (i->id == ARM_INS_IT)
+	{
+		// it, itt, ite, ittt, ... -- each letter after 'i' stands for one
+		// instruction of the block.
+		_itInsnsLeft = std::strlen(i->mnemonic) - 1;
+		_condBody = nullptr;
+		return;
+	}
+	bool inItBlock = _itInsnsLeft > 0;
+	if (inItBlock)
+	{
+		--_itInsnsLeft;
+	}
+
 //	assert(ai->vector_size == 0);
 //	assert(ai->vector_data == ARM_VECTORDATA_INVALID);
 //	assert(ai->cps_mode == ARM_CPSMODE_INVALID);
@@ -1170,16 +1320,23 @@ void Capstone2LlvmIrTranslatorArm::translateInstruction(
 		if (ai->cc == ARM_CC_AL || ai->cc == ARM_CC_INVALID || branchInsn)
 		{
 			_inCondition = false;
+			_condBody = nullptr;
 			(this->*f)(i, ai, irb);
 		}
+		else if (isSimpleConditionalMove(i, ai)
+				&& !isConditionalBodyReusable(irb, ai))
+		{
+			_inCondition = true;
+			_condBody = nullptr;
+			translateCondMov(i, ai, irb);
+		}
 		else
 		{
 			_inCondition = true;
 
-			auto* cond = generateInsnConditionCode(irb, ai);
-			auto bodyIrb = generateIfThen(cond, irb);
-
+			auto bodyIrb = generateConditionalBody(irb, ai, inItBlock);
 			(this->*f)(i, ai, bodyIrb);
+			checkConditionalBody(bodyIrb);
 		}
 	}
 	else
@@ -1446,6 +1603,23 @@ void Capstone2LlvmIrTranslatorArm::translateMov(cs_insn* i, cs_arm* ai, llvm::IR
 	}
 }
 
+/**
+ * Conditional ARM_INS_MOV, ARM_INS_MVN accepted by @c isSimpleConditionalMove().
+ * The new value is selected by the condition, so no branch is generated.
+ */
+void Capstone2LlvmIrTranslatorArm::translateCondMov(cs_insn* i, cs_arm* ai, llvm::IRBuilder<>& irb)
+{
+	auto* cond = generateInsnConditionCode(irb, ai);
+	op0 = loadOp(ai->operands[0], irb);
+	op1 = loadOpBinaryOp1(ai, irb, op0->getType());
+	if (i->id == ARM_INS_MVN)
+	{
+		op1 = genValueNegate(irb, op1);
+	}
+	auto* val = irb.CreateSelect(cond, op1, op0);
+	storeOp(ai->operands[0], val, irb);
+}
+
 /**
  * Preferred synonyms for MOV instructions with shifted register operands:
  * ARM_INS_LSL, ARM_INS_LSR, ARM_INS_ROR, ARM_INS_RRX, ARM_INS_ASR
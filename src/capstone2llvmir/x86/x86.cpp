@@ -104,6 +104,22 @@ void Capstone2LlvmIrTranslatorX86::modifyExtraMode(cs_mode m)
 	_extraMode = m;
 }
 
+/**
+ * Same as @c Capstone2LlvmIrTranslator::translate(), but x87 TOP is known at
+ * the start of the translation only if it was set by @c setX87TopAtStart().
+ */
+Capstone2LlvmIrTranslator::TranslationResult Capstone2LlvmIrTranslatorX86::translate(
+		const std::vector<uint8_t>& bytes,
+		retdec::utils::Address a,
+		llvm::IRBuilder<>& irb,
+		bool stopOnBranch)
+{
+	_x87Top = _x87TopAtStart;
+	_x87TopAtStart = -1;
+
+	return Capstone2LlvmIrTranslator::translate(bytes, a, irb, stopOnBranch);
+}
+
 void Capstone2LlvmIrTranslatorX86::generateEnvironmentArchSpecific()
 {
 	generateX87RegLoadStoreFunctions();
@@ -185,6 +201,19 @@ void Capstone2LlvmIrTranslatorX86::generateX87RegLoadStoreFunctions()
 			_module);
 }
 
+/**
+ * Let the next @c translate() assume that x87 TOP is @a top at its start
+ * (e.g. 0 at a function entry, where the x87 stack is empty). It is then
+ * tracked through the translated instructions until the first branch or until
+ * it gets computed from an unknown value. While it is known, x87 data and tag
+ * registers are accessed directly, otherwise the x87 pseudo functions are
+ * used.
+ */
+void Capstone2LlvmIrTranslatorX86::setX87TopAtStart(unsigned top)
+{
+	_x87TopAtStart = top & 7;
+}
+
 llvm::Function* Capstone2LlvmIrTranslatorX86::getX87DataStoreFunction()
 {
 	return _x87DataStoreFunction;
@@ -628,6 +657,13 @@ void Capstone2LlvmIrTranslatorX86::translateInstruction(
 			throw Capstone2LlvmIrError(msg.str());
 		}
 	}
+
+	// TOP is not known after calls (callee may leave its result on the x87
+	// stack) and branches.
+	if (_branchGenerated)
+	{
+		_x87Top = -1;
+	}
 }
 
 //
@@ -884,8 +920,16 @@ void Capstone2LlvmIrTranslatorX86::storeRegistersPlusSflags(
 	storeRegister(X86_REG_PF, genParityFlag(sflagsVal, irb), irb);
 }
 
+/**
+ * If TOP is statically known, it returns its value as a constant and all the
+ * values computed from it are folded into constants by @a irb.
+ */
 llvm::Value* Capstone2LlvmIrTranslatorX86::loadX87Top(llvm::IRBuilder<>& irb)
 {
+	if (_x87Top >= 0)
+	{
+		return llvm::ConstantInt::get(irb.getIntNTy(3), _x87Top);
+	}
 	return loadRegister(X87_REG_TOP, irb);
 }
 
@@ -905,7 +949,7 @@ llvm::Value* Capstone2LlvmIrTranslatorX86::loadX87TopDecStore(
 		llvm::IRBuilder<>& irb)
 {
 	auto* top = loadX87TopDec(irb);
-	storeRegister(X87_REG_TOP, top, irb);
+	storeX87Top(irb, top);
 	return top;
 }
 
@@ -918,7 +962,7 @@ llvm::Value* Capstone2LlvmIrTranslatorX86::loadX87TopIncStore(
 //	auto* top = loadX87TopInc(irb);
 	auto* top = loadX87Top(irb);
 	auto* inc = irb.CreateAdd(top, llvm::ConstantInt::get(top->getType(), 1));
-	storeRegister(X87_REG_TOP, inc, irb);
+	storeX87Top(irb, inc);
 	return top;
 }
 
@@ -928,7 +972,7 @@ llvm::Value* Capstone2LlvmIrTranslatorX86::x87IncTop(
 {
 	top = top == nullptr ? loadX87Top(irb) : top;
 	auto* inc = irb.CreateAdd(top, llvm::ConstantInt::get(top->getType(), 1));
-	storeRegister(X87_REG_TOP, inc, irb);
+	storeX87Top(irb, inc);
 	return inc;
 }
 
@@ -938,11 +982,46 @@ llvm::Value* Capstone2LlvmIrTranslatorX86::x87DecTop(
 {
 	top = top == nullptr ? loadX87Top(irb) : top;
 	auto* dec = irb.CreateSub(top, llvm::ConstantInt::get(top->getType(), 1));
-	storeRegister(X87_REG_TOP, dec, irb);
+	storeX87Top(irb, dec);
 	return dec;
 }
 
-llvm::CallInst* Capstone2LlvmIrTranslatorX86::storeX87DataReg(
+/**
+ * Store @a val to TOP. TOP stays statically known only if @a val is a constant
+ * (i.e. it was computed from known TOP, or it was set by e.g. FNINIT).
+ */
+llvm::StoreInst* Capstone2LlvmIrTranslatorX86::storeX87Top(
+		llvm::IRBuilder<>& irb,
+		llvm::Value* val)
+{
+	auto* ci = llvm::dyn_cast<llvm::ConstantInt>(val);
+	_x87Top = ci ? ci->getZExtValue() & 7 : -1;
+	return storeRegister(X87_REG_TOP, val, irb);
+}
+
+/**
+ * @return Register from the x87 register class starting with @a first
+ * (@c X86_REG_ST0 or @c X87_REG_TAG0) with the given number @a rNum, if it is
+ * statically known. @c nullptr otherwise.
+ *
+ * Registers are named in the same way as @c RegisterAnalysis in bin2llvmir
+ * names them: the first value pushed into an empty stack (TOP == 0) is in
+ * the register 0, the second one in the register 1, etc.
+ */
+llvm::GlobalVariable* Capstone2LlvmIrTranslatorX86::getX87Register(
+		uint32_t first,
+		llvm::Value* rNum)
+{
+	auto* ci = llvm::dyn_cast<llvm::ConstantInt>(rNum);
+	if (_x87Top < 0 || ci == nullptr)
+	{
+		return nullptr;
+	}
+
+	return getRegister(first + ((7 - ci->getZExtValue()) & 7));
+}
+
+llvm::Instruction* Capstone2LlvmIrTranslatorX86::storeX87DataReg(
 		llvm::IRBuilder<>& irb,
 		llvm::Value* rNum,
 		llvm::Value* val)
@@ -959,6 +1038,11 @@ llvm::CallInst* Capstone2LlvmIrTranslatorX86::storeX87DataReg(
 			tmp);                          // 00 - valid
 	storeX87TagReg(irb, rNum, tagVal);
 
+	if (auto* reg = getX87Register(X86_REG_ST0, rNum))
+	{
+		return irb.CreateStore(val, reg);
+	}
+
 	std::vector<llvm::Value*> ps = {rNum, val};
 	return irb.CreateCall(getX87DataStoreFunction(), ps);
 }
@@ -969,7 +1053,7 @@ llvm::CallInst* Capstone2LlvmIrTranslatorX86::storeX87DataReg(
  * 10 - special, invalid (Nan, unsupported), infinity, denormal
  * 11 - empty
  */
-llvm::CallInst* Capstone2LlvmIrTranslatorX86::storeX87TagReg(
+llvm::Instruction* Capstone2LlvmIrTranslatorX86::storeX87TagReg(
 		llvm::IRBuilder<>& irb,
 		llvm::Value* rNum,
 		llvm::Value* val)
@@ -977,11 +1061,16 @@ llvm::CallInst* Capstone2LlvmIrTranslatorX86::storeX87TagReg(
 	assert(rNum->getType()->isIntegerTy(3));
 	assert(val->getType()->isIntegerTy(2));
 
+	if (auto* reg = getX87Register(X87_REG_TAG0, rNum))
+	{
+		return irb.CreateStore(val, reg);
+	}
+
 	std::vector<llvm::Value*> ps = {rNum, val};
 	return irb.CreateCall(getX87TagStoreFunction(), ps);
 }
 
-llvm::CallInst* Capstone2LlvmIrTranslatorX86::clearX87TagReg(
+llvm::Instruction* Capstone2LlvmIrTranslatorX86::clearX87TagReg(
 		llvm::IRBuilder<>& irb,
 		llvm::Value* rNum)
 {
@@ -991,22 +1080,32 @@ llvm::CallInst* Capstone2LlvmIrTranslatorX86::clearX87TagReg(
 			llvm::ConstantInt::get(irb.getIntNTy(2), -1, true)); // 11 - empty
 }
 
-llvm::CallInst* Capstone2LlvmIrTranslatorX86::loadX87DataReg(
+llvm::Instruction* Capstone2LlvmIrTranslatorX86::loadX87DataReg(
 		llvm::IRBuilder<>& irb,
 		llvm::Value* rNum)
 {
 	assert(rNum->getType()->isIntegerTy(3));
 
+	if (auto* reg = getX87Register(X86_REG_ST0, rNum))
+	{
+		return irb.CreateLoad(reg);
+	}
+
 	std::vector<llvm::Value*> ps = {rNum};
 	return irb.CreateCall(getX87DataLoadFunction(), ps);
 }
 
-llvm::CallInst* Capstone2LlvmIrTranslatorX86::loadX87TagReg(
+llvm::Instruction* Capstone2LlvmIrTranslatorX86::loadX87TagReg(
 		llvm::IRBuilder<>& irb,
 		llvm::Value* rNum)
 {
 	assert(rNum->getType()->isIntegerTy(3));
 
+	if (auto* reg = getX87Register(X87_REG_TAG0, rNum))
+	{
+		return irb.CreateLoad(reg);
+	}
+
 	std::vector<llvm::Value*> ps = {rNum};
 	return irb.CreateCall(getX87TagLoadFunction(), ps);
 }
@@ -2884,7 +2983,7 @@ void Capstone2LlvmIrTranslatorX86::translateFninit(cs_insn* i, cs_x86* xi, llvm:
 	storeRegister(X87_REG_C1, zero, irb);
 	storeRegister(X87_REG_C2, zero, irb);
 	storeRegister(X87_REG_C3, zero, irb);
-	storeRegister(X87_REG_TOP, zero, irb);
+	storeX87Top(irb, zero);
 	storeRegister(X87_REG_B, zero, irb);
 	// FPUTagWord = 0xFFFF;
 	storeRegister(X87_REG_TAG0, i2Set, irb);
@@ -4286,7 +4385,7 @@ void Capstone2LlvmIrTranslatorX86::translateFld(cs_insn* i, cs_x86* xi, llvm::IR
 	auto* top = loadX87TopDec(irb);
 
 	storeX87DataReg(irb, top, op0);
-	storeRegister(X87_REG_TOP, top, irb);
+	storeX87Top(irb, top);
 }
 
 /**
@@ -4349,7 +4448,7 @@ void Capstone2LlvmIrTranslatorX86::translateFloadConstant(cs_insn* i, cs_x86* xi
 	}
 
 	storeX87DataReg(irb, top, val);
-	storeRegister(X87_REG_TOP, top, irb);
+	storeX87Top(irb, top);
 }
 
 /**
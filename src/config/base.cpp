@@ -22,6 +22,8 @@
 namespace retdec {
 namespace config {
 
+std::atomic<std::size_t> ContainerStamp::_lastValue(0);
+
 /**
  * If JSON value is not an object value, throw an internal exception.
  * @param val Value to check.
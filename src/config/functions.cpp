@@ -32,6 +32,7 @@ const std::string JSON_endLine       = "endLine";
 const std::string JSON_fixed         = "wasFixed";
 const std::string JSON_fromDebug     = "isFromDebug";
 const std::string JSON_wrappedName   = "wrappedFunctionName";
+const std::string JSON_aliasedName   = "aliasedFunctionName";
 const std::string JSON_isConstructor = "isConstructor";
 const std::string JSON_isDestructor  = "isDestructor";
 const std::string JSON_isVirtual     = "isVirtual";
@@ -81,6 +82,7 @@ Function Function::fromJsonValue(const Json::Value& val)
 	ret.setComment( safeGetString(val, JSON_comment) );
 	ret.setDeclarationString( safeGetString(val, JSON_decStr) );
 	ret.setWrappedFunctionName( safeGetString(val, JSON_wrappedName) );
+	ret.setAliasedFunctionName( safeGetString(val, JSON_aliasedName) );
 	ret.setSourceFileName( safeGetString(val, JSON_srcFileName) );
 	ret.setStart( safeGetAddress(val, JSON_startAddr) );
 	ret.setEnd( safeGetAddress(val, JSON_endAddr) );
@@ -130,6 +132,7 @@ Json::Value Function::getJsonValue() const
 	if (!getComment().empty()) fnc[JSON_comment] = getComment();
 	if (!getDeclarationString().empty()) fnc[JSON_decStr] = getDeclarationString();
 	if (!getWrappedFunctionName().empty()) fnc[JSON_wrappedName] = getWrappedFunctionName();
+	if (!getAliasedFunctionName().empty()) fnc[JSON_aliasedName] = getAliasedFunctionName();
 	if (!getSourceFileName().empty()) fnc[JSON_srcFileName] = getSourceFileName();
 	if (getStart().isDefined()) fnc[JSON_startAddr] = getStart().getValue();
 	if (getEnd().isDefined()) fnc[JSON_endAddr] = getEnd().getValue();
@@ -176,6 +179,14 @@ bool Function::isThumb() const             { return _thumb; }
  */
 bool Function::isWrapper() const           { return !getWrappedFunctionName().empty(); }
 
+/**
+ * Some functions are identical to other functions (e.g. duplicated template
+ * instantiations). The body of such function is not decompiled, it only calls
+ * the other (aliased) function. This member holds name of the aliased
+ * function. If it is empty, then this Function is not alias.
+ */
+bool Function::isAlias() const             { return !getAliasedFunctionName().empty(); }
+
 void Function::setName(const std::string& n)                { _name = n; }
 void Function::setRealName(const std::string& n)            { _realName = n; }
 void Function::setDemangledName(const std::string& n)       { _demangledName = n; }
@@ -184,6 +195,7 @@ void Function::addComment(const std::string& c)             { _comment += c; }
 void Function::setDeclarationString(const std::string& s)   { _declarationString = s; }
 void Function::setSourceFileName(const std::string& n)      { _sourceFileName = n; }
 void Function::setWrappedFunctionName(const std::string& n) { _wrapperdFunctionName = n; }
+void Function::setAliasedFunctionName(const std::string& n) { _aliasedFunctionName = n; }
 void Function::setStartLine(const retdec::utils::Address& l)       { _startLine = l; }
 void Function::setEndLine(const retdec::utils::Address& l)         { _endLine = l; }
 void Function::setIsUserDefined()                           { _linkType = USER_DEFINED; }
@@ -208,6 +220,7 @@ std::string Function::getComment() const             { return _comment; }
 std::string Function::getDeclarationString() const   { return _declarationString; }
 std::string Function::getSourceFileName() const      { return _sourceFileName; }
 std::string Function::getWrappedFunctionName() const { return _wrapperdFunctionName; }
+std::string Function::getAliasedFunctionName() const { return _aliasedFunctionName; }
 LineNumber Function::getStartLine() const            { return _startLine; }
 LineNumber Function::getEndLine() const              { return _endLine; }
 
@@ -343,7 +343,7 @@ std::pair<GlobalVarContainer::iterator,bool> GlobalVarContainer::insert(
  */
 void GlobalVarContainer::clear()
 {
-	_data.clear();
+	ObjectSetContainer::clear();
 	_addr2global.clear();
 }
 
@@ -357,7 +357,7 @@ size_t GlobalVarContainer::erase(const Object& val)
 	{
 		_addr2global.erase(val.getStorage().getAddress());
 	}
-	return _data.erase(val.getId());
+	return ObjectSetContainer::erase(val.getId());
 }
 
 } // namespace config
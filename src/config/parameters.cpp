@@ -11,6 +11,7 @@ namespace {
 const std::string JSON_verboseOut               = "verboseOut";
 const std::string JSON_keepAllFuncs             = "keepAllFuncs";
 const std::string JSON_selectedDecodeOnly       = "selectedDecodeOnly";
+const std::string JSON_foldIdenticalFuncs       = "foldIdenticalFuncs";
 const std::string JSON_outputFile               = "outputFile";
 const std::string JSON_frontendOutputFile       = "frontEndOutputFile";
 const std::string JSON_ordinalNumDir            = "ordinalNumDirectory";
@@ -54,6 +55,15 @@ bool Parameters::isKeepAllFunctions() const
  */
 bool Parameters::isSelectedDecodeOnly() const { return _selectedDecodeOnly; }
 
+/**
+ * @return Fold identical functions found by the decoder into one canonical
+ * function. Otherwise, each of them is decompiled separately.
+ */
+bool Parameters::isFoldIdenticalFunctions() const
+{
+	return _foldIdenticalFunctions;
+}
+
 /**
  * Find out if some functions or ranges were selected in selective decompilation.
  * @return @c True if @c selectedFunctions or @c selectedRanges not empty,
@@ -93,6 +103,10 @@ void Parameters::setIsSelectedDecodeOnly(bool b)
 {
 	_selectedDecodeOnly = b;
 }
+void Parameters::setIsFoldIdenticalFunctions(bool b)
+{
+	_foldIdenticalFunctions = b;
+}
 
 void Parameters::setOutputFile(const std::string& n)
 {
@@ -135,6 +149,7 @@ Json::Value Parameters::getJsonValue() const
 	params[JSON_verboseOut]         = isVerboseOutput();
 	params[JSON_keepAllFuncs]       = isKeepAllFunctions();
 	params[JSON_selectedDecodeOnly] = isSelectedDecodeOnly();
+	params[JSON_foldIdenticalFuncs] = isFoldIdenticalFunctions();
 	params[JSON_outputFile]         = getOutputFile();
 	params[JSON_frontendOutputFile] = getFrontendOutputFile();
 
@@ -168,6 +183,7 @@ void Parameters::readJsonValue(const Json::Value& val)
 	setIsVerboseOutput( safeGetBool(val, JSON_verboseOut, false) );
 	setIsKeepAllFunctions( safeGetBool(val, JSON_keepAllFuncs) );
 	setIsSelectedDecodeOnly( safeGetBool(val, JSON_selectedDecodeOnly) );
+	setIsFoldIdenticalFunctions( safeGetBool(val, JSON_foldIdenticalFuncs, true) );
 	setOrdinalNumbersDirectory( safeGetString(val, JSON_ordinalNumDir) );
 	setOutputFile( safeGetString(val, JSON_outputFile) );
 	setFrontendOutputFile( safeGetString(val, JSON_frontendOutputFile) );
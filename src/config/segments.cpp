@@ -12,6 +12,8 @@ const std::string JSON_name      = "name";
 const std::string JSON_comment   = "comment";
 const std::string JSON_startAddr = "startAddr";
 const std::string JSON_endAddr   = "endAddr";
+const std::string JSON_entropy   = "entropy";
+const std::string JSON_chiSquare = "chiSquare";
 
 } // anonymous namespace
 
@@ -36,6 +38,11 @@ Segment Segment::fromJsonValue(const Json::Value& val)
 	ret.setName( safeGetString(val, JSON_name) );
 	ret.setComment( safeGetString(val, JSON_comment) );
 	ret.setEnd( safeGetAddress(val, JSON_endAddr) );
+	if (val.isMember(JSON_entropy))
+	{
+		ret.setEntropy( safeGetDouble(val, JSON_entropy) );
+		ret.setChiSquare( safeGetDouble(val, JSON_chiSquare) );
+	}
 
 	return ret;
 }
@@ -52,15 +59,25 @@ Json::Value Segment::getJsonValue() const
 	if (!getComment().empty()) seg[JSON_comment] = getComment();
 	if (getStart().isDefined()) seg[JSON_startAddr] = getStart().getValue();
 	if (getEnd().isDefined()) seg[JSON_endAddr] = getEnd().getValue();
+	if (hasByteStatistics())
+	{
+		seg[JSON_entropy] = getEntropy();
+		seg[JSON_chiSquare] = getChiSquare();
+	}
 
 	return seg;
 }
 
 void Segment::setName(const std::string& n)    { _name = n; }
 void Segment::setComment(const std::string& c) { _comment = c; }
+void Segment::setEntropy(double e)             { _entropy = e; _hasByteStatistics = true; }
+void Segment::setChiSquare(double c)           { _chiSquare = c; _hasByteStatistics = true; }
 
 std::string Segment::getName() const           { return _name; }
 std::string Segment::getComment() const        { return _comment; }
+bool Segment::hasByteStatistics() const        { return _hasByteStatistics; }
+double Segment::getEntropy() const             { return _entropy; }
+double Segment::getChiSquare() const           { return _chiSquare; }
 
 } // namespace config
 } // namespace retdec
@@ -60,6 +60,7 @@ void printHelp()
 	std::cout << "\t--section-vma" << std::endl;
 	std::cout << "\t--file-class" << std::endl;
 	std::cout << "\t--keep-unreachable-funcs true/false" << std::endl;
+	std::cout << "\t--fold-identical-funcs true/false" << std::endl;
 	std::cout << "\t--signatures path" << std::endl;
 	std::cout << "\t--user-signature path" << std::endl;
 	std::cout << "\t--types path" << std::endl;
@@ -284,6 +285,10 @@ int handleArguments(std::vector<std::string> &args)
 			{
 				config.parameters.setIsKeepAllFunctions( (val == "true") ? (true) : (false) );
 			}
+			else if (opt == "--fold-identical-funcs")
+			{
+				config.parameters.setIsFoldIdenticalFunctions( (val == "true") ? (true) : (false) );
+			}
 			else if (opt == "--signatures")
 			{
 				std::vector<std::string> files;
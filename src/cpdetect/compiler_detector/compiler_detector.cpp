@@ -4,6 +4,10 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <map>
+#include <memory>
+
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/binary_path.h"
 #include "retdec/utils/equality.h"
@@ -161,6 +165,26 @@ ToolType metaToTool(const std::string &toolMeta)
 	return ToolType::UNKNOWN;
 }
 
+/**
+ * Get path to the internal rule database which should be used
+ * @param path Path to the full internal rule database
+ * @param packersOnly @c true if only packers are detected
+ * @return Path to the database with packer rules only if @a packersOnly is set
+ *    and such database exists, @a path otherwise
+ */
+std::string getInternalDatabasePath(const std::string &path, bool packersOnly)
+{
+	if (!packersOnly)
+	{
+		return path;
+	}
+
+	FilesystemPath packersPath(FilesystemPath(path).getParentPath());
+	packersPath.append(YARA_PACKERS_DIR);
+	packersPath.append(path.substr(path.find_last_of("/\\") + 1));
+	return packersPath.isFile() ? packersPath.getPath() : path;
+}
+
 } // anonymous namespace
 
 /**
@@ -186,6 +210,49 @@ CompilerDetector::~CompilerDetector()
 	delete search;
 }
 
+/**
+ * Prepare signatures of @a rules for similarity search
+ * @param rules Loaded rules
+ *
+ * Signatures are prepared only once after the rules are loaded, so they do
+ * not have to be parsed again for every searched area.
+ */
+void CompilerDetector::loadRuleSignatures(const std::vector<YaraRule> &rules)
+{
+	for (const auto &rule : rules)
+	{
+		const auto *patternMeta = rule.getMeta("pattern");
+		if (!patternMeta)
+		{
+			continue;
+		}
+
+		auto strippedPattern = patternMeta->getStringValue();
+		while (endsWith(strippedPattern, ";"))
+		{
+			strippedPattern.pop_back();
+		}
+		auto &signature = ruleSignatures.emplace(&rule, RuleSignature(strippedPattern)).first->second;
+
+		const auto *absoluteStartMeta = rule.getMeta("absoluteStart");
+		if (absoluteStartMeta)
+		{
+			signature.hasAbsoluteStart = true;
+			signature.validStart = strToNum(absoluteStartMeta->getStringValue(), signature.absoluteStart);
+		}
+		const auto *startMeta = rule.getMeta("start");
+		const auto *endMeta = rule.getMeta("end");
+		if (startMeta)
+		{
+			signature.startShift = startMeta->getIntValue();
+		}
+		if (endMeta)
+		{
+			signature.endShift = endMeta->getIntValue();
+		}
+	}
+}
+
 /**
  * External databases parsing
  * @return @c true if at least one external database was detected, @c false otherwise
@@ -291,6 +358,20 @@ void CompilerDetector::removeUnusedCompilers()
 	}
 }
 
+/**
+ * Remove every detected tool which is not a packer
+ */
+void CompilerDetector::removeNonPackers()
+{
+	auto &tools = toolInfo.detectedTools;
+	tools.erase(std::remove_if(tools.begin(), tools.end(),
+		[] (const auto &tool)
+		{
+			return !tool.isPacker();
+		}
+	), tools.end());
+}
+
 /**
  * Try detect used compiler (or packer) based on heuristics
  */
@@ -313,7 +394,7 @@ ReturnCode CompilerDetector::getAllSignatures()
 	// Add internal paths.
 	for (const auto &ruleFile : internalPaths)
 	{
-		yara.addRuleFile(ruleFile);
+		yara.addRuleFile(getInternalDatabasePath(ruleFile, cpParams.packersOnly));
 	}
 
 	if (cpParams.external && getExternalDatabases())
@@ -362,24 +443,25 @@ ReturnCode CompilerDetector::getAllSignatures()
 		return (result ? ReturnCode::OK : ReturnCode::UNKNOWN_CP);
 	}
 
+	ruleSignatures.clear();
+	loadRuleSignatures(detected);
+	loadRuleSignatures(undetected);
+
 	Similarity sim;
 	double maxRatio = 0.0;
 
-	for (const auto &rules : {detected, undetected})
+	for (const auto *rules : {&detected, &undetected})
 	{
-		for (const auto &rule : rules)
+		for (const auto &rule : *rules)
 		{
 			const auto *nameMeta = rule.getMeta("name");
-			auto *patternMeta = rule.getMeta("pattern");
-			if (!nameMeta || !patternMeta)
+			const auto signatureIt = ruleSignatures.find(&rule);
+			if (!nameMeta || signatureIt == ruleSignatures.end())
 			{
 				continue;
 			}
-			auto pattern = patternMeta->getStringValue();
-			while (endsWith(pattern,  ";"))
-			{
-				pattern.pop_back();
-			}
+			const auto &signature = signatureIt->second;
+			const auto &pattern = signature.pattern.getPattern();
 			const auto *match = rule.getFirstMatch();
 			const auto *toolMeta = rule.getMeta("tool");
 			const auto *versionMeta = rule.getMeta("version");
@@ -399,13 +481,13 @@ ReturnCode CompilerDetector::getAllSignatures()
 			}
 
 			std::size_t base = 0;
-			const auto *absoluteStartMeta = rule.getMeta("absoluteStart");
-			if (absoluteStartMeta)
+			if (signature.hasAbsoluteStart)
 			{
-				if (!strToNum(absoluteStartMeta->getStringValue(), base))
+				if (!signature.validStart)
 				{
 					continue;
 				}
+				base = signature.absoluteStart;
 			}
 			else if (toolInfo.entryPointOffset)
 			{
@@ -416,20 +498,12 @@ ReturnCode CompilerDetector::getAllSignatures()
 				continue;
 			}
 
-			std::size_t startShift = 0, endShift = 0;
-			const auto *startMeta = rule.getMeta("start");
-			const auto *endMeta = rule.getMeta("end");
-			if (startMeta)
-			{
-				startShift = startMeta->getIntValue();
-			}
-			if (endMeta)
-			{
-				endShift = endMeta->getIntValue();
-			}
-			const auto start = base + startShift;
-			const auto end = base + endShift + fileParser.bytesFromNibblesRounded(pattern.length()) - 1;
-			if (search->areaSimilarity(pattern, sim, start, end)
+			const auto start = base + signature.startShift;
+			const auto end = base + signature.endShift + fileParser.bytesFromNibblesRounded(pattern.length()) - 1;
+			// Rules which cannot reach the best similarity so far are
+			// rejected early in the most similar mode.
+			const auto minRatio = cpParams.searchType == SearchType::MOST_SIMILAR ? maxRatio : 0.0;
+			if (search->areaSimilarity(signature.pattern, sim, start, end, minRatio)
 					&& (cpParams.searchType == SearchType::SIM_LIST
 						|| (cpParams.searchType == SearchType::MOST_SIMILAR
 							&& sim.ratio >= maxRatio)))
@@ -447,6 +521,8 @@ ReturnCode CompilerDetector::getAllSignatures()
 		removeCompilersWithLessSimilarity(maxRatio);
 	}
 
+	// Signatures are keyed by rules which are destroyed together with yara.
+	ruleSignatures.clear();
 	return (result ? ReturnCode::OK : ReturnCode::UNKNOWN_CP);
 }
 
@@ -481,11 +557,36 @@ ReturnCode CompilerDetector::getAllCompilers()
 	return (status == ReturnCode::UNKNOWN_CP && isDetecteion) ? ReturnCode::OK : status;
 }
 
+/**
+ * Detects only packers based on packer signatures and heuristics
+ * @return Status of detection (ReturnCode::OK if all is OK)
+ *
+ * Compilers, linkers, installers and languages are not detected, which makes
+ * this much cheaper than getAllCompilers().
+ */
+ReturnCode CompilerDetector::getAllPackers()
+{
+	const auto status = getAllSignatures();
+	if (heuristics)
+	{
+		heuristics->getPackerHeuristics();
+	}
+	removeNonPackers();
+	std::stable_sort(toolInfo.detectedTools.begin(), toolInfo.detectedTools.end(), compareForSort);
+	removeUnusedCompilers();
+
+	const bool isDetection = !toolInfo.detectedTools.empty();
+	return (status == ReturnCode::UNKNOWN_CP && isDetection) ? ReturnCode::OK : status;
+}
+
 /**
  * Detect all supported information about used compiler or packer
  * @return Status of detection (ReturnCode::OK if all is OK)
  *
  * Compiler can be successfully detected even if is returned a value other than ReturnCode::OK
+ *
+ * If packer-only detection is requested in detection parameters, only packers
+ * are detected.
  */
 ReturnCode CompilerDetector::getAllInformation()
 {
@@ -511,7 +612,7 @@ ReturnCode CompilerDetector::getAllInformation()
 		toolInfo.epSection = Section(*epSec);
 	}
 
-	auto status = getAllCompilers();
+	auto status = cpParams.packersOnly ? getAllPackers() : getAllCompilers();
 	if (invalidEntryPoint)
 	{
 		if (fileParser.isExecutable() || toolInfo.entryPointAddress || toolInfo.entryPointSection)
@@ -178,5 +178,10 @@ void ElfHeuristics::getFormatSpecificCompilerHeuristics()
 	getDynamicEntriesHeuristics();
 }
 
+void ElfHeuristics::getFormatSpecificPackerHeuristics()
+{
+	getUpxHeuristics();
+}
+
 } // namespace cpdetect
 } // namespace retdec
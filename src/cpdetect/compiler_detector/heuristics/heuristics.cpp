@@ -968,6 +968,16 @@ void Heuristics::getFormatSpecificLanguageHeuristics()
 {
 }
 
+/**
+ * Get all packer heuristics which are specific for one file format
+ *
+ * Every heuristic called from here must also be called from
+ * getFormatSpecificCompilerHeuristics().
+ */
+void Heuristics::getFormatSpecificPackerHeuristics()
+{
+}
+
 /**
  * Try detect compiler based on all available heuristics
  */
@@ -982,5 +992,16 @@ void Heuristics::getAllHeuristics()
 	getFormatSpecificCompilerHeuristics();
 }
 
+/**
+ * Try detect packer based on packer heuristics only
+ *
+ * This is much cheaper than getAllHeuristics() because heuristics of
+ * compilers, linkers, installers and languages are skipped.
+ */
+void Heuristics::getPackerHeuristics()
+{
+	getFormatSpecificPackerHeuristics();
+}
+
 } // namespace cpdetect
 } // namespace retdec
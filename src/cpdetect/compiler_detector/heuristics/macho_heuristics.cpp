@@ -135,5 +135,10 @@ void MachOHeuristics::getFormatSpecificCompilerHeuristics()
 	getSectionTableHeuristic();
 }
 
+void MachOHeuristics::getFormatSpecificPackerHeuristics()
+{
+	getUpxHeuristic();
+}
+
 } // namespace cpdetect
 } // namespace retdec
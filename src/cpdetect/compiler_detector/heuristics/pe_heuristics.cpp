@@ -1670,35 +1670,66 @@ void PeHeuristics::getFormatSpecificLanguageHeuristics()
 	getVisualBasicHeuristics();
 }
 
+/**
+ * Run heuristics for detection of used tools in their fixed order
+ * @param packersOnly If @c true, only heuristics which may detect packers are run
+ */
+void PeHeuristics::getToolHeuristics(bool packersOnly)
+{
+	struct ToolHeuristic
+	{
+		void (PeHeuristics::*heuristic)(); ///< heuristic to run
+		bool detectsPackers;               ///< @c true if heuristic may detect packers
+	};
+
+	static const ToolHeuristic toolHeuristics[] =
+	{
+		{&PeHeuristics::getSlashedSignatures, true},
+		{&PeHeuristics::getMorphineHeuristics, true},
+		{&PeHeuristics::getPelockHeuristics, true},
+		{&PeHeuristics::getEzirizReactorHeuristics, true},
+		{&PeHeuristics::getUpxHeuristics, true},
+		{&PeHeuristics::getFsgHeuristics, true},
+		{&PeHeuristics::getPeCompactHeuristics, true},
+		{&PeHeuristics::getAndpakkHeuristics, true},
+		{&PeHeuristics::getEnigmaHeuristics, true},
+		{&PeHeuristics::getVBoxHeuristics, true},
+		{&PeHeuristics::getActiveDeliveryHeuristics, true},
+		{&PeHeuristics::getAdeptProtectorHeuristics, true},
+		{&PeHeuristics::getCodeLockHeuristics, true},
+		{&PeHeuristics::getNetHeuristic, true},
+		{&PeHeuristics::getExcelsiorHeuristics, false},
+		{&PeHeuristics::getVmProtectHeuristics, true},
+		{&PeHeuristics::getBorlandDelphiHeuristics, false},
+		{&PeHeuristics::getBeRoHeuristics, false},
+		{&PeHeuristics::getMsvcIntelHeuristics, false},
+		{&PeHeuristics::getStarforceHeuristic, true},
+		{&PeHeuristics::getArmadilloHeuristic, true},
+		{&PeHeuristics::getRdataHeuristic, false},
+		{&PeHeuristics::getNullsoftHeuristic, false},
+		{&PeHeuristics::getLinkerVersionHeuristic, false},
+		{&PeHeuristics::getManifestHeuristic, false},
+		{&PeHeuristics::getSevenZipHeuristics, false},
+		{&PeHeuristics::getPeSectionHeuristics, true}
+	};
+
+	for (const auto &item : toolHeuristics)
+	{
+		if (item.detectsPackers || !packersOnly)
+		{
+			(this->*item.heuristic)();
+		}
+	}
+}
+
 void PeHeuristics::getFormatSpecificCompilerHeuristics()
 {
-	getSlashedSignatures();
-	getMorphineHeuristics();
-	getPelockHeuristics();
-	getEzirizReactorHeuristics();
-	getUpxHeuristics();
-	getFsgHeuristics();
-	getPeCompactHeuristics();
-	getAndpakkHeuristics();
-	getEnigmaHeuristics();
-	getVBoxHeuristics();
-	getActiveDeliveryHeuristics();
-	getAdeptProtectorHeuristics();
-	getCodeLockHeuristics();
-	getNetHeuristic();
-	getExcelsiorHeuristics();
-	getVmProtectHeuristics();
-	getBorlandDelphiHeuristics();
-	getBeRoHeuristics();
-	getMsvcIntelHeuristics();
-	getStarforceHeuristic();
-	getArmadilloHeuristic();
-	getRdataHeuristic();
-	getNullsoftHeuristic();
-	getLinkerVersionHeuristic();
-	getManifestHeuristic();
-	getSevenZipHeuristics();
-	getPeSectionHeuristics();
+	getToolHeuristics(false);
+}
+
+void PeHeuristics::getFormatSpecificPackerHeuristics()
+{
+	getToolHeuristics(true);
 }
 
 } // namespace cpdetect
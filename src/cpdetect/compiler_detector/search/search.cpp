@@ -5,6 +5,8 @@
  */
 
 #include <algorithm>
+#include <bitset>
+#include <cstring>
 #include <map>
 
 #include "retdec/utils/container.h"
@@ -114,6 +116,113 @@ std::size_t Search::RelativeJump::getBytesAfter() const
 	return bytesAfter;
 }
 
+/**
+ * Constructor of SimilarityPattern
+ * @param signPattern Signature pattern
+ *
+ * Patterns with slashes or with ';' characters are not packed. Similarity of them
+ * is counted nibble by nibble.
+ */
+Search::SimilarityPattern::SimilarityPattern(const std::string &signPattern) : pattern(signPattern),
+	packed(signPattern.find_first_of("/;") == std::string::npos)
+{
+	if(!packed)
+	{
+		return;
+	}
+
+	const auto words = (pattern.length() + 7) / 8;
+	values.resize(words);
+	cares.resize(words);
+	caresFrom.resize(words + 1);
+
+	for(std::size_t i = 0; i < words; ++i)
+	{
+		std::uint8_t valueBytes[8] = {};
+		std::uint8_t careBytes[8] = {};
+		for(std::size_t j = 0, index = i * 8; j < 8 && index < pattern.length(); ++j, ++index)
+		{
+			if(pattern[index] != '-' && pattern[index] != '?')
+			{
+				valueBytes[j] = pattern[index];
+				careBytes[j] = 0x80;
+				++caresFrom[i];
+			}
+		}
+
+		std::memcpy(&values[i], valueBytes, sizeof(values[i]));
+		std::memcpy(&cares[i], careBytes, sizeof(cares[i]));
+	}
+
+	for(std::size_t i = words; i > 0; --i)
+	{
+		caresFrom[i - 1] += caresFrom[i];
+	}
+}
+
+/**
+ * Destructor of SimilarityPattern
+ */
+Search::SimilarityPattern::~SimilarityPattern()
+{
+
+}
+
+/**
+ * Get original signature pattern
+ * @return Original signature pattern
+ */
+const std::string& Search::SimilarityPattern::getPattern() const
+{
+	return pattern;
+}
+
+/**
+ * Check if pattern is packed
+ * @return @c true if pattern is packed, @c false otherwise
+ */
+bool Search::SimilarityPattern::isPacked() const
+{
+	return packed;
+}
+
+/**
+ * Get number of 64-bit words of packed pattern
+ */
+std::size_t Search::SimilarityPattern::getNumberOfWords() const
+{
+	return values.size();
+}
+
+/**
+ * Get packed nibbles of pattern
+ * @param index Index of word
+ * @return Eight nibbles of pattern starting on nibble <tt>8 * index</tt>
+ */
+std::uint64_t Search::SimilarityPattern::getValues(std::size_t index) const
+{
+	return values[index];
+}
+
+/**
+ * Get packed masks of significant nibbles
+ * @param index Index of word
+ * @return Word with highest bit of each byte set if corresponding nibble is significant
+ */
+std::uint64_t Search::SimilarityPattern::getCares(std::size_t index) const
+{
+	return cares[index];
+}
+
+/**
+ * Get number of significant nibbles from word @a index to the end of pattern
+ * @param index Index of word (number of words means end of pattern)
+ */
+std::size_t Search::SimilarityPattern::getCaresFrom(std::size_t index) const
+{
+	return caresFrom[index];
+}
+
 /**
  * Check is some slashes are defined for target architecture of input file
  * @return @c true if at least one slash pattern is defined for target architecture
@@ -473,6 +582,125 @@ bool Search::areaSimilarity(const std::string &signPattern, Similarity &sim, std
 	return result;
 }
 
+/**
+ * Count number of significant nibbles of packed pattern which agree with content of file
+ * @param signPattern Packed signature pattern
+ * @param fileIndex Index of nibble in file on which pattern starts
+ * @param minSame Minimal interesting number of agreeing nibbles
+ * @param same Into this parameter is stored number of agreeing nibbles
+ * @return @c true if at least @a minSame nibbles agree, @c false otherwise
+ *
+ * Counting is stopped as soon as @a minSame nibbles cannot agree. Whole pattern
+ * must fit into content of file.
+ */
+bool Search::countPackedSimilarity(const SimilarityPattern &signPattern, std::size_t fileIndex, unsigned long long minSame, unsigned long long &same) const
+{
+	const auto length = signPattern.getPattern().length();
+	same = 0;
+
+	for(std::size_t i = 0, e = signPattern.getNumberOfWords(); i < e; ++i)
+	{
+		if(same + signPattern.getCaresFrom(i) < minSame)
+		{
+			return false;
+		}
+
+		std::uint64_t fileWord = 0;
+		std::memcpy(&fileWord, nibbles.data() + fileIndex + i * 8, std::min<std::size_t>(8, length - i * 8));
+		const auto diff = fileWord ^ signPattern.getValues(i);
+		// highest bit of each byte is set if the byte of diff is not zero
+		const auto differ = ((diff & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) | diff;
+		same += std::bitset<64>(~differ & signPattern.getCares(i)).count();
+	}
+
+	return same >= minSame;
+}
+
+/**
+ * Count the most similar similarity in area
+ * @param signPattern Prepared signature pattern
+ * @param sim Structure for save similarity
+ * @param startOffset Start offset in file (in bytes)
+ * @param stopOffset Stop offset in file (in bytes)
+ * @param minRatio Minimal interesting similarity ratio
+ * @return @c true if function went OK and found similarity is at least @a minRatio,
+ *    @c false otherwise
+ *
+ * Result is the same as the result of areaSimilarity() for the original pattern,
+ * but packed patterns are compared by eight nibbles at once and positions which
+ * cannot give better similarity are rejected early.
+ *
+ * If function return @c false, @a sim is left unchanged
+ */
+bool Search::areaSimilarity(const SimilarityPattern &signPattern, Similarity &sim, std::size_t startOffset, std::size_t stopOffset, double minRatio) const
+{
+	if(!signPattern.isPacked())
+	{
+		Similarity act;
+		if(!areaSimilarity(signPattern.getPattern(), act, startOffset, stopOffset) || act.ratio < minRatio)
+		{
+			return false;
+		}
+
+		sim.same = act.same;
+		sim.total = act.total;
+		sim.ratio = act.ratio;
+		return true;
+	}
+	if(startOffset > stopOffset)
+	{
+		return false;
+	}
+
+	const auto areaSize = nibblesFromBytes(stopOffset - startOffset + 1);
+	const auto signSize = signPattern.getPattern().length();
+	const unsigned long long total = signPattern.getCaresFrom(0);
+	if(areaSize < signSize || !total || static_cast<double>(total) / total < minRatio)
+	{
+		return false;
+	}
+	const auto iters = (startOffset == stopOffset) ? 1 : areaSize - signSize + 1;
+
+	// Total number of significant nibbles is the same on all positions, so
+	// position is better only if more nibbles agree on it.
+	unsigned long long minSame = 0;
+	while(static_cast<double>(minSame) / total < minRatio)
+	{
+		++minSame;
+	}
+
+	auto result = false;
+	unsigned long long maxSame = 0;
+	for(std::size_t i = 0, fileIndex = nibblesFromBytes(startOffset); i < iters; ++i, ++fileIndex)
+	{
+		// Nibble after the pattern must be in file too.
+		if(fileIndex + signSize >= nibbles.length())
+		{
+			break;
+		}
+
+		unsigned long long same = 0;
+		if(countPackedSimilarity(signPattern, fileIndex, result ? maxSame + 1 : minSame, same))
+		{
+			maxSame = same;
+			result = true;
+			if(maxSame == total)
+			{
+				break;
+			}
+		}
+	}
+
+	if(result)
+	{
+		sim.same = maxSame;
+		sim.total = total;
+		sim.ratio = static_cast<double>(maxSame) / total;
+	}
+
+	return result;
+}
+
 /**
  * Check if file contains specified substring
  * @param str Coveted substring
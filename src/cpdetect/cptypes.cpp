@@ -13,7 +13,8 @@ namespace cpdetect {
  * Constructor of DetectParams structure
  */
 DetectParams::DetectParams(SearchType searchType_, bool internal_, bool external_, std::size_t epBytesCount_) :
-		searchType(searchType_), internal(internal_), external(external_), epBytesCount(epBytesCount_)
+		searchType(searchType_), internal(internal_), external(external_), epBytesCount(epBytesCount_),
+		packersOnly(false)
 {
 
 }
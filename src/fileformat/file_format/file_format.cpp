@@ -164,12 +164,19 @@ void FileFormat::init()
 		crc32.clear();
 		md5.clear();
 		sha256.clear();
+		byteStatistics.clear();
+		similarityHash.clear();
 	}
 	else
 	{
 		crc32 = retdec::crypto::getCrc32(bytes.data(), bytes.size());
 		md5 = retdec::crypto::getMd5(bytes.data(), bytes.size());
 		sha256 = retdec::crypto::getSha256(bytes.data(), bytes.size());
+		byteStatistics.clear();
+		byteStatistics.update(bytes.data(), bytes.size());
+		SimilarityHash hash;
+		hash.update(bytes.data(), bytes.size());
+		similarityHash = hash.getDigest();
 	}
 	initStream();
 }
@@ -934,6 +941,46 @@ std::string FileFormat::getSha256() const
 	return sha256;
 }
 
+/**
+ * Get statistics of byte values
+ * @return Statistics of byte values of file content
+ *
+ * Statistics are computed together with hashes of file content, so they are
+ * empty if file hashes were not computed
+ */
+const ByteStatistics& FileFormat::getByteStatistics() const
+{
+	return byteStatistics;
+}
+
+/**
+ * Get statistics of byte values of overlay
+ * @return Statistics of byte values of overlay (empty if there is no overlay)
+ */
+ByteStatistics FileFormat::getOverlayByteStatistics() const
+{
+	ByteStatistics result;
+	const auto size = getOverlaySize();
+	if(size)
+	{
+		result.update(getLoadedBytesData() + getDeclaredFileLength(), size);
+	}
+
+	return result;
+}
+
+/**
+ * Get locality-sensitive hash
+ * @return Digest of file content (see SimilarityHash)
+ *
+ * Hash is computed together with hashes of file content, so it is empty if
+ * file hashes were not computed or if file is too small
+ */
+std::string FileFormat::getSimilarityHash() const
+{
+	return similarityHash;
+}
+
 /**
  * Get section table CRC32
  * @return CRC32 of section table
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 
 #include "retdec/utils/conversion.h"
@@ -14,6 +16,62 @@ using namespace retdec::utils;
 namespace retdec {
 namespace fileformat {
 
+namespace
+{
+
+const std::size_t READ_BLOCK_SIZE = 0x10000;
+const int END_OF_INPUT = -1;
+const std::uint8_t NOT_HEX = 0xFF;
+
+/**
+ * Creates table of values of hexadecimal digits indexed by character
+ * @return Table with @c NOT_HEX for characters which are not hexadecimal digits
+ */
+std::array<std::uint8_t, 0x100> createHexDigitValues()
+{
+	std::array<std::uint8_t, 0x100> result;
+	result.fill(NOT_HEX);
+
+	for(unsigned i = 0; i < 10; ++i)
+	{
+		result['0' + i] = i;
+	}
+
+	for(unsigned i = 0; i < 6; ++i)
+	{
+		result['a' + i] = 10 + i;
+		result['A' + i] = 10 + i;
+	}
+
+	return result;
+}
+
+const auto hexDigitValues = createHexDigitValues();
+
+/**
+ * Converts big-endian bytes to integer
+ * @param bytes Bytes to convert
+ * @param size Number of bytes
+ * @return Integer value or zero if value does not fit into 64 bits
+ */
+unsigned long long bytesToInt(const std::uint8_t *bytes, std::size_t size)
+{
+	unsigned long long result = 0;
+	for(std::size_t i = 0; i < size; ++i)
+	{
+		if(result >> 56)
+		{
+			return 0;
+		}
+
+		result = (result << 8) | bytes[i];
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
 /**
  * Constructor
  */
@@ -64,161 +122,280 @@ IntelHexParser::~IntelHexParser()
 }
 
 /**
- * Parsing
+ * Sets input stream to parse and prepares the read buffer
+ * @param inputStream Reference to std::istream
  * @return @c true on success, @c false otherwise
  */
-bool IntelHexParser::parse()
+bool IntelHexParser::setInputStream(std::istream &inputStream)
 {
-	index = 0;
-	IntelHexToken token;
-
-	while(true)
+	if(!inputStream)
 	{
-		token = tokenizer.getToken();
-		switch(token.recordType)
-		{
-			case IntelHexToken::REC_TYPE::RT_DATA:
-				handleData(token);
-				break;
-			case IntelHexToken::REC_TYPE::RT_EXT_LINADDR:
-				setOffset(token);
-				break;
-			case IntelHexToken::REC_TYPE::RT_EXT_SEGADDR:
-				setSegment(token);
-				break;
-			case IntelHexToken::REC_TYPE::RT_START_LINADDR:
-				setEIP(token);
-				break;
-			case IntelHexToken::REC_TYPE::RT_START_SEGADDR:
-				setCSIP(token);
-				break;
-			case IntelHexToken::REC_TYPE::RT_EOFILE:
-				sections.push_back(actualSection);
-				return true;
-			case IntelHexToken::REC_TYPE::RT_ERROR:
-			default:
-				errorDesc = token.errorDesc;
-				return false;
-		}
+		return false;
 	}
 
+	source = &inputStream;
+	buffer.resize(READ_BLOCK_SIZE);
+	bufferPos = 0;
+	bufferEnd = 0;
 	return true;
 }
 
 /**
- * Parse data Intel HEX data record
- * @param token Data token received from tokenizer
+ * Reads next block of characters from input stream
+ * @return @c true if at least one character was read, @c false otherwise
  */
-void IntelHexParser::handleData(const IntelHexToken &token)
+bool IntelHexParser::fillBuffer()
 {
-	retdec::utils::Address address = 0;
-	// 32bit mode
-	if(mode)
+	bufferPos = 0;
+	bufferEnd = 0;
+	if(!source || !*source)
 	{
-		address = upperAddress;
-		address = address << 16;
-		address = address | IntelHexParser::strToInt(token.address);
+		return false;
 	}
-	// 8086 real mode
-	else
+
+	source->read(buffer.data(), buffer.size());
+	bufferEnd = static_cast<std::size_t>(source->gcount());
+	return bufferEnd != 0;
+}
+
+/**
+ * Get next character from input
+ * @return Next character or @c END_OF_INPUT if there are no more characters
+ */
+inline int IntelHexParser::getChar()
+{
+	if(bufferPos == bufferEnd && !fillBuffer())
 	{
-		address = segmenetAddress;
-		address = address * 16;
-		address = address + IntelHexParser::strToInt(token.address);
+		return END_OF_INPUT;
 	}
 
-	const int diff = address - (actualAddress - 1);
-	if(diff == 1)
+	return static_cast<unsigned char>(buffer[bufferPos++]);
+}
+
+/**
+ * Reads one byte written as two hexadecimal digits
+ * @param byte Into this parameter the read byte is stored
+ * @return @c true on success, @c false if digits are not hexadecimal
+ */
+inline bool IntelHexParser::readByte(std::uint8_t &byte)
+{
+	const int high = getChar();
+	const int low = getChar();
+	if(high == END_OF_INPUT || low == END_OF_INPUT)
 	{
-		// Still the same section
-		for(std::vector<int>::size_type i = 0; i < token.data.size(); i += 2)
-		{
-			// Size of vector is always even
-			std::string tmp;
-			tmp.push_back(token.data[i]);
-			tmp.push_back(token.data[i+1]);
-			actualSection.data.push_back(IntelHexParser::strToInt(tmp));
-			actualAddress += 1;
-		}
+		return false;
 	}
-	else
+
+	const auto highValue = hexDigitValues[high];
+	const auto lowValue = hexDigitValues[low];
+	if(highValue == NOT_HEX || lowValue == NOT_HEX)
 	{
-		// New section
-		if(actualAddress)
-		{
-			sections.push_back(actualSection);
-			++index;
-		}
+		return false;
+	}
 
-		actualAddress = address;
-		actualSection.address = address;
-		actualSection.index = index;
-		actualSection.data.clear();
+	byte = static_cast<std::uint8_t>((highValue << 4) | lowValue);
+	return true;
+}
 
-		for(std::vector<int>::size_type i = 0; i < token.data.size(); i += 2)
+/**
+ * Skips newline delimiters between records
+ * @return @c true if next record follows, @c false otherwise
+ */
+bool IntelHexParser::skipNewlines()
+{
+	while(true)
+	{
+		const int c = getChar();
+		if(c == '\r' || c == '\n')
+		{
+			continue;
+		}
+		else if(c == ':')
 		{
-			std::string tmp;
-			tmp.push_back(token.data[i]);
-			tmp.push_back(token.data[i+1]);
-			actualSection.data.push_back(IntelHexParser::strToInt(tmp));
-			actualAddress += 1;
+			// New record, let parseRecord() read the colon
+			--bufferPos;
+			return true;
 		}
+
+		return false;
 	}
 }
 
 /**
- * Sets new address offset value
- * @param token Extended address token
+ * Stores error description
+ * @param description Error description
+ * @return Always @c false
  */
-void IntelHexParser::setOffset(const IntelHexToken &token)
+bool IntelHexParser::failure(const std::string &description)
 {
-	mode = true;
-	upperAddress = IntelHexParser::strToInt(token.data);
+	errorDesc = description;
+	return false;
 }
 
 /**
- * Sets new segment value
- * @param token Segment info token
+ * Parsing
+ * @return @c true on success, @c false otherwise
  */
-void IntelHexParser::setSegment(const IntelHexToken &token)
+bool IntelHexParser::parse()
 {
-	mode = false;
-	segmenetAddress = IntelHexParser::strToInt(token.data);
+	index = 0;
+	bool endOfFile = false;
+
+	while(parseRecord(endOfFile))
+	{
+		if(endOfFile)
+		{
+			sections.push_back(std::move(actualSection));
+			actualSection.data.clear();
+			return true;
+		}
+	}
+
+	return false;
 }
 
 /**
- * Sets value of entry point
- * @param token EIP token
+ * Parse one Intel HEX record
+ * @param endOfFile Into this parameter is stored @c true if end of file record was parsed
+ * @return @c true on success, @c false otherwise
+ *
+ * Data bytes are decoded straight into the actual section and checksum is
+ * computed along the way, so no intermediate strings are created.
  */
-void IntelHexParser::setEIP(const IntelHexToken &token)
+bool IntelHexParser::parseRecord(bool &endOfFile)
 {
-	hasEP = true;
-	EIP = IntelHexParser::strToInt(token.data);
+	// Starting colon
+	if(getChar() != ':')
+	{
+		return failure("Starting semicolon missing.");
+	}
+
+	// Byte count
+	std::uint8_t byteCount = 0;
+	if(!readByte(byteCount))
+	{
+		return failure("Invalid byte count sequence.");
+	}
+
+	// Address
+	std::uint8_t addressHigh = 0, addressLow = 0;
+	if(!readByte(addressHigh) || !readByte(addressLow))
+	{
+		return failure("Invalid address sequence.");
+	}
+
+	// Record type, max. type number is 5
+	std::uint8_t recordType = 0;
+	if(!readByte(recordType) || recordType > IntelHexToken::REC_TYPE::RT_START_LINADDR)
+	{
+		return failure("Invalid record type sequence.");
+	}
+
+	// Data
+	std::uint8_t record[0x100];
+	auto *data = record;
+	if(recordType == IntelHexToken::REC_TYPE::RT_DATA)
+	{
+		data = startData((addressHigh << 8) | addressLow, byteCount);
+	}
+
+	unsigned checksum = byteCount + addressHigh + addressLow + recordType;
+	for(std::size_t i = 0; i < byteCount; ++i)
+	{
+		if(!readByte(data[i]))
+		{
+			return failure("Invalid data sequence.");
+		}
+
+		checksum += data[i];
+	}
+
+	// Checksum
+	std::uint8_t recordChecksum = 0;
+	if(!readByte(recordChecksum) || ((checksum + recordChecksum) & 0xFF))
+	{
+		return failure("Invalid checksum.");
+	}
+
+	switch(recordType)
+	{
+		case IntelHexToken::REC_TYPE::RT_EXT_LINADDR:
+			mode = true;
+			upperAddress = bytesToInt(record, byteCount);
+			break;
+		case IntelHexToken::REC_TYPE::RT_EXT_SEGADDR:
+			mode = false;
+			segmenetAddress = bytesToInt(record, byteCount);
+			break;
+		case IntelHexToken::REC_TYPE::RT_START_LINADDR:
+			hasEP = true;
+			EIP = bytesToInt(record, byteCount);
+			break;
+		case IntelHexToken::REC_TYPE::RT_START_SEGADDR:
+			hasEP = true;
+			CS = bytesToInt(record, std::min<std::size_t>(byteCount, 2));
+			IP = byteCount > 2 ? bytesToInt(record + 2, std::min<std::size_t>(byteCount - 2, 2)) : 0;
+			break;
+		case IntelHexToken::REC_TYPE::RT_EOFILE:
+			endOfFile = true;
+			return true;
+		default:
+			break;
+	}
+
+	// Newline delimiters
+	if(!skipNewlines())
+	{
+		return failure("Invalid newline sequence.");
+	}
+
+	return true;
 }
 
 /**
- * Sets value of entry point
- * @param token CS:IP token
+ * Prepares actual section for data of new data record
+ * @param offset Address field of data record
+ * @param byteCount Number of data bytes in record
+ * @return Pointer to the place where data of record should be stored
  */
-void IntelHexParser::setCSIP(const IntelHexToken &token)
+std::vector<unsigned char>::pointer IntelHexParser::startData(std::uint16_t offset, std::uint8_t byteCount)
 {
-	std::string first;
-
-	for(unsigned i = 0; i < 4; ++i)
+	retdec::utils::Address address = 0;
+	// 32bit mode
+	if(mode)
+	{
+		address = upperAddress;
+		address = address << 16;
+		address = address | offset;
+	}
+	// 8086 real mode
+	else
 	{
-		first.push_back(token.data[i]);
+		address = segmenetAddress;
+		address = address * 16;
+		address = address + offset;
 	}
 
-	std::string second;
-
-	for(unsigned i = 4; i < 8; ++i)
+	const int diff = address - (actualAddress - 1);
+	if(diff != 1)
 	{
-		second.push_back(token.data[i]);
+		// New section
+		if(actualAddress)
+		{
+			sections.push_back(std::move(actualSection));
+			++index;
+		}
+
+		actualAddress = address;
+		actualSection.address = address;
+		actualSection.index = index;
+		actualSection.data.clear();
 	}
 
-	hasEP = true;
-	CS = IntelHexParser::strToInt(first);
-	IP = IntelHexParser::strToInt(second);
+	const auto oldSize = actualSection.data.size();
+	actualSection.data.resize(oldSize + byteCount);
+	actualAddress += byteCount;
+	return actualSection.data.data() + oldSize;
 }
 
 /**
@@ -228,7 +405,8 @@ void IntelHexParser::setCSIP(const IntelHexToken &token)
  */
 bool IntelHexParser::parseFile(const std::string &pathToFile)
 {
-	if(!tokenizer.openFile(pathToFile))
+	fstr.open(pathToFile, std::ifstream::binary);
+	if(!fstr.is_open() || !setInputStream(fstr))
 	{
 		errorDesc = "Unable to open file.";
 		return false;
@@ -244,7 +422,7 @@ bool IntelHexParser::parseFile(const std::string &pathToFile)
  */
 bool IntelHexParser::parseStream(std::istream &inputStream)
 {
-	if(!tokenizer.setInputStream(inputStream))
+	if(!setInputStream(inputStream))
 	{
 		errorDesc = "Unable to load stream.";
 		return false;
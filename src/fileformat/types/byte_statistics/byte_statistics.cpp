@@ -0,0 +1,192 @@
+/**
+ * @file src/fileformat/types/byte_statistics/byte_statistics.cpp
+ * @brief Class for statistics of byte values.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cmath>
+
+#include "retdec/fileformat/types/byte_statistics/byte_statistics.h"
+
+namespace retdec {
+namespace fileformat {
+
+namespace
+{
+
+/// Minimal number of bytes for which content is guessed
+const std::uint64_t MIN_GUESS_SIZE = 256;
+/// Entropy (bits per byte) from which data are considered compressed or encrypted
+const double HIGH_ENTROPY = 7.2;
+/// Chi-square critical value for 255 degrees of freedom and significance level 0.001
+const double UNIFORM_CHI_SQUARE_LIMIT = 330.5;
+
+} // anonymous namespace
+
+/**
+ * Constructor
+ */
+ByteStatistics::ByteStatistics() : size(0)
+{
+	histogram.fill(0);
+}
+
+/**
+ * Destructor
+ */
+ByteStatistics::~ByteStatistics()
+{
+
+}
+
+/**
+ * Get histogram of byte values
+ * @return Number of occurrences of each byte value
+ */
+const ByteStatistics::Histogram& ByteStatistics::getHistogram() const
+{
+	return histogram;
+}
+
+/**
+ * Get number of counted bytes
+ * @return Number of counted bytes
+ */
+std::uint64_t ByteStatistics::getSize() const
+{
+	return size;
+}
+
+/**
+ * Get Shannon entropy of counted bytes
+ * @return Entropy in bits per byte (from 0 to 8)
+ */
+double ByteStatistics::getEntropy() const
+{
+	if(!size)
+	{
+		return 0.0;
+	}
+
+	double entropy = 0.0;
+	for(auto count : histogram)
+	{
+		if(count)
+		{
+			const double probability = static_cast<double>(count) / size;
+			entropy -= probability * std::log2(probability);
+		}
+	}
+
+	return entropy;
+}
+
+/**
+ * Get chi-square score of counted bytes against uniform distribution
+ * @return Chi-square score (the lower the more uniform byte values are)
+ */
+double ByteStatistics::getChiSquare() const
+{
+	if(!size)
+	{
+		return 0.0;
+	}
+
+	const double expected = static_cast<double>(size) / histogram.size();
+	double chiSquare = 0.0;
+	for(auto count : histogram)
+	{
+		const double diff = count - expected;
+		chiSquare += diff * diff / expected;
+	}
+
+	return chiSquare;
+}
+
+/**
+ * Guess content of counted bytes from their entropy and chi-square score
+ * @return Likely content of data
+ */
+ByteStatistics::Content ByteStatistics::getLikelyContent() const
+{
+	if(size < MIN_GUESS_SIZE)
+	{
+		return Content::UNKNOWN;
+	}
+	else if(getEntropy() < HIGH_ENTROPY)
+	{
+		return Content::PLAIN;
+	}
+
+	return getChiSquare() <= UNIFORM_CHI_SQUARE_LIMIT ? Content::ENCRYPTED : Content::COMPRESSED;
+}
+
+/**
+ * Count bytes
+ * @param data Pointer to bytes
+ * @param dataSize Number of bytes
+ */
+void ByteStatistics::update(const unsigned char *data, std::uint64_t dataSize)
+{
+	if(!data)
+	{
+		return;
+	}
+
+	for(std::uint64_t i = 0; i < dataSize; ++i)
+	{
+		++histogram[data[i]];
+	}
+
+	size += dataSize;
+}
+
+/**
+ * Reset all counts
+ */
+void ByteStatistics::clear()
+{
+	histogram.fill(0);
+	size = 0;
+}
+
+/**
+ * @return @c true if no bytes were counted, @c false otherwise
+ */
+bool ByteStatistics::isEmpty() const
+{
+	return !size;
+}
+
+/**
+ * @return @c true if counted bytes are likely compressed or encrypted, @c false otherwise
+ */
+bool ByteStatistics::isLikelyPacked() const
+{
+	const auto content = getLikelyContent();
+	return content == Content::COMPRESSED || content == Content::ENCRYPTED;
+}
+
+/**
+ * Get name of likely content
+ * @param content Likely content of data
+ * @return Name of content
+ */
+std::string contentToString(ByteStatistics::Content content)
+{
+	switch(content)
+	{
+		case ByteStatistics::Content::PLAIN:
+			return "plain";
+		case ByteStatistics::Content::COMPRESSED:
+			return "compressed";
+		case ByteStatistics::Content::ENCRYPTED:
+			return "encrypted";
+		case ByteStatistics::Content::UNKNOWN:
+		default:
+			return "unknown";
+	}
+}
+
+} // namespace fileformat
+} // namespace retdec
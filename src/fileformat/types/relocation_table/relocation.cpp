@@ -9,11 +9,19 @@
 namespace retdec {
 namespace fileformat {
 
+namespace
+{
+
+const std::string emptyName;
+const std::vector<std::uint8_t> emptyMask;
+
+} // anonymous namespace
+
 /**
  * Constructor
  */
 Relocation::Relocation() : address(0), offsetInSection(0), linkToSection(0),
-	addend(0), type(0), linkToSectionIsValid(false), linkToSymbolIsValid(false)
+	linkToSymbol(0), addend(0), type(0), linkToSectionIsValid(false), linkToSymbolIsValid(false)
 {
 
 }
@@ -30,9 +38,9 @@ Relocation::~Relocation()
  * Get name of relocation
  * @return Relocation name
  */
-std::string Relocation::getName() const
+const std::string& Relocation::getName() const
 {
-	return name;
+	return name ? *name : emptyName;
 }
 
 /**
@@ -109,18 +117,25 @@ unsigned long long Relocation::getType() const
  * Get relocation mask
  * @return Relocation mask as vector of mask bytes
  */
-std::vector<std::uint8_t> Relocation::getMask() const
+const std::vector<std::uint8_t>& Relocation::getMask() const
 {
-	return mask;
+	return mask ? *mask : emptyMask;
 }
 
 /**
  * Set relocation name
  * @param relocationName Name of relocation
  */
-void Relocation::setName(std::string relocationName)
+void Relocation::setName(const std::string &relocationName)
 {
-	name = relocationName;
+	if(relocationName.empty())
+	{
+		name.reset();
+	}
+	else
+	{
+		name = std::make_shared<const std::string>(relocationName);
+	}
 }
 
 /**
@@ -185,7 +200,14 @@ void Relocation::setType(unsigned long long relocationType)
  */
 void Relocation::setMask(const std::vector<std::uint8_t> &relocationMask)
 {
-	mask = relocationMask;
+	if(relocationMask.empty())
+	{
+		mask.reset();
+	}
+	else
+	{
+		mask = std::make_shared<const std::vector<std::uint8_t>>(relocationMask);
+	}
 }
 
 /**
@@ -217,7 +239,7 @@ void Relocation::invalidateLinkToSymbol()
  */
 bool Relocation::hasEmptyName() const
 {
-	return name.empty();
+	return !name;
 }
 
 } // namespace fileformat
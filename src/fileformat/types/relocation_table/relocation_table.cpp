@@ -12,6 +12,20 @@ using namespace retdec::utils;
 namespace retdec {
 namespace fileformat {
 
+/**
+ * Replace value by its instance shared in table
+ * @param value Value to replace
+ * @param pool Shared instances of values
+ */
+template<typename T, typename Pool>
+void RelocationTable::intern(std::shared_ptr<const T> &value, Pool &pool)
+{
+	if(value)
+	{
+		value = *pool.insert(value).first;
+	}
+}
+
 /**
  * Constructor
  */
@@ -125,6 +139,8 @@ RelocationTable::relocationsIterator RelocationTable::end() const
 void RelocationTable::clear()
 {
 	table.clear();
+	names.clear();
+	masks.clear();
 }
 
 /**
@@ -133,6 +149,8 @@ void RelocationTable::clear()
  */
 void RelocationTable::addRelocation(Relocation &relocation)
 {
+	intern(relocation.name, names);
+	intern(relocation.mask, masks);
 	table.push_back(relocation);
 }
 
@@ -11,6 +11,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/fileformat/types/sec_seg/sec_seg.h"
+#include "retdec/fileformat/types/similarity_hash/similarity_hash.h"
 #include "retdec/fileformat/utils/conversions.h"
 #include "retdec/fileformat/utils/file_io.h"
 #include "retdec/fileformat/utils/other.h"
@@ -40,7 +41,10 @@ SecSeg::~SecSeg()
 }
 
 /**
- * Compute all supported hashes
+ * Compute all supported hashes and statistics of byte values
+ *
+ * Locality-sensitive hash is computed only for code, because it is used to
+ * find variants of already analysed code
  */
 void SecSeg::computeHashes()
 {
@@ -48,6 +52,18 @@ void SecSeg::computeHashes()
 	crc32 = retdec::crypto::getCrc32(hashData, bytes.size());
 	md5 = retdec::crypto::getMd5(hashData, bytes.size());
 	sha256 = retdec::crypto::getSha256(hashData, bytes.size());
+	byteStatistics.clear();
+	byteStatistics.update(hashData, bytes.size());
+	if(isSomeCode())
+	{
+		SimilarityHash hash;
+		hash.update(hashData, bytes.size());
+		similarityHash = hash.getDigest();
+	}
+	else
+	{
+		similarityHash.clear();
+	}
 }
 
 /**
@@ -204,6 +220,31 @@ std::string SecSeg::getSha256() const
 	return sha256;
 }
 
+/**
+ * Get statistics of byte values
+ * @return Statistics of byte values of section or segment data
+ *
+ * Statistics are computed together with hashes, so they are empty when
+ * hashes were not computed
+ */
+const ByteStatistics& SecSeg::getByteStatistics() const
+{
+	return byteStatistics;
+}
+
+/**
+ * Get locality-sensitive hash
+ * @return Digest of section or segment data (see SimilarityHash)
+ *
+ * Hash is computed together with other hashes and only for code, so it is
+ * empty for other sections and segments, when hashes were not computed or
+ * when there are too few data
+ */
+std::string SecSeg::getSimilarityHash() const
+{
+	return similarityHash;
+}
+
 /**
  * Get name
  * @return Name
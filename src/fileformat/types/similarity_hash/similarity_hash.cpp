@@ -0,0 +1,307 @@
+/**
+ * @file src/fileformat/types/similarity_hash/similarity_hash.cpp
+ * @brief Class for locality-sensitive hash of data.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "retdec/utils/conversion.h"
+#include "retdec/fileformat/types/similarity_hash/similarity_hash.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace fileformat {
+
+namespace
+{
+
+/// Number of bytes of digest body (two bits for each bucket)
+const std::size_t BODY_SIZE = SimilarityHash::BUCKETS / 4;
+/// Number of bytes of digest header (checksum, length, quartile ratios)
+const std::size_t HEADER_SIZE = 3;
+/// Penalty for big difference of header values
+const std::size_t HEADER_DIFF_PENALTY = 12;
+/// Penalty for the biggest possible difference of bucket quartiles
+const std::size_t BUCKET_DIFF_PENALTY = 6;
+
+/**
+ * Create permutation of byte values used for Pearson hashing
+ * @return Permutation of byte values
+ */
+std::array<std::uint8_t, 256> createPearsonTable()
+{
+	std::array<std::uint8_t, 256> table;
+	for(std::size_t i = 0; i < table.size(); ++i)
+	{
+		table[i] = static_cast<std::uint8_t>(i);
+	}
+
+	// Fisher-Yates shuffle driven by xorshift generator with fixed seed,
+	// so the table (and therefore all digests) is always the same
+	std::uint32_t state = 0x2545F491;
+	for(std::size_t i = table.size() - 1; i > 0; --i)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		std::swap(table[i], table[state % (i + 1)]);
+	}
+
+	return table;
+}
+
+/**
+ * Pearson hash of three bytes
+ * @param salt Salt which distinguishes mappings of different trigrams
+ * @param first First byte
+ * @param second Second byte
+ * @param third Third byte
+ * @return Hash of bytes
+ */
+std::uint8_t pearsonHash(std::uint8_t salt, std::uint8_t first, std::uint8_t second, std::uint8_t third)
+{
+	static const auto table = createPearsonTable();
+	return table[table[table[table[salt] ^ first] ^ second] ^ third];
+}
+
+/**
+ * Get logarithmic representation of data length
+ * @param size Length of data
+ * @return Length which fits into one byte
+ */
+std::uint8_t lengthToByte(std::uint64_t size)
+{
+	double result;
+	if(size <= 656)
+	{
+		result = std::log(size) / std::log(1.5);
+	}
+	else if(size <= 3199)
+	{
+		result = std::log(size) / std::log(1.3) - 8.72777;
+	}
+	else
+	{
+		result = std::log(size) / std::log(1.1) - 62.5472;
+	}
+
+	return static_cast<std::uint8_t>(static_cast<std::uint64_t>(std::floor(result)) & 0xFF);
+}
+
+/**
+ * Get distance of two values on circle with @a range values
+ * @param first First value
+ * @param second Second value
+ * @param range Number of values on circle
+ * @return Distance of values
+ */
+std::size_t circularDistance(std::size_t first, std::size_t second, std::size_t range)
+{
+	const auto diff = first > second ? first - second : second - first;
+	return std::min(diff, range - diff);
+}
+
+/**
+ * Get distance of two header values
+ * @param first First value
+ * @param second Second value
+ * @param range Number of possible values
+ * @return Distance of values (big differences are penalized)
+ */
+std::size_t headerDistance(std::size_t first, std::size_t second, std::size_t range)
+{
+	const auto diff = circularDistance(first, second, range);
+	return diff <= 1 ? diff : (diff - 1) * HEADER_DIFF_PENALTY;
+}
+
+/**
+ * Convert digest to bytes
+ * @param digest Digest
+ * @param bytes Into this parameter are stored bytes of digest
+ * @return @c true if digest is valid, @c false otherwise
+ */
+bool digestToBytes(const std::string &digest, std::vector<std::uint8_t> &bytes)
+{
+	if(digest.length() != SimilarityHash::DIGEST_LENGTH)
+	{
+		return false;
+	}
+
+	bytes.clear();
+	bytes.reserve(digest.length() / 2);
+	for(std::size_t i = 0; i < digest.length(); i += 2)
+	{
+		if(!std::isxdigit(static_cast<unsigned char>(digest[i])) || !std::isxdigit(static_cast<unsigned char>(digest[i + 1])))
+		{
+			return false;
+		}
+		bytes.push_back(static_cast<std::uint8_t>(std::strtoul(digest.substr(i, 2).c_str(), nullptr, 16)));
+	}
+
+	return true;
+}
+
+} // anonymous namespace
+
+const std::size_t SimilarityHash::BUCKETS;
+const std::size_t SimilarityHash::MIN_DATA_SIZE;
+const std::size_t SimilarityHash::DIGEST_LENGTH;
+
+/**
+ * Constructor
+ */
+SimilarityHash::SimilarityHash()
+{
+	clear();
+}
+
+/**
+ * Destructor
+ */
+SimilarityHash::~SimilarityHash()
+{
+
+}
+
+/**
+ * Get number of processed bytes
+ * @return Number of processed bytes
+ */
+std::uint64_t SimilarityHash::getSize() const
+{
+	return size;
+}
+
+/**
+ * Get digest of processed bytes
+ * @return Digest (hexadecimal string) or empty string if there are too few
+ *    processed bytes or if they are too uniform to compute meaningful digest
+ */
+std::string SimilarityHash::getDigest() const
+{
+	if(size < MIN_DATA_SIZE)
+	{
+		return "";
+	}
+
+	std::vector<std::uint32_t> sorted(buckets.begin(), buckets.begin() + BUCKETS);
+	std::sort(sorted.begin(), sorted.end());
+	const std::uint64_t q1 = sorted[BUCKETS / 4 - 1];
+	const std::uint64_t q2 = sorted[BUCKETS / 2 - 1];
+	const std::uint64_t q3 = sorted[BUCKETS * 3 / 4 - 1];
+	const auto nonZero = BUCKETS - (std::upper_bound(sorted.begin(), sorted.end(), 0) - sorted.begin());
+	if(!q3 || nonZero <= BUCKETS / 2)
+	{
+		return "";
+	}
+
+	std::vector<std::uint8_t> bytes(HEADER_SIZE + BODY_SIZE, 0);
+	bytes[0] = checksum;
+	bytes[1] = lengthToByte(size);
+	bytes[2] = static_cast<std::uint8_t>((((q1 * 100 / q3) & 0x0F) << 4) | ((q2 * 100 / q3) & 0x0F));
+	for(std::size_t i = 0; i < BUCKETS; ++i)
+	{
+		const auto count = buckets[i];
+		const std::uint8_t quartile = count <= q1 ? 0 : (count <= q2 ? 1 : (count <= q3 ? 2 : 3));
+		bytes[HEADER_SIZE + i / 4] |= quartile << ((i % 4) * 2);
+	}
+
+	std::string result;
+	bytesToHexString(bytes, result);
+	return result;
+}
+
+/**
+ * Process bytes
+ * @param data Pointer to bytes
+ * @param dataSize Number of bytes
+ *
+ * Calling this method repeatedly gives the same digest as processing all bytes
+ * at once
+ */
+void SimilarityHash::update(const unsigned char *data, std::uint64_t dataSize)
+{
+	if(!data)
+	{
+		return;
+	}
+
+	for(std::uint64_t i = 0; i < dataSize; ++i)
+	{
+		const auto byte = data[i];
+		if(size + i >= window.size())
+		{
+			checksum = pearsonHash(0, byte, window[0], checksum);
+			++buckets[pearsonHash(2, byte, window[0], window[1])];
+			++buckets[pearsonHash(3, byte, window[0], window[2])];
+			++buckets[pearsonHash(5, byte, window[1], window[2])];
+			++buckets[pearsonHash(7, byte, window[1], window[3])];
+			++buckets[pearsonHash(11, byte, window[0], window[3])];
+			++buckets[pearsonHash(13, byte, window[2], window[3])];
+		}
+
+		window[3] = window[2];
+		window[2] = window[1];
+		window[1] = window[0];
+		window[0] = byte;
+	}
+
+	size += dataSize;
+}
+
+/**
+ * Reset hash to state without processed bytes
+ */
+void SimilarityHash::clear()
+{
+	buckets.fill(0);
+	window.fill(0);
+	checksum = 0;
+	size = 0;
+}
+
+/**
+ * Get distance of two digests
+ * @param digest1 First digest
+ * @param digest2 Second digest
+ * @param distance Into this parameter is stored distance of digests
+ * @return @c true if both digests are valid, @c false otherwise
+ *
+ * Distance of identical digests is zero. The more data differ, the bigger
+ * the distance is. If function returns @c false, value of @a distance is left
+ * unchanged.
+ */
+bool similarityHashDistance(const std::string &digest1, const std::string &digest2, std::size_t &distance)
+{
+	std::vector<std::uint8_t> bytes1, bytes2;
+	if(!digestToBytes(digest1, bytes1) || !digestToBytes(digest2, bytes2))
+	{
+		return false;
+	}
+
+	std::size_t result = bytes1[0] != bytes2[0];
+	const auto lengthDiff = circularDistance(bytes1[1], bytes2[1], 256);
+	result += lengthDiff <= 1 ? lengthDiff : lengthDiff * HEADER_DIFF_PENALTY;
+	result += headerDistance(bytes1[2] >> 4, bytes2[2] >> 4, 16);
+	result += headerDistance(bytes1[2] & 0x0F, bytes2[2] & 0x0F, 16);
+	for(std::size_t i = HEADER_SIZE; i < bytes1.size(); ++i)
+	{
+		for(std::size_t j = 0; j < 8; j += 2)
+		{
+			const auto diff = std::abs(((bytes1[i] >> j) & 0x03) - ((bytes2[i] >> j) & 0x03));
+			result += diff == 3 ? BUCKET_DIFF_PENALTY : diff;
+		}
+	}
+
+	distance = result;
+	return true;
+}
+
+} // namespace fileformat
+} // namespace retdec
@@ -354,6 +354,8 @@ void CoffDetector::getSections()
 			fs.setCrc32(auxSect->getCrc32());
 			fs.setMd5(auxSect->getMd5());
 			fs.setSha256(auxSect->getSha256());
+			fs.setByteStatistics(auxSect->getByteStatistics());
+			fs.setSimilarityHash(auxSect->getSimilarityHash());
 		}
 
 		fileInfo.addSection(fs);
@@ -0,0 +1,142 @@
+/**
+ * @file src/fileinfo/file_detector/detection_fields.cpp
+ * @brief Resolution of requested fields to detection stages.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/utils/string.h"
+#include "fileinfo/file_detector/detection_fields.h"
+
+using namespace retdec::utils;
+using namespace retdec::fileformat;
+
+namespace fileinfo {
+
+namespace {
+
+/**
+ * Field which can be requested by user
+ */
+struct DetectionField
+{
+	const char *name; ///< name of field
+	unsigned stages;  ///< detection stages needed for field
+	unsigned hashes;  ///< hashes needed for field (NO_FILE_HASHES, NO_VERBOSE_HASHES)
+};
+
+const unsigned EP_STAGES = STAGE_COMPILER | STAGE_ADDITIONAL;
+
+/**
+ * All supported fields
+ *
+ * Fields used by the config file are listed together as @c config.
+ * Sections in the config are filtered by their byte statistics, which are
+ *    computed together with verbose hashes. Imports are detected for the
+ *    config as well, as they are when all fields are detected.
+ */
+const DetectionField detectionFields[] =
+{
+	{"format",       NO_STAGES,          0},
+	{"class",        NO_STAGES,          0},
+	{"type",         NO_STAGES,          0},
+	{"architecture", NO_STAGES,          0},
+	{"endianness",   NO_STAGES,          0},
+	{"bits",         NO_STAGES,          0},
+	{"entry-point",  EP_STAGES,          0},
+	{"image-base",   EP_STAGES,          0},
+	{"compiler",     STAGE_COMPILER,     0},
+	{"rich-header",  STAGE_RICH_HEADER,  0},
+	{"overlay",      STAGE_OVERLAY,      0},
+	{"pdb",          STAGE_PDB,          0},
+	{"resources",    STAGE_RESOURCES,    NO_VERBOSE_HASHES},
+	{"manifest",     STAGE_MANIFEST,     0},
+	{"imports",      STAGE_IMPORTS,      NO_VERBOSE_HASHES},
+	{"exports",      STAGE_EXPORTS,      0},
+	{"hashes",       STAGE_HASHES,       NO_FILE_HASHES | NO_VERBOSE_HASHES},
+	{"header",       STAGE_ADDITIONAL,   0},
+	{"sections",     STAGE_ADDITIONAL,   NO_VERBOSE_HASHES},
+	{"segments",     STAGE_ADDITIONAL,   0},
+	{"symbols",      STAGE_ADDITIONAL,   0},
+	{"relocations",  STAGE_ADDITIONAL,   0},
+	{"dotnet",       STAGE_ADDITIONAL,   0},
+	{"certificates", STAGE_CERTIFICATES, 0},
+	{"loader",       STAGE_LOADER,       0},
+	{"strings",      STAGE_STRINGS,      0},
+	{"config",       EP_STAGES | STAGE_IMPORTS, NO_VERBOSE_HASHES}
+};
+
+} // anonymous namespace
+
+/**
+ * Resolve requested fields to detection stages and load flags
+ * @param fields Comma-separated list of requested fields
+ * @param stages Into this parameter are stored detection stages needed for
+ *    @a fields
+ * @param loadFlags Load flags which are updated so that parser does not
+ *    compute hashes and strings which are not needed for @a fields
+ * @return @c true if all fields are known, @c false otherwise
+ *
+ * If function returns @c false, @a stages and @a loadFlags are left unchanged.
+ */
+bool resolveDetectionFields(const std::string &fields, DetectionStages &stages, LoadFlags &loadFlags)
+{
+	unsigned resStages = NO_STAGES;
+	unsigned resHashes = 0;
+
+	for(const auto &field : split(fields))
+	{
+		if(field.empty())
+		{
+			continue;
+		}
+
+		bool found = false;
+		for(const auto &item : detectionFields)
+		{
+			if(field == item.name)
+			{
+				resStages |= item.stages;
+				resHashes |= item.hashes;
+				found = true;
+				break;
+			}
+		}
+
+		if(!found)
+		{
+			return false;
+		}
+	}
+
+	unsigned resFlags = loadFlags | ((NO_FILE_HASHES | NO_VERBOSE_HASHES) & ~resHashes);
+	if(resStages & STAGE_STRINGS)
+	{
+		resFlags |= DETECT_STRINGS;
+	}
+	else
+	{
+		resFlags &= ~DETECT_STRINGS;
+	}
+
+	stages = static_cast<DetectionStages>(resStages);
+	loadFlags = static_cast<LoadFlags>(resFlags);
+	return true;
+}
+
+/**
+ * Get names of all supported fields
+ * @return Names of fields
+ */
+std::vector<std::string> getDetectionFieldNames()
+{
+	std::vector<std::string> names;
+
+	for(const auto &item : detectionFields)
+	{
+		names.push_back(item.name);
+	}
+
+	return names;
+}
+
+} // namespace fileinfo
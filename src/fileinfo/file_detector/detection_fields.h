@@ -0,0 +1,47 @@
+/**
+ * @file src/fileinfo/file_detector/detection_fields.h
+ * @brief Resolution of requested fields to detection stages.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef FILEINFO_FILE_DETECTOR_DETECTION_FIELDS_H
+#define FILEINFO_FILE_DETECTOR_DETECTION_FIELDS_H
+
+#include <string>
+#include <vector>
+
+#include "retdec/fileformat/fftypes.h"
+
+namespace fileinfo {
+
+/**
+ * Optional stages of detection run by FileDetector
+ *
+ * Format, class, architecture, file type, endianness and bit-size are
+ *    read from the file header and they are always detected.
+ */
+enum DetectionStages
+{
+	NO_STAGES          = 0,
+	STAGE_COMPILER     = 1 << 0,
+	STAGE_RICH_HEADER  = 1 << 1,
+	STAGE_OVERLAY      = 1 << 2,
+	STAGE_PDB          = 1 << 3,
+	STAGE_RESOURCES    = 1 << 4,
+	STAGE_MANIFEST     = 1 << 5,
+	STAGE_IMPORTS      = 1 << 6,
+	STAGE_EXPORTS      = 1 << 7,
+	STAGE_HASHES       = 1 << 8,
+	STAGE_ADDITIONAL   = 1 << 9,
+	STAGE_CERTIFICATES = 1 << 10,
+	STAGE_LOADER       = 1 << 11,
+	STAGE_STRINGS      = 1 << 12,
+	ALL_STAGES         = (1 << 13) - 1
+};
+
+bool resolveDetectionFields(const std::string &fields, DetectionStages &stages, retdec::fileformat::LoadFlags &loadFlags);
+std::vector<std::string> getDetectionFieldNames();
+
+} // namespace fileinfo
+
+#endif
@@ -1114,6 +1114,8 @@ void ElfDetector::getSections()
 			fs.setCrc32(auxSec->getCrc32());
 			fs.setMd5(auxSec->getMd5());
 			fs.setSha256(auxSec->getSha256());
+			fs.setByteStatistics(auxSec->getByteStatistics());
+			fs.setSimilarityHash(auxSec->getSimilarityHash());
 		}
 		fileInfo.addSection(fs);
 		switch(sec->get_type())
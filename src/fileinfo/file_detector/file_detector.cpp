@@ -4,7 +4,12 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <tinyxml2.h>
 
@@ -24,7 +29,7 @@ namespace fileinfo {
  * Constructor in subclass must initialize members @a fileParser and @a loaded.
  */
 FileDetector::FileDetector(std::string pathToInputFile, FileInformation &finfo, retdec::cpdetect::DetectParams &searchPar, retdec::fileformat::LoadFlags loadFlags) :
-	fileInfo(finfo), cpParams(searchPar), fileConfig(nullptr), fileParser(nullptr), loaded(false), loadFlags(loadFlags)
+	fileInfo(finfo), cpParams(searchPar), fileConfig(nullptr), fileParser(nullptr), loaded(false), loadFlags(loadFlags), stages(ALL_STAGES)
 {
 	fileInfo.setPathToFile(pathToInputFile);
 }
@@ -113,6 +118,7 @@ void FileDetector::getOverlayInfo()
 	{
 		fileInfo.setOverlayOffset(fileParser->getDeclaredFileLength());
 		fileInfo.setOverlaySize(size);
+		fileInfo.setOverlayByteStatistics(fileParser->getOverlayByteStatistics());
 	}
 }
 
@@ -219,6 +225,8 @@ void FileDetector::getHashes()
 	fileInfo.setCrc32(fileParser->getCrc32());
 	fileInfo.setMd5(fileParser->getMd5());
 	fileInfo.setSha256(fileParser->getSha256());
+	fileInfo.setByteStatistics(fileParser->getByteStatistics());
+	fileInfo.setSimilarityHash(fileParser->getSimilarityHash());
 	fileInfo.setSectionTableCrc32(fileParser->getSectionTableCrc32());
 	fileInfo.setSectionTableMd5(fileParser->getSectionTableMd5());
 	fileInfo.setSectionTableSha256(fileParser->getSectionTableSha256());
@@ -315,8 +323,112 @@ void FileDetector::setConfigFile(retdec::config::Config &config)
 	fileParser->initFromConfig(config);
 }
 
+/**
+ * Set optional detection stages which are run by getAllInformation()
+ * @param detectionStages Detection stages (all stages are run by default)
+ */
+void FileDetector::setDetectionStages(DetectionStages detectionStages)
+{
+	stages = detectionStages;
+}
+
+/**
+ * Run optional detection stages set by setDetectionStages()
+ *
+ * Stages only read the parsed file and each of them fills its own part of
+ *    @a fileInfo, so independent stages are run in parallel. A stage is
+ *    started only after all stages it depends on are finished:
+ *    - stages which add messages are run in the order of the table below, so
+ *      order of messages is deterministic,
+ *    - additional (format-specific) information may overwrite entry point
+ *      found by compiler detection,
+ *    - loader modifies addresses of symbols in relocatable files, so it waits
+ *      for all stages which read them.
+ */
+void FileDetector::runDetectionStages()
+{
+	struct Stage
+	{
+		DetectionStages stage;          ///< stage
+		void (FileDetector::*run)();    ///< method which runs stage
+		unsigned dependencies;          ///< stages which must be finished before stage
+	};
+
+	const unsigned messageStages = STAGE_COMPILER | STAGE_RICH_HEADER;
+	const Stage stageTable[] =
+	{
+		{STAGE_COMPILER,     &FileDetector::getCompilerInformation, NO_STAGES},
+		{STAGE_RICH_HEADER,  &FileDetector::getRichHeaderInfo,      STAGE_COMPILER},
+		{STAGE_OVERLAY,      &FileDetector::getOverlayInfo,         NO_STAGES},
+		{STAGE_PDB,          &FileDetector::getPdbInfo,             NO_STAGES},
+		{STAGE_RESOURCES,    &FileDetector::getResourceInfo,        NO_STAGES},
+		{STAGE_MANIFEST,     &FileDetector::getManifestInfo,        NO_STAGES},
+		{STAGE_IMPORTS,      &FileDetector::getImports,             NO_STAGES},
+		{STAGE_EXPORTS,      &FileDetector::getExports,             NO_STAGES},
+		{STAGE_HASHES,       &FileDetector::getHashes,              NO_STAGES},
+		{STAGE_ADDITIONAL,   &FileDetector::getAdditionalInfo,      messageStages},
+		{STAGE_CERTIFICATES, &FileDetector::getCertificates,        NO_STAGES},
+		{STAGE_LOADER,       &FileDetector::getLoaderInfo,          ALL_STAGES & ~(STAGE_LOADER | STAGE_STRINGS)},
+		{STAGE_STRINGS,      &FileDetector::getStrings,             NO_STAGES}
+	};
+
+	std::vector<const Stage*> pending;
+	for(const auto &item : stageTable)
+	{
+		if(stages & item.stage)
+		{
+			pending.push_back(&item);
+		}
+	}
+
+	// Stages which are not run are considered finished
+	unsigned finished = ALL_STAGES & ~stages;
+	std::mutex mutex;
+	std::condition_variable stageFinished;
+
+	auto worker = [&]()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		while(!pending.empty())
+		{
+			auto next = std::find_if(pending.begin(), pending.end(),
+				[&](const Stage *item) { return !(item->dependencies & ~finished); });
+			if(next == pending.end())
+			{
+				stageFinished.wait(lock);
+				continue;
+			}
+
+			const auto *item = *next;
+			pending.erase(next);
+			lock.unlock();
+			(this->*item->run)();
+			lock.lock();
+			finished |= item->stage;
+			stageFinished.notify_all();
+		}
+	};
+
+	const std::size_t hwThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	const std::size_t numOfThreads = std::min(hwThreads, pending.size());
+	std::vector<std::thread> threads;
+	for(std::size_t i = 1; i < numOfThreads; ++i)
+	{
+		threads.emplace_back(worker);
+	}
+
+	worker();
+	for(auto &thread : threads)
+	{
+		thread.join();
+	}
+}
+
 /**
  * Get all supported information about binary file
+ *
+ * Only information from detection stages set by setDetectionStages() is
+ *    detected. Basic information from the file header is always detected.
  */
 void FileDetector::getAllInformation()
 {
@@ -328,19 +440,7 @@ void FileDetector::getAllInformation()
 		detectFileType();
 		getEndianness();
 		getArchitectureBitSize();
-		getCompilerInformation();
-		getRichHeaderInfo();
-		getOverlayInfo();
-		getPdbInfo();
-		getResourceInfo();
-		getManifestInfo();
-		getImports();
-		getExports();
-		getHashes();
-		getAdditionalInfo();
-		getCertificates();
-		getLoaderInfo();
-		getStrings();
+		runDetectionStages();
 	}
 }
 
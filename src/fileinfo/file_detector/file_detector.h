@@ -8,6 +8,7 @@
 #define FILEINFO_FILE_DETECTOR_FILE_DETECTOR_H
 
 #include "retdec/utils/non_copyable.h"
+#include "fileinfo/file_detector/detection_fields.h"
 #include "fileinfo/file_information/file_information.h"
 
 namespace fileinfo {
@@ -35,6 +36,8 @@ class FileDetector : private retdec::utils::NonCopyable
 		void getCertificates();
 		void getLoaderInfo();
 		/// @}
+
+		void runDetectionStages();
 	protected:
 		FileInformation &fileInfo;                           ///< information about file
 		retdec::cpdetect::DetectParams &cpParams;                   ///< parameters for detection of used compiler
@@ -42,6 +45,7 @@ class FileDetector : private retdec::utils::NonCopyable
 		std::shared_ptr<retdec::fileformat::FileFormat> fileParser; ///< parser of input file
 		bool loaded;                                         ///< internal state of instance
 		retdec::fileformat::LoadFlags loadFlags;                    ///< load flags for configurable running
+		DetectionStages stages;                              ///< optional detection stages which are run
 
 		/// @name Pure virtual detection methods
 		/// @{
@@ -56,6 +60,7 @@ class FileDetector : private retdec::utils::NonCopyable
 		virtual ~FileDetector();
 
 		void setConfigFile(retdec::config::Config &config);
+		void setDetectionStages(DetectionStages detectionStages);
 		void getAllInformation();
 		const retdec::fileformat::FileFormat* getFileParser() const;
 };
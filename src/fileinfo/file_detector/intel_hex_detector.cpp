@@ -53,6 +53,8 @@ void IntelHexDetector::getSections()
 		fs.setCrc32(sec->getCrc32());
 		fs.setMd5(sec->getMd5());
 		fs.setSha256(sec->getSha256());
+		fs.setByteStatistics(sec->getByteStatistics());
+		fs.setSimilarityHash(sec->getSimilarityHash());
 		fs.setName(sec->getName());
 		fs.setIndex(sec->getIndex());
 		fs.setStartAddress(sec->getAddress());
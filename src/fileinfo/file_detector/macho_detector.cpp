@@ -110,6 +110,8 @@ void MachODetector::getSections()
 		fsec.setOffset(sec->getOffset());
 		fsec.setSizeInFile(sec->getSizeInFile());
 		fsec.setStartAddress(sec->getAddress());
+		fsec.setByteStatistics(sec->getByteStatistics());
+		fsec.setSimilarityHash(sec->getSimilarityHash());
 		if(sec->getSizeInMemory(res))
 		{
 			fsec.setSizeInMemory(res);
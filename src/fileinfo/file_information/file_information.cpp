@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "retdec/utils/address.h"
+#include "retdec/fileformat/types/similarity_hash/similarity_hash.h"
 #include "fileinfo/file_information/file_information.h"
 #include "fileinfo/file_information/file_information_types/type_conversions.h"
 
@@ -147,6 +148,52 @@ std::string FileInformation::getSha256() const
 	return sha256;
 }
 
+/**
+ * Get entropy of input file
+ * @return Entropy of input file in bits per byte
+ */
+std::string FileInformation::getEntropyStr() const
+{
+	return getEntropyAsString(byteStatistics);
+}
+
+/**
+ * Get chi-square score of input file
+ * @return Chi-square score of byte values of input file
+ */
+std::string FileInformation::getChiSquareStr() const
+{
+	return getChiSquareAsString(byteStatistics);
+}
+
+/**
+ * Get likely content of input file
+ * @return Likely content of input file (e.g. compressed or encrypted data)
+ */
+std::string FileInformation::getLikelyContentStr() const
+{
+	return getLikelyContentAsString(byteStatistics);
+}
+
+/**
+ * Get locality-sensitive hash of input file
+ * @return Locality-sensitive hash of input file
+ */
+std::string FileInformation::getSimilarityHash() const
+{
+	return similarityHash;
+}
+
+/**
+ * Get distance of locality-sensitive hash of input file from compared hash
+ * @return Distance of hashes or empty string if either of them is not valid
+ */
+std::string FileInformation::getSimilarityHashDistanceStr() const
+{
+	std::size_t distance;
+	return similarityHashDistance(similarityHash, comparedSimilarityHash, distance) ? numToStr(distance) : "";
+}
+
 /**
  * Get CRC32 of section table
  * @return CRC32 of section table
@@ -677,6 +724,33 @@ std::string FileInformation::getOverlaySizeStr(std::ios_base &(* format)(std::io
 	return header.getOverlaySizeStr(format);
 }
 
+/**
+ * Get overlay entropy
+ * @return Entropy of overlay in bits per byte
+ */
+std::string FileInformation::getOverlayEntropyStr() const
+{
+	return getEntropyAsString(overlayByteStatistics);
+}
+
+/**
+ * Get overlay chi-square score
+ * @return Chi-square score of byte values of overlay
+ */
+std::string FileInformation::getOverlayChiSquareStr() const
+{
+	return getChiSquareAsString(overlayByteStatistics);
+}
+
+/**
+ * Get likely content of overlay
+ * @return Likely content of overlay (e.g. compressed or encrypted data)
+ */
+std::string FileInformation::getOverlayLikelyContentStr() const
+{
+	return getLikelyContentAsString(overlayByteStatistics);
+}
+
 /**
  * Get number of records in rich header
  * @return Number of records in rich header
@@ -1823,6 +1897,56 @@ std::string FileInformation::getSectionSha256(std::size_t position) const
 	return sections[position].getSha256();
 }
 
+/**
+ * Get statistics of byte values of section
+ * @param position Position of section in internal list of sections (0..x)
+ * @return Statistics of byte values of section
+ */
+const retdec::fileformat::ByteStatistics& FileInformation::getSectionByteStatistics(std::size_t position) const
+{
+	return sections[position].getByteStatistics();
+}
+
+/**
+ * Get section entropy
+ * @param position Position of section in internal list of sections (0..x)
+ * @return Entropy of section in bits per byte
+ */
+std::string FileInformation::getSectionEntropyStr(std::size_t position) const
+{
+	return sections[position].getEntropyStr();
+}
+
+/**
+ * Get section chi-square score
+ * @param position Position of section in internal list of sections (0..x)
+ * @return Chi-square score of byte values of section
+ */
+std::string FileInformation::getSectionChiSquareStr(std::size_t position) const
+{
+	return sections[position].getChiSquareStr();
+}
+
+/**
+ * Get likely content of section
+ * @param position Position of section in internal list of sections (0..x)
+ * @return Likely content of section (e.g. compressed or encrypted data)
+ */
+std::string FileInformation::getSectionLikelyContentStr(std::size_t position) const
+{
+	return sections[position].getLikelyContentStr();
+}
+
+/**
+ * Get locality-sensitive hash of section
+ * @param position Position of section in internal list of sections (0..x)
+ * @return Locality-sensitive hash of section
+ */
+std::string FileInformation::getSectionSimilarityHash(std::size_t position) const
+{
+	return sections[position].getSimilarityHash();
+}
+
 /**
  * Get number of section flags
  * @param position Position of section in internal list of sections (0..x)
@@ -3026,6 +3150,33 @@ void FileInformation::setSha256(const std::string &fileSha256)
 	sha256 = fileSha256;
 }
 
+/**
+ * Set statistics of byte values of input file
+ * @param fileByteStatistics Statistics of byte values of input file
+ */
+void FileInformation::setByteStatistics(const retdec::fileformat::ByteStatistics &fileByteStatistics)
+{
+	byteStatistics = fileByteStatistics;
+}
+
+/**
+ * Set locality-sensitive hash of input file
+ * @param fileSimilarityHash Locality-sensitive hash of input file
+ */
+void FileInformation::setSimilarityHash(const std::string &fileSimilarityHash)
+{
+	similarityHash = fileSimilarityHash;
+}
+
+/**
+ * Set locality-sensitive hash which is compared with hash of input file
+ * @param hash Locality-sensitive hash (e.g. of already analysed file)
+ */
+void FileInformation::setComparedSimilarityHash(const std::string &hash)
+{
+	comparedSimilarityHash = hash;
+}
+
 /**
  * Set CRC32 of section table
  * @param sCrc32 CRC32 of section table
@@ -3413,6 +3564,15 @@ void FileInformation::setOverlaySize(unsigned long long size)
 	header.setOverlaySize(size);
 }
 
+/**
+ * Set statistics of byte values of overlay
+ * @param stats Statistics of byte values of overlay
+ */
+void FileInformation::setOverlayByteStatistics(const retdec::fileformat::ByteStatistics &stats)
+{
+	overlayByteStatistics = stats;
+}
+
 /**
  * Set rich header
  * @param rHeader Information about rich header
@@ -29,6 +29,10 @@ class FileInformation
 		std::string secCrc32;                          ///< CRC32 of section table
 		std::string secMd5;                            ///< MD5 of section table
 		std::string secSha256;                         ///< SHA256 of section table
+		retdec::fileformat::ByteStatistics byteStatistics;        ///< statistics of byte values of input file
+		retdec::fileformat::ByteStatistics overlayByteStatistics; ///< statistics of byte values of overlay
+		std::string similarityHash;                    ///< locality-sensitive hash of input file
+		std::string comparedSimilarityHash;            ///< locality-sensitive hash compared with hash of input file
 		retdec::fileformat::Format fileFormatEnum;     ///< format of input file in enumeration representation
 		std::string fileFormat;                        ///< format of input file in string representation
 		std::string fileClass;                         ///< class of file
@@ -73,6 +77,11 @@ class FileInformation
 		std::string getCrc32() const;
 		std::string getMd5() const;
 		std::string getSha256() const;
+		std::string getEntropyStr() const;
+		std::string getChiSquareStr() const;
+		std::string getLikelyContentStr() const;
+		std::string getSimilarityHash() const;
+		std::string getSimilarityHashDistanceStr() const;
 		std::string getSectionTableCrc32() const;
 		std::string getSectionTableMd5() const;
 		std::string getSectionTableSha256() const;
@@ -136,6 +145,9 @@ class FileInformation
 		std::string getNumberOfDeclaredSymbolTablesStr() const;
 		std::string getOverlayOffsetStr(std::ios_base &(* format)(std::ios_base &)) const;
 		std::string getOverlaySizeStr(std::ios_base &(* format)(std::ios_base &)) const;
+		std::string getOverlayEntropyStr() const;
+		std::string getOverlayChiSquareStr() const;
+		std::string getOverlayLikelyContentStr() const;
 		/// @}
 
 		/// @name Getters of @a richHeader
@@ -286,6 +298,11 @@ class FileInformation
 		std::string getSectionCrc32(std::size_t index) const;
 		std::string getSectionMd5(std::size_t index) const;
 		std::string getSectionSha256(std::size_t index) const;
+		const retdec::fileformat::ByteStatistics& getSectionByteStatistics(std::size_t index) const;
+		std::string getSectionEntropyStr(std::size_t index) const;
+		std::string getSectionChiSquareStr(std::size_t index) const;
+		std::string getSectionLikelyContentStr(std::size_t index) const;
+		std::string getSectionSimilarityHash(std::size_t index) const;
 		std::string getSectionIndexStr(std::size_t position) const;
 		std::string getSectionOffsetStr(std::size_t position, std::ios_base &(* format)(std::ios_base &)) const;
 		std::string getSectionSizeInFileStr(std::size_t position, std::ios_base &(* format)(std::ios_base &)) const;
@@ -447,6 +464,9 @@ class FileInformation
 		void setCrc32(const std::string &fileCrc32);
 		void setMd5(const std::string &fileMd5);
 		void setSha256(const std::string &fileSha256);
+		void setByteStatistics(const retdec::fileformat::ByteStatistics &fileByteStatistics);
+		void setSimilarityHash(const std::string &fileSimilarityHash);
+		void setComparedSimilarityHash(const std::string &hash);
 		void setSectionTableCrc32(const std::string &sCrc32);
 		void setSectionTableMd5(const std::string &sMd5);
 		void setSectionTableSha256(const std::string &sSha256);
@@ -490,6 +510,7 @@ class FileInformation
 		void setNumberOfDeclaredSymbolTables(unsigned long long noOfTables);
 		void setOverlayOffset(unsigned long long offset);
 		void setOverlaySize(unsigned long long size);
+		void setOverlayByteStatistics(const retdec::fileformat::ByteStatistics &stats);
 		void setRichHeader(const retdec::fileformat::RichHeader *rHeader);
 		void setPdbType(const std::string &sType);
 		void setPdbPath(const std::string &sPath);
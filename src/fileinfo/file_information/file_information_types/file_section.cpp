@@ -84,6 +84,51 @@ std::string FileSection::getSha256() const
 	return sha256;
 }
 
+/**
+ * Get statistics of byte values
+ * @return Statistics of byte values of section content
+ */
+const retdec::fileformat::ByteStatistics& FileSection::getByteStatistics() const
+{
+	return byteStatistics;
+}
+
+/**
+ * Get entropy
+ * @return Entropy of section content in bits per byte
+ */
+std::string FileSection::getEntropyStr() const
+{
+	return getEntropyAsString(byteStatistics);
+}
+
+/**
+ * Get chi-square score
+ * @return Chi-square score of byte values of section content
+ */
+std::string FileSection::getChiSquareStr() const
+{
+	return getChiSquareAsString(byteStatistics);
+}
+
+/**
+ * Get likely content
+ * @return Likely content of section (e.g. compressed or encrypted data)
+ */
+std::string FileSection::getLikelyContentStr() const
+{
+	return getLikelyContentAsString(byteStatistics);
+}
+
+/**
+ * Get locality-sensitive hash
+ * @return Locality-sensitive hash of section content
+ */
+std::string FileSection::getSimilarityHash() const
+{
+	return similarityHash;
+}
+
 /**
  * Get section index
  * @return Index of file section
@@ -319,6 +364,24 @@ void FileSection::setSha256(std::string sectionSha256)
 	sha256 = sectionSha256;
 }
 
+/**
+ * Set statistics of byte values
+ * @param sectionByteStatistics Statistics of byte values of section content
+ */
+void FileSection::setByteStatistics(const retdec::fileformat::ByteStatistics &sectionByteStatistics)
+{
+	byteStatistics = sectionByteStatistics;
+}
+
+/**
+ * Set locality-sensitive hash
+ * @param sectionSimilarityHash Locality-sensitive hash of section content
+ */
+void FileSection::setSimilarityHash(std::string sectionSimilarityHash)
+{
+	similarityHash = sectionSimilarityHash;
+}
+
 /**
  * Set index of section
  * @param sectionIndex Index of section
@@ -7,6 +7,7 @@
 #ifndef FILEINFO_FILE_INFORMATION_FILE_INFORMATION_TYPES_FILE_SECTION_H
 #define FILEINFO_FILE_INFORMATION_FILE_INFORMATION_TYPES_FILE_SECTION_H
 
+#include "retdec/fileformat/types/byte_statistics/byte_statistics.h"
 #include "fileinfo/file_information/file_information_types/flags.h"
 
 namespace fileinfo {
@@ -24,6 +25,8 @@ class FileSection
 		std::string crc32;                        ///< CRC32 of section content
 		std::string md5;                          ///< MD5 of section content
 		std::string sha256;                       ///< SHA256 of section content
+		retdec::fileformat::ByteStatistics byteStatistics; ///< statistics of byte values of section content
+		std::string similarityHash;               ///< locality-sensitive hash of section content
 		unsigned long long index;                 ///< index of section
 		unsigned long long offset;                ///< offset in file
 		unsigned long long sizeInFile;            ///< size of section in file
@@ -51,6 +54,11 @@ class FileSection
 		std::string getCrc32() const;
 		std::string getMd5() const;
 		std::string getSha256() const;
+		const retdec::fileformat::ByteStatistics& getByteStatistics() const;
+		std::string getEntropyStr() const;
+		std::string getChiSquareStr() const;
+		std::string getLikelyContentStr() const;
+		std::string getSimilarityHash() const;
 		std::string getIndexStr() const;
 		std::string getOffsetStr(std::ios_base &(* format)(std::ios_base &)) const;
 		std::string getSizeInFileStr(std::ios_base &(* format)(std::ios_base &)) const;
@@ -80,6 +88,8 @@ class FileSection
 		void setCrc32(std::string sectionCrc32);
 		void setMd5(std::string sectionMd5);
 		void setSha256(std::string sectionSha256);
+		void setByteStatistics(const retdec::fileformat::ByteStatistics &sectionByteStatistics);
+		void setSimilarityHash(std::string sectionSimilarityHash);
 		void setIndex(unsigned long long sectionIndex);
 		void setOffset(unsigned long long sectionOffset);
 		void setSizeInFile(unsigned long long size);
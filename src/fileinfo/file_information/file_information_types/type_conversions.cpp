@@ -4,10 +4,33 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <iomanip>
+#include <sstream>
 #include <string>
 
+#include "fileinfo/file_information/file_information_types/type_conversions.h"
+
+using namespace retdec::fileformat;
+
 namespace fileinfo {
 
+namespace
+{
+
+/**
+ * Get floating point number as string with fixed number of decimal places
+ * @param number Number for conversion
+ * @return Number in string representation
+ */
+std::string getFixedAsString(double number)
+{
+	std::ostringstream result;
+	result << std::fixed << std::setprecision(6) << number;
+	return result.str();
+}
+
+} // anonymous namespace
+
 /**
  * Get binary composition of number
  * @param number Number for conversion
@@ -26,4 +49,34 @@ std::string getBinaryRepresentation(unsigned long long number, unsigned long lon
 	return result;
 }
 
+/**
+ * Get entropy as string
+ * @param stats Statistics of byte values
+ * @return Entropy in bits per byte or empty string if no bytes were counted
+ */
+std::string getEntropyAsString(const ByteStatistics &stats)
+{
+	return stats.isEmpty() ? "" : getFixedAsString(stats.getEntropy());
+}
+
+/**
+ * Get chi-square score as string
+ * @param stats Statistics of byte values
+ * @return Chi-square score or empty string if no bytes were counted
+ */
+std::string getChiSquareAsString(const ByteStatistics &stats)
+{
+	return stats.isEmpty() ? "" : getFixedAsString(stats.getChiSquare());
+}
+
+/**
+ * Get likely content as string
+ * @param stats Statistics of byte values
+ * @return Likely content of data or empty string if no bytes were counted
+ */
+std::string getLikelyContentAsString(const ByteStatistics &stats)
+{
+	return stats.isEmpty() ? "" : contentToString(stats.getLikelyContent());
+}
+
 } // namespace fileinfo
@@ -11,10 +11,14 @@
 #include <vector>
 
 #include "retdec/utils/conversion.h"
+#include "retdec/fileformat/types/byte_statistics/byte_statistics.h"
 
 namespace fileinfo {
 
 std::string getBinaryRepresentation(unsigned long long number, unsigned long long numberOfBits);
+std::string getEntropyAsString(const retdec::fileformat::ByteStatistics &stats);
+std::string getChiSquareAsString(const retdec::fileformat::ByteStatistics &stats);
+std::string getLikelyContentAsString(const retdec::fileformat::ByteStatistics &stats);
 
 /**
  * Get number as string
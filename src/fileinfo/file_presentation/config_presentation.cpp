@@ -138,6 +138,36 @@ void ConfigPresentation::presentPatterns()
 	PatternConfigGetter(fileinfo, &outDoc);
 }
 
+/**
+ * Present sections together with statistics of their bytes as segments
+ *
+ * Only sections which are mapped into memory and whose bytes were counted
+ * are presented.
+ */
+void ConfigPresentation::presentSections()
+{
+	for(std::size_t i = 0, e = fileinfo.getNumberOfStoredSections(); i < e; ++i)
+	{
+		const auto &stats = fileinfo.getSectionByteStatistics(i);
+		unsigned long long address, size;
+		if(stats.isEmpty()
+				|| !strToNum(fileinfo.getSectionAddressStr(i, std::dec), address)
+				|| !address
+				|| !strToNum(fileinfo.getSectionSizeInFileStr(i, std::dec), size)
+				|| !size)
+		{
+			continue;
+		}
+
+		Segment seg(address);
+		seg.setEnd(address + size - 1);
+		seg.setName(fileinfo.getSectionName(i));
+		seg.setEntropy(stats.getEntropy());
+		seg.setChiSquare(stats.getChiSquare());
+		outDoc.segments.insert(seg);
+	}
+}
+
 bool ConfigPresentation::present()
 {
 	if(!stateIsValid)
@@ -241,6 +271,7 @@ bool ConfigPresentation::present()
 	presentCompiler();
 	presentLanguages();
 	presentPatterns();
+	presentSections();
 	return true;
 }
 
@@ -25,6 +25,7 @@ class ConfigPresentation : public FilePresentation
 		void presentCompiler();
 		void presentLanguages();
 		void presentPatterns();
+		void presentSections();
 		/// @}
 	public:
 		ConfigPresentation(FileInformation &fileinfo_, std::string file_);
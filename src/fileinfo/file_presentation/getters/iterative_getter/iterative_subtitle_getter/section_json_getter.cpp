@@ -45,6 +45,10 @@ SectionJsonGetter::SectionJsonGetter(FileInformation &fileInfo) : IterativeSubti
 	commonHeaderElements.push_back("crc32");
 	commonHeaderElements.push_back("md5");
 	commonHeaderElements.push_back("sha256");
+	commonHeaderElements.push_back("entropy");
+	commonHeaderElements.push_back("chiSquare");
+	commonHeaderElements.push_back("likelyContent");
+	commonHeaderElements.push_back("similarityHash");
 }
 
 /**
@@ -105,6 +109,10 @@ bool SectionJsonGetter::getRecord(std::size_t structIndex, std::size_t recIndex,
 	record.push_back(fileinfo.getSectionCrc32(recIndex));
 	record.push_back(fileinfo.getSectionMd5(recIndex));
 	record.push_back(fileinfo.getSectionSha256(recIndex));
+	record.push_back(fileinfo.getSectionEntropyStr(recIndex));
+	record.push_back(fileinfo.getSectionChiSquareStr(recIndex));
+	record.push_back(fileinfo.getSectionLikelyContentStr(recIndex));
+	record.push_back(fileinfo.getSectionSimilarityHash(recIndex));
 
 	return true;
 }
@@ -36,6 +36,11 @@ std::size_t BasicJsonGetter::loadInformation(std::vector<std::string> &desc, std
 	desc.push_back("crc32");
 	desc.push_back("md5");
 	desc.push_back("sha256");
+	desc.push_back("entropy");
+	desc.push_back("chiSquare");
+	desc.push_back("likelyContent");
+	desc.push_back("similarityHash");
+	desc.push_back("similarityHashDistance");
 	desc.push_back("fileFormat");
 	desc.push_back("fileClass");
 	desc.push_back("fileType");
@@ -46,6 +51,11 @@ std::size_t BasicJsonGetter::loadInformation(std::vector<std::string> &desc, std
 	info.push_back(fileinfo.getCrc32());
 	info.push_back(fileinfo.getMd5());
 	info.push_back(fileinfo.getSha256());
+	info.push_back(fileinfo.getEntropyStr());
+	info.push_back(fileinfo.getChiSquareStr());
+	info.push_back(fileinfo.getLikelyContentStr());
+	info.push_back(fileinfo.getSimilarityHash());
+	info.push_back(fileinfo.getSimilarityHashDistanceStr());
 	info.push_back(fileinfo.getFileFormat());
 	info.push_back(fileinfo.getFileClass());
 	info.push_back(fileinfo.getFileType());
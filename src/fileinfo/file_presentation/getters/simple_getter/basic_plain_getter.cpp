@@ -40,6 +40,8 @@ std::size_t BasicPlainGetter::loadInformation(std::vector<std::string> &desc, st
 	desc.push_back("CRC32                    : ");
 	desc.push_back("MD5                      : ");
 	desc.push_back("SHA256                   : ");
+	desc.push_back("Similarity hash          : ");
+	desc.push_back("Similarity hash distance : ");
 	desc.push_back("File format              : ");
 	desc.push_back("File class               : ");
 	desc.push_back("File type                : ");
@@ -60,6 +62,8 @@ std::size_t BasicPlainGetter::loadInformation(std::vector<std::string> &desc, st
 	info.push_back(fileinfo.getCrc32());
 	info.push_back(fileinfo.getMd5());
 	info.push_back(fileinfo.getSha256());
+	info.push_back(fileinfo.getSimilarityHash());
+	info.push_back(fileinfo.getSimilarityHashDistanceStr());
 	info.push_back(fileinfo.getFileFormat());
 	info.push_back(fileinfo.getFileClass());
 	info.push_back(fileinfo.getFileType());
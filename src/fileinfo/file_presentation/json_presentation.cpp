@@ -254,6 +254,9 @@ void JsonPresentation::presentOverlay(Json::Value &root) const
 		{
 			jOverlay["size"] = size;
 		}
+		presentIfNotEmpty("entropy", fileinfo.getOverlayEntropyStr(), jOverlay);
+		presentIfNotEmpty("chiSquare", fileinfo.getOverlayChiSquareStr(), jOverlay);
+		presentIfNotEmpty("likelyContent", fileinfo.getOverlayLikelyContentStr(), jOverlay);
 		root["overlay"] = jOverlay;
 	}
 }
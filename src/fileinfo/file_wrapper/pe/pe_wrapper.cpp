@@ -170,6 +170,8 @@ bool PeWrapper::getFileSection(unsigned long long secIndex, FileSection &section
 	section.setCrc32("");
 	section.setMd5("");
 	section.setSha256("");
+	section.setByteStatistics(ByteStatistics());
+	section.setSimilarityHash("");
 	unsigned long long index;
 	if(strToNum(section.getIndexStr(), index))
 	{
@@ -179,6 +181,8 @@ bool PeWrapper::getFileSection(unsigned long long secIndex, FileSection &section
 			section.setCrc32(auxSec->getCrc32());
 			section.setMd5(auxSec->getMd5());
 			section.setSha256(auxSec->getSha256());
+			section.setByteStatistics(auxSec->getByteStatistics());
+			section.setSimilarityHash(auxSec->getSimilarityHash());
 		}
 	}
 
@@ -53,7 +53,10 @@ struct ProgParams
 	std::size_t maxMemory;                  ///< maximal memory
 	bool maxMemoryHalfRAM;                  ///< limit maximal memory to half of system RAM
 	std::size_t epBytesCount;               ///< number of bytes to load from entry point
+	std::string similarTo;                  ///< similarity hash compared with hash of input file
 	LoadFlags loadFlags;                    ///< load flags for `fileformat`
+	std::string fields;                     ///< requested fields (all if empty)
+	DetectionStages detectionStages;        ///< detection stages needed for requested fields
 
 	ProgParams() : searchMode(SearchType::EXACT_MATCH),
 					internalDatabase(true),
@@ -65,7 +68,8 @@ struct ProgParams
 					maxMemory(0),
 					maxMemoryHalfRAM(false),
 					epBytesCount(EP_BYTES_SIZE),
-					loadFlags(LoadFlags::NONE) {}
+					loadFlags(LoadFlags::NONE),
+					detectionStages(ALL_STAGES) {}
 };
 
 /**
@@ -157,6 +161,15 @@ void printHelp()
 				<< "                          Either all hashes or only file/verbose hashes.\n"
 				<< "                          All assumed if no argument specified.\n"
 				<< "    --ep-bytes=N          Number of bytes to load from entry point. (Default: " << EP_BYTES_SIZE << ")\n"
+				<< "    --similar-to=hash     Print distance of similarity hash of input file from\n"
+				<< "                          the given similarity hash (e.g. hash of already\n"
+				<< "                          analysed file). The lower the distance, the more\n"
+				<< "                          similar files are.\n"
+				<< "    --fields=list         Detect only the given comma-separated fields. Other\n"
+				<< "                          information is neither computed nor printed.\n"
+				<< "                          Fields needed for the config file are added\n"
+				<< "                          when it is generated. Supported fields are:\n"
+				<< "                          " << joinStrings(getDetectionFieldNames(), ",\n                          ") << ".\n"
 				<< "\n"
 				<< "Other options for specifying output:\n"
 				<< "    --verbose, -v         Print more information about input file.\n"
@@ -211,7 +224,8 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 	std::vector<std::string> argv;
 
 	std::set<std::string> withArgs = {"malware", "m", "crypto", "C", "other",
-			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes"};
+			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes", "similar-to",
+			"fields"};
 	for (int i = 1; i < argc; ++i)
 	{
 		std::string a = _argv[i];
@@ -353,6 +367,19 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 			if (!strToNum(epBytesCountString, params.epBytesCount))
 				return false;
 		}
+		else if (c == "--similar-to")
+		{
+			params.similarTo = getParamOrDie(argv, i);
+			std::size_t distance;
+			if (!similarityHashDistance(params.similarTo, params.similarTo, distance))
+				return false;
+		}
+		else if (c == "--fields")
+		{
+			params.fields = getParamOrDie(argv, i);
+			if (params.fields.empty())
+				return false;
+		}
 		else if (params.filePath.empty())
 		{
 			params.filePath = argv[i];
@@ -368,6 +395,21 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 		return false;
 	}
 
+	if(!params.fields.empty())
+	{
+		// Config file is generated from fileinfo, so it must not miss anything.
+		auto fields = params.fields;
+		if(params.generateConfigFile)
+		{
+			fields += ",config";
+		}
+
+		if(!resolveDetectionFields(fields, params.detectionStages, params.loadFlags))
+		{
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -433,6 +475,7 @@ int main(int argc, char* argv[])
 	FileDetector *fileDetector = nullptr;
 	fileinfo.setPathToFile(params.filePath);
 	fileinfo.setFileFormatEnum(fileFormat);
+	fileinfo.setComparedSimilarityHash(params.similarTo);
 	ErrorHandlerInfo hInfo { &params, &fileinfo };
 	llvm::install_fatal_error_handler(fatalErrorHandler, &hInfo);
 	switch(fileFormat)
@@ -468,6 +511,7 @@ int main(int argc, char* argv[])
 				{
 					fileDetector->setConfigFile(config);
 				}
+				fileDetector->setDetectionStages(params.detectionStages);
 				fileDetector->getAllInformation();
 			}
 			else
@@ -224,8 +224,7 @@ void DefUseAnalysis::computeGenAndKillForNode(ShPtr<DefUseChains> ducs,
 		// the node.
 		for (const auto &varUse : varUses) {
 			// Consider only uses which are "read" uses, not "write" uses.
-			const auto &readVarsInVarUse = va->getValueData(varUse)->getDirReadVars();
-			if (!hasItem(readVarsInVarUse, defVar)) {
+			if (!va->getValueData(varUse)->isDirRead(defVar)) {
 				continue;
 			}
 
@@ -426,16 +425,14 @@ void DefUseAnalysis::computeDefUseChainForStmt(ShPtr<DefUseChains> ducs,
 			// Note: In [ItC], this is not done. However, the algorithm doesn't
 			//       work correctly if we don't add the current statement into
 			//       the def-use chain in such a case.
-			const auto &readVars = va->getValueData(*i)->getDirReadVars();
-			if (hasItem(readVars, defVar)) {
+			if (va->getValueData(*i)->isDirRead(defVar)) {
 				du.insert(*i);
 			}
 			return;
 		}
 
 		// Check whether the statement uses defVar (if not, then skip it).
-		const auto &readVars = va->getValueData(*i)->getDirReadVars();
-		if (!hasItem(readVars, defVar)) {
+		if (!va->getValueData(*i)->isDirRead(defVar)) {
 			continue;
 		}
 
@@ -462,8 +459,9 @@ void DefUseAnalysis::computeDefUseChainForStmt(ShPtr<DefUseChains> ducs,
 * pointer.
 */
 ShPtr<Variable> DefUseAnalysis::getDefVarInStmt(ShPtr<Statement> stmt) {
-	const auto &writtenVars = va->getValueData(stmt)->getDirWrittenVars();
-	return writtenVars.empty() ? ShPtr<Variable>() : *writtenVars.begin();
+	ShPtr<ValueData> stmtData(va->getValueData(stmt));
+	return stmtData->getNumOfDirWrittenVars() == 0 ? ShPtr<Variable>() :
+		*stmtData->dir_written_begin();
 }
 
 } // namespace llvmir2hll
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+
 #include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
@@ -79,18 +81,65 @@
 #include "retdec/utils/container.h"
 
 using retdec::utils::addToSet;
-using retdec::utils::hasItem;
 
 namespace retdec {
 namespace llvmir2hll {
 
 /**
-* @brief Constructs a new ValueData object.
+* @brief Constructs a new numbering without any variables.
+*/
+VarNumbering::VarNumbering(): vars(), ids() {}
+
+/**
+* @brief Returns the number of @a var, numbering it if it has not been
+*        numbered yet.
+*
+* @par Preconditions
+*  - @a var is non-null
+*/
+VarNumbering::Id VarNumbering::getId(ShPtr<Variable> var) {
+	PRECONDITION_NON_NULL(var);
+
+	auto i = ids.emplace(var.get(), static_cast<Id>(vars.size()));
+	if (i.second) {
+		vars.push_back(var);
+	}
+	return i.first->second;
+}
+
+/**
+* @brief Stores the number of @a var into @a id if @a var has been numbered.
+*
+* @return @c true if @a var has been numbered, @c false otherwise. If @c false
+*         is returned, @a id is left untouched.
+*/
+bool VarNumbering::findId(ShPtr<Variable> var, Id &id) const {
+	auto i = ids.find(var.get());
+	if (i == ids.end()) {
+		return false;
+	}
+	id = i->second;
+	return true;
+}
+
+/**
+* @brief Returns the variable with the given number.
+*
+* @par Preconditions
+*  - @a id is a number returned by getId()
 */
-ValueData::ValueData(): dirReadVars(), dirWrittenVars(), dirAllVars(),
-	dirNumOfVarUses(), mayBeReadVars(), mayBeWrittenVars(),
-	mayBeAccessedVars(), mustBeReadVars(), mustBeWrittenVars(),
-	mustBeAccessedVars(), calls(), addressTakenVars(), containsDerefs(false),
+const ShPtr<Variable> &VarNumbering::getVar(Id id) const {
+	PRECONDITION(id < vars.size(), "id " << id << " has not been assigned");
+
+	return vars[id];
+}
+
+/**
+* @brief Constructs a new ValueData object whose variables are numbered by
+*        @a numbering.
+*/
+ValueData::ValueData(ShPtr<VarNumbering> numbering): numbering(numbering),
+	varIds(), dirNumOfVarUses(), calls(), containsDerefs(false),
 	containsArrayAccesses(false), containsStructAccesses(false) {}
 
 /**
@@ -111,23 +160,41 @@ ValueData &ValueData::operator=(const ValueData &other) = default;
 /**
 * @brief Returns @c true if the current object is equal to @a other, @c false
 *        otherwise.
+*
+* The objects are equal if they have the same variables in every set, the
+* same number of direct uses of every variable, the same calls, and the same
+* flags. The result does not depend on the numberings of variables in which
+* the objects are expressed, so data computed before and after the numbering
+* of ValueAnalysis has been reset are compared by their variables.
 */
 bool ValueData::operator==(const ValueData &other) const {
-	return (dirReadVars == other.dirReadVars &&
-		dirWrittenVars == other.dirWrittenVars &&
-		dirAllVars == other.dirAllVars &&
-		dirNumOfVarUses == other.dirNumOfVarUses &&
-		mayBeReadVars == other.mayBeReadVars &&
-		mayBeWrittenVars == mayBeWrittenVars &&
-		mayBeAccessedVars == mayBeAccessedVars &&
-		mustBeReadVars == other.mustBeReadVars &&
-		mustBeWrittenVars == mustBeWrittenVars &&
-		mustBeAccessedVars == mustBeAccessedVars &&
-		calls == other.calls &&
-		addressTakenVars == other.addressTakenVars &&
-		containsDerefs == other.containsDerefs &&
-		containsArrayAccesses == other.containsArrayAccesses &&
-		containsStructAccesses == other.containsStructAccesses);
+	if (calls != other.calls ||
+			containsDerefs != other.containsDerefs ||
+			containsArrayAccesses != other.containsArrayAccesses ||
+			containsStructAccesses != other.containsStructAccesses) {
+		return false;
+	}
+
+	// When both objects use the same numbering, it suffices to compare the
+	// numbers. Otherwise, the numbers have to be resolved into variables.
+	if (numbering == other.numbering) {
+		return varIds == other.varIds &&
+			dirNumOfVarUses == other.dirNumOfVarUses;
+	}
+
+	for (std::size_t kind = 0; kind < NumOfVarSetKinds; ++kind) {
+		auto k = static_cast<VarSetKind>(kind);
+		if (VarSet(varsBegin(k), varsEnd(k)) !=
+				VarSet(other.varsBegin(k), other.varsEnd(k))) {
+			return false;
+		}
+	}
+	for (auto i = varsBegin(DirAll), e = varsEnd(DirAll); i != e; ++i) {
+		if (getDirNumOfUses(*i) != other.getDirNumOfUses(*i)) {
+			return false;
+		}
+	}
+	return true;
 }
 
 /**
@@ -138,46 +205,25 @@ bool ValueData::operator!=(const ValueData &other) const {
 	return !(*this == other);
 }
 
-/**
-* @brief Returns the variables that are directly read.
-*/
-const VarSet &ValueData::getDirReadVars() const {
-	return dirReadVars;
-}
-
-/**
-* @brief Returns the variables that are directly written into.
-*/
-const VarSet &ValueData::getDirWrittenVars() const {
-	return dirWrittenVars;
-}
-
-/**
-* @brief Returns the set of all directly accessed variables.
-*/
-const VarSet &ValueData::getDirAccessedVars() const {
-	return dirAllVars;
-}
-
 /**
 * @brief Returns the number of directly read variables.
 */
 std::size_t ValueData::getNumOfDirReadVars() const {
-	return dirReadVars.size();
+	return varIds[DirRead].size();
 }
 
 /**
 * @brief Returns the number of directly written variables.
 */
 std::size_t ValueData::getNumOfDirWrittenVars() const {
-	return dirWrittenVars.size();
+	return varIds[DirWritten].size();
 }
 
 /**
 * @brief Returns the number of directly accessed variables.
 */
 std::size_t ValueData::getNumOfDirAccessedVars() const {
-	return dirAllVars.size();
+	return varIds[DirAll].size();
 }
 
 /**
@@ -189,11 +235,18 @@ std::size_t ValueData::getNumOfDirAccessedVars() const {
 std::size_t ValueData::getDirNumOfUses(ShPtr<Variable> var) const {
 	PRECONDITION_NON_NULL(var);
 
-	auto i = dirNumOfVarUses.find(var);
-	if (i != dirNumOfVarUses.end()) {
+	// A variable that has not been numbered cannot have any use.
+	VarNumbering::Id id;
+	if (!numbering->findId(var, id)) {
+		return 0;
+	}
+
+	auto i = std::lower_bound(dirNumOfVarUses.begin(), dirNumOfVarUses.end(),
+		std::make_pair(id, std::size_t(0)));
+	if (i != dirNumOfVarUses.end() && i->first == id) {
 		return i->second;
 	}
-	// The given variable doesn't exist, so it doesn't have any use.
+	// The given variable is not used, so it doesn't have any use.
 	return 0;
 }
 
@@ -201,100 +254,70 @@ std::size_t ValueData::getDirNumOfUses(ShPtr<Variable> var) const {
 * @brief Returns an iterator to the first directly read variable.
 */
 ValueData::var_iterator ValueData::dir_read_begin() const {
-	return dirReadVars.begin();
+	return varsBegin(DirRead);
 }
 
 /**
 * @brief Returns an iterator past the last directly read variable.
 */
 ValueData::var_iterator ValueData::dir_read_end() const {
-	return dirReadVars.end();
+	return varsEnd(DirRead);
 }
 
 /**
 * @brief Returns an iterator to the first directly written variable.
 */
 ValueData::var_iterator ValueData::dir_written_begin() const {
-	return dirWrittenVars.begin();
+	return varsBegin(DirWritten);
 }
 
 /**
 * @brief Returns an iterator past the last directly written variable.
 */
 ValueData::var_iterator ValueData::dir_written_end() const {
-	return dirWrittenVars.end();
+	return varsEnd(DirWritten);
 }
 
 /**
 * @brief Returns an iterator to the first directly accessed variable.
 */
 ValueData::var_iterator ValueData::dir_all_begin() const {
-	return dirAllVars.begin();
+	return varsBegin(DirAll);
 }
 
 /**
 * @brief Returns an iterator past the last directly accessed variable.
 */
 ValueData::var_iterator ValueData::dir_all_end() const {
-	return dirAllVars.end();
+	return varsEnd(DirAll);
 }
 
 /**
 * @brief Returns @c true if @a var is directly read, @c false otherwise.
 */
 bool ValueData::isDirRead(ShPtr<Variable> var) const {
-	return hasItem(dirReadVars, var);
+	return contains(DirRead, var);
 }
 
 /**
 * @brief Returns @c true if @a var is directly written, @c false otherwise.
 */
 bool ValueData::isDirWritten(ShPtr<Variable> var) const {
-	return hasItem(dirWrittenVars, var);
+	return contains(DirWritten, var);
 }
 
 /**
 * @brief Returns @c true if @a var is directly accessed, @c false otherwise.
 */
 bool ValueData::isDirAccessed(ShPtr<Variable> var) const {
-	return hasItem(dirAllVars, var);
-}
-
-/**
-* @brief Returns the set of variables that may be indirectly read.
-*
-* Variables which must be read (i.e. are always read) are not included into the
-* result.
-*/
-const VarSet &ValueData::getMayBeReadVars() const {
-	return mayBeReadVars;
-}
-
-/**
-* @brief Returns the set of variables into which may be indirectly written.
-*
-* Variables which must be written (i.e. are always written) are not included
-* into the result.
-*/
-const VarSet &ValueData::getMayBeWrittenVars() const {
-	return mayBeWrittenVars;
-}
-
-/**
-* @brief Returns the set of variables that may be indirectly accessed.
-*
-* Variables which must be accessed (i.e. are always accessed) are not included
-* into the result.
-*/
-const VarSet &ValueData::getMayBeAccessedVars() const {
-	return mayBeAccessedVars;
+	return contains(DirAll, var);
 }
 
 /**
 * @brief Returns @c true if @a var may be indirectly read, @c false otherwise.
 */
 bool ValueData::mayBeIndirRead(ShPtr<Variable> var) const {
-	return hasItem(mayBeReadVars, var);
+	return contains(MayBeRead, var);
 }
 
 /**
@@ -302,7 +325,7 @@ bool ValueData::mayBeIndirRead(ShPtr<Variable> var) const {
 *        otherwise.
 */
 bool ValueData::mayBeIndirWritten(ShPtr<Variable> var) const {
-	return hasItem(mayBeWrittenVars, var);
+	return contains(MayBeWritten, var);
 }
 
 /**
@@ -310,7 +333,7 @@ bool ValueData::mayBeIndirWritten(ShPtr<Variable> var) const {
 *        otherwise.
 */
 bool ValueData::mayBeIndirAccessed(ShPtr<Variable> var) const {
-	return hasItem(mayBeAccessedVars, var);
+	return contains(MayBeAccessed, var);
 }
 
 /**
@@ -321,7 +344,7 @@ bool ValueData::mayBeIndirAccessed(ShPtr<Variable> var) const {
 * result.
 */
 ValueData::var_iterator ValueData::may_be_read_begin() const {
-	return mayBeReadVars.begin();
+	return varsBegin(MayBeRead);
 }
 
 /**
@@ -332,7 +355,7 @@ ValueData::var_iterator ValueData::may_be_read_begin() const {
 * result.
 */
 ValueData::var_iterator ValueData::may_be_read_end() const {
-	return mayBeReadVars.end();
+	return varsEnd(MayBeRead);
 }
 
 /**
@@ -343,7 +366,7 @@ ValueData::var_iterator ValueData::may_be_read_end() const {
 * into the result.
 */
 ValueData::var_iterator ValueData::may_be_written_begin() const {
-	return mayBeWrittenVars.begin();
+	return varsBegin(MayBeWritten);
 }
 
 /**
@@ -354,7 +377,7 @@ ValueData::var_iterator ValueData::may_be_written_begin() const {
 * into the result.
 */
 ValueData::var_iterator ValueData::may_be_written_end() const {
-	return mayBeWrittenVars.end();
+	return varsEnd(MayBeWritten);
 }
 
 /**
@@ -365,7 +388,7 @@ ValueData::var_iterator ValueData::may_be_written_end() const {
 * into the result.
 */
 ValueData::var_iterator ValueData::may_be_accessed_begin() const {
-	return mayBeAccessedVars.begin();
+	return varsBegin(MayBeAccessed);
 }
 
 /**
@@ -375,35 +398,14 @@ ValueData::var_iterator ValueData::may_be_accessed_begin() const {
 * into the result.
 */
 ValueData::var_iterator ValueData::may_be_accessed_end() const {
-	return mayBeAccessedVars.end();
-}
-
-/**
-* @brief Returns the set of variables that must be indirectly read.
-*/
-const VarSet &ValueData::getMustBeReadVars() const {
-	return mustBeReadVars;
-}
-
-/**
-* @brief Returns the set of variables into which must be indirectly written.
-*/
-const VarSet &ValueData::getMustBeWrittenVars() const {
-	return mustBeWrittenVars;
-}
-
-/**
-* @brief Returns the set of variables that must be indirectly accessed.
-*/
-const VarSet &ValueData::getMustBeAccessedVars() const {
-	return mustBeAccessedVars;
+	return varsEnd(MayBeAccessed);
 }
 
 /**
 * @brief Returns @c true if @a var must be indirectly read, @c false otherwise.
 */
 bool ValueData::mustBeIndirRead(ShPtr<Variable> var) const {
-	return hasItem(mustBeReadVars, var);
+	return contains(MustBeRead, var);
 }
 
 /**
@@ -411,7 +413,7 @@ bool ValueData::mustBeIndirRead(ShPtr<Variable> var) const {
 *        otherwise.
 */
 bool ValueData::mustBeIndirWritten(ShPtr<Variable> var) const {
-	return hasItem(mustBeWrittenVars, var);
+	return contains(MustBeWritten, var);
 }
 
 /**
@@ -419,7 +421,7 @@ bool ValueData::mustBeIndirWritten(ShPtr<Variable> var) const {
 *        otherwise.
 */
 bool ValueData::mustBeIndirAccessed(ShPtr<Variable> var) const {
-	return hasItem(mustBeAccessedVars, var);
+	return contains(MustBeAccessed, var);
 }
 
 /**
@@ -427,7 +429,7 @@ bool ValueData::mustBeIndirAccessed(ShPtr<Variable> var) const {
 *        indirectly read.
 */
 ValueData::var_iterator ValueData::must_be_read_begin() const {
-	return mustBeReadVars.begin();
+	return varsBegin(MustBeRead);
 }
 
 /**
@@ -435,7 +437,7 @@ ValueData::var_iterator ValueData::must_be_read_begin() const {
 *        indirectly read.
 */
 ValueData::var_iterator ValueData::must_be_read_end() const {
-	return mustBeReadVars.end();
+	return varsEnd(MustBeRead);
 }
 
 /**
@@ -443,7 +445,7 @@ ValueData::var_iterator ValueData::must_be_read_end() const {
 *        written.
 */
 ValueData::var_iterator ValueData::must_be_written_begin() const {
-	return mustBeWrittenVars.begin();
+	return varsBegin(MustBeWritten);
 }
 
 /**
@@ -451,7 +453,7 @@ ValueData::var_iterator ValueData::must_be_written_begin() const {
 *        written.
 */
 ValueData::var_iterator ValueData::must_be_written_end() const {
-	return mustBeWrittenVars.end();
+	return varsEnd(MustBeWritten);
 }
 
 /**
@@ -459,7 +461,7 @@ ValueData::var_iterator ValueData::must_be_written_end() const {
 *        accessed.
 */
 ValueData::var_iterator ValueData::must_be_accessed_begin() const {
-	return mustBeAccessedVars.begin();
+	return varsBegin(MustBeAccessed);
 }
 
 /**
@@ -467,7 +469,7 @@ ValueData::var_iterator ValueData::must_be_accessed_begin() const {
 *        accessed.
 */
 ValueData::var_iterator ValueData::must_be_accessed_end() const {
-	return mustBeAccessedVars.end();
+	return varsEnd(MustBeAccessed);
 }
 
 /**
@@ -509,7 +511,7 @@ ValueData::call_iterator ValueData::call_end() const {
 * @brief Returns @c true if there are any address operators, @c false otherwise.
 */
 bool ValueData::hasAddressOps() const {
-	return !addressTakenVars.empty();
+	return !varIds[AddressTaken].empty();
 }
 
 /**
@@ -521,7 +523,7 @@ bool ValueData::hasAddressOps() const {
 bool ValueData::hasAddressTaken(ShPtr<Variable> var) const {
 	PRECONDITION_NON_NULL(var);
 
-	return hasItem(addressTakenVars, var);
+	return contains(AddressTaken, var);
 }
 
 /**
@@ -549,23 +551,87 @@ bool ValueData::hasStructAccesses() const {
 * @brief Clears all private containers and variables.
 */
 void ValueData::clear() {
-	dirReadVars.clear();
-	dirWrittenVars.clear();
-	dirAllVars.clear();
+	for (auto &ids : varIds) {
+		ids.clear();
+	}
 	dirNumOfVarUses.clear();
-	mayBeReadVars.clear();
-	mayBeWrittenVars.clear();
-	mayBeAccessedVars.clear();
-	mustBeReadVars.clear();
-	mustBeWrittenVars.clear();
-	mustBeAccessedVars.clear();
 	calls.clear();
-	addressTakenVars.clear();
 	containsDerefs = false;
 	containsArrayAccesses = false;
 	containsStructAccesses = false;
 }
 
+/**
+* @brief Adds @a var into the set of variables of the given kind.
+*/
+void ValueData::addVar(VarSetKind kind, ShPtr<Variable> var) {
+	auto id = numbering->getId(var);
+	auto &ids = varIds[kind];
+	auto i = std::lower_bound(ids.begin(), ids.end(), id);
+	if (i == ids.end() || *i != id) {
+		ids.insert(i, id);
+	}
+}
+
+/**
+* @brief Adds all variables from @a vars into the set of variables of the
+*        given kind.
+*/
+void ValueData::addVars(VarSetKind kind, const VarSet &vars) {
+	for (const auto &var : vars) {
+		addVar(kind, var);
+	}
+}
+
+/**
+* @brief Increments the number of direct uses of @a var.
+*/
+void ValueData::addDirUse(ShPtr<Variable> var) {
+	auto id = numbering->getId(var);
+	auto i = std::lower_bound(dirNumOfVarUses.begin(), dirNumOfVarUses.end(),
+		std::make_pair(id, std::size_t(0)));
+	if (i == dirNumOfVarUses.end() || i->first != id) {
+		i = dirNumOfVarUses.insert(i, std::make_pair(id, std::size_t(0)));
+	}
+	++i->second;
+}
+
+/**
+* @brief Computes the set of all directly accessed variables from the sets of
+*        directly read and written variables.
+*/
+void ValueData::computeDirAllVars() {
+	auto &dirAll = varIds[DirAll];
+	dirAll.clear();
+	std::set_union(varIds[DirRead].begin(), varIds[DirRead].end(),
+		varIds[DirWritten].begin(), varIds[DirWritten].end(),
+		std::back_inserter(dirAll));
+}
+
+/**
+* @brief Returns @c true if @a var is in the set of variables of the given
+*        kind, @c false otherwise.
+*/
+bool ValueData::contains(VarSetKind kind, ShPtr<Variable> var) const {
+	VarNumbering::Id id;
+	return numbering->findId(var, id) &&
+		std::binary_search(varIds[kind].begin(), varIds[kind].end(), id);
+}
+
+/**
+* @brief Returns an iterator to the first variable of the given kind.
+*/
+ValueData::var_iterator ValueData::varsBegin(VarSetKind kind) const {
+	return var_iterator(numbering.get(), varIds[kind].begin());
+}
+
+/**
+* @brief Returns an iterator past the last variable of the given kind.
+*/
+ValueData::var_iterator ValueData::varsEnd(VarSetKind kind) const {
+	return var_iterator(numbering.get(), varIds[kind].end());
+}
+
 /**
 * @brief Constructs a new visitor.
 *
@@ -574,7 +640,8 @@ void ValueData::clear() {
 ValueAnalysis::ValueAnalysis(ShPtr<AliasAnalysis> aliasAnalysis,
 		bool enableCaching):
 	OrderedAllVisitor(false, false), Caching(enableCaching),
-	aliasAnalysis(aliasAnalysis), valueData(), writing(false),
+	aliasAnalysis(aliasAnalysis), varNumbering(std::make_shared<VarNumbering>()),
+	valueData(), writing(false),
 	removingFromCache(false) {}
 
 /**
@@ -598,15 +665,19 @@ ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 
 	// Initialization.
 	restart(false, false);
-	valueData = ShPtr<ValueData>(new ValueData());
+	if (!isCachingEnabled()) {
+		// Without caching, there is nobody who could share the numbering, so
+		// start from scratch to keep the numbers small.
+		varNumbering = std::make_shared<VarNumbering>();
+	}
+	valueData = ShPtr<ValueData>(new ValueData(varNumbering));
 	writing = false;
 
 	// Obtain read and written-into variables.
 	value->accept(this);
 
 	// Merge them into the set of all variables.
-	addToSet(valueData->dirReadVars, valueData->dirAllVars);
-	addToSet(valueData->dirWrittenVars, valueData->dirAllVars);
+	valueData->computeDirAllVars();
 
 	// Caching.
 	addToCache(value, valueData);
@@ -621,6 +692,9 @@ ShPtr<ValueData> ValueAnalysis::getValueData(ShPtr<Value> value) {
 */
 void ValueAnalysis::clearCache() {
 	Caching::clearCache();
+	// Variables that have been removed from the module would otherwise be
+	// kept alive by the numbering.
+	varNumbering = std::make_shared<VarNumbering>();
 	validateState();
 }
 
@@ -804,19 +878,19 @@ void ValueAnalysis::computeAndStoreIndirectlyUsedVars(ShPtr<DerefOpExpr> expr) {
 	const VarSet &varsFromInnmostDeref(accessedVarsInDeref[numOfDerefs - 1]);
 	if (mustInDeref[numOfDerefs - 1]) {
 		// must
-		valueData->mustBeAccessedVars.insert(*varsFromInnmostDeref.begin());
+		valueData->addVar(ValueData::MustBeAccessed, *varsFromInnmostDeref.begin());
 		if (writing) {
-			valueData->mustBeWrittenVars.insert(*varsFromInnmostDeref.begin());
+			valueData->addVar(ValueData::MustBeWritten, *varsFromInnmostDeref.begin());
 		} else {
-			valueData->mustBeReadVars.insert(*varsFromInnmostDeref.begin());
+			valueData->addVar(ValueData::MustBeRead, *varsFromInnmostDeref.begin());
 		}
 	} else {
 		// may
-		addToSet(varsFromInnmostDeref, valueData->mayBeAccessedVars);
+		valueData->addVars(ValueData::MayBeAccessed, varsFromInnmostDeref);
 		if (writing) {
-			addToSet(varsFromInnmostDeref, valueData->mayBeWrittenVars);
+			valueData->addVars(ValueData::MayBeWritten, varsFromInnmostDeref);
 		} else {
-			addToSet(varsFromInnmostDeref, valueData->mayBeReadVars);
+			valueData->addVars(ValueData::MayBeRead, varsFromInnmostDeref);
 		}
 	}
 	// For the index [i], where i = 0, ..., numOfDerefs - 1 (not the outermost
@@ -825,12 +899,12 @@ void ValueAnalysis::computeAndStoreIndirectlyUsedVars(ShPtr<DerefOpExpr> expr) {
 		const VarSet &varsFromCurrDeref(accessedVarsInDeref[i]);
 		if (mustInDeref[i]) {
 			// must
-			valueData->mustBeAccessedVars.insert(*varsFromCurrDeref.begin());
-			valueData->mustBeReadVars.insert(*varsFromCurrDeref.begin());
+			valueData->addVar(ValueData::MustBeAccessed, *varsFromCurrDeref.begin());
+			valueData->addVar(ValueData::MustBeRead, *varsFromCurrDeref.begin());
 		} else {
 			// may
-			addToSet(varsFromCurrDeref, valueData->mayBeAccessedVars);
-			addToSet(varsFromCurrDeref, valueData->mayBeReadVars);
+			valueData->addVars(ValueData::MayBeAccessed, varsFromCurrDeref);
+			valueData->addVars(ValueData::MayBeRead, varsFromCurrDeref);
 		}
 	}
 }
@@ -1068,7 +1142,7 @@ void ValueAnalysis::visit(ShPtr<AddressOpExpr> expr) {
 	// Address operators
 	//
 	if (ShPtr<Variable> var = cast<Variable>(expr->getOperand())) {
-		valueData->addressTakenVars.insert(var);
+		valueData->addVar(ValueData::AddressTaken, var);
 	}
 
 	OrderedAllVisitor::visit(expr);
@@ -1451,12 +1525,12 @@ void ValueAnalysis::visit(ShPtr<Variable> var) {
 	// Directly used variables
 	//
 	if (writing) {
-		valueData->dirWrittenVars.insert(var);
+		valueData->addVar(ValueData::DirWritten, var);
 	} else {
-		valueData->dirReadVars.insert(var);
+		valueData->addVar(ValueData::DirRead, var);
 	}
 
-	valueData->dirNumOfVarUses[var]++;
+	valueData->addDirUse(var);
 }
 
 void ValueAnalysis::visit(ShPtr<BitCastExpr> expr) {
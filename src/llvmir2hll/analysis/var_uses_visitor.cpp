@@ -28,9 +28,7 @@
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/utils/container.h"
 
-using retdec::utils::addToSet;
 using retdec::utils::hasItem;
-using retdec::utils::setUnion;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -196,10 +194,11 @@ void VarUsesVisitor::stmtHasBeenAdded(ShPtr<Statement> stmt,
 
 	// Get all variables used in the new statement.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	VarSet dirUsedVars(stmtData->getDirAccessedVars());
-	VarSet indirUsedVars(setUnion(
-		stmtData->getMayBeAccessedVars(),
-		stmtData->getMustBeAccessedVars()));
+	VarSet dirUsedVars(stmtData->dir_all_begin(), stmtData->dir_all_end());
+	VarSet indirUsedVars(stmtData->may_be_accessed_begin(),
+		stmtData->may_be_accessed_end());
+	indirUsedVars.insert(stmtData->must_be_accessed_begin(),
+		stmtData->must_be_accessed_end());
 
 	// Go over all variables used in the function. If the current variable is
 	// used in the new statement, update its uses.
@@ -261,10 +260,6 @@ void VarUsesVisitor::stmtHasBeenChanged(ShPtr<Statement> stmt,
 
 	// Get all variables used in the new statement.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	const VarSet &dirUsedVars(stmtData->getDirAccessedVars());
-	const VarSet &indirUsedVars(setUnion(
-		stmtData->getMayBeAccessedVars(),
-		stmtData->getMustBeAccessedVars()));
 
 	// Go over all variables used in the function and remove the statement from
 	// the uses of all variables in the function which are not used in the
@@ -272,12 +267,13 @@ void VarUsesVisitor::stmtHasBeenChanged(ShPtr<Statement> stmt,
 	for (const auto &p : cache[func]) {
 		// Direct uses.
 		p.second->dirUses.erase(stmt);
-		if (hasItem(dirUsedVars, p.first)) {
+		if (stmtData->isDirAccessed(p.first)) {
 			p.second->dirUses.insert(stmt);
 		}
 		// Indirect uses.
 		p.second->indirUses.erase(stmt);
-		if (hasItem(indirUsedVars, p.first)) {
+		if (stmtData->mayBeIndirAccessed(p.first) ||
+				stmtData->mustBeIndirAccessed(p.first)) {
 			p.second->indirUses.insert(stmt);
 		}
 	}
@@ -410,9 +406,10 @@ void VarUsesVisitor::findAndStoreUses(ShPtr<Statement> stmt) {
 		}
 
 		// Indirectly used variables.
-		VarSet indirUsedVars;
-		addToSet(stmtData->getMayBeAccessedVars(), indirUsedVars);
-		addToSet(stmtData->getMustBeAccessedVars(), indirUsedVars);
+		VarSet indirUsedVars(stmtData->may_be_accessed_begin(),
+			stmtData->may_be_accessed_end());
+		indirUsedVars.insert(stmtData->must_be_accessed_begin(),
+			stmtData->must_be_accessed_end());
 		// For every indirectly used variable...
 		for (const auto &var : indirUsedVars) {
 			ShPtr<VarUses> &varUses(cache[func][var]);
@@ -430,8 +427,8 @@ void VarUsesVisitor::findAndStoreUses(ShPtr<Statement> stmt) {
 		}
 
 		// Is the variable used indirectly?
-		if (hasItem(stmtData->getMayBeAccessedVars(), var) ||
-				hasItem(stmtData->getMustBeAccessedVars(), var)) {
+		if (stmtData->mayBeIndirAccessed(var) ||
+				stmtData->mustBeIndirAccessed(var)) {
 			varUses->indirUses.insert(stmt);
 		}
 	}
@@ -4,11 +4,14 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <utility>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/address_op_expr.h"
 #include "retdec/llvmir2hll/ir/and_op_expr.h"
 #include "retdec/llvmir2hll/ir/array_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/binary_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_cast_expr.h"
 #include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
@@ -45,6 +48,7 @@
 #include "retdec/llvmir2hll/ir/sub_op_expr.h"
 #include "retdec/llvmir2hll/ir/ternary_op_expr.h"
 #include "retdec/llvmir2hll/ir/trunc_cast_expr.h"
+#include "retdec/llvmir2hll/ir/unary_op_expr.h"
 #include "retdec/llvmir2hll/ir/variable.h"
 #include "retdec/llvmir2hll/support/debug.h"
 
@@ -52,44 +56,85 @@ namespace retdec {
 namespace llvmir2hll {
 namespace {
 
+/// Maximal number of memoized results. When it is reached, all memoized results
+/// are dropped.
+const std::size_t MAX_MEMOIZED_RESULTS = 1024;
+
+/**
+* @brief Collects variables in an expression, in the order of their
+*        appearance.
+*/
+class VarsInExprCollector: private OrderedAllVisitor {
+public:
+	/**
+	* @brief Stores the variables in @a expr into @a vars.
+	*/
+	void collect(ShPtr<Expression> expr, std::vector<ShPtr<Variable>> &vars) {
+		vars.clear();
+		this->vars = &vars;
+		expr->accept(this);
+	}
+
+private:
+	using OrderedAllVisitor::visit;
+	virtual void visit(ShPtr<Variable> var) override {
+		vars->push_back(var);
+	}
+
+private:
+	/// Collected variables.
+	std::vector<ShPtr<Variable>> *vars = nullptr;
+};
+
 /**
 * @brief Top and pop stack.
 *
 * @param[in, out] stack Stack to top and pop.
 *
-* @return Topped constant operand.
+* @return Topped operand.
 */
-ShPtr<Constant> topAndPopStack(ArithmExprEvaluator::ConstStack &stack) {
+EvaluatedValue topAndPopStack(ArithmExprEvaluator::ValueStack &stack) {
 	ASSERT_MSG(!stack.empty(), "Signalizes not correctly evaluating.");
-	ShPtr<Constant> constant(stack.top());
-	stack.pop();
-	return constant;
+	EvaluatedValue value(std::move(stack.back()));
+	stack.pop_back();
+	return value;
 }
 
 /**
 * @brief Choose the first and the second operator from the @a stack and
-*        return a @c ConstPair.
+*        return an @c EvaluatedValuePair.
 *
 * @param[in, out] stack Stack with operands.
 *
-* @return A pair of constant operands.
+* @return A pair of operands.
 */
-ArithmExprEvaluator::ConstPair getFirstAndSecondOpFromStack(
-		ArithmExprEvaluator::ConstStack &stack) {
+EvaluatedValuePair getFirstAndSecondOpFromStack(
+		ArithmExprEvaluator::ValueStack &stack) {
 	// The second operand is on the top of the stack, so pop it first.
-	ShPtr<Constant> second(topAndPopStack(stack));
-	ShPtr<Constant> first(topAndPopStack(stack));
-	return ArithmExprEvaluator::ConstPair(first, second);
+	EvaluatedValue second(topAndPopStack(stack));
+	EvaluatedValue first(topAndPopStack(stack));
+	return EvaluatedValuePair(std::move(first), std::move(second));
 }
 
 /**
-* @brief Clear the @a stack.
-*
-* @param[in, out] stack Stack to clear.
+* @brief Returns the result of a bitwise and of @a first and @a second.
 */
-void clearStack(ArithmExprEvaluator::ConstStack &stack) {
-	// std::stack doesn't have clear method.
-	stack = ArithmExprEvaluator::ConstStack();
+llvm::APInt bitAnd(const llvm::APInt &first, const llvm::APInt &second) {
+	return first & second;
+}
+
+/**
+* @brief Returns the result of a bitwise or of @a first and @a second.
+*/
+llvm::APInt bitOr(const llvm::APInt &first, const llvm::APInt &second) {
+	return first | second;
+}
+
+/**
+* @brief Returns the result of a bitwise xor of @a first and @a second.
+*/
+llvm::APInt bitXor(const llvm::APInt &first, const llvm::APInt &second) {
+	return first ^ second;
 }
 
 } // anonymous namespace
@@ -99,7 +144,9 @@ void clearStack(ArithmExprEvaluator::ConstStack &stack) {
 *
 * Use create() to create instances.
 */
-ArithmExprEvaluator::ArithmExprEvaluator() : canBeEvaluated(true) {}
+ArithmExprEvaluator::ArithmExprEvaluator():
+	canBeEvaluated(true), varValues(nullptr), stackOfResults(),
+	memoizedResults(), varsInExpr() {}
 
 /**
 * @brief Destructor.
@@ -129,14 +176,8 @@ ShPtr<Constant> ArithmExprEvaluator::evaluate(ShPtr<Expression> expr) {
 */
 ShPtr<Constant> ArithmExprEvaluator::evaluate(ShPtr<Expression> expr,
 		const VarConstMap &varValues) {
-	// Need to set stack and canBeEvaluated to initial state.
-	clearStack(stackOfResults);
-	canBeEvaluated = true;
-
-	this->varValues = &varValues;
-	expr->accept(this);
-	return canBeEvaluated && !stackOfResults.empty() ? stackOfResults.top() :
-		ShPtr<Constant>();
+	// A constant is created only for the final result.
+	return evaluateToValue(expr, varValues).toConstant();
 }
 
 /**
@@ -148,19 +189,13 @@ ShPtr<Constant> ArithmExprEvaluator::evaluate(ShPtr<Expression> expr,
 * @return <tt>Just(bool)</tt> if the @a expr after evaluation is @c bool,
 *         <tt>Nothing<bool>()</tt> otherwise.
 */
-Maybe<bool> ArithmExprEvaluator::toBool(ShPtr<Expression> expr, VarConstMap
-		varValues) {
-	ShPtr<Constant> result(evaluate(expr, varValues));
-	if (!result) {
-		return Nothing<bool>();
-	}
-
-	if (ShPtr<ConstInt> constInt = cast<ConstInt>(result)) {
-			return Just(!constInt->isZero());
-	} else if (ShPtr<ConstFloat> constFloat = cast<ConstFloat>(result)) {
-		return Just(!constFloat->isZero());
-	} else if (ShPtr<ConstBool> constBool = cast<ConstBool>(result)) {
-		return Just(constBool->getValue());
+Maybe<bool> ArithmExprEvaluator::toBool(ShPtr<Expression> expr,
+		const VarConstMap &varValues) {
+	EvaluatedValue result(evaluateToValue(expr, varValues));
+	if (result.isInt() || result.isFloat()) {
+		return Just(!result.isZero());
+	} else if (result.isBool()) {
+		return Just(result.getBool());
 	} else {
 		return Nothing<bool>();
 	}
@@ -183,589 +218,550 @@ void ArithmExprEvaluator::visit(ShPtr<DerefOpExpr> expr) {
 }
 
 void ArithmExprEvaluator::visit(ShPtr<NotOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> operand(getOperandForUnaryOpAndResolveTypes());
+		EvaluatedValue operand(getOperandForUnaryOpAndResolveTypes());
 		resolveOpSpecifications(expr, operand);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (ShPtr<ConstInt> operandConstInt = cast<ConstInt>(operand)) {
-			result = ConstBool::create(!operandConstInt->getValue());
-		} else if (ShPtr<ConstFloat> operandConstFloat = cast<ConstFloat>(
-				operand)) {
-			result = ConstBool::create(operandConstFloat->isZero());
-		} else if (ShPtr<ConstBool> operandConstBool = cast<ConstBool>(
-				operand)) {
-			result = ConstBool::create(!operandConstBool->getValue());
+		EvaluatedValue result;
+		if (operand.isInt()) {
+			result = EvaluatedValue(!operand.getInt());
+		} else if (operand.isFloat()) {
+			result = EvaluatedValue(operand.isZero());
+		} else if (operand.isBool()) {
+			result = EvaluatedValue(!operand.getBool());
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<NegOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> operand(getOperandForUnaryOpAndResolveTypes());
+		EvaluatedValue operand(getOperandForUnaryOpAndResolveTypes());
 		resolveOpSpecifications(expr, operand);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (ShPtr<ConstInt> operandConstInt = cast<ConstInt>(operand)) {
-			result = ConstInt::create(-operandConstInt->getValue());
-		} else if (ShPtr<ConstFloat> operandConstFloat = cast<ConstFloat>(
-				operand)) {
-			llvm::APFloat apFloat = operandConstFloat->getValue();
+		EvaluatedValue result;
+		if (operand.isInt()) {
+			result = EvaluatedValue(-operand.getInt());
+		} else if (operand.isFloat()) {
+			llvm::APFloat apFloat = operand.getFloat();
 			apFloat.changeSign();
-			result = ConstFloat::create(apFloat);
+			result = EvaluatedValue(apFloat);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::eq);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = ConstBool::create(
-				performOperationOverApFloat(constFloatPair) ==
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::eq);
+		} else if (areFloats(operands)) {
+			result = EvaluatedValue(
+				performOperationOverApFloat(operands) ==
 					llvm::APFloat::cmpEqual);
-		} else if (Maybe<ConstBoolPair> constBoolPair = castConstPair<
-				ConstBool>(constPair)) {
-			result = ConstBool::create(constBoolPair->first->getValue() ==
-				constBoolPair->second->getValue());
+		} else if (areBools(operands)) {
+			result = EvaluatedValue(operands.first.getBool() ==
+				operands.second.getBool());
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::ne);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = ConstBool::create(
-				performOperationOverApFloat(constFloatPair) !=
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::ne);
+		} else if (areFloats(operands)) {
+			result = EvaluatedValue(
+				performOperationOverApFloat(operands) !=
 					llvm::APFloat::cmpEqual);
-		} else if (Maybe<ConstBoolPair> constBoolPair = castConstPair<
-				ConstBool>(constPair)) {
-			result = ConstBool::create(constBoolPair->first->getValue() !=
-				constBoolPair->second->getValue());
+		} else if (areBools(operands)) {
+			result = EvaluatedValue(operands.first.getBool() !=
+				operands.second.getBool());
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<LtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::sle);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::sle);
+		} else if (areFloats(operands)) {
 			llvm::APFloat::cmpResult cmpResult = performOperationOverApFloat(
-				constFloatPair);
-			result = ConstBool::create(cmpResult == llvm::APFloat::cmpEqual ||
+				operands);
+			result = EvaluatedValue(cmpResult == llvm::APFloat::cmpEqual ||
 					cmpResult == llvm::APFloat::cmpLessThan);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<GtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::sge);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::sge);
+		} else if (areFloats(operands)) {
 			llvm::APFloat::cmpResult cmpResult = performOperationOverApFloat(
-				constFloatPair);
-			result = ConstBool::create(cmpResult == llvm::APFloat::cmpEqual ||
+				operands);
+			result = EvaluatedValue(cmpResult == llvm::APFloat::cmpEqual ||
 					cmpResult == llvm::APFloat::cmpGreaterThan);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<LtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::slt);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = ConstBool::create(
-				performOperationOverApFloat(constFloatPair) ==
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::slt);
+		} else if (areFloats(operands)) {
+			result = EvaluatedValue(
+				performOperationOverApFloat(operands) ==
 					llvm::APFloat::cmpLessThan);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<GtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::sgt);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = ConstBool::create(
-				performOperationOverApFloat(constFloatPair) ==
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::sgt);
+		} else if (areFloats(operands)) {
+			result = EvaluatedValue(
+				performOperationOverApFloat(operands) ==
 					llvm::APFloat::cmpGreaterThan);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
+		EvaluatedValue result;
 		bool overflow = false;
 		llvm::APFloat::opStatus opStatus = llvm::APFloat::opOK;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair,
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands,
 				&llvm::APInt::sadd_ov, overflow);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = performOperationOverApFloat(constFloatPair,
+		} else if (areFloats(operands)) {
+			result = performOperationOverApFloat(operands,
 				&llvm::APFloat::add, opStatus);
 		} else {
 			canBeEvaluated = false;
 		}
 
 		resolveOverflows(overflow, opStatus);
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
+		EvaluatedValue result;
 		bool overflow = false;
 		llvm::APFloat::opStatus opStatus = llvm::APFloat::opOK;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair,
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands,
 				&llvm::APInt::ssub_ov, overflow);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = performOperationOverApFloat(constFloatPair,
+		} else if (areFloats(operands)) {
+			result = performOperationOverApFloat(operands,
 				&llvm::APFloat::subtract, opStatus);
 		} else {
 			canBeEvaluated = false;
 		}
 
 		resolveOverflows(overflow, opStatus);
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
+		EvaluatedValue result;
 		bool overflow = false;
 		llvm::APFloat::opStatus opStatus = llvm::APFloat::opOK;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair,
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands,
 				&llvm::APInt::smul_ov, overflow);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = performOperationOverApFloat(constFloatPair,
+		} else if (areFloats(operands)) {
+			result = performOperationOverApFloat(operands,
 				&llvm::APFloat::multiply, opStatus);
 		} else {
 			canBeEvaluated = false;
 		}
 
 		resolveOverflows(overflow, opStatus);
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ModOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
+		EvaluatedValue result;
 		llvm::APFloat::opStatus opStatus = llvm::APFloat::opOK;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::srem);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = performOperationOverApFloat(constFloatPair,
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, &llvm::APInt::srem);
+		} else if (areFloats(operands)) {
+			result = performOperationOverApFloat(operands,
 				&llvm::APFloat::mod, opStatus);
 		} else {
 			canBeEvaluated = false;
 		}
 
 		resolveOverflowForAPFloat(opStatus);
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
+		EvaluatedValue result;
 		bool overflow = false;
 		llvm::APFloat::opStatus opStatus = llvm::APFloat::opOK;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair,
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands,
 				&llvm::APInt::sdiv_ov, overflow);
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = performOperationOverApFloat(constFloatPair,
+		} else if (areFloats(operands)) {
+			result = performOperationOverApFloat(operands,
 				&llvm::APFloat::divide, opStatus);
 		} else {
 			canBeEvaluated = false;
 		}
 
 		resolveOverflows(overflow, opStatus);
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<AndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = ConstBool::create(!constIntPair->first->isZero() &&
-				!constIntPair->second->isZero());
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = ConstBool::create(!constFloatPair->first->isZero() &&
-				!constFloatPair->second->isZero());
-		} else if (Maybe<ConstBoolPair> constBoolPair = castConstPair<
-				ConstBool>(constPair)) {
-			result = ConstBool::create(constBoolPair->first->getValue() &&
-				constBoolPair->second->getValue());
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = EvaluatedValue(!operands.first.isZero() &&
+				!operands.second.isZero());
+		} else if (areFloats(operands)) {
+			result = EvaluatedValue(!operands.first.isZero() &&
+				!operands.second.isZero());
+		} else if (areBools(operands)) {
+			result = EvaluatedValue(operands.first.getBool() &&
+				operands.second.getBool());
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<OrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = ConstBool::create(!constIntPair->first->isZero() ||
-				!constIntPair->second->isZero());
-		} else if (Maybe<ConstFloatPair> constFloatPair = castConstPair<
-				ConstFloat>(constPair)) {
-			result = ConstBool::create(!constFloatPair->first->isZero() ||
-				!constFloatPair->second->isZero());
-		} else if (Maybe<ConstBoolPair> constBoolPair = castConstPair<
-				ConstBool>(constPair)) {
-			result = ConstBool::create(constBoolPair->first->getValue() ||
-				constBoolPair->second->getValue());
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = EvaluatedValue(!operands.first.isZero() ||
+				!operands.second.isZero());
+		} else if (areFloats(operands)) {
+			result = EvaluatedValue(!operands.first.isZero() ||
+				!operands.second.isZero());
+		} else if (areBools(operands)) {
+			result = EvaluatedValue(operands.first.getBool() ||
+				operands.second.getBool());
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<BitAndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::And);
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, bitAnd);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<BitOrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::Or);
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, bitOr);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			result = performOperationOverApInt(constIntPair, &llvm::APInt::Xor);
+		EvaluatedValue result;
+		if (areInts(operands)) {
+			result = performOperationOverApInt(operands, bitXor);
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<BitShlOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
-		ShPtr<Constant> result;
+		EvaluatedValue result;
 		bool overflow = false;
-		if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-				constPair)) {
-			APSIntPair apsIntPair(getAPSIntsFromConstants(constIntPair));
-			result = ConstInt::create(apsIntPair.first.sshl_ov(
-				apsIntPair.second, overflow));
+		if (areInts(operands)) {
+			const llvm::APSInt &first(operands.first.getInt());
+			result = EvaluatedValue(first.sshl_ov(operands.second.getInt(),
+				overflow));
 		} else {
 			canBeEvaluated = false;
 		}
 
 		resolveOverflowForAPInt(overflow);
-		stackOfResults.push(result);
+		stackOfResults.push_back(std::move(result));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<BitShrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ConstPair constPair(getOperandsForBinaryOpAndResolveTypes());
-		resolveOpSpecifications(expr, constPair);
+		EvaluatedValuePair operands(getOperandsForBinaryOpAndResolveTypes());
+		resolveOpSpecifications(expr, operands);
 		if (!canBeEvaluated) {
 			return;
 		}
 
 		if (expr->isArithmetical()) {
-			ShPtr<Constant> result;
-			if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-					constPair)) {
-				result = performOperationOverApInt(constIntPair,
+			EvaluatedValue result;
+			if (areInts(operands)) {
+				result = performOperationOverApInt(operands,
 					&llvm::APInt::ashr);
 			} else {
 				canBeEvaluated = false;
 			}
 
-			stackOfResults.push(result);
+			stackOfResults.push_back(std::move(result));
 		} else if (expr->isLogical()) {
-			ShPtr<Constant> result;
-			if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(
-					constPair)) {
-				result = performOperationOverApInt(constIntPair,
+			EvaluatedValue result;
+			if (areInts(operands)) {
+				result = performOperationOverApInt(operands,
 					&llvm::APInt::lshr);
 			} else {
 				canBeEvaluated = false;
 			}
 
-			stackOfResults.push(result);
+			stackOfResults.push_back(std::move(result));
 		}
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<TernaryOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperand(expr->getCondition());
+	evaluateOperand(expr->getTrueValue());
+	evaluateOperand(expr->getFalseValue());
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> falseValue(topAndPopStack(stackOfResults));
-		ShPtr<Constant> trueValue(topAndPopStack(stackOfResults));
-		ShPtr<Constant> condition(topAndPopStack(stackOfResults));
+		EvaluatedValue falseValue(topAndPopStack(stackOfResults));
+		EvaluatedValue trueValue(topAndPopStack(stackOfResults));
+		EvaluatedValue condition(topAndPopStack(stackOfResults));
 
 		bool condResult(true);
-		if (ShPtr<ConstInt> condConstInt = cast<ConstInt>(condition)) {
-			condResult = !condConstInt->isZero();
-		} else if (ShPtr<ConstFloat> condConstFloat = cast<ConstFloat>(
-				condition)) {
-			condResult = !condConstFloat->isZero();
-		} else if (ShPtr<ConstBool> condConstBool = cast<ConstBool>(condition)) {
-			condResult = condConstBool->getValue();
+		if (condition.isInt() || condition.isFloat()) {
+			condResult = !condition.isZero();
+		} else if (condition.isBool()) {
+			condResult = condition.getBool();
 		} else {
 			canBeEvaluated = false;
 		}
 
-		stackOfResults.push(condResult ? trueValue : falseValue);
+		stackOfResults.push_back(condResult ? std::move(trueValue) :
+			std::move(falseValue));
 	}
 }
 
@@ -774,52 +770,52 @@ void ArithmExprEvaluator::visit(ShPtr<CallExpr> expr) {
 }
 
 void ArithmExprEvaluator::visit(ShPtr<BitCastExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> constant(topAndPopStack(stackOfResults));
-		resolveCast(expr, constant);
-		stackOfResults.push(constant);
+		EvaluatedValue operand(topAndPopStack(stackOfResults));
+		resolveCast(expr, operand);
+		stackOfResults.push_back(std::move(operand));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ExtCastExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> constant(topAndPopStack(stackOfResults));
-		resolveCast(expr, constant);
-		stackOfResults.push(constant);
+		EvaluatedValue operand(topAndPopStack(stackOfResults));
+		resolveCast(expr, operand);
+		stackOfResults.push_back(std::move(operand));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<TruncCastExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> constant(topAndPopStack(stackOfResults));
-		resolveCast(expr, constant);
-		stackOfResults.push(constant);
+		EvaluatedValue operand(topAndPopStack(stackOfResults));
+		resolveCast(expr, operand);
+		stackOfResults.push_back(std::move(operand));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<FPToIntCastExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> constant(topAndPopStack(stackOfResults));
-		resolveCast(expr, constant);
-		stackOfResults.push(constant);
+		EvaluatedValue operand(topAndPopStack(stackOfResults));
+		resolveCast(expr, operand);
+		stackOfResults.push_back(std::move(operand));
 	}
 }
 
 void ArithmExprEvaluator::visit(ShPtr<IntToFPCastExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	evaluateOperands(expr);
 
 	if (canBeEvaluated) {
-		ShPtr<Constant> constant(topAndPopStack(stackOfResults));
-		resolveCast(expr, constant);
-		stackOfResults.push(constant);
+		EvaluatedValue operand(topAndPopStack(stackOfResults));
+		resolveCast(expr, operand);
+		stackOfResults.push_back(std::move(operand));
 	}
 }
 
@@ -832,19 +828,19 @@ void ArithmExprEvaluator::visit(ShPtr<PtrToIntCastExpr> expr) {
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ConstBool> constant) {
-	stackOfResults.push(constant);
+	stackOfResults.emplace_back(constant);
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ConstFloat> constant) {
-	stackOfResults.push(constant);
+	stackOfResults.emplace_back(constant);
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ConstInt> constant) {
-	stackOfResults.push(constant);
+	stackOfResults.emplace_back(constant);
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ConstSymbol> constant) {
-	stackOfResults.push(constant->getValue());
+	stackOfResults.emplace_back(constant->getValue());
 }
 
 void ArithmExprEvaluator::visit(ShPtr<ConstNullPointer> constant) {
@@ -866,104 +862,246 @@ void ArithmExprEvaluator::visit(ShPtr<ConstStruct> constant) {
 void ArithmExprEvaluator::visit(ShPtr<Variable> var) {
 	auto it = varValues->find(var);
 	if (it != varValues->end()) {
-		stackOfResults.push(it->second);
+		stackOfResults.emplace_back(it->second);
 	} else {
 		canBeEvaluated = false;
 	}
 }
 
-void ArithmExprEvaluator::resolveTypesUnaryOp(ShPtr<Constant> &operand) {}
+void ArithmExprEvaluator::resolveTypesUnaryOp(EvaluatedValue &operand) {}
 
-void ArithmExprEvaluator::resolveTypesBinaryOp(ConstPair &constPair) {}
+void ArithmExprEvaluator::resolveTypesBinaryOp(EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<AddOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<AndOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<BitAndOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<BitOrOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<BitShlOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<BitShrOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<BitXorOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<DivOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<EqOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<GtOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<GtEqOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<LtEqOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<LtOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<ModOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<MulOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<NegOpExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<NeqOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<NotOpExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<OrOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveOpSpecifications(ShPtr<SubOpExpr> expr,
-	ConstPair &constPair) {}
+	EvaluatedValuePair &operands) {}
 
 void ArithmExprEvaluator::resolveCast(ShPtr<BitCastExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveCast(ShPtr<ExtCastExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveCast(ShPtr<FPToIntCastExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveCast(ShPtr<IntToFPCastExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveCast(ShPtr<TruncCastExpr> expr,
-	ShPtr<Constant> &constant) {}
+	EvaluatedValue &operand) {}
 
 void ArithmExprEvaluator::resolveOverflowForAPInt(bool overflow) {}
 
 void ArithmExprEvaluator::resolveOverflowForAPFloat(llvm::APFloat::opStatus
 	opStatus) {}
 
+/**
+* @brief Evaluates @a expr and returns the resulting value.
+*
+* @param[in] expr An expression to evaluation.
+* @param[in] varValues Map of constants to substitute the variables in @a expr.
+*
+* @return If @a expr can be evaluated, returns its value, otherwise an invalid
+*         value.
+*/
+EvaluatedValue ArithmExprEvaluator::evaluateToValue(ShPtr<Expression> expr,
+		const VarConstMap &varValues) {
+	// Constants are evaluated faster than their memoized results are checked.
+	bool memoize = !isa<Constant>(expr);
+	EvaluatedValue result;
+	if (memoize && getMemoizedResult(expr, varValues, result)) {
+		return result;
+	}
+
+	// Need to set stack and canBeEvaluated to initial state. The stack keeps
+	// its capacity, so it is not reallocated in every evaluation.
+	stackOfResults.clear();
+	canBeEvaluated = true;
+
+	this->varValues = &varValues;
+	evaluateOperand(expr);
+	if (canBeEvaluated && !stackOfResults.empty()) {
+		result = topAndPopStack(stackOfResults);
+	}
+
+	if (memoize) {
+		memoizeResult(expr, varValues, result);
+	}
+	return result;
+}
+
+/**
+* @brief Finds a memoized result of the evaluation of @a expr.
+*
+* @param[in] expr An evaluated expression.
+* @param[in] varValues Map of constants to substitute the variables in @a expr.
+* @param[out] result The memoized result (invalid if the evaluation failed).
+*
+* @return @c true if there is a memoized result of @a expr, which has not been
+*         modified since, and the variables in @a expr are substituted by the
+*         same values, @c false otherwise.
+*/
+bool ArithmExprEvaluator::getMemoizedResult(ShPtr<Expression> expr,
+		const VarConstMap &varValues, EvaluatedValue &result) {
+	auto memoizedIt = memoizedResults.find(expr);
+	if (memoizedIt == memoizedResults.end()) {
+		return false;
+	}
+	const MemoizedResult &memoized(memoizedIt->second);
+
+	// Variables are not compared by isEqualTo() because it does not
+	// distinguish a variable from its copy, which may have a different value.
+	VarsInExprCollector().collect(expr, varsInExpr);
+	if (varsInExpr != memoized.vars) {
+		return false;
+	}
+	for (std::size_t i = 0, e = varsInExpr.size(); i < e; ++i) {
+		auto valueIt = varValues.find(varsInExpr[i]);
+		auto value = valueIt != varValues.end() ? valueIt->second : nullptr;
+		auto &memoizedValue = memoized.varValues[i];
+		if (!value || !memoizedValue) {
+			if (value || memoizedValue) {
+				return false;
+			}
+		} else if (!value->isEqualTo(memoizedValue)) {
+			return false;
+		}
+	}
+
+	if (!memoized.exprCopy->isEqualTo(expr)) {
+		return false;
+	}
+
+	result = memoized.result;
+	return true;
+}
+
+/**
+* @brief Memoizes @a result of the evaluation of @a expr with @a varValues.
+*
+* The number of memoized results is bounded. When the bound is reached, all
+* the memoized results are dropped.
+*/
+void ArithmExprEvaluator::memoizeResult(ShPtr<Expression> expr,
+		const VarConstMap &varValues, const EvaluatedValue &result) {
+	if (memoizedResults.size() >= MAX_MEMOIZED_RESULTS &&
+			memoizedResults.find(expr) == memoizedResults.end()) {
+		memoizedResults.clear();
+	}
+
+	// Expressions and constants may be modified in place, so copies are kept.
+	MemoizedResult &memoized(memoizedResults[expr]);
+	memoized.exprCopy = ucast<Expression>(expr->clone());
+	VarsInExprCollector().collect(expr, memoized.vars);
+	memoized.varValues.clear();
+	for (const auto &var : memoized.vars) {
+		auto valueIt = varValues.find(var);
+		memoized.varValues.push_back(valueIt != varValues.end() ?
+			ucast<Constant>(valueIt->second->clone()) : ShPtr<Constant>());
+	}
+	memoized.result = result;
+}
+
+/**
+* @brief Evaluates @a operand and pushes its value onto @c stackOfResults.
+*
+* If the evaluation has already failed, it does nothing.
+*/
+void ArithmExprEvaluator::evaluateOperand(ShPtr<Expression> operand) {
+	if (!canBeEvaluated) {
+		return;
+	}
+
+	operand->accept(this);
+}
+
+/**
+* @brief Evaluates the operand of @a expr.
+*/
+void ArithmExprEvaluator::evaluateOperands(ShPtr<UnaryOpExpr> expr) {
+	evaluateOperand(expr->getOperand());
+}
+
+/**
+* @brief Evaluates the operands of @a expr.
+*/
+void ArithmExprEvaluator::evaluateOperands(ShPtr<BinaryOpExpr> expr) {
+	evaluateOperand(expr->getFirstOperand());
+	evaluateOperand(expr->getSecondOperand());
+}
+
+/**
+* @brief Evaluates the operand of @a expr.
+*/
+void ArithmExprEvaluator::evaluateOperands(ShPtr<CastExpr> expr) {
+	evaluateOperand(expr->getOperand());
+}
+
 /**
 * @brief Get operand from @c stackOfResults and call resolve types method that
 *        is implemented in sub-evaluators.
 *
-* @return Constant operand after types corrections.
+* @return Operand after types corrections.
 */
-ShPtr<Constant> ArithmExprEvaluator::getOperandForUnaryOpAndResolveTypes() {
-	ShPtr<Constant> operand(topAndPopStack(stackOfResults));
+EvaluatedValue ArithmExprEvaluator::getOperandForUnaryOpAndResolveTypes() {
+	EvaluatedValue operand(topAndPopStack(stackOfResults));
 	resolveTypesUnaryOp(operand);
 	return operand;
 }
@@ -972,38 +1110,41 @@ ShPtr<Constant> ArithmExprEvaluator::getOperandForUnaryOpAndResolveTypes() {
 * @brief Get operands from @c stackOfResults and call resolve types method that
 *        is implemented in sub-evaluators.
 *
-* @return A pair of constant operands after types corrections.
+* @return A pair of operands after types corrections.
 */
-ArithmExprEvaluator::ConstPair ArithmExprEvaluator::
-		getOperandsForBinaryOpAndResolveTypes() {
-	ConstPair constPair(getFirstAndSecondOpFromStack(stackOfResults));
-	resolveTypesBinaryOp(constPair);
-	return constPair;
+EvaluatedValuePair ArithmExprEvaluator::getOperandsForBinaryOpAndResolveTypes() {
+	EvaluatedValuePair operands(getFirstAndSecondOpFromStack(stackOfResults));
+	resolveTypesBinaryOp(operands);
+	return operands;
 }
 
 /**
-* @brief Casts the constants in @a constPair to the given type.
-*
-* @tparam ConstType Type of the constants after the cast.
-*
-* @return A pair of casted constants if the cast was correct, Nothing<>
-*         otherwise.
+* @brief Returns @c true if both values in @a values are integers, @c false
+*        otherwise.
 */
-template<typename ConstType>
-Maybe<std::pair<ShPtr<ConstType>, ShPtr<ConstType>>> ArithmExprEvaluator::
-		castConstPair(const ConstPair &constPair) {
-	ShPtr<ConstType> firstConst(cast<ConstType>(constPair.first));
-	ShPtr<ConstType> secConst(cast<ConstType>(constPair.second));
-	if (!firstConst || !secConst) {
-		return Nothing<std::pair<ShPtr<ConstType>, ShPtr<ConstType>>>();
-	} else {
-		return Just(std::make_pair(firstConst, secConst));
-	}
+bool ArithmExprEvaluator::areInts(const EvaluatedValuePair &values) {
+	return values.first.isInt() && values.second.isInt();
+}
+
+/**
+* @brief Returns @c true if both values in @a values are floats, @c false
+*        otherwise.
+*/
+bool ArithmExprEvaluator::areFloats(const EvaluatedValuePair &values) {
+	return values.first.isFloat() && values.second.isFloat();
+}
+
+/**
+* @brief Returns @c true if both values in @a values are bools, @c false
+*        otherwise.
+*/
+bool ArithmExprEvaluator::areBools(const EvaluatedValuePair &values) {
+	return values.first.isBool() && values.second.isBool();
 }
 
 /**
 * @brief Perform the operation specified by @a op on the first and the
-*        second operand in @a constIntPair.
+*        second operand in @a operands.
 *
 * @a op are functions with prototype like:
 * @code
@@ -1011,135 +1152,153 @@ Maybe<std::pair<ShPtr<ConstType>, ShPtr<ConstType>>> ArithmExprEvaluator::
 * bool &Overflow) const.
 * @endcode
 *
-* @param[in] constIntPair A pair of @c ConstInt operands.
-* @param[in] op Operation to do on @a constIntPair operands.
+* @param[in] operands A pair of integral operands.
+* @param[in] op Operation to do on @a operands.
 * @param[out] overflow Overflow status of operation.
 *
 * @return Result of operation.
 */
-ShPtr<ConstInt> ArithmExprEvaluator::performOperationOverApInt(
-		const Maybe<ConstIntPair> &constIntPair, LLVMAPIntAPIntBoolOp op,
+EvaluatedValue ArithmExprEvaluator::performOperationOverApInt(
+		const EvaluatedValuePair &operands, LLVMAPIntAPIntBoolOp op,
 		bool &overflow) {
-	APSIntPair apsIntPair(getAPSIntsFromConstants(constIntPair));
-	return ConstInt::create((apsIntPair.first.*op)(apsIntPair.second,
-		overflow), apsIntPair.first.isSigned());
+	const llvm::APSInt &first(operands.first.getInt());
+	return EvaluatedValue((first.*op)(operands.second.getInt(), overflow),
+		first.isSigned());
 }
 
 /**
 * @brief Perform the operation specified by @a op on the first and the
-*        second operand in @a constIntPair.
+*        second operand in @a operands.
 *
 * @a op are functions with prototype like:
 * @code
-* APInt And(const APInt &RHS) const;
+* APInt srem(const APInt &RHS) const;
+* @endcode
+*
+* @param[in] operands A pair of integral operands.
+* @param[in] op Operation to do on @a operands.
+*
+* @return Result of operation.
+*/
+EvaluatedValue ArithmExprEvaluator::performOperationOverApInt(
+		const EvaluatedValuePair &operands, LLVMAPIntAPIntOp op) {
+	const llvm::APSInt &first(operands.first.getInt());
+	return EvaluatedValue((first.*op)(operands.second.getInt()),
+		first.isSigned());
+}
+
+/**
+* @brief Perform the operation specified by @a func on the first and the
+*        second operand in @a operands.
+*
+* @a func are functions with prototype like:
+* @code
+* APInt bitAnd(const APInt &first, const APInt &second);
 * @endcode
 *
-* @param[in] constIntPair A pair of @c ConstInt operands.
-* @param[in] op Operation to do on @a constIntPair operands.
+* @param[in] operands A pair of integral operands.
+* @param[in] func Operation to do on @a operands.
 *
 * @return Result of operation.
 */
-ShPtr<ConstInt> ArithmExprEvaluator::performOperationOverApInt(
-		const Maybe<ConstIntPair> &constIntPair, LLVMAPIntAPIntOp op) {
-	APSIntPair apsIntPair(getAPSIntsFromConstants(constIntPair));
-	return ConstInt::create((apsIntPair.first.*op)(apsIntPair.second),
-		apsIntPair.first.isSigned());
+EvaluatedValue ArithmExprEvaluator::performOperationOverApInt(
+		const EvaluatedValuePair &operands, APIntAPIntFunc func) {
+	const llvm::APSInt &first(operands.first.getInt());
+	return EvaluatedValue(func(first, operands.second.getInt()),
+		first.isSigned());
 }
 
 /**
 * @brief Perform the operation specified by @a op on the first and the
-*        second operand in @a constIntPair.
+*        second operand in @a operands.
 *
 * @a op are functions with prototype like:
 * @code
 * bool sgt(uint64_t RHS) const;
 * @endcode
 *
-* @param[in] constIntPair A pair of @c ConstInt operands.
-* @param[in] op Operation to do on @a constIntPair operands.
+* @param[in] operands A pair of integral operands.
+* @param[in] op Operation to do on @a operands.
 *
 * @return Result of operation.
 */
-ShPtr<ConstBool> ArithmExprEvaluator::performOperationOverApInt(
-		const Maybe<ConstIntPair> &constIntPair, LLVMBoolAPIntOp op) {
-	APSIntPair apsIntPair(getAPSIntsFromConstants(constIntPair));
-	return ConstBool::create((apsIntPair.first.*op)(apsIntPair.second));
+EvaluatedValue ArithmExprEvaluator::performOperationOverApInt(
+		const EvaluatedValuePair &operands, LLVMBoolAPIntOp op) {
+	return EvaluatedValue((operands.first.getInt().*op)(
+		operands.second.getInt()));
 }
 
 /**
 * @brief Perform the compare operation on the first and the second operand in
-*        @a constFloatPair.
+*        @a operands.
 *
-* @param[in] constFloatPair A pair of @c ConstFloat operands.
+* @param[in] operands A pair of floating-point operands.
 *
 * @return Result of operation.
 */
 llvm::APFloat::cmpResult ArithmExprEvaluator::performOperationOverApFloat(
-		const Maybe<ConstFloatPair> &constFloatPair) {
-	APFloatPair apFloatPair(getAPFloatsFromConstants(constFloatPair));
-	return apFloatPair.first.compare(apFloatPair.second);
+		const EvaluatedValuePair &operands) {
+	return operands.first.getFloat().compare(operands.second.getFloat());
 }
 
 /**
 * @brief Perform the operation specified by @a op on the first and the
-*        second operand in @a constFloatPair.
+*        second operand in @a operands.
 *
 * @a op are functions with prototype like:
 * @code
 * opStatus add(const APFloat &, roundingMode);
 * @endcode
 *
-* @param[in] constFloatPair A pair of @c ConstFloat operands.
-* @param[in] op Operation to do on @a constFloatPair operands.
+* @param[in] operands A pair of floating-point operands.
+* @param[in] op Operation to do on @a operands.
 * @param[out] status Status of success of operation.
 *
 * @return Result of operation.
 */
-ShPtr<ConstFloat> ArithmExprEvaluator::performOperationOverApFloat(
-		const Maybe<ConstFloatPair> &constFloatPair, LLVMAPFloatOp op, llvm::
+EvaluatedValue ArithmExprEvaluator::performOperationOverApFloat(
+		const EvaluatedValuePair &operands, LLVMAPFloatOp op, llvm::
 		APFloat::opStatus &status) {
-	APFloatPair apFloatPair(getAPFloatsFromConstants(constFloatPair));
-	status = ((apFloatPair.first).*op)(apFloatPair.second, llvm::APFloat::
+	llvm::APFloat result(operands.first.getFloat());
+	status = (result.*op)(operands.second.getFloat(), llvm::APFloat::
 		rmNearestTiesToEven);
-	return ConstFloat::create(apFloatPair.first);
+	return EvaluatedValue(result);
 }
 
 /**
 * @brief An overload of @c performOperationOverApFloat() when the operation has
 *        no rounding mode.
 */
-ShPtr<ConstFloat> ArithmExprEvaluator::performOperationOverApFloat(
-		const Maybe<ConstFloatPair> &constFloatPair, LLVMAPFloatOpNoRounding op,
+EvaluatedValue ArithmExprEvaluator::performOperationOverApFloat(
+		const EvaluatedValuePair &operands, LLVMAPFloatOpNoRounding op,
 		llvm::APFloat::opStatus &status) {
-	APFloatPair apFloatPair(getAPFloatsFromConstants(constFloatPair));
-	status = ((apFloatPair.first).*op)(apFloatPair.second);
-	return ConstFloat::create(apFloatPair.first);
+	llvm::APFloat result(operands.first.getFloat());
+	status = (result.*op)(operands.second.getFloat());
+	return EvaluatedValue(result);
 }
 
 /**
-* @brief Create @c APSIntPair from @a constIntPair and return it.
+* @brief Create @c APSIntPair from @a values and return it.
 *
-* @param[in] constIntPair A pair of @c ConstInt.
+* @param[in] values A pair of integral values.
 *
 * @return Created pair of @c llvm::APSInt.
 */
-ArithmExprEvaluator::APSIntPair ArithmExprEvaluator::getAPSIntsFromConstants(
-		const Maybe<ConstIntPair> &constIntPair) {
-	return APSIntPair(constIntPair->first->getValue(),
-		constIntPair->second->getValue());
+ArithmExprEvaluator::APSIntPair ArithmExprEvaluator::getAPSIntsFromValues(
+		const EvaluatedValuePair &values) {
+	return APSIntPair(values.first.getInt(), values.second.getInt());
 }
 
 /**
-* @brief Create @c APFloatPair from @a constFloatPair and return it.
+* @brief Create @c APFloatPair from @a values and return it.
 *
-* @param[in] constFloatPair A pair of @c ConstFloat.
+* @param[in] values A pair of floating-point values.
 *
 * @return Created pair of @c llvm::APFloat.
 */
-ArithmExprEvaluator::APFloatPair ArithmExprEvaluator::getAPFloatsFromConstants(
-		const Maybe<ConstFloatPair> &constFloatPair) {
-	return APFloatPair(constFloatPair->first->getValue(),
-		constFloatPair->second->getValue());
+ArithmExprEvaluator::APFloatPair ArithmExprEvaluator::getAPFloatsFromValues(
+		const EvaluatedValuePair &values) {
+	return APFloatPair(values.first.getFloat(), values.second.getFloat());
 }
 
 /**
@@ -1154,19 +1313,5 @@ void ArithmExprEvaluator::resolveOverflows(bool overflow,
 	resolveOverflowForAPInt(overflow);
 }
 
-/**
-* @brief Return if @a constant is a @c ConstInt or a @c ConstFloat zero.
-*
-* @param[in] constant A constant to check.
-*
-* @return If @a constant is @c ConstInt or @c ConstFloat zero.
-*/
-bool ArithmExprEvaluator::isConstantZero(ShPtr<Constant> constant) {
-	ShPtr<ConstInt> secConstInt(cast<ConstInt>(constant));
-	ShPtr<ConstFloat> secConstFloat(cast<ConstFloat>(constant));
-	return (secConstInt && secConstInt->isZero()) ||
-			(secConstFloat && secConstFloat->isZero());
-}
-
 } // namespace llvmir2hll
 } // namespace retdec
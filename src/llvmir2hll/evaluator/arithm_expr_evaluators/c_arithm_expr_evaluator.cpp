@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <cstdint>
+#include <utility>
+
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator_factory.h"
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/c_arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/binary_op_expr.h"
@@ -69,21 +72,28 @@ void convertOperandsToSameSemantics(ArithmExprEvaluator::APFloatPair
 }
 
 /**
-* @brief Tries to convert the given constant integer to a constant float.
+* @brief Creates an integral value in the same way as ConstInt::create() does.
+*/
+EvaluatedValue createIntValue(std::int64_t value, unsigned bitWidth,
+		bool isSigned = true) {
+	return EvaluatedValue(llvm::APInt(bitWidth, value, isSigned), isSigned);
+}
+
+/**
+* @brief Tries to convert the given integral value to a floating-point value.
 *
-* When the constant integer cannot be converted, it returns the null pointer.
+* When the integral value cannot be converted, it returns an invalid value.
 */
-ShPtr<ConstFloat> constIntToConstFloat(ShPtr<ConstInt> constInt) {
-	llvm::APFloat apFloat(
-		constInt->getValue().roundToDouble(constInt->isSigned())
-	);
+EvaluatedValue intValueToFloatValue(const EvaluatedValue &intValue) {
+	const llvm::APSInt &value(intValue.getInt());
+	llvm::APFloat apFloat(value.roundToDouble(value.isSigned()));
 	// On a MSVC build, roundToDouble() returns 0.0 when the bit width of
-	// constInt is too big (> 64). If this is the case, the coversion failed,
+	// intValue is too big (> 64). If this is the case, the coversion failed,
 	// so signal a failure instead of returning an invalid value (0.0).
-	if (apFloat.isZero() && !constInt->isZero()) {
-		return nullptr;
+	if (apFloat.isZero() && !intValue.isZero()) {
+		return EvaluatedValue();
 	}
-	return ConstFloat::create(apFloat);
+	return EvaluatedValue(apFloat);
 }
 
 /**
@@ -111,65 +121,66 @@ bool hasOperandsSameBitWidth(const ArithmExprEvaluator::APSIntPair &apsIntPair)
 }
 
 /**
-* @brief Try convert both of operands from @a constPair from @c ConstBool to
-*        @c ConstInt.
+* @brief Try convert both of operands from @a operands from bools to
+*        integers.
 *
-* This is possible only if @a constPair contains operands which are @c ConstBool.
+* This is possible only if @a operands contains operands which are bools.
 *
-* @param[in, out] constPair Pair of constants.
+* @param[in, out] operands Pair of operands.
 */
-void tryConvertBoolBoolToInt(ArithmExprEvaluator::ConstPair &constPair) {
-	if (Maybe<ArithmExprEvaluator::ConstBoolPair> constBoolPair =
-			ArithmExprEvaluator::castConstPair<ConstBool>(constPair)) {
-		constPair.first = ConstInt::create(constBoolPair->first->getValue(),
+void tryConvertBoolBoolToInt(EvaluatedValuePair &operands) {
+	if (operands.first.isBool() && operands.second.isBool()) {
+		operands.first = createIntValue(operands.first.getBool(),
 			DEFAULT_INT_BIT_WIDTH);
-		constPair.second = ConstInt::create(constBoolPair->second->getValue(),
+		operands.second = createIntValue(operands.second.getBool(),
 			DEFAULT_INT_BIT_WIDTH);
 	}
 }
 
 /**
-* @brief Try convert operands from @a constPair to @c ConstFloat.
+* @brief Try convert operands from @a operands to floats.
 *
-* This is possible only if one of operands is a @c ConstFloat, the second is a
-* @c ConstInt, and the conversion can be done (some integral values cannot be
+* This is possible only if one of operands is a float, the second is an
+* integer, and the conversion can be done (some integral values cannot be
 * represented as floats).
 *
-* @param[in, out] constPair Pair of constants.
+* @param[in, out] operands Pair of operands.
 */
-void tryConvertFloatIntToFloat(ArithmExprEvaluator::ConstPair &constPair) {
-	if (isa<ConstFloat>(constPair.first)) {
-		if (ShPtr<ConstInt> constInt = cast<ConstInt>(constPair.second)) {
-			if (ShPtr<ConstFloat> constFloat = constIntToConstFloat(constInt)) {
-				constPair.second = constFloat;
+void tryConvertFloatIntToFloat(EvaluatedValuePair &operands) {
+	if (operands.first.isFloat()) {
+		if (operands.second.isInt()) {
+			EvaluatedValue floatValue(intValueToFloatValue(operands.second));
+			if (floatValue.isValid()) {
+				operands.second = std::move(floatValue);
 			}
 		}
-	} else if (isa<ConstFloat>(constPair.second)) {
-		if (ShPtr<ConstInt> constInt = cast<ConstInt>(constPair.first)) {
-			if (ShPtr<ConstFloat> constFloat = constIntToConstFloat(constInt)) {
-				constPair.first = constFloat;
+	} else if (operands.second.isFloat()) {
+		if (operands.first.isInt()) {
+			EvaluatedValue floatValue(intValueToFloatValue(operands.first));
+			if (floatValue.isValid()) {
+				operands.first = std::move(floatValue);
 			}
 		}
 	}
 }
 
 /**
-* @brief Try convert operands from @a constPair to @c ConstInt.
+* @brief Try convert operands from @a operands to integers.
 *
-* This is possible only if one of operands is a @c ConstBool and the second is a
-* @c ConstInt.
+* This is possible only if one of operands is a bool and the second is an
+* integer.
 *
-* @param[in, out] constPair Pair of constants.
+* @param[in, out] operands Pair of operands.
 */
-void tryConvertBoolIntToInt(ArithmExprEvaluator::ConstPair &constPair) {
-	if (ShPtr<ConstBool> constBool = cast<ConstBool>(constPair.first)) {
-		if (isa<ConstInt>(constPair.second)) {
-			constPair.first = ConstInt::create(constBool->getValue(),
+void tryConvertBoolIntToInt(EvaluatedValuePair &operands) {
+	if (operands.first.isBool()) {
+		if (operands.second.isInt()) {
+			operands.first = createIntValue(operands.first.getBool(),
 				DEFAULT_INT_BIT_WIDTH);
 		}
-	} else if (ShPtr<ConstBool> constBool = cast<ConstBool>(constPair.second)) {
-		if (isa<ConstInt>(constPair.first)) {
-			constPair.second = ConstInt::create(constBool->getValue(),
+	} else if (operands.second.isBool()) {
+		if (operands.first.isInt()) {
+			operands.second = createIntValue(operands.second.getBool(),
 				DEFAULT_INT_BIT_WIDTH);
 		}
 	}
@@ -206,9 +217,9 @@ std::string CArithmExprEvaluator::getId() const {
 *
 * @param[in, out] operand Operand on which is resolved types correction.
 */
-void CArithmExprEvaluator::resolveTypesUnaryOp(ShPtr<Constant> &operand) {
-	if (ShPtr<ConstBool> constBool = cast<ConstBool>(operand)) {
-		operand = ConstInt::create(constBool->getValue(), DEFAULT_INT_BIT_WIDTH,
+void CArithmExprEvaluator::resolveTypesUnaryOp(EvaluatedValue &operand) {
+	if (operand.isBool()) {
+		operand = createIntValue(operand.getBool(), DEFAULT_INT_BIT_WIDTH,
 			true);
 	}
 }
@@ -216,36 +227,36 @@ void CArithmExprEvaluator::resolveTypesUnaryOp(ShPtr<Constant> &operand) {
 /**
 * @brief Resolve types of operands in binary operations.
 *
-* @param[in, out] constPair Pair of constants on which is resolved types.
+* @param[in, out] operands Pair of operands on which is resolved types.
 */
-void CArithmExprEvaluator::resolveTypesBinaryOp(ConstPair &constPair) {
-	tryConvertBoolBoolToInt(constPair);
-	if (!constPair.first->getType()->isEqualTo(constPair.second->getType())) {
+void CArithmExprEvaluator::resolveTypesBinaryOp(EvaluatedValuePair &operands) {
+	tryConvertBoolBoolToInt(operands);
+	if (!operands.first.hasSameTypeAs(operands.second)) {
 		// Different types of operands, try to cast to same one.
-		tryConvertFloatIntToFloat(constPair);
-		tryConvertBoolIntToInt(constPair);
+		tryConvertFloatIntToFloat(operands);
+		tryConvertBoolIntToInt(operands);
 	}
 
 	// Problems with integer bit width and signed/unsigned types.
-	if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(constPair)) {
-		APSIntPair apsIntPair(getAPSIntsFromConstants(constIntPair));
+	if (areInts(operands)) {
+		APSIntPair apsIntPair(getAPSIntsFromValues(operands));
 		if (isSignedOrUnsignedOperands(apsIntPair) &&
 				!hasOperandsSameBitWidth(apsIntPair)) {
 			// Different bit width, same signed/unsigned type.
 			// Resolution: convert to same bit width. Extend from lower bit
 			//             width to the highest bit width of operands.
 			convertOperandsToSameBitWidth(apsIntPair);
-			constPair.first = ConstInt::create(apsIntPair.first);
-			constPair.second = ConstInt::create(apsIntPair.second);
+			operands.first = EvaluatedValue(apsIntPair.first);
+			operands.second = EvaluatedValue(apsIntPair.second);
 		} else if (!isSignedOrUnsignedOperands(apsIntPair) &&
 				hasOperandsSameBitWidth(apsIntPair)) {
 			// Same bit width, different signed/unsigned type on operands.
 			// Resolution: convert both operands to unsigned.
 			if (apsIntPair.first.isSigned() && !apsIntPair.second.isSigned()) {
-				constPair.first = ConstInt::create(apsIntPair.first, false);
+				operands.first = EvaluatedValue(apsIntPair.first, false);
 			} else if (!apsIntPair.first.isSigned() && apsIntPair.second.
 					isSigned()) {
-				constPair.second = ConstInt::create(apsIntPair.second, false);
+				operands.second = EvaluatedValue(apsIntPair.second, false);
 			}
 		} else if (!isSignedOrUnsignedOperands(apsIntPair) &&
 				!hasOperandsSameBitWidth(apsIntPair)) {
@@ -258,29 +269,28 @@ void CArithmExprEvaluator::resolveTypesBinaryOp(ConstPair &constPair) {
 			APSIntPair temp(apsIntPair);
 			convertOperandsToSameBitWidth(apsIntPair);
 			if (temp.first.getBitWidth() != apsIntPair.first.getBitWidth()) {
-				constPair.first = ConstInt::create(apsIntPair.first, apsIntPair.
+				operands.first = EvaluatedValue(apsIntPair.first, apsIntPair.
 					second.isSigned());
 			} else if (temp.second.getBitWidth() != apsIntPair.second.
 					getBitWidth()) {
-				constPair.second = ConstInt::create(apsIntPair.second, apsIntPair.
+				operands.second = EvaluatedValue(apsIntPair.second, apsIntPair.
 					first.isSigned());
 			}
 		}
 	}
 
 	// Conversion to same float semantics (same size).
-	if (Maybe<ConstFloatPair> constFloatPair = castConstPair<ConstFloat>(
-			constPair)) {
-		APFloatPair apFloatPair = getAPFloatsFromConstants(constFloatPair);
+	if (areFloats(operands)) {
+		APFloatPair apFloatPair = getAPFloatsFromValues(operands);
 		convertOperandsToSameSemantics(apFloatPair);
-		constPair.first = ConstFloat::create(apFloatPair.first);
-		constPair.second = ConstFloat::create(apFloatPair.second);
+		operands.first = EvaluatedValue(apFloatPair.first);
+		operands.second = EvaluatedValue(apFloatPair.second);
 	}
 }
 
 void CArithmExprEvaluator::resolveOpSpecifications(ShPtr<DivOpExpr> expr,
-		ConstPair &constPair) {
-	if (isa<ConstInt>(constPair.second) && isConstantZero(constPair.second)) {
+		EvaluatedValuePair &operands) {
+	if (operands.second.isInt() && operands.second.isZero()) {
 		// Integer division with zero is not defined in C language.
 		canBeEvaluated = false;
 		return;
@@ -288,16 +298,16 @@ void CArithmExprEvaluator::resolveOpSpecifications(ShPtr<DivOpExpr> expr,
 }
 
 void CArithmExprEvaluator::resolveOpSpecifications(ShPtr<ModOpExpr> expr,
-		ConstPair &constPair) {
+		EvaluatedValuePair &operands) {
 	// Remaindering with zero is not defined in C language.
-	canBeEvaluated &= !isConstantZero(constPair.second);
+	canBeEvaluated &= !operands.second.isZero();
 }
 
 void CArithmExprEvaluator::resolveCast(ShPtr<BitCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	if (isa<IntType>(expr->getType())) {
 		if (ShPtr<ConstFloat> constFloat = cast<ConstFloat>(expr->getOperand())) {
-			constant = ConstInt::create(constFloat->getValue().bitcastToAPInt());
+			operand = EvaluatedValue(constFloat->getValue().bitcastToAPInt());
 		} else {
 			canBeEvaluated = false;
 		}
@@ -312,35 +322,34 @@ void CArithmExprEvaluator::resolveCast(ShPtr<BitCastExpr> expr,
 }
 
 void CArithmExprEvaluator::resolveCast(ShPtr<ExtCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	if (ShPtr<IntType> intType = cast<IntType>(expr->getType())) {
-		if (ShPtr<ConstInt> constInt = cast<ConstInt>(constant)) {
-			if (intType->getSize() <= constInt->getValue().getBitWidth()) {
+		if (operand.isInt()) {
+			const llvm::APSInt &value(operand.getInt());
+			if (intType->getSize() <= value.getBitWidth()) {
 				// Extension can be only from lower bitWidth to higher.
 				canBeEvaluated = false;
 				return;
 			}
 			if (expr->getVariant() == ExtCastExpr::Variant::ZExt) {
-				constant = ConstInt::create(
-					constInt->getValue().zext(intType->getSize()));
+				operand = EvaluatedValue(value.zext(intType->getSize()));
 			} else if (expr->getVariant() == ExtCastExpr::Variant::SExt) {
-				constant = ConstInt::create(
-					constInt->getValue().sext(intType->getSize()));
+				operand = EvaluatedValue(value.sext(intType->getSize()));
 			} else {
 				canBeEvaluated = false;
 			}
-		} else if (ShPtr<ConstBool> constBool = cast<ConstBool>(constant)) {
+		} else if (operand.isBool()) {
 			if (intType->getSize() <= 1) {
 				// Extension can be only when bitWidth is more then 1 because we
 				// want extend boolean constant.
 				canBeEvaluated = false;
 				return;
 			}
-			llvm::APInt apInt(1, int(constBool->getValue()), false);
+			llvm::APInt apInt(1, int(operand.getBool()), false);
 			if (expr->getVariant() == ExtCastExpr::Variant::ZExt) {
-				constant = ConstInt::create(apInt.zext(intType->getSize()));
+				operand = EvaluatedValue(apInt.zext(intType->getSize()));
 			} else if (expr->getVariant() == ExtCastExpr::Variant::SExt) {
-				constant = ConstInt::create(apInt.sext(intType->getSize()));
+				operand = EvaluatedValue(apInt.sext(intType->getSize()));
 			} else {
 					canBeEvaluated = false;
 			}
@@ -357,20 +366,20 @@ void CArithmExprEvaluator::resolveCast(ShPtr<ExtCastExpr> expr,
 }
 
 void CArithmExprEvaluator::resolveCast(ShPtr<FPToIntCastExpr> expr,
-		ShPtr<Constant> &constant) {
-	if (ShPtr<ConstFloat> constFloat = cast<ConstFloat>(constant)) {
+		EvaluatedValue &operand) {
+	if (operand.isFloat()) {
 		if (ShPtr<IntType> intType = cast<IntType>(expr->getType())) {
+			const llvm::APFloat &value(operand.getFloat());
 			// NAN and INFINITY not supported conversion to Int in IEEE-754.
-			if (constFloat->getValue().isInfinity() || constFloat->getValue().
-				isNaN()) {
+			if (value.isInfinity() || value.isNaN()) {
 				canBeEvaluated = false;
 				return;
 			}
 			llvm::APSInt apsInt(intType->getSize(), 0);
 			bool status;
-			constFloat->getValue().convertToInteger(apsInt, llvm::APFloat::
-				rmTowardZero, &status);
-			constant = ConstInt::create(apsInt);
+			value.convertToInteger(apsInt, llvm::APFloat::rmTowardZero,
+				&status);
+			operand = EvaluatedValue(apsInt);
 		} else {
 			canBeEvaluated = false;
 		}
@@ -380,42 +389,40 @@ void CArithmExprEvaluator::resolveCast(ShPtr<FPToIntCastExpr> expr,
 }
 
 void CArithmExprEvaluator::resolveCast(ShPtr<IntToFPCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	if (isa<FloatType>(expr->getType())) {
-		ShPtr<ConstInt> constInt = cast<ConstInt>(constant);
-		ShPtr<ConstBool> constBool = cast<ConstBool>(constant);
-		if ((!constInt && !constBool)) {
+		if (!operand.isInt() && !operand.isBool()) {
 			canBeEvaluated = false;
 			return;
 		}
 		llvm::APFloat apFloat(0.0);
-		if (constInt) {
-			apFloat.convertFromAPInt(constInt->getValue(), constInt->isSigned(),
-				llvm::APFloat::rmTowardZero);
-		} else if (constBool) {
-			llvm::APInt apInt(1, int(constBool->getValue()), false);
+		if (operand.isInt()) {
+			apFloat.convertFromAPInt(operand.getInt(),
+				operand.getInt().isSigned(), llvm::APFloat::rmTowardZero);
+		} else {
+			llvm::APInt apInt(1, int(operand.getBool()), false);
 			apFloat.convertFromAPInt(apInt, false, llvm::APFloat::rmTowardZero);
 		}
-		constant = ConstFloat::create(apFloat);
+		operand = EvaluatedValue(apFloat);
 	} else {
 		canBeEvaluated = false;
 	}
 }
 
 void CArithmExprEvaluator::resolveCast(ShPtr<TruncCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	if (ShPtr<IntType> intType = cast<IntType>(expr->getType())) {
-		if (ShPtr<ConstInt> constInt = cast<ConstInt>(constant)) {
-			if (intType->getSize() >= constInt->getValue().getBitWidth()) {
+		if (operand.isInt()) {
+			const llvm::APSInt &value(operand.getInt());
+			if (intType->getSize() >= value.getBitWidth()) {
 				// Truncate can be only from higher bitWidth to lower.
 				canBeEvaluated = false;
 				return;
 			}
-			constant = ConstInt::create(
-				constInt->getValue().trunc(intType->getSize()));
+			operand = EvaluatedValue(value.trunc(intType->getSize()));
 		} else {
-			// Truncate is not supported on ConstBool and ConstFloat when
-			// we want truncate to IntType.
+			// Truncate is not supported on bools and floats when we want
+			// truncate to IntType.
 			canBeEvaluated = false;
 		}
 	} else if (ShPtr<FloatType> floatType = cast<FloatType>(expr->getType())) {
@@ -42,18 +42,18 @@ std::string StrictArithmExprEvaluator::getId() const {
 /**
 * @brief Resolve types of operands in binary operations.
 *
-* @param[in, out] constPair Pair of constants on which is resolved types.
+* @param[in, out] operands Pair of operands on which is resolved types.
 */
-void StrictArithmExprEvaluator::resolveTypesBinaryOp(ConstPair &constPair) {
-	if (!constPair.first->getType()->isEqualTo(constPair.second->getType())) {
+void StrictArithmExprEvaluator::resolveTypesBinaryOp(
+		EvaluatedValuePair &operands) {
+	if (!operands.first.hasSameTypeAs(operands.second)) {
 		// Both of operands must have same type.
 		canBeEvaluated = false;
 	}
 
-	if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(constPair)) {
-		APSIntPair apsIntPair(getAPSIntsFromConstants(constIntPair));
-		if (apsIntPair.first.getBitWidth() !=
-				apsIntPair.second.getBitWidth()) {
+	if (areInts(operands)) {
+		if (operands.first.getInt().getBitWidth() !=
+				operands.second.getInt().getBitWidth()) {
 			// Both of operands must have to same bitWidth.
 			canBeEvaluated = false;
 		}
@@ -61,70 +61,67 @@ void StrictArithmExprEvaluator::resolveTypesBinaryOp(ConstPair &constPair) {
 }
 
 void StrictArithmExprEvaluator::resolveOpSpecifications(ShPtr<DivOpExpr> expr,
-		ConstPair &constPair) {
+		EvaluatedValuePair &operands) {
 	if (!canBeEvaluated) {
 		return;
 	}
 
-	if (isConstantZero(constPair.second)) {
+	if (operands.second.isZero()) {
 		// Division with zero is not supported.
 		canBeEvaluated = false;
 		return;
 	}
 
 	// Supported only division without remainder.
-	if (Maybe<ConstIntPair> constIntPair = castConstPair<ConstInt>(constPair)) {
-		APSIntPair apsIntPair = getAPSIntsFromConstants(constIntPair);
-		ShPtr<ConstInt> remConstInt(ConstInt::create(apsIntPair.first.srem(
-			apsIntPair.second)));
-		if (!remConstInt->isZero()) {
+	if (areInts(operands)) {
+		APSIntPair apsIntPair = getAPSIntsFromValues(operands);
+		if (apsIntPair.first.srem(apsIntPair.second) != 0) {
 			canBeEvaluated = false;
 		}
 	}
 }
 
 void StrictArithmExprEvaluator::resolveOpSpecifications(ShPtr<ModOpExpr> expr,
-		ConstPair &constPair) {
+		EvaluatedValuePair &operands) {
 	// Remaindering with zero not supported.
-	canBeEvaluated &= !isConstantZero(constPair.second);
+	canBeEvaluated &= !operands.second.isZero();
 }
 
 void StrictArithmExprEvaluator::resolveOpSpecifications(ShPtr<NegOpExpr> expr,
-		ShPtr<Constant> &constant) {
-	ShPtr<ConstInt> opConstInt(cast<ConstInt>(constant));
-	ShPtr<ConstFloat> opConstFloat(cast<ConstFloat>(constant));
-	if (opConstInt && opConstInt->isSigned() && opConstInt->isMinSigned()) {
+		EvaluatedValue &operand) {
+	if (operand.isInt() && operand.getInt().isSigned() &&
+			operand.getInt().isMinSignedValue()) {
 		// Don't evaluate -128 on 8 bits to 128. Overflow.
 		canBeEvaluated = false;
 	}
-	if (!opConstInt && !opConstFloat) {
+	if (!operand.isInt() && !operand.isFloat()) {
 		// Don't evaluate -True.
 		canBeEvaluated = false;
 	}
 }
 
 void StrictArithmExprEvaluator::resolveCast(ShPtr<BitCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	canBeEvaluated = false;
 }
 
 void StrictArithmExprEvaluator::resolveCast(ShPtr<ExtCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	canBeEvaluated = false;
 }
 
 void StrictArithmExprEvaluator::resolveCast(ShPtr<FPToIntCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	canBeEvaluated = false;
 }
 
 void StrictArithmExprEvaluator::resolveCast(ShPtr<IntToFPCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	canBeEvaluated = false;
 }
 
 void StrictArithmExprEvaluator::resolveCast(ShPtr<TruncCastExpr> expr,
-		ShPtr<Constant> &constant) {
+		EvaluatedValue &operand) {
 	canBeEvaluated = false;
 }
 
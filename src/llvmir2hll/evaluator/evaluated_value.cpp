@@ -0,0 +1,233 @@
+/**
+* @file src/llvmir2hll/evaluator/evaluated_value.cpp
+* @brief Implementation of EvaluatedValue.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/evaluator/evaluated_value.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_float.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/constant.h"
+#include "retdec/llvmir2hll/ir/type.h"
+#include "retdec/llvmir2hll/support/debug.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Returns the size of @a value in bits.
+*
+* The sizes are the same as the sizes of the types of float constants (see
+* ConstFloat::getType()).
+*/
+unsigned getFloatSize(const llvm::APFloat &value) {
+	return llvm::APFloat::getLargest(value.getSemantics(), true).
+		bitcastToAPInt().getBitWidth();
+}
+
+} // anonymous namespace
+
+/**
+* @brief Constructs an invalid value.
+*/
+EvaluatedValue::EvaluatedValue():
+	kind(Kind::Invalid), intValue(), floatValue(0.0), boolValue(false),
+	constant() {}
+
+/**
+* @brief Constructs a value from the given constant.
+*
+* Integer, float, and bool constants are stored inline. Other constants are
+* only remembered, so they can be returned from toConstant(). If @a constant
+* is the null pointer, the value is invalid.
+*/
+EvaluatedValue::EvaluatedValue(ShPtr<Constant> constant):
+	kind(Kind::Other), intValue(), floatValue(0.0), boolValue(false),
+	constant(constant) {
+	if (ShPtr<ConstInt> constInt = cast<ConstInt>(constant)) {
+		kind = Kind::Int;
+		intValue = constInt->getValue();
+	} else if (ShPtr<ConstFloat> constFloat = cast<ConstFloat>(constant)) {
+		kind = Kind::Float;
+		floatValue = constFloat->getValue();
+	} else if (ShPtr<ConstBool> constBool = cast<ConstBool>(constant)) {
+		kind = Kind::Bool;
+		boolValue = constBool->getValue();
+	} else if (!constant) {
+		kind = Kind::Invalid;
+	}
+}
+
+/**
+* @brief Constructs an integral value.
+*
+* The signedness is taken from @a value, just like in ConstInt::create().
+*/
+EvaluatedValue::EvaluatedValue(const llvm::APSInt &value):
+	kind(Kind::Int), intValue(value), floatValue(0.0), boolValue(false),
+	constant() {}
+
+/**
+* @brief Constructs an integral value.
+*
+* @param[in] value Value.
+* @param[in] isSigned Is the value signed?
+*/
+EvaluatedValue::EvaluatedValue(const llvm::APInt &value, bool isSigned):
+	// Since the second parameter of llvm::APSInt() is "isUnsigned", we have to
+	// negate the value of isSigned.
+	kind(Kind::Int), intValue(value, !isSigned), floatValue(0.0),
+	boolValue(false), constant() {}
+
+/**
+* @brief Constructs a floating-point value.
+*/
+EvaluatedValue::EvaluatedValue(const llvm::APFloat &value):
+	kind(Kind::Float), intValue(), floatValue(value), boolValue(false),
+	constant() {}
+
+/**
+* @brief Constructs a boolean value.
+*/
+EvaluatedValue::EvaluatedValue(bool value):
+	kind(Kind::Bool), intValue(), floatValue(0.0), boolValue(value),
+	constant() {}
+
+/**
+* @brief Returns @c true if the value is valid, @c false otherwise.
+*/
+bool EvaluatedValue::isValid() const {
+	return kind != Kind::Invalid;
+}
+
+/**
+* @brief Returns @c true if the value is an integer, @c false otherwise.
+*/
+bool EvaluatedValue::isInt() const {
+	return kind == Kind::Int;
+}
+
+/**
+* @brief Returns @c true if the value is a float, @c false otherwise.
+*/
+bool EvaluatedValue::isFloat() const {
+	return kind == Kind::Float;
+}
+
+/**
+* @brief Returns @c true if the value is a bool, @c false otherwise.
+*/
+bool EvaluatedValue::isBool() const {
+	return kind == Kind::Bool;
+}
+
+/**
+* @brief Returns the integral value.
+*
+* @par Preconditions
+*  - isInt()
+*/
+const llvm::APSInt &EvaluatedValue::getInt() const {
+	PRECONDITION(isInt(), "the value is not an integer");
+
+	return intValue;
+}
+
+/**
+* @brief Returns the floating-point value.
+*
+* @par Preconditions
+*  - isFloat()
+*/
+const llvm::APFloat &EvaluatedValue::getFloat() const {
+	PRECONDITION(isFloat(), "the value is not a float");
+
+	return floatValue;
+}
+
+/**
+* @brief Returns the boolean value.
+*
+* @par Preconditions
+*  - isBool()
+*/
+bool EvaluatedValue::getBool() const {
+	PRECONDITION(isBool(), "the value is not a bool");
+
+	return boolValue;
+}
+
+/**
+* @brief Returns @c true if the value is an integral or a floating-point zero,
+*        @c false otherwise.
+*/
+bool EvaluatedValue::isZero() const {
+	if (isInt()) {
+		return !intValue.getBoolValue();
+	} else if (isFloat()) {
+		return floatValue.isZero();
+	}
+	return false;
+}
+
+/**
+* @brief Returns @c true if the value has the same type as @a other, @c false
+*        otherwise.
+*
+* The result is the same as if the types of the constants corresponding to
+* both values were compared by using Type::isEqualTo(). This means that the
+* signedness of integers is not taken into account and that a bool has the
+* same type as a one-bit integer.
+*/
+bool EvaluatedValue::hasSameTypeAs(const EvaluatedValue &other) const {
+	if (!isValid() || !other.isValid()) {
+		return false;
+	}
+
+	if (kind == Kind::Other || other.kind == Kind::Other) {
+		// Rare case (a symbolic constant with e.g. a string value), so just
+		// compare the types of the constants.
+		return toConstant()->getType()->isEqualTo(
+			other.toConstant()->getType());
+	}
+
+	if (isFloat() || other.isFloat()) {
+		if (!isFloat() || !other.isFloat()) {
+			return false;
+		}
+		return &floatValue.getSemantics() == &other.floatValue.getSemantics() ||
+			getFloatSize(floatValue) == getFloatSize(other.floatValue);
+	}
+
+	unsigned bitWidth = isBool() ? 1 : intValue.getBitWidth();
+	unsigned otherBitWidth = other.isBool() ? 1 : other.intValue.getBitWidth();
+	return bitWidth == otherBitWidth;
+}
+
+/**
+* @brief Returns a constant with the value.
+*
+* If the value has been created from a constant, this constant is returned.
+* Otherwise, a new constant is created. If the value is invalid, the null
+* pointer is returned.
+*/
+ShPtr<Constant> EvaluatedValue::toConstant() const {
+	if (constant) {
+		return constant;
+	}
+
+	if (isInt()) {
+		return ConstInt::create(intValue);
+	} else if (isFloat()) {
+		return ConstFloat::create(floatValue);
+	} else if (isBool()) {
+		return ConstBool::create(boolValue);
+	}
+	return ShPtr<Constant>();
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -105,8 +105,9 @@ StmtSet LhsRhsUsesCFGTraversal::getUses(ShPtr<Statement> stmt,
 		}
 	}
 
+	VarSet rhsVars(rhsData->dir_read_begin(), rhsData->dir_read_end());
 	ShPtr<LhsRhsUsesCFGTraversal> traverser(new LhsRhsUsesCFGTraversal(
-		stmt, lhsVar, rhsData->getDirReadVars(), cfg, va, cio));
+		stmt, lhsVar, rhsVars, cfg, va, cio));
 
 	// The traverser returns true if and only if there are some suitable uses.
 	// Dot NOT return traverser->uses without checking the return value as
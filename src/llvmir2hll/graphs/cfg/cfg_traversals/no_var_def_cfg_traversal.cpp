@@ -11,7 +11,6 @@
 #include "retdec/utils/container.h"
 
 using retdec::utils::hasItem;
-using retdec::utils::shareSomeItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -81,11 +80,12 @@ bool NoVarDefCFGTraversal::visitStmt(ShPtr<Statement> stmt) {
 
 	// Check that no variable from vars is (or may be) modified in the
 	// statement.
-	if (shareSomeItem(stmtData->getDirWrittenVars(), vars) ||
-			shareSomeItem(stmtData->getMayBeWrittenVars(), vars) ||
-			shareSomeItem(stmtData->getMustBeWrittenVars(), vars)) {
-		currRetVal = false;
-		return false;
+	for (const auto &var : vars) {
+		if (stmtData->isDirWritten(var) || stmtData->mayBeIndirWritten(var) ||
+				stmtData->mustBeIndirWritten(var)) {
+			currRetVal = false;
+			return false;
+		}
 	}
 
 	return true;
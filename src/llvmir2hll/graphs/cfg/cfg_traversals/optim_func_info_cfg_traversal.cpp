@@ -231,7 +231,7 @@ void OptimFuncInfoCFGTraversal::precomputeAlwaysModifiedVarsBeforeRead() {
 		ShPtr<ValueData> stmtData(va->getValueData(stmt));
 
 		// Handle directly read variables.
-		addToSet(stmtData->getDirReadVars(), readVars);
+		readVars.insert(stmtData->dir_read_begin(), stmtData->dir_read_end());
 
 		// Handle function calls (indirectly accessed variables).
 		for (auto i = stmtData->call_begin(), e = stmtData->call_end(); i != e; ++i) {
@@ -270,25 +270,28 @@ void OptimFuncInfoCFGTraversal::updateFuncInfo(ShPtr<Statement> stmt) {
 	// example, if there is an if statement in the function, its body may never
 	// be entered etc.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	addToSet(stmtData->getDirReadVars(), funcInfo->mayBeReadVars);
-	addToSet(stmtData->getMayBeReadVars(), funcInfo->mayBeReadVars);
-	addToSet(stmtData->getMustBeReadVars(), funcInfo->mayBeReadVars);
-	addToSet(stmtData->getDirWrittenVars(), funcInfo->mayBeModifiedVars);
-	addToSet(stmtData->getMayBeWrittenVars(), funcInfo->mayBeModifiedVars);
-	addToSet(stmtData->getMustBeWrittenVars(), funcInfo->mayBeModifiedVars);
+	funcInfo->mayBeReadVars.insert(stmtData->dir_read_begin(),
+		stmtData->dir_read_end());
+	funcInfo->mayBeReadVars.insert(stmtData->may_be_read_begin(),
+		stmtData->may_be_read_end());
+	funcInfo->mayBeReadVars.insert(stmtData->must_be_read_begin(),
+		stmtData->must_be_read_end());
+	funcInfo->mayBeModifiedVars.insert(stmtData->dir_written_begin(),
+		stmtData->dir_written_end());
+	funcInfo->mayBeModifiedVars.insert(stmtData->may_be_written_begin(),
+		stmtData->may_be_written_end());
+	funcInfo->mayBeModifiedVars.insert(stmtData->must_be_written_begin(),
+		stmtData->must_be_written_end());
 
 	// Update storedGlobalVars. If the statement writes into a variable in
 	// storedGlobalVars, we have to remove it from storedGlobalVars. Indeed, we
 	// require that no local variable storing a global variable is written-into,
 	// just read.
-	const VarSet &dirWrittenVars(stmtData->getDirWrittenVars());
-	const VarSet &mayBeWrittenVars(stmtData->getMayBeWrittenVars());
-	const VarSet &mustBeWrittenVars(stmtData->getMustBeWrittenVars());
 	for (auto i = storedGlobalVars.begin(), e = storedGlobalVars.end();
 			i != e; ++i) {
-		if (hasItem(dirWrittenVars, i->second) ||
-				hasItem(mayBeWrittenVars, i->second) ||
-				hasItem(mustBeWrittenVars, i->second)) {
+		if (stmtData->isDirWritten(i->second) ||
+				stmtData->mayBeIndirWritten(i->second) ||
+				stmtData->mustBeIndirWritten(i->second)) {
 			storedGlobalVars.erase(i);
 			break;
 		}
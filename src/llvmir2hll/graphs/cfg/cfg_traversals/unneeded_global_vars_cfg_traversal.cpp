@@ -20,7 +20,6 @@
 using retdec::utils::getKeysFromMap;
 using retdec::utils::hasItem;
 using retdec::utils::mapHasKey;
-using retdec::utils::setIntersection;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -208,8 +207,16 @@ ShPtr<UnneededGlobalVarsCFGTraversal::UnneededGlobalVars> UnneededGlobalVarsCFGT
 	// For every unneeded statement...
 	auto i = unneededStmts.begin();
 	while (i != unneededStmts.end()) {
-		const VarSet &usedVars(va->getValueData(*i)->getDirAccessedVars());
-		if (setIntersection(usedVars, unneededGlobalVars).empty()) {
+		ShPtr<ValueData> stmtData(va->getValueData(*i));
+		bool accessesUnneededGlobalVar = false;
+		for (auto j = stmtData->dir_all_begin(), e = stmtData->dir_all_end();
+				j != e; ++j) {
+			if (hasItem(unneededGlobalVars, *j)) {
+				accessesUnneededGlobalVar = true;
+				break;
+			}
+		}
+		if (!accessesUnneededGlobalVar) {
 			unneededStmts.erase(*i++);
 		} else {
 			++i;
@@ -8,9 +8,6 @@
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/var_def_cfg_traversal.h"
 #include "retdec/llvmir2hll/ir/statement.h"
 #include "retdec/llvmir2hll/support/debug.h"
-#include "retdec/utils/container.h"
-
-using retdec::utils::shareSomeItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -76,10 +73,11 @@ bool VarDefCFGTraversal::visitStmt(ShPtr<Statement> stmt) {
 	// that it doesn't suffice if the variable may be written -- it either has
 	// to be read directly or must be read indirectly.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	if (shareSomeItem(stmtData->getDirWrittenVars(), vars) ||
-			shareSomeItem(stmtData->getMustBeWrittenVars(), vars)) {
-		currRetVal = true;
-		return false;
+	for (const auto &var : vars) {
+		if (stmtData->isDirWritten(var) || stmtData->mustBeIndirWritten(var)) {
+			currRetVal = true;
+			return false;
+		}
 	}
 
 	return true;
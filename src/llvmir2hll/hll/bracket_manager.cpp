@@ -32,17 +32,13 @@
 #include "retdec/llvmir2hll/ir/expression.h"
 #include "retdec/llvmir2hll/ir/ext_cast_expr.h"
 #include "retdec/llvmir2hll/ir/fp_to_int_cast_expr.h"
-#include "retdec/llvmir2hll/ir/function.h"
-#include "retdec/llvmir2hll/ir/global_var_def.h"
 #include "retdec/llvmir2hll/ir/gt_eq_op_expr.h"
 #include "retdec/llvmir2hll/ir/gt_op_expr.h"
 #include "retdec/llvmir2hll/ir/int_to_fp_cast_expr.h"
 #include "retdec/llvmir2hll/ir/int_to_ptr_cast_expr.h"
-#include "retdec/llvmir2hll/ir/int_type.h"
 #include "retdec/llvmir2hll/ir/lt_eq_op_expr.h"
 #include "retdec/llvmir2hll/ir/lt_op_expr.h"
 #include "retdec/llvmir2hll/ir/mod_op_expr.h"
-#include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/ir/mul_op_expr.h"
 #include "retdec/llvmir2hll/ir/neg_op_expr.h"
 #include "retdec/llvmir2hll/ir/neq_op_expr.h"
@@ -54,21 +50,16 @@
 #include "retdec/llvmir2hll/ir/ternary_op_expr.h"
 #include "retdec/llvmir2hll/ir/trunc_cast_expr.h"
 #include "retdec/llvmir2hll/ir/variable.h"
-#include "retdec/utils/container.h"
-
-using retdec::utils::mapGetValueOrDefault;
 
 namespace retdec {
 namespace llvmir2hll {
 
 /**
 * @brief Constructs a new base class for brackets managers.
-*
-* @param[in] module The module to be analyzed.
 */
-BracketManager::BracketManager(ShPtr<Module> module) {
-	this->module = module;
-}
+BracketManager::BracketManager():
+	exprOperator(Operators::ADD), exprOperandDirection(Direction::CENTER),
+	exprHasOperator(false) {}
 
 /**
 * @brief Destructs the brackets manager.
@@ -76,50 +67,69 @@ BracketManager::BracketManager(ShPtr<Module> module) {
 BracketManager::~BracketManager() {}
 
 /**
-* @brief Iterate through the module and visit all functions and all global
-*        variables. Starts brackets analyse.
+* @brief Function that decides whether the brackets are needed. This function
+*        is needed to be called from HLL writers.
+*
+* @param[in] expr Input expression.
+*
+* @return @c true if brackets are needed, @c false otherwise.
+*
+* The decision is made in the context of the operand that is currently being
+* emitted (see @c enterOperandOf(...)).
 */
-void BracketManager::init() {
-	// Visit the initializer of all global variables.
-	for (auto i = module->global_var_begin(), e = module->global_var_end();
-			i != e; ++i) {
-		if (ShPtr<Expression> init = (*i)->getInitializer()) {
-			init->accept(this);
-		}
+bool BracketManager::areBracketsNeeded(ShPtr<Expression> expr) {
+	determineOperator(expr);
+	if (!exprHasOperator || prevOperatorsStack.empty()) {
+		return false;
 	}
+	return areBracketsNeededPrecTable(exprOperator);
+}
 
-	// Visit all functions.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		(*i)->accept(this);
+/**
+* @brief Informs the manager that an operand of @a expr is going to be
+*        emitted.
+*
+* @param[in] expr Expression whose operand is going to be emitted.
+*
+* For binary expressions, this function is meant for the first operand (use
+* @c enterSecondOperandOf(...) for the second one). For other expressions, it
+* is meant for any of their operands (including arguments of calls). Every call
+* has to be paired with a call to @c leaveOperandOf(...) after the operand is
+* emitted.
+*/
+void BracketManager::enterOperandOf(ShPtr<Expression> expr) {
+	determineOperator(expr);
+	if (exprHasOperator) {
+		addOperatorOnStackIfSupported(exprOperator, exprOperandDirection);
 	}
 }
 
 /**
-* @brief Function that decides whether the brackets are needed. This function
-*        is needed to be called from HLL writers.
+* @brief Informs the manager that the second operand of @a expr is going to
+*        be emitted.
 *
-* @param[in] expr Input expression.
+* @param[in] expr Expression whose second operand is going to be emitted.
 *
-* @return @c true if brackets are needed, @c false otherwise.
+* Every call has to be paired with a call to @c leaveOperandOf(...) after the
+* operand is emitted.
 */
-bool BracketManager::areBracketsNeeded(ShPtr<Expression> expr) {
-	// Try to find an expression.
-	return mapGetValueOrDefault(bracketsAreNeededMap, expr, true);
+void BracketManager::enterSecondOperandOf(ShPtr<BinaryOpExpr> expr) {
+	determineOperator(expr);
+	if (exprHasOperator) {
+		addOperatorOnStackIfSupported(exprOperator, Direction::RIGHT);
+	}
 }
 
 /**
-* @brief Function find out, if brackets are needed for input @a expression.
+* @brief Informs the manager that an operand of @a expr has been emitted.
 *
-* @param[in] expr Input @a expression.
-* @param currentOperator enum @c Operators.
+* @param[in] expr Expression passed to the paired @c enterOperandOf(...) or
+*                 @c enterSecondOperandOf(...).
 */
-void BracketManager::areBracketsNeededForExpr(ShPtr<Expression> expr,
-		Operators currentOperator) {
-	if (prevOperatorsStack.empty()) {
-		bracketsAreNeededMap[expr] = false;
-	} else {
-		bracketsAreNeededMap[expr] = areBracketsNeededPrecTable(currentOperator);
+void BracketManager::leaveOperandOf(ShPtr<Expression> expr) {
+	determineOperator(expr);
+	if (exprHasOperator) {
+		removeOperatorFromStackIfSupported(exprOperator);
 	}
 }
 
@@ -196,324 +206,219 @@ void BracketManager::removeOperatorFromStackIfSupported(
 }
 
 /**
-* @brief Function visit operand of @c UnaryOpExpr. Function also add operator
-*        on stack of previous operators and after visit operand remove this operator
-*        from stack.
+* @brief Determines the operator of @a expr and the direction of its first
+*        operand and stores them into @c exprOperator and
+*        @c exprOperandDirection.
 *
-* @param[in] expr Current @a expression.
-* @param[in] currentOperator enum @c Operators. Current operator.
+* If @a expr has no operator (e.g. it is a constant or a variable),
+* @c exprHasOperator is set to @c false.
 */
-void BracketManager::treeTraversalForUnaryOpWithStackOperations(
-		ShPtr<UnaryOpExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::CENTER);
-	expr->getOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+void BracketManager::determineOperator(ShPtr<Expression> expr) {
+	expr->accept(this);
 }
 
 /**
-* @brief Function visit operands of @c BinaryOpExpr. Function also add operator
-*        on stack of previous operators and after visit operand remove this operator
-*        from stack.
-*
-* @param[in] expr Current @a expression.
-* @param[in] currentOperator enum @c Operators.
-*/
-void BracketManager::treeTraversalForBinaryOpWithStackOperations(
-		ShPtr<BinaryOpExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::LEFT);
-	expr->getFirstOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
-
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
-	expr->getSecondOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
-}
-
-/**
-* @brief Function visit operands of @c TernaryOpExpr. Function also add operator
-*        on stack of previous operators and after visit operand remove this operator
-*        from stack.
-*
-* @param[in] expr Current @a expression.
-* @param[in] currentOperator enum @c Operators.
-*/
-void BracketManager::treeTraversalForTernaryOpWithStackOperations(
-		ShPtr<TernaryOpExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
-	expr->getTrueValue()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
-
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
-	expr->getCondition()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
-
-	addOperatorOnStackIfSupported(currentOperator, Direction::RIGHT);
-	expr->getFalseValue()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
-}
-
-/**
-* @brief Function visit operand of @c CastExpr. Function also add operator on
-*        stack of previous operators and after visit operand remove this operator
-*        from stack.
-*
-* @param[in] expr Current @a expression.
-* @param[in] currentOperator enum @c Operators.
+* @brief Stores the given operator and the direction of the first operand.
 */
-void BracketManager::treeTraversalForCastWithStackOperations(
-		ShPtr<CastExpr> expr, Operators currentOperator) {
-	addOperatorOnStackIfSupported(currentOperator, Direction::CENTER);
-	expr->getOperand()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
+void BracketManager::setOperator(Operators currentOperator,
+		Direction operandDirection) {
+	exprOperator = currentOperator;
+	exprOperandDirection = operandDirection;
+	exprHasOperator = true;
 }
 
 /**
-* @brief Function visit @a arguments of @c CallExpr. Function also add operator on
-*        stack of previous operators and after visit operand remove this operator
-*        from stack.
-*
-* @param[in] expr Current @a expression.
-* @param[in] currentOperator enum @c Operators.
+* @brief Stores that the current expression has no operator.
 */
-void BracketManager::treeTraversalForCallWithStackOperations(
-		ShPtr<CallExpr> expr, Operators currentOperator) {
-	// Called expression.
-	addOperatorOnStackIfSupported(currentOperator, Direction::LEFT);
-	expr->getCalledExpr()->accept(this);
-	removeOperatorFromStackIfSupported(currentOperator);
-
-	// Arguments.
-	for (const auto &arg : expr->getArgs()) {
-		addOperatorOnStackIfSupported(currentOperator, Direction::LEFT);
-		arg->accept(this);
-		removeOperatorFromStackIfSupported(currentOperator);
-	}
+void BracketManager::setNoOperator() {
+	exprHasOperator = false;
 }
 
 void BracketManager::visit(ShPtr<AddressOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::ADDRESS);
-	treeTraversalForUnaryOpWithStackOperations(expr, Operators::ADDRESS);
+	setOperator(Operators::ADDRESS, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<AssignOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::ASSIGN);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::ASSIGN);
+	setOperator(Operators::ASSIGN, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<ArrayIndexOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::ARRAY);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::ARRAY);
+	setOperator(Operators::ARRAY, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<StructIndexOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::STRUCT);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::STRUCT);
+	setOperator(Operators::STRUCT, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<DerefOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::DEREF);
-	treeTraversalForUnaryOpWithStackOperations(expr, Operators::DEREF);
+	setOperator(Operators::DEREF, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<NotOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::NOT);
-	treeTraversalForUnaryOpWithStackOperations(expr, Operators::NOT);
+	setOperator(Operators::NOT, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<NegOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::NEG);
-	treeTraversalForUnaryOpWithStackOperations(expr, Operators::NEG);
+	setOperator(Operators::NEG, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<EqOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::EQ);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::EQ);
+	setOperator(Operators::EQ, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<NeqOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::NEQ);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::NEQ);
+	setOperator(Operators::NEQ, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<LtEqOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::LTEQ);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::LTEQ);
+	setOperator(Operators::LTEQ, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<GtEqOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::GTEQ);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::GTEQ);
+	setOperator(Operators::GTEQ, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<LtOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::LT);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::LT);
+	setOperator(Operators::LT, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<GtOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::GT);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::GT);
+	setOperator(Operators::GT, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<AddOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::ADD);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::ADD);
+	setOperator(Operators::ADD, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<SubOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::SUB);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::SUB);
+	setOperator(Operators::SUB, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<MulOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::MUL);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::MUL);
+	setOperator(Operators::MUL, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<ModOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::MOD);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::MOD);
+	setOperator(Operators::MOD, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<DivOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::DIV);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::DIV);
+	setOperator(Operators::DIV, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<AndOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::AND);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::AND);
+	setOperator(Operators::AND, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<OrOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::OR);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::OR);
+	setOperator(Operators::OR, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<BitAndOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::BITAND);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::BITAND);
+	setOperator(Operators::BITAND, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<BitOrOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::BITOR);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::BITOR);
+	setOperator(Operators::BITOR, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<BitXorOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::BITXOR);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::BITXOR);
+	setOperator(Operators::BITXOR, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<BitShlOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::BITSHL);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::BITSHL);
+	setOperator(Operators::BITSHL, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<BitShrOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::BITSHR);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::BITSHR);
+	setOperator(Operators::BITSHR, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<TernaryOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::TERNARY);
-	treeTraversalForTernaryOpWithStackOperations(expr, Operators::TERNARY);
+	setOperator(Operators::TERNARY, Direction::RIGHT);
 }
 
 void BracketManager::visit(ShPtr<CallExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CALL);
-	treeTraversalForCallWithStackOperations(expr, Operators::CALL);
+	setOperator(Operators::CALL, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<CommaOpExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::COMMA);
-	treeTraversalForBinaryOpWithStackOperations(expr, Operators::COMMA);
+	setOperator(Operators::COMMA, Direction::LEFT);
 }
 
 void BracketManager::visit(ShPtr<BitCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<ExtCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<TruncCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<FPToIntCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<IntToFPCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<IntToPtrCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<PtrToIntCastExpr> expr) {
-	areBracketsNeededForExpr(expr, Operators::CAST);
-	treeTraversalForCastWithStackOperations(expr, Operators::CAST);
+	setOperator(Operators::CAST, Direction::CENTER);
 }
 
 void BracketManager::visit(ShPtr<ConstBool> constant) {
 	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstFloat> constant) {
 	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstInt> constant) {
 	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstNullPointer> constant) {
 	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstString> constant) {
 	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstArray> constant) {
-	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
-
-	// We need to visit elements which are possible present in the constant.
-	OrderedAllVisitor::visit(constant);
+	// Brackets are never needed around constants. Their elements are
+	// emitted in the context of the constant's parent.
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstStruct> constant) {
-	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
-
-	// We need to visit elements which are possible present in the constant.
-	OrderedAllVisitor::visit(constant);
+	// Brackets are never needed around constants. Their elements are
+	// emitted in the context of the constant's parent.
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<ConstSymbol> constant) {
 	// Brackets are never needed around constants.
-	bracketsAreNeededMap[constant] = false;
+	setNoOperator();
 }
 
 void BracketManager::visit(ShPtr<Variable> var) {
 	// Brackets are never needed around variables.
-	bracketsAreNeededMap[var] = false;
+	setNoOperator();
 }
 
 } // namespace llvmir2hll
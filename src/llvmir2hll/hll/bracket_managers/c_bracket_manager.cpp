@@ -12,13 +12,8 @@ namespace llvmir2hll {
 
 /**
 * @brief Constructs a new C brackets manager.
-*
-* @param[in] module The module to be analyzed.
 */
-CBracketManager::CBracketManager(ShPtr<Module> module): BracketManager(module) {
-	// Starts running of brackets elimination analyse.
-	init();
-}
+CBracketManager::CBracketManager() {}
 
 std::string CBracketManager::getId() const {
 	return "CBracketManager";
@@ -12,11 +12,8 @@ namespace llvmir2hll {
 /**
 * @brief Constructs a new brackets manager thath turns off eleminating redundant
 *        brackets.
-*
-* @param[in] module The module to be written.
 */
-NoBracketManager::NoBracketManager(ShPtr<Module> module):BracketManager(module) {
-}
+NoBracketManager::NoBracketManager() {}
 
 std::string NoBracketManager::getId() const {
 	return "NoBracketManager";
@@ -14,13 +14,8 @@ namespace llvmir2hll {
 
 /**
 * @brief Constructs a new Python' brackets manager.
-*
-* @param[in] module The module to be analyzed.
 */
-PyBracketManager::PyBracketManager(ShPtr<Module> module): BracketManager(module) {
-	// Starts running of brackets elimination analyse.
-	init();
-}
+PyBracketManager::PyBracketManager() {}
 
 std::string PyBracketManager::getId() const {
 	return "PyBracketManager";
@@ -906,7 +906,9 @@ void HLLWriter::emitExprWithBracketsIfNeeded(ShPtr<Expression> expr) {
 void HLLWriter::emitUnaryOpExpr(const std::string &opRepr,
 		ShPtr<UnaryOpExpr> expr) {
 	out << opRepr;
+	bracketsManager->enterOperandOf(expr);
 	emitExprWithBracketsIfNeeded(expr->getOperand());
+	bracketsManager->leaveOperandOf(expr);
 }
 
 /**
@@ -924,14 +926,45 @@ void HLLWriter::emitBinaryOpExpr(const std::string &opRepr,
 	if (bracketsAreNeeded) {
 		out << "(";
 	}
+	bracketsManager->enterOperandOf(expr);
 	expr->getFirstOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	out << opRepr;
+	bracketsManager->enterSecondOperandOf(expr);
 	expr->getSecondOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	if (bracketsAreNeeded) {
 		out << ")";
 	}
 }
 
+/**
+* @brief Emits the operand of a compound operator.
+*
+* @param[in] operand Operand of the compound operator.
+* @param[in] rhs Right-hand side of the assignment from which the compound
+*                operator has been created.
+*
+* When @a operand is an operand of @a rhs (e.g. @c b in <tt>a = a + b</tt>,
+* which is emitted as <tt>a += b</tt>), brackets around it are decided in the
+* same way as when @a rhs is emitted as a whole.
+*/
+void HLLWriter::emitOperandOfCompoundOp(ShPtr<Expression> operand,
+		ShPtr<Expression> rhs) {
+	ShPtr<BinaryOpExpr> binaryRhs(cast<BinaryOpExpr>(rhs));
+	if (operand == rhs || !binaryRhs) {
+		operand->accept(this);
+	} else if (operand == binaryRhs->getFirstOperand()) {
+		bracketsManager->enterOperandOf(binaryRhs);
+		operand->accept(this);
+		bracketsManager->leaveOperandOf(binaryRhs);
+	} else {
+		bracketsManager->enterSecondOperandOf(binaryRhs);
+		operand->accept(this);
+		bracketsManager->leaveOperandOf(binaryRhs);
+	}
+}
+
 /**
 * @brief Emits a description of the detected cryptographic pattern for the
 *        given global variable.
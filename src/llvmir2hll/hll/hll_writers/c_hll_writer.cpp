@@ -525,9 +525,9 @@ void CHLLWriter::visit(ShPtr<Function> func) {
 
 bool CHLLWriter::emitTargetCode(ShPtr<Module> module) {
 	if (optionKeepAllBrackets) {
-		bracketsManager = ShPtr<BracketManager>(new NoBracketManager(module));
+		bracketsManager = ShPtr<BracketManager>(new NoBracketManager());
 	} else {
-		bracketsManager = ShPtr<BracketManager>(new CBracketManager(module));
+		bracketsManager = ShPtr<BracketManager>(new CBracketManager());
 	}
 
 	if (optionUseCompoundOperators) {
@@ -548,30 +548,38 @@ void CHLLWriter::visit(ShPtr<AddressOpExpr> expr) {
 }
 
 void CHLLWriter::visit(ShPtr<AssignOpExpr> expr) {
-	emitAssignment(expr->getFirstOperand(), expr->getSecondOperand());
+	emitAssignment(expr->getFirstOperand(), expr->getSecondOperand(), expr);
 }
 
 void CHLLWriter::visit(ShPtr<ArrayIndexOpExpr> expr) {
 	// Base.
+	bracketsManager->enterOperandOf(expr);
 	emitExprWithBracketsIfNeeded(expr->getBase());
+	bracketsManager->leaveOperandOf(expr);
 
 	// Access.
 	out << "[";
+	bracketsManager->enterSecondOperandOf(expr);
 	expr->getIndex()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	out << "]";
 }
 
 void CHLLWriter::visit(ShPtr<StructIndexOpExpr> expr) {
 	// Base.
 	ShPtr<Expression> base(expr->getFirstOperand());
+	bracketsManager->enterOperandOf(expr);
 	emitExprWithBracketsIfNeeded(base);
+	bracketsManager->leaveOperandOf(expr);
 
 	// Access.
 	out << (isa<PointerType>(base->getType()) ? "->" : ".");
 
 	// Element.
 	out << "e";
+	bracketsManager->enterSecondOperandOf(expr);
 	expr->getSecondOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 }
 
 void CHLLWriter::visit(ShPtr<DerefOpExpr> expr) {
@@ -615,11 +623,13 @@ void CHLLWriter::visit(ShPtr<TernaryOpExpr> expr) {
 	if (bracketsAreNeeded) {
 		out << "(";
 	}
+	bracketsManager->enterOperandOf(expr);
 	expr->getCondition()->accept(this);
 	out << " ? ";
 	expr->getTrueValue()->accept(this);
 	out << " : ";
 	expr->getFalseValue()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	if (bracketsAreNeeded) {
 		out << ")";
 	}
@@ -677,6 +687,8 @@ void CHLLWriter::visit(ShPtr<BitShrOpExpr> expr) {
 }
 
 void CHLLWriter::visit(ShPtr<CallExpr> expr) {
+	bracketsManager->enterOperandOf(expr);
+
 	// Called expression.
 	emitExprWithBracketsIfNeeded(expr->getCalledExpr());
 
@@ -684,6 +696,8 @@ void CHLLWriter::visit(ShPtr<CallExpr> expr) {
 	out << "(";
 	emitSequenceWithAccept(expr->getArgs(), ", ");
 	out << ")";
+
+	bracketsManager->leaveOperandOf(expr);
 }
 
 void CHLLWriter::visit(ShPtr<CommaOpExpr> expr) {
@@ -703,7 +717,9 @@ void CHLLWriter::visit(ShPtr<TruncCastExpr> expr) {
 	if (isa<IntType>(expr->getType()) &&
 			(cast<IntType>(expr->getType())->isBool())) {
 		out << "(";
+		bracketsManager->enterOperandOf(expr);
 		expr->getOperand()->accept(this);
+		bracketsManager->leaveOperandOf(expr);
 		out << "&1)";
 	} else {
 		emitCastInStandardWay(expr);
@@ -719,7 +735,9 @@ void CHLLWriter::visit(ShPtr<FPToIntCastExpr> expr) {
 		type->accept(this);
 	}
 	out << ")";
+	bracketsManager->enterOperandOf(expr);
 	expr->getOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 }
 
 void CHLLWriter::visit(ShPtr<IntToFPCastExpr> expr) {
@@ -810,11 +828,23 @@ void CHLLWriter::visit(ShPtr<AssignStmt> stmt) {
 
 /**
 * @brief Emits the given assignment (without leading or trailing whitespace).
+*
+* @param[in] lhs Left-hand side of the assignment.
+* @param[in] rhs Right-hand side of the assignment.
+* @param[in] assignExpr If the assignment is an expression, the expression.
+*                       Otherwise, the null pointer.
 */
-void CHLLWriter::emitAssignment(ShPtr<Expression> lhs, ShPtr<Expression> rhs) {
+void CHLLWriter::emitAssignment(ShPtr<Expression> lhs, ShPtr<Expression> rhs,
+		ShPtr<AssignOpExpr> assignExpr) {
 	CompoundOpManager::CompoundOp compoundOp(
 		compoundOpManager->tryOptimizeToCompoundOp(lhs, rhs));
+	if (assignExpr) {
+		bracketsManager->enterOperandOf(assignExpr);
+	}
 	lhs->accept(this);
+	if (assignExpr) {
+		bracketsManager->leaveOperandOf(assignExpr);
+	}
 	if (compoundOp.isUnaryOperator()) {
 		// ++ or --
 		out << compoundOp.getOperator();
@@ -822,9 +852,15 @@ void CHLLWriter::emitAssignment(ShPtr<Expression> lhs, ShPtr<Expression> rhs) {
 		// = or X=, where X is an operator
 		out << " " << compoundOp.getOperator() << " ";
 
+		if (assignExpr) {
+			bracketsManager->enterSecondOperandOf(assignExpr);
+		}
 		emitConstantsInStructuredWay = true;
-		compoundOp.getOperand()->accept(this);
+		emitOperandOfCompoundOp(compoundOp.getOperand(), rhs);
 		emitConstantsInStructuredWay = false;
+		if (assignExpr) {
+			bracketsManager->leaveOperandOf(assignExpr);
+		}
 	}
 }
 
@@ -1659,7 +1695,9 @@ void CHLLWriter::emitCastInStandardWay(ShPtr<CastExpr> expr) {
 	out << "(";
 	expr->getType()->accept(this);
 	out << ")";
+	bracketsManager->enterOperandOf(expr);
 	expr->getOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 }
 
 /**
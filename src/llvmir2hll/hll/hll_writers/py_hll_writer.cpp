@@ -151,9 +151,9 @@ bool PyHLLWriter::emitFileFooter() {
 
 bool PyHLLWriter::emitTargetCode(ShPtr<Module> module) {
 	if (optionKeepAllBrackets) {
-		bracketsManager = ShPtr<BracketManager>(new NoBracketManager(module));
+		bracketsManager = ShPtr<BracketManager>(new NoBracketManager());
 	} else {
-		bracketsManager = ShPtr<BracketManager>(new PyBracketManager(module));
+		bracketsManager = ShPtr<BracketManager>(new PyBracketManager());
 	}
 
 	if (optionUseCompoundOperators) {
@@ -207,21 +207,29 @@ void PyHLLWriter::visit(ShPtr<AssignOpExpr> expr) {
 
 void PyHLLWriter::visit(ShPtr<ArrayIndexOpExpr> expr) {
 	// Base.
+	bracketsManager->enterOperandOf(expr);
 	emitExprWithBracketsIfNeeded(expr->getBase());
+	bracketsManager->leaveOperandOf(expr);
 
 	// Access.
 	out << "[";
+	bracketsManager->enterSecondOperandOf(expr);
 	expr->getIndex()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	out << "]";
 }
 
 void PyHLLWriter::visit(ShPtr<StructIndexOpExpr> expr) {
 	// Base.
+	bracketsManager->enterOperandOf(expr);
 	emitExprWithBracketsIfNeeded(expr->getFirstOperand());
+	bracketsManager->leaveOperandOf(expr);
 
 	// Access + element.
 	out << "['";
+	bracketsManager->enterSecondOperandOf(expr);
 	expr->getSecondOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	out << "']";
 }
 
@@ -266,11 +274,13 @@ void PyHLLWriter::visit(ShPtr<TernaryOpExpr> expr) {
 	if (bracketsAreNeeded) {
 		out << "(";
 	}
+	bracketsManager->enterOperandOf(expr);
 	expr->getTrueValue()->accept(this);
 	out << " if ";
 	expr->getCondition()->accept(this);
 	out << " else ";
 	expr->getFalseValue()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 	if (bracketsAreNeeded) {
 		out << ")";
 	}
@@ -327,14 +337,20 @@ void PyHLLWriter::visit(ShPtr<BitShrOpExpr> expr) {
 		emitBinaryOpExpr(" >> ", expr);
 	} else {
 		out << "lshr(";
+		bracketsManager->enterOperandOf(expr);
 		expr->getFirstOperand()->accept(this);
+		bracketsManager->leaveOperandOf(expr);
 		out << ", ";
+		bracketsManager->enterSecondOperandOf(expr);
 		expr->getSecondOperand()->accept(this);
+		bracketsManager->leaveOperandOf(expr);
 		out << ")";
 	}
 }
 
 void PyHLLWriter::visit(ShPtr<CallExpr> expr) {
+	bracketsManager->enterOperandOf(expr);
+
 	// Called expression.
 	emitExprWithBracketsIfNeeded(expr->getCalledExpr());
 
@@ -342,6 +358,8 @@ void PyHLLWriter::visit(ShPtr<CallExpr> expr) {
 	out << "(";
 	emitSequenceWithAccept(expr->getArgs(), ", ");
 	out << ")";
+
+	bracketsManager->leaveOperandOf(expr);
 }
 
 void PyHLLWriter::visit(ShPtr<CommaOpExpr> expr) {
@@ -470,7 +488,7 @@ void PyHLLWriter::visit(ShPtr<AssignStmt> stmt) {
 	out << " " << compoundOp.getOperator() << " ";
 
 	emitConstantsInStructuredWay = true;
-	compoundOp.getOperand()->accept(this);
+	emitOperandOfCompoundOp(compoundOp.getOperand(), stmt->getRhs());
 	emitConstantsInStructuredWay = false;
 
 	out << "\n";
@@ -573,7 +591,9 @@ void PyHLLWriter::visit(ShPtr<ForLoopStmt> stmt) {
 	bool endCondEmitted = false;
 	if (ShPtr<LtOpExpr> ltEndCond = cast<LtOpExpr>(stmt->getEndCond())) {
 		if (stmt->getIndVar() == ltEndCond->getFirstOperand()) {
+			bracketsManager->enterSecondOperandOf(ltEndCond);
 			ltEndCond->getSecondOperand()->accept(this);
+			bracketsManager->leaveOperandOf(ltEndCond);
 			endCondEmitted = true;
 		}
 	}
@@ -887,7 +907,9 @@ void PyHLLWriter::emitUninitializedConstArray(ShPtr<ConstArray> array) {
 * @brief Emits the operand of the given cast.
 */
 void PyHLLWriter::emitOperandOfCast(ShPtr<CastExpr> expr) {
+	bracketsManager->enterOperandOf(expr);
 	expr->getOperand()->accept(this);
+	bracketsManager->leaveOperandOf(expr);
 }
 
 /**
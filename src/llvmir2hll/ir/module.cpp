@@ -22,9 +22,9 @@
 
 using retdec::utils::FilterIterator;
 using retdec::utils::filterTo;
-using retdec::utils::hasItem;
 using retdec::utils::mapGetValueOrDefault;
 using retdec::utils::mapHasKey;
+using retdec::utils::removeItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -43,7 +43,9 @@ namespace llvmir2hll {
 Module::Module(const llvm::Module *llvmModule, const std::string &identifier,
 		ShPtr<Semantics> semantics, ShPtr<Config> config):
 	llvmModule(llvmModule), identifier(identifier), semantics(semantics),
-	config(config), globalVars(), funcs(), debugVarNameMap() {
+	config(config), globalVars(), globalVarsSet(), globalVarDefs(), funcs(),
+	funcsSet(), debugVarNameMap(), globalVarsByName(), funcsByName(),
+	nameIndexesValid(false), nameIndexesNumOfNameChanges(0) {
 		PRECONDITION_NON_NULL(llvmModule);
 		PRECONDITION_NON_NULL(semantics);
 	}
@@ -62,21 +64,26 @@ Module::~Module() {}
 * If the global variable already exists, it replaces its initializer with @a
 * init.
 *
-* Time complexity: @c O(n), where @c n is the number of global variables in the
-* module.
+* Time complexity: @c O(1) on average.
 */
 void Module::addGlobalVar(ShPtr<Variable> var, ShPtr<Expression> init) {
 	// Check whether the variable has already been added.
-	for (auto i = globalVars.begin(), e = globalVars.end(); i != e; ++i) {
-		if ((*i)->getVar() == var) {
-			// It does, so just replace its initializer.
-			(*i)->setInitializer(init);
-			return;
-		}
+	auto i = globalVarDefs.find(var);
+	if (i != globalVarDefs.end()) {
+		// It does, so just replace its initializer.
+		i->second->setInitializer(init);
+		return;
 	}
 
 	// The variable does not exist, so add it.
-	globalVars.push_back(GlobalVarDef::create(var, init));
+	auto varDef = GlobalVarDef::create(var, init);
+	globalVars.push_back(varDef);
+	globalVarsSet.insert(var);
+	globalVarDefs.emplace(var, varDef);
+	if (nameIndexesValid) {
+		// The first variable with the name stays in the index.
+		globalVarsByName.emplace(var->getName(), var);
+	}
 }
 
 /**
@@ -85,30 +92,33 @@ void Module::addGlobalVar(ShPtr<Variable> var, ShPtr<Expression> init) {
 * If the global variable does not exist, this function does nothing.
 *
 * Time complexity: @c O(n), where @c n is the number of global variables in the
-* module.
+* module (the order of the remaining variables is preserved).
 */
 void Module::removeGlobalVar(ShPtr<Variable> var) {
-	for (auto i = globalVars.begin(), e = globalVars.end(); i != e; ++i) {
-		if ((*i)->getVar() == var) {
-			globalVars.erase(i);
-			return;
-		}
+	auto i = globalVarDefs.find(var);
+	if (i == globalVarDefs.end()) {
+		return;
+	}
+
+	removeItem(globalVars, i->second);
+	globalVarDefs.erase(i);
+	globalVarsSet.erase(var);
+
+	// Another variable with the same name may exist, so the name index has to
+	// be rebuilt when it contains the removed variable.
+	if (nameIndexesValid &&
+			mapGetValueOrDefault(globalVarsByName, var->getName()) == var) {
+		nameIndexesValid = false;
 	}
 }
 
 /**
 * @brief Returns @c true if @a var is a global variable, @c false otherwise.
 *
-* Time complexity: @c O(n), where @c n is the number of global variables in the
-* module.
+* Time complexity: @c O(1) on average.
 */
 bool Module::isGlobalVar(ShPtr<Variable> var) const {
-	for (auto i = globalVars.begin(), e = globalVars.end(); i != e; ++i) {
-		if ((*i)->getVar() == var) {
-			return true;
-		}
-	}
-	return false;
+	return mapHasKey(globalVarDefs, var);
 }
 
 /**
@@ -126,16 +136,12 @@ bool Module::isGlobalVarStoringStringLiteral(const std::string &varName) const {
 * If @a var is not a global variable or if it has no initializer, the null
 * pointer is returned.
 *
-* Time complexity: @c O(n), where @c n is the number of global variables in the
-* module.
+* Time complexity: @c O(1) on average.
 */
 ShPtr<Expression> Module::getInitForGlobalVar(ShPtr<Variable> var) const {
-	for (auto i = globalVars.begin(), e = globalVars.end(); i != e; ++i) {
-		if ((*i)->getVar() == var) {
-			return (*i)->getInitializer();
-		}
-	}
-	return ShPtr<Expression>();
+	auto i = globalVarDefs.find(var);
+	return i != globalVarDefs.end() ? i->second->getInitializer() :
+		ShPtr<Expression>();
 }
 
 /**
@@ -144,32 +150,27 @@ ShPtr<Expression> Module::getInitForGlobalVar(ShPtr<Variable> var) const {
 * @param[in] varName Name of the variable.
 *
 * If there is no global variable named @a varName, it returns the null pointer.
+* If there are more global variables named @a varName, the first one is
+* returned.
 *
-* Time complexity: @c O(n), where @c n is the number of global variables in the
-* module.
+* Time complexity: @c O(1) on average when no variable has been renamed since
+* the last lookup by name, @c O(n) otherwise, where @c n is the number of global
+* variables and functions in the module.
 */
 ShPtr<Variable> Module::getGlobalVarByName(const std::string &varName) const {
-	for (auto i = globalVars.begin(), e = globalVars.end(); i != e; ++i) {
-		if ((*i)->getVar()->getName() == varName) {
-			return (*i)->getVar();
-		}
-	}
-
-	// There is no global variable named varName.
-	return ShPtr<Variable>();
+	updateNameIndexes();
+	return mapGetValueOrDefault(globalVarsByName, varName);
 }
 
 /**
 * @brief Returns all global variables (without their initializer).
 *
-* Time complexity: @c O(n), where @c n is the number of global variables in the
-* module.
+* The returned set is valid until a global variable is added to or removed
+* from the module.
+*
+* Time complexity: @c O(1).
 */
-VarSet Module::getGlobalVars() const {
-	VarSet globalVarsSet;
-	for (auto i = globalVars.begin(), e = globalVars.end(); i != e; ++i) {
-		globalVarsSet.insert((*i)->getVar());
-	}
+const VarSet &Module::getGlobalVars() const {
 	return globalVarsSet;
 }
 
@@ -238,12 +239,8 @@ bool Module::hasGlobalVars() const {
 *        name.
 */
 bool Module::hasGlobalVar(const std::string &name) const {
-	for (auto &varDef : globalVars) {
-		if (varDef->getVar()->getName() == name) {
-			return true;
-		}
-	}
-	return false;
+	updateNameIndexes();
+	return mapHasKey(globalVarsByName, name);
 }
 
 /**
@@ -268,8 +265,14 @@ Module::global_var_iterator Module::global_var_end() const {
 * If the function already exists in the module, nothing is done.
 */
 void Module::addFunc(ShPtr<Function> func) {
-	if (!hasItem(funcs, func)) {
-		funcs.push_back(func);
+	if (!funcsSet.insert(func).second) {
+		return;
+	}
+
+	funcs.push_back(func);
+	if (nameIndexesValid) {
+		// The first function with the name stays in the index.
+		funcsByName.emplace(func->getName(), func);
 	}
 }
 
@@ -279,7 +282,18 @@ void Module::addFunc(ShPtr<Function> func) {
 * If there is no matching function, nothing is removed.
 */
 void Module::removeFunc(ShPtr<Function> func) {
+	if (funcsSet.erase(func) == 0) {
+		return;
+	}
+
 	removeItem(funcs, func);
+
+	// Another function with the same name may exist, so the name index has to
+	// be rebuilt when it contains the removed function.
+	if (nameIndexesValid &&
+			mapGetValueOrDefault(funcsByName, func->getName()) == func) {
+		nameIndexesValid = false;
+	}
 }
 
 /**
@@ -288,7 +302,7 @@ void Module::removeFunc(ShPtr<Function> func) {
 * @a func may be either a function definition or a function declaration.
 */
 bool Module::funcExists(ShPtr<Function> func) const {
-	return hasItem(funcs, func);
+	return funcsSet.find(func) != funcsSet.end();
 }
 
 /**
@@ -319,14 +333,15 @@ bool Module::isMainFunc(ShPtr<Function> func) const {
 * @param[in] funcName Name of the function.
 *
 * If there is no function named @a funcName, it returns the null pointer.
+* If there are more functions named @a funcName, the first one is returned.
+*
+* Time complexity: @c O(1) on average when no variable has been renamed since
+* the last lookup by name, @c O(n) otherwise, where @c n is the number of global
+* variables and functions in the module.
 */
 ShPtr<Function> Module::getFuncByName(const std::string &funcName) const {
-	for (const auto &func : funcs) {
-		if (func->getName() == funcName) {
-			return func;
-		}
-	}
-	return ShPtr<Function>();
+	updateNameIndexes();
+	return mapGetValueOrDefault(funcsByName, funcName);
 }
 
 /**
@@ -678,6 +693,34 @@ bool Module::allFuncDefinitionsHaveLineRange() const {
 	return true;
 }
 
+/**
+* @brief Rebuilds the indexes of global variables and functions by their names
+*        when they are not up to date.
+*
+* Names are changed directly in variables, so the indexes are considered to be
+* out of date after a change of a name of any variable.
+*/
+void Module::updateNameIndexes() const {
+	if (nameIndexesValid &&
+			nameIndexesNumOfNameChanges == Variable::getNumOfNameChanges()) {
+		return;
+	}
+
+	globalVarsByName.clear();
+	for (const auto &varDef : globalVars) {
+		// emplace() keeps the first variable with the given name.
+		globalVarsByName.emplace(varDef->getVar()->getName(), varDef->getVar());
+	}
+
+	funcsByName.clear();
+	for (const auto &func : funcs) {
+		funcsByName.emplace(func->getName(), func);
+	}
+
+	nameIndexesValid = true;
+	nameIndexesNumOfNameChanges = Variable::getNumOfNameChanges();
+}
+
 /**
 * @brief Is there a function satisfying the given predicate?
 */
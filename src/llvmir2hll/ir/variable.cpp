@@ -12,6 +12,8 @@
 namespace retdec {
 namespace llvmir2hll {
 
+std::size_t Variable::numOfNameChanges = 0;
+
 /**
 * @brief Constructs a new variable.
 *
@@ -125,7 +127,10 @@ ShPtr<Variable> Variable::copy() const {
 * @brief Sets the variable's name to @a newName.
 */
 void Variable::setName(const std::string &newName) {
-	name = newName;
+	if (name != newName) {
+		name = newName;
+		++numOfNameChanges;
+	}
 }
 
 /**
@@ -160,6 +165,16 @@ void Variable::markAsExternal() {
 	internal = false;
 }
 
+/**
+* @brief Returns the number of changes of names of all variables so far.
+*
+* It allows caching name-based lookups of variables (see Module): a cache is
+* valid as long as this number has not changed since the cache was built.
+*/
+std::size_t Variable::getNumOfNameChanges() {
+	return numOfNameChanges;
+}
+
 /**
 * @brief Creates a new variable.
 *
@@ -48,6 +48,7 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_while_cond_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/utils/container.h"
+#include "retdec/utils/memory.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
 
@@ -55,6 +56,7 @@ using namespace retdec::llvm_support;
 using namespace std::string_literals;
 
 using retdec::utils::hasItem;
+using retdec::utils::MemoryBudget;
 using retdec::utils::sleep;
 using retdec::utils::startsWith;
 
@@ -68,6 +70,22 @@ const std::string OPT_SUFFIX = "Optimizer";
 /// Prefix of aggressive optimizations.
 const std::string AGGRESSIVE_OPTS_PREFIX = "Aggressive";
 
+/// Optimizations that are skipped when memory is scarce. They either need a
+/// lot of memory (dataflow analyses) or only improve the readability of the
+/// generated code.
+const StringSet OPTS_SKIPPED_UNDER_MEMORY_PRESSURE = {
+	"AggressiveGlobalToLocal",
+	"AuxiliaryVariables",
+	"CopyPropagation",
+	"DeadCode",
+	"DeadGlobalAssign",
+	"DeadLocalAssign",
+	"GlobalToLocal",
+	"IfToSwitch",
+	"SimpleCopyPropagation",
+	"WhileTrueToForLoop",
+};
+
 /**
 * @brief Trims the optional suffix "Optimizer" from all optimization names in
 *        @a opts.
@@ -161,7 +179,9 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 		hllWriter(hllWriter), va(va), cio(cio),
 		arithmExprEvaluator(arithmExprEvaluator),
 		enableAggressiveOpts(enableAggressiveOpts), enableDebug(enableDebug),
-		recoverFromOutOfMemory(true), frontendRunOpts(), backendRunOpts() {
+		recoverFromOutOfMemory(true),
+		reportedBudgetStage(MemoryBudget::Stage::Normal), frontendRunOpts(),
+		backendRunOpts() {
 			PRECONDITION_NON_NULL(hllWriter);
 			PRECONDITION_NON_NULL(va);
 			PRECONDITION_NON_NULL(cio);
@@ -357,7 +377,7 @@ bool OptimizerManager::optShouldBeRun(const std::string &optId) const {
 */
 void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer) {
 	const std::string OPT_ID = optimizer->getId();
-	if (!optShouldBeRun(OPT_ID)) {
+	if (!optShouldBeRun(OPT_ID) || !fitsIntoMemoryBudget(OPT_ID)) {
 		return;
 	}
 
@@ -384,6 +404,47 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 	backendRunOpts.insert(OPT_ID);
 }
 
+/**
+* @brief Returns @c true if the optimization with @a optId may be run with
+*        respect to the memory budget, @c false otherwise.
+*
+* As the memory usage gets closer to the budget (see utils::MemoryBudget), the
+* cache of the value analysis is dropped, then memory-hungry and optional
+* optimizations are skipped, and finally, no more optimizations are run so the
+* code obtained so far can be emitted. When no budget is set, this function
+* always returns @c true.
+*/
+bool OptimizerManager::fitsIntoMemoryBudget(const std::string &optId) {
+	const auto stage = MemoryBudget::getStage();
+	if (stage == MemoryBudget::Stage::Normal) {
+		return true;
+	}
+
+	if (stage > reportedBudgetStage) {
+		reportedBudgetStage = stage;
+		if (stage == MemoryBudget::Stage::DropCaches) {
+			printWarningMessage("memory usage is close to the budget; "
+				"dropping caches");
+		} else if (stage == MemoryBudget::Stage::SkipOptional) {
+			printWarningMessage("memory usage is close to the budget; "
+				"skipping optional optimizations");
+		} else {
+			printWarningMessage("memory budget exhausted; "
+				"skipping remaining optimizations");
+		}
+	}
+
+	// The cache is rebuilt by the optimizations that are still run, so it
+	// has to be dropped before each of them.
+	va->clearCache();
+
+	if (stage == MemoryBudget::Stage::EmitPartial) {
+		return false;
+	}
+	return stage != MemoryBudget::Stage::SkipOptional ||
+		!hasItem(OPTS_SKIPPED_UNDER_MEMORY_PRESSURE, optId);
+}
+
 /**
 * @brief Prints debug information about the currently run optimization with @a
 *        optId.
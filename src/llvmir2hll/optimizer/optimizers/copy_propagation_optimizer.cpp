@@ -525,7 +525,8 @@ void CopyPropagationOptimizer::handleCaseSingleUse(ShPtr<Statement> stmt,
 		//     b = 5
 		//     return 5
 		//
-		const auto &readVarsInStmt = stmtData->getDirReadVars();
+		VarSet readVarsInStmt(stmtData->dir_read_begin(),
+			stmtData->dir_read_end());
 		if (VarDefCFGTraversal::isVarDefBetweenStmts(readVarsInStmt, stmt, use,
 				ducs->cfg, va)) {
 			return;
@@ -575,7 +576,9 @@ void CopyPropagationOptimizer::handleCaseSingleUse(ShPtr<Statement> stmt,
 		// (ii), and (i) and (ii) do not contain function calls or dereferences
 		// (the reason is that they may changed the value of lemon, if it is a
 		// global variable). Note that (iii) can contain any statements.
-		const auto &readVarsInLastDef = va->getValueData(lastDef)->getDirReadVars();
+		ShPtr<ValueData> lastDefData(va->getValueData(lastDef));
+		VarSet readVarsInLastDef(lastDefData->dir_read_begin(),
+			lastDefData->dir_read_end());
 		if (!NoVarDefCFGTraversal::noVarIsDefinedBetweenStmts(use, lhsUseDefs,
 				readVarsInLastDef, ducs->cfg, va)) {
 			return;
@@ -15,9 +15,6 @@
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvmir2hll/utils/ir.h"
-#include "retdec/utils/container.h"
-
-using retdec::utils::hasItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -82,7 +79,7 @@ bool DeadLocalAssignOptimizer::canBeOptimized(ShPtr<Variable> var,
 
 		// The variable is not read in the use.
 		ShPtr<ValueData> useData(va->getValueData(use));
-		if (hasItem(useData->getDirReadVars(), var)) {
+		if (useData->isDirRead(var)) {
 			return false;
 		}
 
@@ -43,7 +43,7 @@ GlobalToLocalOptimizer::GlobalToLocalOptimizer(ShPtr<Module> module,
 		ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio):
 	Optimizer(module), cg(CGBuilder::getCG(module)), va(va), cio(cio),
 	vuv(), usefulGlobalVars(), uselessGlobalVars(),
-	funcUsedGlobalVarsMap() {
+	funcUsedGlobalVarsMap(), globalVarUsingFuncsMap() {
 		PRECONDITION_NON_NULL(module);
 		PRECONDITION_NON_NULL(va);
 		PRECONDITION_NON_NULL(cio);
@@ -133,12 +133,9 @@ void GlobalToLocalOptimizer::convertUselessGlobalVars() {
 	for (const auto &var : uselessGlobalVars) {
 		ShPtr<Expression> init(module->getInitForGlobalVar(var));
 
-		// For each function...
-		for (auto j = module->func_definition_begin(),
-				f = module->func_definition_end(); j != f; ++j) {
-			if (hasItem(funcUsedGlobalVarsMap[*j], var)) {
-				convertGlobalVarToLocalVarInFunc(var, *j, init);
-			}
+		// For each function that uses the variable...
+		for (const auto &func : getFuncsUsingGlobalVar(var)) {
+			convertGlobalVarToLocalVarInFunc(var, func, init);
 		}
 
 		module->removeGlobalVar(var);
@@ -283,7 +280,8 @@ void GlobalToLocalOptimizer::computeGlobalVarsUsedInGlobalVarDef() {
 
 /**
 * @brief Computes @c globalVarsUsedInGlobalVarDef and @c funcUsedGlobalVarsMap
-*        for each function (definitions and declarations).
+*        for each function (definitions and declarations), and its inverse @c
+*        globalVarUsingFuncsMap.
 */
 void GlobalToLocalOptimizer::computeUsedGlobalVars() {
 	computeGlobalVarsUsedInGlobalVarDef();
@@ -298,6 +296,17 @@ void GlobalToLocalOptimizer::computeUsedGlobalVars() {
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		funcUsedGlobalVarsMap[*i] = computeUsedGlobalVarsForFunc(*i);
 	}
+
+	// Invert the mapping so that the sub-optimizations may iterate only over
+	// functions that actually use a global variable instead of over all
+	// functions for every global variable.
+	globalVarUsingFuncsMap.clear();
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		for (const auto &var : funcUsedGlobalVarsMap[*i]) {
+			globalVarUsingFuncsMap[var].push_back(*i);
+		}
+	}
 }
 
 /**
@@ -325,6 +334,21 @@ VarSet GlobalToLocalOptimizer::computeUsedGlobalVarsForFunc(
 	return usedGlobalVars;
 }
 
+/**
+* @brief Returns the function definitions that use the given global variable
+*        (in the same order as in the module).
+*
+* @par Preconditions
+*  - @c globalVarUsingFuncsMap has been computed
+*/
+const FuncVector &GlobalToLocalOptimizer::getFuncsUsingGlobalVar(
+		ShPtr<Variable> var) const {
+	static const FuncVector noFuncs;
+
+	auto i = globalVarUsingFuncsMap.find(var);
+	return i != globalVarUsingFuncsMap.end() ? i->second : noFuncs;
+}
+
 /**
 * @brief Computes the sets of ``useful'' and ``useless'' global variables, @c
 *        usefulGlobalVars and @c uselessGlobalVars.
@@ -370,10 +394,10 @@ void GlobalToLocalOptimizer::computeUsefulAndUselessGlobalVars() {
 	for (auto i = module->global_var_begin(), e = module->global_var_end();
 			i != e; ++i) {
 		ShPtr<Variable> var((*i)->getVar());
-		// For each function...
-		for (auto j = module->func_definition_begin(),
-				f = module->func_definition_end(); j != f; ++j) {
-			if (isUsefulInFunc(var, *j)) {
+		// For each function that uses the variable (a global variable cannot
+		// be useful in a function that does not use it)...
+		for (const auto &func : getFuncsUsingGlobalVar(var)) {
+			if (isUsefulInFunc(var, func)) {
 				usefulGlobalVars.insert(var);
 
 				// If the variable is useful in at least a single function,
@@ -451,7 +475,7 @@ bool GlobalToLocalOptimizer::isUsefulInFunc(ShPtr<Variable> var,
 			}
 
 			ShPtr<ValueData> stmtData(va->getValueData(stmt));
-			addToSet(stmtData->getDirAccessedVars(), usedVars);
+			usedVars.insert(stmtData->dir_all_begin(), stmtData->dir_all_end());
 			// Since there are no dereferences in the statement (see the
 			// description of isStatementImplyingUsefulness()), we do not have
 			// to include indirectly accessed variables.
@@ -504,21 +528,6 @@ bool GlobalToLocalOptimizer::isStatementImplyingUsefulness(
 	return false;
 }
 
-/**
-* @brief Returns @c true if the given global variable is used in the given
-*        function, @c false otherwise.
-*
-* @par Preconditions
-*  - @a var and @a func are non-null
-*/
-bool GlobalToLocalOptimizer::isUsedInFunc(ShPtr<Variable> var,
-		ShPtr<Function> func) {
-	PRECONDITION_NON_NULL(var);
-	PRECONDITION_NON_NULL(func);
-
-	return hasItem(funcUsedGlobalVarsMap[func], var);
-}
-
 /**
 * @brief Returns @c true if the given global variable may be removed from the
 *        module as unused, @c false otherwise.
@@ -530,11 +539,8 @@ bool GlobalToLocalOptimizer::globalVarMayBeRemovedAsUnused(ShPtr<Variable> var)
 	PRECONDITION_NON_NULL(var);
 
 	// The variable cannot be used in any function.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		if (isUsedInFunc(var, *i)) {
-			return false;
-		}
+	if (!getFuncsUsingGlobalVar(var).empty()) {
+		return false;
 	}
 
 	//
@@ -569,11 +575,9 @@ bool GlobalToLocalOptimizer::globalVarMayBeConverted(ShPtr<Variable> var,
 	PRECONDITION_NON_NULL(var);
 	PRECONDITION_NON_NULL(func);
 
-	// The global variable has to be used only in this function. Check all
-	// functions whether var is used in them.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		if (*i != func && isUsedInFunc(var, *i)) {
+	// The global variable has to be used only in this function.
+	for (const auto &usingFunc : getFuncsUsingGlobalVar(var)) {
+		if (usingFunc != func) {
 			return false;
 		}
 	}
@@ -101,8 +101,7 @@ bool IfBeforeLoopOptimizer::tryOptimizationCase1(ShPtr<IfStmt> stmt) {
 		// There should be only a single variable in the if's condition.
 		return false;
 	}
-	const VarSet &allVarsUsedInIfCond(ifCondData->getDirAccessedVars());
-	ShPtr<Variable> x(*allVarsUsedInIfCond.begin());
+	ShPtr<Variable> x(*ifCondData->dir_all_begin());
 	if (cast<Variable>(ifCondOp->getFirstOperand()) != x &&
 		cast<Variable>(ifCondOp->getSecondOperand()) != x) {
 		// One operand of ifCondOp has to be x.
@@ -193,8 +192,7 @@ bool IfBeforeLoopOptimizer::tryOptimizationCase2(ShPtr<IfStmt> stmt) {
 		// There should be only a single variable in the if's condition.
 		return false;
 	}
-	const VarSet &allVarsUsedInIfCond(ifCondData->getDirAccessedVars());
-	ShPtr<Variable> x(*allVarsUsedInIfCond.begin());
+	ShPtr<Variable> x(*ifCondData->dir_all_begin());
 	if (!x) {
 		// The variable x was not found.
 		return false;
@@ -181,7 +181,6 @@ void SimpleCopyPropagationOptimizer::tryOptimizationCase1(
 	// We will need the set of variables which may be accessed when calling the
 	// function from the right-hand side.
 	ShPtr<ValueData> stmtData(va->getValueData(stmt));
-	const VarSet &varsAccessedInCall(stmtData->getDirAccessedVars());
 	ShPtr<CallInfo> rhsCallInfo(cio->getCallInfo(rhsCall, currFunc));
 
 	// Get the first statement where the variable is used by going through the
@@ -216,7 +215,7 @@ void SimpleCopyPropagationOptimizer::tryOptimizationCase1(
 		// indirectly).
 		for (auto i = firstUseStmtData->dir_all_begin(),
 				e = firstUseStmtData->dir_all_end(); i != e; ++i) {
-			if (hasItem(varsAccessedInCall, *i) ||
+			if (stmtData->isDirAccessed(*i) ||
 					rhsCallInfo->mayBeRead(*i) ||
 					rhsCallInfo->mayBeModified(*i)) {
 				return;
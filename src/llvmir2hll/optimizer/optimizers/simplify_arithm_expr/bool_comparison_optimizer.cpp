@@ -24,7 +24,10 @@ REGISTER_AT_FACTORY("BoolComparison", BOOL_COMPARISON_OPTIMIZER_ID,
 *            expressions.
 */
 BoolComparisonSubOptimizer::BoolComparisonSubOptimizer(ShPtr<ArithmExprEvaluator>
-		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {}
+		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<EqOpExpr>();
+	addOptimizedExprType<NeqOpExpr>();
+}
 
 /**
 * @brief Destructs the sub-optimizer.
@@ -114,16 +117,16 @@ void BoolComparisonSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 
 template<typename ExprType>
 void BoolComparisonSubOptimizer::optimizeNestedComparisons(ExprType expr) {
-	SubOptimizer::visit(expr);
+	visitOperands(expr);
 }
 
 void BoolComparisonSubOptimizer::replaceWithFirstOperand(ShPtr<BinaryOpExpr> expr) {
-	Expression::replaceExpression(expr, expr->getFirstOperand());
+	optimizeExpr(expr, expr->getFirstOperand());
 }
 
 void BoolComparisonSubOptimizer::replaceWithNegationOfFirstOperand(
 		ShPtr<BinaryOpExpr> expr) {
-	Expression::replaceExpression(
+	optimizeExpr(
 		expr,
 		ExpressionNegater::negate(expr->getFirstOperand())
 	);
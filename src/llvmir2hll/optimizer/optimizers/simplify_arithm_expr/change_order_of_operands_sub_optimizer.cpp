@@ -23,7 +23,9 @@ REGISTER_AT_FACTORY("ChangeOrderOfOperands", CHANGE_ORDER_OF_OPERANDS_SUB_OPTIMI
 */
 ChangeOrderOfOperandsSubOptimizer::ChangeOrderOfOperandsSubOptimizer(
 		ShPtr<ArithmExprEvaluator> arithmExprEvaluator):
-			SubOptimizer(arithmExprEvaluator) {}
+			SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<MulOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -47,7 +49,7 @@ std::string ChangeOrderOfOperandsSubOptimizer::getId() const {
 }
 
 void ChangeOrderOfOperandsSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// Optimization like "a * 3(ConstInt/ConstFloat)" -> optimized to "3 * a".
 	// Need to ensure not to optimize 2 * 3 because this expression will be
@@ -41,7 +41,23 @@ REGISTER_AT_FACTORY("ConstOperatorConst", CONST_OPERATOR_CONST_SUB_OPTIMIZER_ID,
 */
 ConstOperatorConstSubOptimizer::ConstOperatorConstSubOptimizer(
 		ShPtr<ArithmExprEvaluator> arithmExprEvaluator):
-			SubOptimizer(arithmExprEvaluator) {}
+			SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<AddOpExpr>();
+	addOptimizedExprType<SubOpExpr>();
+	addOptimizedExprType<MulOpExpr>();
+	addOptimizedExprType<DivOpExpr>();
+	addOptimizedExprType<BitAndOpExpr>();
+	addOptimizedExprType<BitOrOpExpr>();
+	addOptimizedExprType<BitXorOpExpr>();
+	addOptimizedExprType<LtOpExpr>();
+	addOptimizedExprType<LtEqOpExpr>();
+	addOptimizedExprType<GtOpExpr>();
+	addOptimizedExprType<GtEqOpExpr>();
+	addOptimizedExprType<EqOpExpr>();
+	addOptimizedExprType<NeqOpExpr>();
+	addOptimizedExprType<AndOpExpr>();
+	addOptimizedExprType<OrOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -65,73 +81,73 @@ std::string ConstOperatorConstSubOptimizer::getId() const {
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// This is resolved in EqualOperandsSubOptimizer.
 	// This case has some special conditions which are resolved there.
@@ -143,7 +159,7 @@ void ConstOperatorConstSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// This is resolved in EqualOperandsSubOptimizer.
 	// This case has some special conditions which are resolved there.
@@ -155,13 +171,13 @@ void ConstOperatorConstSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<AndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
 void ConstOperatorConstSubOptimizer::visit(ShPtr<OrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
@@ -33,7 +33,13 @@ REGISTER_AT_FACTORY("EqualOperands", EQUAL_OPERANDS_SUB_OPTIMIZER_ID,
 *            expressions.
 */
 EqualOperandsSubOptimizer::EqualOperandsSubOptimizer(ShPtr<ArithmExprEvaluator>
-		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {}
+		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<AddOpExpr>();
+	addOptimizedExprType<SubOpExpr>();
+	addOptimizedExprType<DivOpExpr>();
+	addOptimizedExprType<EqOpExpr>();
+	addOptimizedExprType<NeqOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -57,7 +63,7 @@ std::string EqualOperandsSubOptimizer::getId() const {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// Optimization like "a + a" -> optimized to "2 * a".
 	if ((expr->getFirstOperand())->isEqualTo(expr->getSecondOperand())) {
@@ -70,7 +76,7 @@ void EqualOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// Optimization like "a - a" -> optimized to "0".
 	if ((expr->getFirstOperand())->isEqualTo(expr->getSecondOperand())) {
@@ -85,7 +91,7 @@ void EqualOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// Optimization like "a / a" -> optimized to "1".
 	if ((expr->getFirstOperand())->isEqualTo(expr->getSecondOperand())) {
@@ -100,7 +106,7 @@ void EqualOperandsSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// We don't want to optimize func() == func() or 2.74 == 2.74.
 	if (!isaConstIntOrIntTypeVariable(expr->getFirstOperand())) {
@@ -115,7 +121,7 @@ void EqualOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void EqualOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// We don't want to optimize func() != func() or 2.74 != 2.74.
 	if (!isaConstIntOrIntTypeVariable(expr->getFirstOperand())) {
@@ -24,7 +24,9 @@ REGISTER_AT_FACTORY("NegationOperator", NEGATION_OPERATOR_SUB_OPTIMIZER_ID,
 */
 NegationOperatorSubOptimizer::NegationOperatorSubOptimizer(ShPtr<
 	ArithmExprEvaluator> arithmExprEvaluator):
-		SubOptimizer(arithmExprEvaluator) {}
+		SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<NotOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -48,7 +50,7 @@ std::string NegationOperatorSubOptimizer::getId() const {
 }
 
 void NegationOperatorSubOptimizer::visit(ShPtr<NotOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	ShPtr<Expression> negatedExpr(ExpressionNegater::negate(expr->getOperand()));
 	// !(a + b) is not optimized to !(a + b) because this is uselessly. Not to
@@ -26,7 +26,10 @@ REGISTER_AT_FACTORY("NegativeOperand", NEGATIVE_OPERAND_SUB_OPTIMIZER_ID,
 */
 NegativeOperandSubOptimizer::NegativeOperandSubOptimizer(
 		ShPtr<ArithmExprEvaluator> arithmExprEvaluator):
-			SubOptimizer(arithmExprEvaluator) {}
+			SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<AddOpExpr>();
+	addOptimizedExprType<SubOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -50,7 +53,7 @@ std::string NegativeOperandSubOptimizer::getId() const {
 }
 
 void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// -------
 	// First negative operand optimization.
@@ -134,7 +137,7 @@ void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void NegativeOperandSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// -------
 	// Second negative operand optimization.
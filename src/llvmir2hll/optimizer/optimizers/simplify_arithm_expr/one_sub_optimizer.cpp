@@ -30,7 +30,11 @@ REGISTER_AT_FACTORY("One", ONE_SUB_OPTIMIZER_ID, SubOptimizerFactory,
 *            expressions.
 */
 OneSubOptimizer::OneSubOptimizer(ShPtr<ArithmExprEvaluator>
-		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {}
+		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<MulOpExpr>();
+	addOptimizedExprType<DivOpExpr>();
+	addOptimizedExprType<BitXorOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -53,7 +57,7 @@ std::string OneSubOptimizer::getId() const {
 }
 
 void OneSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isOpOne(expr->getFirstOperand())) {
 		// Optimization like "1(ConstInt/ConstFloat) * a" -> optimized to "a".
@@ -65,7 +69,7 @@ void OneSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 }
 
 void OneSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isOpOne(expr->getSecondOperand())) {
 		// Optimization like "a / 1(ConstInt/ConstFloat)" -> optimized to "a".
@@ -74,7 +78,7 @@ void OneSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 }
 
 void OneSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isConstIntOne(expr->getFirstOperand())) {
 		// Optimization like "1 ^ (a == b)" -> optimized to "a != b" or
@@ -25,7 +25,8 @@ namespace llvmir2hll {
 *  - @a arithmExprEvaluator is non-null
 */
 SubOptimizer::SubOptimizer(ShPtr<ArithmExprEvaluator> arithmExprEvaluator):
-		arithmExprEvaluator(arithmExprEvaluator) {
+		arithmExprEvaluator(arithmExprEvaluator), codeChanged(false),
+		optimizingOnlyRoot(false), lastNewExpr(), optimizedExprTypes() {
 	PRECONDITION_NON_NULL(arithmExprEvaluator);
 }
 
@@ -45,6 +46,32 @@ bool SubOptimizer::tryOptimize(ShPtr<Expression> expr) {
 	return tryOptimizeAndReturnIfCodeChanged(expr);
 }
 
+/**
+* @brief Tries to optimize only @a expr, without its operands.
+*
+* @param[in] expr An expression to optimize.
+*
+* @return The expression that has replaced @a expr if @a expr was optimized,
+*         the null pointer otherwise.
+*
+* The operands of @a expr are supposed to be already optimized.
+*/
+ShPtr<Expression> SubOptimizer::tryOptimizeRoot(ShPtr<Expression> expr) {
+	optimizingOnlyRoot = true;
+	bool changed = tryOptimizeAndReturnIfCodeChanged(expr);
+	optimizingOnlyRoot = false;
+	return changed ? lastNewExpr : ShPtr<Expression>();
+}
+
+/**
+* @brief Returns the types of expressions optimized by this sub-optimizer.
+*
+* Expressions of other types are left untouched by tryOptimizeRoot().
+*/
+const SubOptimizer::ExprTypeSet &SubOptimizer::getOptimizedExprTypes() const {
+	return optimizedExprTypes;
+}
+
 /**
 * @brief Optimize expression from @a oldExpr to @a newExpr.
 *
@@ -59,6 +86,7 @@ void SubOptimizer::optimizeExpr(ShPtr<Expression> oldExpr,
 	}
 
 	Expression::replaceExpression(oldExpr, newExpr);
+	lastNewExpr = newExpr;
 	codeChanged = true;
 }
 
@@ -24,7 +24,9 @@ REGISTER_AT_FACTORY("TernaryOperator", TERNARY_OPERATOR_SUB_OPTIMIZER_ID,
 */
 TernaryOperatorSubOptimizer::TernaryOperatorSubOptimizer(
 		ShPtr<ArithmExprEvaluator> arithmExprEvaluator):
-			SubOptimizer(arithmExprEvaluator) {}
+			SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<TernaryOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -48,7 +50,7 @@ std::string TernaryOperatorSubOptimizer::getId() const {
 }
 
 void TernaryOperatorSubOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	ShPtr<ConstBool> constBool(cast<ConstBool>(expr->getCondition()));
 	if (!constBool) {
@@ -52,7 +52,18 @@ REGISTER_AT_FACTORY("ThreeOperands", OP_OPER_OP_OPER_OP_SUB_OPTIMIZER_ID,
 *            expressions.
 */
 ThreeOperandsSubOptimizer::ThreeOperandsSubOptimizer(ShPtr<ArithmExprEvaluator>
-		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {}
+		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<AddOpExpr>();
+	addOptimizedExprType<SubOpExpr>();
+	addOptimizedExprType<LtOpExpr>();
+	addOptimizedExprType<LtEqOpExpr>();
+	addOptimizedExprType<GtOpExpr>();
+	addOptimizedExprType<GtEqOpExpr>();
+	addOptimizedExprType<EqOpExpr>();
+	addOptimizedExprType<NeqOpExpr>();
+	addOptimizedExprType<BitXorOpExpr>();
+	addOptimizedExprType<OrOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -76,7 +87,7 @@ std::string ThreeOperandsSubOptimizer::getId() const {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// Optimizations dependent on the first Constant operand or on the second
 	// Constant operand.
@@ -199,7 +210,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	// Optimizations dependent on the first Constant operand.
 	if (isConstFloatOrConstInt(expr->getFirstOperand())) {
@@ -380,7 +391,7 @@ bool ThreeOperandsSubOptimizer::analyzeOpOperOp(ShPtr<Expression> &constant,
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
@@ -389,7 +400,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
@@ -398,7 +409,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
@@ -407,7 +418,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
@@ -416,7 +427,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
@@ -425,7 +436,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
 	if (exprPair) {
@@ -434,13 +445,13 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeBitXorOpWithRelationalOperator(expr);
 }
 
 void ThreeOperandsSubOptimizer::visit(ShPtr<OrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	tryOptimizeOrOpExprWithRelOperators(expr);
 }
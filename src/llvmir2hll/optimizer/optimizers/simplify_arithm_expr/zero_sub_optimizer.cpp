@@ -33,7 +33,16 @@ REGISTER_AT_FACTORY("Zero", ZERO_SUB_OPTIMIZER_ID, SubOptimizerFactory,
 *            expressions.
 */
 ZeroSubOptimizer::ZeroSubOptimizer(ShPtr<ArithmExprEvaluator>
-		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {}
+		arithmExprEvaluator): SubOptimizer(arithmExprEvaluator) {
+	addOptimizedExprType<AddOpExpr>();
+	addOptimizedExprType<SubOpExpr>();
+	addOptimizedExprType<MulOpExpr>();
+	addOptimizedExprType<DivOpExpr>();
+	addOptimizedExprType<ModOpExpr>();
+	addOptimizedExprType<BitAndOpExpr>();
+	addOptimizedExprType<BitOrOpExpr>();
+	addOptimizedExprType<BitXorOpExpr>();
+}
 
 /**
 * @brief Destructor.
@@ -56,7 +65,7 @@ std::string ZeroSubOptimizer::getId() const {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) + a -> optimized to "a".
@@ -68,7 +77,7 @@ void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	ShPtr<ConstInt> secOpConstInt(cast<ConstInt>(expr->getSecondOperand()));
 	ShPtr<ConstFloat> secOpConstFloat(cast<ConstFloat>(expr->getSecondOperand()));
@@ -105,7 +114,7 @@ void ZeroSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) * a -> optimized to "0".
@@ -117,7 +126,7 @@ void ZeroSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) / a -> optimized to "0".
@@ -126,7 +135,7 @@ void ZeroSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<ModOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) % a -> optimized to "0".
@@ -135,7 +144,7 @@ void ZeroSubOptimizer::visit(ShPtr<ModOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isConstIntZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) & a -> optimized to "0".
@@ -147,7 +156,7 @@ void ZeroSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isConstIntZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) | a -> optimized to "a".
@@ -160,7 +169,7 @@ void ZeroSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
 }
 
 void ZeroSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	OrderedAllVisitor::visit(expr);
+	visitOperands(expr);
 
 	if (isConstIntZero(expr->getFirstOperand())) {
 		// Optimization like 0(ConstFloat/ConstInt) ^ a -> optimized to "a".
@@ -4,7 +4,10 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <typeinfo>
+
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/and_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
@@ -63,108 +66,143 @@ void SimplifyArithmExprOptimizer::doOptimization() {
 	// Visit the initializer of all global variables.
 	for (auto i = module->global_var_begin(), e = module->global_var_end();
 			i != e; ++i) {
-		// Keep optimizing until there are no changes.
-		do {
-			codeChanged = false;
-			if (ShPtr<Expression> init = (*i)->getInitializer()) {
-				init->accept(this);
-			}
-		} while (codeChanged);
+		if (ShPtr<Expression> init = (*i)->getInitializer()) {
+			init->accept(this);
+		}
 	}
+	simplifiedExprs.clear();
 
-	// Visit all functions.
+	// Visit all functions. A single pass suffices because every replaced
+	// expression is simplified again right away (see simplify()).
 	for (auto i = module->func_definition_begin(),
 			e = module->func_definition_end(); i != e; ++i) {
-		// Keep optimizing until there are no changes.
-		do {
-			codeChanged = false;
-			restart();
-			(*i)->accept(this);
-		} while (codeChanged);
+		restart();
+		(*i)->accept(this);
+		simplifiedExprs.clear();
 	}
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<AddOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
+}
+
+void SimplifyArithmExprOptimizer::visit(ShPtr<AndOpExpr> expr) {
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<SubOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<MulOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<DivOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<ModOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<LtOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<GtOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<EqOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<NeqOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<NotOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<OrOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
 }
 
 void SimplifyArithmExprOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
-	tryOptimizeInSubOptimizations(expr);
+	simplify(expr);
+}
+
+/**
+* @brief Simplifies @a expr and its operands.
+*
+* The operands are simplified first. Then, @a expr is offered to the
+* sub-optimizers. If one of them replaces it, the replacement is simplified in
+* the same way. Already simplified expressions are skipped.
+*
+* @param[in] expr An expression to simplify.
+*/
+template<typename ExprType>
+void SimplifyArithmExprOptimizer::simplify(ShPtr<ExprType> expr) {
+	if (!simplifiedExprs.insert(expr).second) {
+		// The expression has already been simplified.
+		return;
+	}
+
+	OrderedAllVisitor::visit(expr);
+
+	if (ShPtr<Expression> newExpr = tryOptimizeInSubOptimizations(expr)) {
+		newExpr->accept(this);
+	}
 }
 
 /**
-* @brief Iterate through all sub-optimizers and try optimize @a expr.
+* @brief Tries to optimize @a expr in the sub-optimizers that optimize
+*        expressions of its type.
 *
-* If something was optimized in sub-optimizations, @c codeChanged is set to
-* @c true.
+* The sub-optimizers are tried in the order in which they were created. The
+* first successful one wins.
 *
-* @param[in] expr An expression to optimize.
+* @param[in] expr An expression to optimize. Its operands have to be already
+*                 simplified.
+*
+* @return The expression that has replaced @a expr if @a expr was optimized,
+*         the null pointer otherwise.
 */
-void SimplifyArithmExprOptimizer::tryOptimizeInSubOptimizations(
+ShPtr<Expression> SimplifyArithmExprOptimizer::tryOptimizeInSubOptimizations(
 		ShPtr<Expression> expr) {
-	for (const auto &subOptim : subOptims) {
-		codeChanged |= subOptim->tryOptimize(expr);
+	auto it = subOptimsForExprType.find(std::type_index(typeid(*expr)));
+	if (it == subOptimsForExprType.end()) {
+		return ShPtr<Expression>();
 	}
+
+	for (const auto &subOptim : it->second) {
+		if (ShPtr<Expression> newExpr = subOptim->tryOptimizeRoot(expr)) {
+			return newExpr;
+		}
+	}
+	return ShPtr<Expression>();
 }
 
 /**
@@ -185,6 +223,12 @@ void SimplifyArithmExprOptimizer::createSubOptimizers(ShPtr<ArithmExprEvaluator>
 			)
 		);
 	}
+
+	for (const auto &subOptim : subOptims) {
+		for (const auto &exprType : subOptim->getOptimizedExprTypes()) {
+			subOptimsForExprType[exprType].push_back(subOptim);
+		}
+	}
 }
 
 } // namespace llvmir2hll
@@ -51,87 +51,104 @@ ExprTypesFixer::~ExprTypesFixer() {}
 *        @c ExprTypesAnalysis.
 *
 * @param[in] module Searched module.
+*
+* Every tagged expression is checked once, based on the statistics computed
+* before any type is changed.
 */
 void ExprTypesFixer::setProbablyTypes(ShPtr<Module> module) {
-	// Create Analysis of integer types.
+	// Check statistics about all variables and fix their types to correct
+	// signed if expected.
+	for (const auto &p : computeTagCounts(module)) {
+		fixTypeOfExpr(p.first, p.second, module);
+	}
+}
+
+/**
+* @brief Computes counts of signed and unsigned tags of all expressions in the
+*        given module.
+*
+* @param[in] module Searched module.
+*/
+ExprTypesFixer::ExprTagCountsMap ExprTypesFixer::computeTagCounts(
+		ShPtr<Module> module) {
+	// The analysis returns statistics about variables in map.
 	ShPtr<ExprTypesAnalysis> exprTypesAnalysis(ExprTypesAnalysis::create());
-	bool changed = true;
-	while (changed) {
-		changed = false;
-		// The analysis returns statistics about variables in map.
-		ExprTypesAnalysis::ExprTagsMap exprTagsMap =
-				exprTypesAnalysis->analyzeExprTypes(module);
-		// Check statistics about all variables and fix their types to correct
-		// signed if expected.
-		for (const auto &p : exprTagsMap) {
-			ShPtr<Expression> expr = p.first;
-			// Get statistics about expression - how many times it is used as
-			// signed.
-			std::size_t isSigned = exprTypesAnalysis->getCountOfTag(
-				expr, ExprTypesAnalysis::ExprTag::Signed);
-			// Get statistics about expression - how many times it is used as
-			// unsigned.
-			std::size_t isUnsigned = exprTypesAnalysis->getCountOfTag(
-				expr, ExprTypesAnalysis::ExprTag::Unsigned);
-			// We can change the type of a variable.
-			if (ShPtr<Variable> var = cast<Variable>(expr)) {
-				if (ShPtr<IntType> type = cast<IntType>(var->getType())) {
-					// Evaluation of statistics and fixing of type.
-					if ((isSigned > isUnsigned) && type->isUnsigned()) {
-						changed = true;
-						var->setType(IntType::create(type->getSize(), true));
-					} else if ((isSigned <= isUnsigned) && type->isSigned()) {
-						changed = true;
-						var->setType(IntType::create(type->getSize(), false));
-					}
-				}
-			// We can change the type of a constant.
-			} else if (ShPtr<ConstInt> constant = cast<ConstInt>(expr)) {
-				if (ShPtr<IntType> type = cast<IntType>(constant->getType())) {
-					// Evaluation of statistics and fixing of type.
-					if ((isSigned > isUnsigned) && constant->isUnsigned()) {
-						changed = true;
-						llvm::APSInt val = constant->getValue();
-						val.setIsSigned(true);
-						Expression::replaceExpression(expr,
-							ConstInt::create(val));
-					} else if ((isSigned <= isUnsigned) && constant->isSigned()) {
-						changed = true;
-						llvm::APSInt val = constant->getValue();
-						val.setIsUnsigned(true);
-						Expression::replaceExpression(expr,
-							ConstInt::create(val));
-					}
-				}
-			// We can change the type of a CalledExpr of CallExpr.
-			} else if (ShPtr<CallExpr> callExpr = cast<CallExpr>(expr)) {
-				if (ShPtr<Variable> var = cast<Variable>(callExpr->getCalledExpr())) {
-					// We are finding a local function.
-					bool found = false;
-					// Searched function.
-					ShPtr<Function> func = module->getFuncByName(var->getName());
+	ExprTypesAnalysis::ExprTagsMap exprTagsMap(
+		exprTypesAnalysis->analyzeExprTypes(module));
+
+	ExprTagCountsMap exprTagCounts;
+	for (const auto &p : exprTagsMap) {
+		TagCounts &counts(exprTagCounts[p.first]);
+		for (const auto &tag : p.second) {
+			if (tag == ExprTypesAnalysis::ExprTag::Signed) {
+				++counts.isSigned;
+			} else {
+				++counts.isUnsigned;
+			}
+		}
+	}
+	return exprTagCounts;
+}
+
+/**
+* @brief Changes the type of @a expr if it does not correspond to the counts
+*        of its tags.
+*
+* @param[in] expr Checked expression.
+* @param[in] counts Counts of tags of @a expr.
+* @param[in] module Searched module.
+*/
+void ExprTypesFixer::fixTypeOfExpr(ShPtr<Expression> expr,
+		const TagCounts &counts, ShPtr<Module> module) {
+	// Get statistics about expression - how many times it is used as signed
+	// and unsigned.
+	std::size_t isSigned = counts.isSigned;
+	std::size_t isUnsigned = counts.isUnsigned;
+
+	// We can change the type of a variable.
+	if (ShPtr<Variable> var = cast<Variable>(expr)) {
+		if (ShPtr<IntType> type = cast<IntType>(var->getType())) {
+			// Evaluation of statistics and fixing of type.
+			if ((isSigned > isUnsigned) && type->isUnsigned()) {
+				var->setType(IntType::create(type->getSize(), true));
+			} else if ((isSigned <= isUnsigned) && type->isSigned()) {
+				var->setType(IntType::create(type->getSize(), false));
+			}
+		}
+	// We can change the type of a constant.
+	} else if (ShPtr<ConstInt> constant = cast<ConstInt>(expr)) {
+		if (ShPtr<IntType> type = cast<IntType>(constant->getType())) {
+			// Evaluation of statistics and fixing of type.
+			if ((isSigned > isUnsigned) && constant->isUnsigned()) {
+				llvm::APSInt val = constant->getValue();
+				val.setIsSigned(true);
+				Expression::replaceExpression(expr, ConstInt::create(val));
+			} else if ((isSigned <= isUnsigned) && constant->isSigned()) {
+				llvm::APSInt val = constant->getValue();
+				val.setIsUnsigned(true);
+				Expression::replaceExpression(expr, ConstInt::create(val));
+			}
+		}
+	// We can change the type of a CalledExpr of CallExpr.
+	} else if (ShPtr<CallExpr> callExpr = cast<CallExpr>(expr)) {
+		if (ShPtr<Variable> var = cast<Variable>(callExpr->getCalledExpr())) {
+			// Searched function.
+			ShPtr<Function> func = module->getFuncByName(var->getName());
+			if (ShPtr<IntType> type = cast<IntType>(var->getType())) {
+				// Evaluation of statistics and fixing of the type.
+				if ((isSigned > isUnsigned) && type->isUnsigned()) {
+					var->setType(IntType::create(type->getSize(), true));
+					// If the called expression is a function, we have to
+					// change its type, too.
 					if (func) {
-						found = true;
+						func->setRetType(IntType::create(type->getSize(), true));
 					}
-					if (ShPtr<IntType> type = cast<IntType>(var->getType())) {
-						// Evaluation of statistics and fixing of the type.
-						if ((isSigned > isUnsigned) && type->isUnsigned()) {
-							changed = true;
-							var->setType(IntType::create(type->getSize(), true));
-							// If the called expression is a function, we have
-							// to change its type, too.
-							if (found) {
-								func->setRetType(IntType::create(type->getSize(), true));
-							}
-						} else if ((isSigned <= isUnsigned) && type->isSigned()) {
-							changed = true;
-							var->setType(IntType::create(type->getSize(), false));
-							// If the called expression is a function, we have
-							// to change its type, too.
-							if (found) {
-								func->setRetType(IntType::create(type->getSize(), false));
-							}
-						}
+				} else if ((isSigned <= isUnsigned) && type->isSigned()) {
+					var->setType(IntType::create(type->getSize(), false));
+					// If the called expression is a function, we have to
+					// change its type, too.
+					if (func) {
+						func->setRetType(IntType::create(type->getSize(), false));
 					}
 				}
 			}
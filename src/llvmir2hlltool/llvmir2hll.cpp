@@ -94,8 +94,9 @@ using namespace llvm;
 using retdec::llvmir2hll::ShPtr;
 using retdec::utils::hasItem;
 using retdec::utils::joinStrings;
+using retdec::utils::getTotalSystemMemory;
 using retdec::utils::limitSystemMemory;
-using retdec::utils::limitSystemMemoryToHalfOfTotalSystemMemory;
+using retdec::utils::MemoryBudget;
 using retdec::utils::split;
 using retdec::utils::strToNum;
 
@@ -495,22 +496,30 @@ bool Decompiler::runOnModule(Module &m) {
 		convertConstantsToSymbolicNames();
 	}
 
-	if (ValidateModule) {
+	// When memory is scarce, skip phases that do not affect the target code.
+	bool skipOptionalPhases = MemoryBudget::shouldSkipOptionalPhases();
+	if (skipOptionalPhases) {
+		retdec::llvm_support::printWarningMessage("memory usage is close to"
+			" the budget; skipping validation, pattern finding, and emission"
+			" of graphs");
+	}
+
+	if (ValidateModule && !skipOptionalPhases) {
 		if (Debug) retdec::llvm_support::printPhase("module validation");
 		validateResultingModule();
 	}
 
-	if (!FindPatterns.empty()) {
+	if (!FindPatterns.empty() && !skipOptionalPhases) {
 		if (Debug) retdec::llvm_support::printPhase("finding patterns");
 		findPatterns();
 	}
 
-	if (EmitCFGs) {
+	if (EmitCFGs && !skipOptionalPhases) {
 		if (Debug) retdec::llvm_support::printPhase("emission of control-flow graphs");
 		emitCFGs();
 	}
 
-	if (EmitCG) {
+	if (EmitCG && !skipOptionalPhases) {
 		if (Debug) retdec::llvm_support::printPhase("emission of a call graph");
 		emitCG();
 	}
@@ -635,23 +644,34 @@ bool Decompiler::initialize(Module &m) {
 /**
 * @brief Limits the maximal memory of the tool based on the command-line
 *        parameters.
+*
+* Apart from the hard limit, the same amount of memory is set as the memory
+* budget (see utils::MemoryBudget), so the decompilation degrades gracefully
+* before the hard limit is hit. If the hard limit cannot be set, the budget is
+* still used. If the amount of memory cannot be determined, it fails.
 */
 bool Decompiler::limitMaximalMemoryIfRequested() {
+	std::size_t limit = 0;
 	if (MaxMemoryLimitHalfRAM) {
-		auto limitationSucceeded = limitSystemMemoryToHalfOfTotalSystemMemory();
-		if (!limitationSucceeded) {
+		limit = getTotalSystemMemory() / 2;
+		if (limit == 0) {
 			retdec::llvm_support::printErrorMessage(
-				"Failed to limit maximal memory to half of system RAM."
+				"failed to limit maximal memory to half of system RAM"
 			);
 			return false;
 		}
 	} else if (MaxMemoryLimit > 0) {
-		auto limitationSucceeded = limitSystemMemory(MaxMemoryLimit);
-		if (!limitationSucceeded) {
-			retdec::llvm_support::printErrorMessage(
-				"Failed to limit maximal memory to " + std::to_string(MaxMemoryLimit) + "."
-			);
-		}
+		limit = MaxMemoryLimit;
+	} else {
+		return true;
+	}
+
+	MemoryBudget::setLimit(limit);
+	if (!limitSystemMemory(limit)) {
+		retdec::llvm_support::printWarningMessage(
+			"failed to limit maximal memory to " + std::to_string(limit)
+			+ ", relying on the memory budget"
+		);
 	}
 
 	return true;
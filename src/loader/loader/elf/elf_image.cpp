@@ -121,6 +121,8 @@ bool ElfImage::loadExecutableFile()
 		}
 	}
 
+	flushRemovedSegments();
+
 	// In case we haven't loaded anything, try to fall back to loading it as relocatable file.
 	// That means sections are considered as source of data for loader.
 	if (getNumberOfSegments() == 0)
@@ -198,6 +200,8 @@ bool ElfImage::loadRelocatableFile()
 			return false;
 	}
 
+	flushRemovedSegments();
+
 	// Apply relocations
 	applyRelocations();
 
@@ -316,14 +320,23 @@ const Segment* ElfImage::addSegment(const retdec::fileformat::SecSeg* secSeg, st
 		return nullptr;
 	}
 
-	// Because we iterate over getSegments() here, we cannot afford to modify it during loop, it would break iterators.
-	// We need to store what to add and remove and do it after the loop.
-	// For removeList, we cannot use unique_ptr because we would move ownership of the object (segment) to removeList and
-	// this would invalidate pointers in getSegments(). Theoretically, we could just then remove all segments from getSegments() that
-	// point to nullptr, but this way, it is more intuitive and clear.
+	// Placed segments never overlap, so only the last one starting before the new segment and those starting inside it
+	// can overlap it. Find them in the map instead of going through all the segments, which would be quadratic
+	// for objects with many sections. They are taken out of the map and the ones which survive are put back
+	// under their new start address.
+	std::vector<Segment*> overlapping;
+	auto itr = _placedSegments.upper_bound(start);
+	if (itr != _placedSegments.begin() && std::prev(itr)->second->getEndAddress() >= start)
+		--itr;
+	while (itr != _placedSegments.end() && itr->first <= end)
+	{
+		overlapping.push_back(itr->second);
+		itr = _placedSegments.erase(itr);
+	}
+
+	// Removal from getSegments() is postponed to flushRemovedSegments() so it is done in a single pass.
 	std::vector<std::unique_ptr<Segment>> segmentsToInsert;
-	std::vector<Segment*> segmentsToRemove;
-	for (const auto& segment : getSegments())
+	for (auto* segment : overlapping)
 	{
 		auto overlapResult = OverlapResolver::resolve(segment->getAddressRange(), retdec::utils::Range<std::uint64_t>(start, end));
 		switch (overlapResult.getOverlap())
@@ -333,8 +346,8 @@ const Segment* ElfImage::addSegment(const retdec::fileformat::SecSeg* secSeg, st
 				break;
 			// Full overlap means we completely overlapped existing segment and we are free to remove it.
 			case Overlap::Full:
-				segmentsToRemove.push_back(segment.get());
-				break;
+				_removedSegments.insert(segment);
+				continue;
 			// Shrink existing segment using the second range from the result.
 			case Overlap::OverStart:
 			{
@@ -356,7 +369,7 @@ const Segment* ElfImage::addSegment(const retdec::fileformat::SecSeg* secSeg, st
 				const retdec::utils::Range<std::uint64_t>& newRange1 = overlapResult.getRanges()[0];
 				const retdec::utils::Range<std::uint64_t>& newRange2 = overlapResult.getRanges()[2];
 
-				auto segmentCopy = std::make_unique<Segment>(*segment.get());
+				auto segmentCopy = std::make_unique<Segment>(*segment);
 				segment->shrink(newRange1.getStart(), newRange1.getSize());
 				segmentCopy->shrink(newRange2.getStart(), newRange2.getSize());
 
@@ -366,19 +379,32 @@ const Segment* ElfImage::addSegment(const retdec::fileformat::SecSeg* secSeg, st
 			default:
 				break;
 		}
-	}
 
-	for (auto& segment : segmentsToRemove)
-		removeSegment(segment);
+		_placedSegments[segment->getAddress()] = segment;
+	}
 
 	Segment* retSegment = insertSegment(std::make_unique<Segment>(secSeg, address, memSize, std::move(dataSource)));
+	_placedSegments[retSegment->getAddress()] = retSegment;
 
 	for (auto& segment : segmentsToInsert)
-		insertSegment(std::move(segment));
+	{
+		Segment* insertedSegment = insertSegment(std::move(segment));
+		_placedSegments[insertedSegment->getAddress()] = insertedSegment;
+	}
 
 	return retSegment;
 }
 
+/**
+ * Removes segments which were fully overlapped during addSegment() calls from the image.
+ * It needs to be called after all segments are added and before the segments of the image are used.
+ */
+void ElfImage::flushRemovedSegments()
+{
+	removeSegments(_removedSegments);
+	_removedSegments.clear();
+}
+
 bool ElfImage::canLoadSections(const std::vector<retdec::fileformat::Section*>& sections) const
 {
 	// First, filter out non-SHF_ALLOC sections
@@ -473,8 +499,66 @@ void ElfImage::fixBssSegments()
 	}
 }
 
+ElfImage::RelocationPatcher::RelocationPatcher(ElfImage* image) : _image(image), _endianness(image->getEndianness())
+{
+}
+
+bool ElfImage::RelocationPatcher::get(std::size_t size, std::uint64_t address, std::uint64_t& value)
+{
+	const auto* data = locate(address, size);
+	if (!data)
+		return false;
+
+	value = 0;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		const auto byteIndex = _endianness == retdec::utils::Endianness::BIG ? i : size - i - 1;
+		value = (value << 8) | data[byteIndex];
+	}
+
+	return true;
+}
+
+bool ElfImage::RelocationPatcher::set(std::size_t size, std::uint64_t address, std::uint64_t value)
+{
+	auto* data = locate(address, size);
+	if (!data)
+		return false;
+
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		const auto byteIndex = _endianness == retdec::utils::Endianness::BIG ? size - i - 1 : i;
+		data[byteIndex] = static_cast<std::uint8_t>(value >> (8 * i));
+	}
+
+	return true;
+}
+
+std::uint8_t* ElfImage::RelocationPatcher::locate(std::uint64_t address, std::size_t size)
+{
+	if (!_segment || !_segment->containsAddress(address))
+	{
+		_segment = _image->getSegmentFromAddress(address);
+		if (!_segment)
+			return nullptr;
+
+		// Segment data are not owned by the segment but by the file format and they are
+		// writable, see SegmentDataSource::saveData().
+		auto rawData = _segment->getRawData();
+		_data = const_cast<std::uint8_t*>(rawData.first);
+		_dataSize = rawData.first ? rawData.second : 0;
+	}
+
+	const auto offset = address - _segment->getAddress();
+	if (offset >= _dataSize || size > _dataSize - offset)
+		return nullptr;
+
+	return _data + offset;
+}
+
 void ElfImage::applyRelocations()
 {
+	RelocationPatcher patcher(this);
 	for (auto& relTable : getFileFormat()->getRelocationTables())
 	{
 		if (relTable->getLinkToSymbolTable() >= getFileFormat()->getNumberOfSymbolTables())
@@ -499,17 +583,13 @@ void ElfImage::applyRelocations()
 			if (sym->getType() == retdec::fileformat::Symbol::Type::EXTERN)
 				continue;
 
-			resolveRelocation(rel, *sym);
+			resolveRelocation(rel, symbolAddress, patcher);
 		}
 	}
 }
 
-void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, const retdec::fileformat::Symbol& sym)
+void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, std::uint64_t symAddress, RelocationPatcher& patcher)
 {
-	unsigned long long symAddress;
-	if (!sym.getAddress(symAddress))
-		return;
-
 	switch (getFileFormat()->getTargetArchitecture())
 	{
 		case retdec::fileformat::Architecture::X86:
@@ -519,17 +599,19 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 				case R_386_32:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					value += symAddress + rel.getAddend();
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				case R_386_PC32:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					value += symAddress + rel.getAddend() - rel.getSectionOffset();
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				default:
@@ -544,21 +626,23 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 				case R_ARM_ABS32:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					value += symAddress + rel.getAddend();
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				case R_ARM_CALL:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					std::uint64_t copy = value;
 					// jumps/calls are on per-instruction level
 					value += (symAddress + rel.getAddend() - rel.getSectionOffset()) >> 2;
 					// 24 bit relocation
 					value = (copy & 0xFF000000) | (value & 0x00FFFFFF);
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				default:
@@ -568,27 +652,29 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 		}
 		case retdec::fileformat::Architecture::MIPS:
 		{
-			static const retdec::fileformat::Relocation* lastMipsHi16 = nullptr;
+			auto& lastMipsHi16 = patcher.lastHi16;
 
 			switch (rel.getType())
 			{
 				case R_MIPS_32:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					value += symAddress + rel.getAddend();
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				case R_MIPS_26:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					std::uint64_t copy = value;
 					// 26 bit relocation with specific formula
 					value += (symAddress + (rel.getAddend() | ((rel.getSectionOffset() + 4) & 0xF0000000))) >> 2;
 					value = (copy & 0xFC000000) | (value & 0x03FFFFFF);
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				case R_MIPS_HI16:
@@ -604,16 +690,18 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 
 					std::uint64_t value, valueHi, valueLo;
 					// +2 for operands of the instructions
-					get2Byte(lastMipsHi16->getAddress() + 2, valueHi);
-					get2Byte(rel.getAddress() + 2, valueLo);
+					if (!patcher.get(2, lastMipsHi16->getAddress() + 2, valueHi))
+						return;
+					if (!patcher.get(2, rel.getAddress() + 2, valueLo))
+						return;
 
 					value = ((valueHi << 16) | valueLo) + rel.getAddend();
 					value += symAddress;
 
 					valueHi = (value >> 16) & 0xFFFF;
 					valueLo = value & 0xFFFF;
-					set2Byte(lastMipsHi16->getAddress() + 2, valueHi);
-					set2Byte(rel.getAddress() + 2, valueLo);
+					patcher.set(2, lastMipsHi16->getAddress() + 2, valueHi);
+					patcher.set(2, rel.getAddress() + 2, valueLo);
 					lastMipsHi16 = nullptr;
 					break;
 				}
@@ -624,16 +712,17 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 		}
 		case retdec::fileformat::Architecture::POWERPC:
 		{
-			static const retdec::fileformat::Relocation* lastPpcHi16 = nullptr;
+			auto& lastPpcHi16 = patcher.lastHi16;
 
 			switch (rel.getType())
 			{
 				case R_PPC_ADDR32:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					value += symAddress + rel.getAddend();
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				case R_PPC_ADDR16_HI:
@@ -649,8 +738,10 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 						return;
 
 					std::uint64_t value, valueHi, valueLo;
-					get2Byte(lastPpcHi16->getAddress(), valueHi);
-					get2Byte(rel.getAddress(), valueLo);
+					if (!patcher.get(2, lastPpcHi16->getAddress(), valueHi))
+						return;
+					if (!patcher.get(2, rel.getAddress(), valueLo))
+						return;
 
 					// Handling of R_PPC_ADDR16_HA
 					if (lastPpcHi16->getType() == R_PPC_ADDR16_HA)
@@ -662,21 +753,22 @@ void ElfImage::resolveRelocation(const retdec::fileformat::Relocation& rel, cons
 
 					valueHi = (value >> 16) & 0xFFFF;
 					valueLo = value & 0xFFFF;
-					set2Byte(lastPpcHi16->getAddress(), valueHi);
-					set2Byte(rel.getAddress(), valueLo);
+					patcher.set(2, lastPpcHi16->getAddress(), valueHi);
+					patcher.set(2, rel.getAddress(), valueLo);
 					lastPpcHi16 = nullptr;
 					break;
 				}
 				case R_PPC_REL24:
 				{
 					std::uint64_t value;
-					get4Byte(rel.getAddress(), value);
+					if (!patcher.get(4, rel.getAddress(), value))
+						return;
 					std::uint64_t copy = value;
 					// 24 bit relocation where bits 3-29 are used for relocations
 					value = (value & 0x3FFFFFC) >> 2;
 					value += (symAddress + rel.getAddend() - rel.getSectionOffset()) >> 2;
 					value = (copy & 0xFC000003) | ((value << 2) & 0x3FFFFFC);
-					set4Byte(rel.getAddress(), value);
+					patcher.set(4, rel.getAddress(), value);
 					break;
 				}
 				default:
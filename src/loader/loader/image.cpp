@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <climits>
 #include <cstring>
 
@@ -452,6 +453,24 @@ void Image::removeSegment(Segment* segment)
 	}
 }
 
+/**
+ * Removes all the given segments in a single pass over the segments of the image.
+ * The relative order of the remaining segments is preserved.
+ *
+ * @param segments Segments to remove.
+ */
+void Image::removeSegments(const std::unordered_set<const Segment*>& segments)
+{
+	if (segments.empty())
+		return;
+
+	_segments.erase(std::remove_if(_segments.begin(), _segments.end(),
+			[&segments](const std::unique_ptr<Segment>& segment)
+			{
+				return segments.find(segment.get()) != segments.end();
+			}), _segments.end());
+}
+
 void Image::nameSegment(Segment* segment)
 {
 	if (segment->getSecSeg() == nullptr || segment->getSecSeg()->getName().empty())
@@ -4,6 +4,8 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+
 #include "retdec/utils/conversion.h"
 #include "retdec/patterngen/pattern_extractor/pattern_extractor.h"
 #include "retdec/fileformat/file_format/elf/elf_format.h"
@@ -165,8 +167,11 @@ bool PatternExtractor::processFile()
 			"unknown relocation code " + std::to_string(unknownReloc));
 	}
 
+	indexRelocations();
+
 	if (inputFile->isCoff() || inputFile->isMacho()) {
 		// COFF and Mach-O files are processed by sections.
+		indexFunctionSymbols();
 		for (const auto *section : inputFile->getSections()) {
 			processSection(section);
 		}
@@ -199,6 +204,58 @@ bool PatternExtractor::processFile()
 }
 
 
+/**
+ * Divide relocations by sections they link to and sort them by their offsets
+ * so that relocations of each pattern can be found by binary search.
+ */
+void PatternExtractor::indexRelocations()
+{
+	std::size_t order = 0;
+	for (const auto *relTab : inputFile->getRelocationTables()) {
+		for (std::size_t i = 0; i < relTab->getNumberOfRelocations(); ++i) {
+			unsigned long long sectionLink;
+			const auto *reloc = relTab->getRelocation(i);
+			if (!reloc || !reloc->getLinkToSection(sectionLink)) {
+				continue;
+			}
+
+			sectionRelocations[sectionLink].push_back(
+				RelocationEntry{reloc->getSectionOffset(), order++, reloc});
+		}
+	}
+
+	for (auto &item : sectionRelocations) {
+		std::stable_sort(item.second.begin(), item.second.end(),
+			[](const auto &f, const auto &o) {
+				return f.offset < o.offset;
+			});
+	}
+}
+
+
+/**
+ * Divide function symbols by sections they link to. Symbols in each section
+ * keep their order from symbol tables.
+ */
+void PatternExtractor::indexFunctionSymbols()
+{
+	for (const auto *symTab : inputFile->getSymbolTables()) {
+		for (std::size_t i = 0; i < symTab->getNumberOfSymbols(); ++i) {
+			// Get symbol and check if it is function.
+			const Symbol* symbol = symTab->getSymbol(i);
+			if(!symbol || !symbol->isFunction()) {
+				continue;
+			}
+
+			unsigned long long sectionLink;
+			if(symbol->getLinkToSection(sectionLink)) {
+				sectionFunctions[sectionLink].push_back(symbol);
+			}
+		}
+	}
+}
+
+
 /**
  * Check if we can use this 64-bit PowerPC file.
  *
@@ -370,21 +427,9 @@ void PatternExtractor::processSection(const Section *section)
 
 	// Get all function symbols for section.
 	std::vector<const Symbol*> symbols;
-	for (auto* symTab : inputFile->getSymbolTables()) {
-		for (std::size_t i = 0; i < symTab->getNumberOfSymbols(); ++i) {
-			// Get symbol and check if it is function.
-			const Symbol* symbol = symTab->getSymbol(i);
-			if(!symbol || !symbol->isFunction()) {
-				continue;
-			}
-
-			// Check section index.
-			unsigned long long sectionLink;
-			if(symbol->getLinkToSection(sectionLink)
-				&& section->getIndex() == sectionLink) {
-				symbols.push_back(symbol);
-			}
-		}
+	auto symbolsIt = sectionFunctions.find(section->getIndex());
+	if (symbolsIt != sectionFunctions.end()) {
+		symbols = symbolsIt->second;
 	}
 
 	std::sort(symbols.begin(), symbols.end(), [](auto* f, auto* o) {
@@ -466,23 +511,30 @@ void PatternExtractor::addPattern(
 		pattern.setSourcePath(inputFile->getPathToFile());
 		pattern.setRuleName(groupName + "_" + std::to_string(patterns.size()));
 
-		// Add relocations.
-		for (const auto *relTab : inputFile->getRelocationTables()) {
-			for (std::size_t i = 0; i < relTab->getNumberOfRelocations(); ++i) {
-				// Get relocation's section link and compare with section index.
-				unsigned long long sectionLink;
-				auto reloc = relTab->getRelocation(i);
-				if (!reloc || !reloc->getLinkToSection(sectionLink)
-						|| sectionLink != section->getIndex()) {
-					continue;
-				}
-
-				auto relocOffset = reloc->getSectionOffset();
-				if (relocOffset >= offset && relocOffset < offset + size) {
-					const auto mask = reloc->getMask();
-					pattern.addReference(reloc->getName(),
-						relocOffset - offset, mask);
-				}
+		// Add relocations. They are added in the order in which they are
+		// in relocation tables.
+		auto relocsIt = sectionRelocations.find(section->getIndex());
+		if (relocsIt != sectionRelocations.end()) {
+			const auto &relocs = relocsIt->second;
+			auto first = std::lower_bound(relocs.begin(), relocs.end(), offset,
+				[](const auto &entry, unsigned long long value) {
+					return entry.offset < value;
+				});
+
+			std::vector<const RelocationEntry*> symbolRelocs;
+			for (auto it = first;
+					it != relocs.end() && it->offset < offset + size; ++it) {
+				symbolRelocs.push_back(&*it);
+			}
+			std::sort(symbolRelocs.begin(), symbolRelocs.end(),
+				[](const auto *f, const auto *o) {
+					return f->order < o->order;
+				});
+
+			for (const auto *entry : symbolRelocs) {
+				const auto *reloc = entry->relocation;
+				pattern.addReference(reloc->getName(), entry->offset - offset,
+					reloc->getMask());
 			}
 		}
 		pattern.loadData(std::move(symbolData));
@@ -25,6 +25,28 @@ const std::vector<Plugin*> PluginMgr::plugins =
 	upx_plugin
 };
 
+/**
+ * Get the precompiled regular expression matching the packer versions
+ * supported by the plugin. Regular expressions of all plugins are compiled
+ * only once, on the first call.
+ *
+ * @param plugin The registered plugin.
+ *
+ * @return Non case-sensitive regular expression of the plugin.
+ */
+const std::regex& PluginMgr::versionRegex(const Plugin* plugin)
+{
+	static const std::map<const Plugin*, std::regex> regexes = []()
+	{
+		std::map<const Plugin*, std::regex> result;
+		for (const auto& p : plugins)
+			result.emplace(p, std::regex(p->getInfo()->packerVersion, std::regex::icase));
+		return result;
+	}();
+
+	return regexes.at(plugin);
+}
+
 /**
  * Find the matching plugins in the registered plugins table.
  *
@@ -53,8 +75,7 @@ PluginList PluginMgr::matchingPlugins(const std::string& packerName, const std::
 	for (const auto& plugin : matchedPlugins)
 	{
 		// Non case-sensitive regular expressions to match against packerVersion
-		std::regex versionRegex(plugin->getInfo()->packerVersion, std::regex::icase);
-		if (std::regex_search(packerVersion, versionRegex))
+		if (std::regex_search(packerVersion, versionRegex(plugin)))
 			result.push_back(plugin);
 	}
 
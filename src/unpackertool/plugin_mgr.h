@@ -10,6 +10,7 @@
 #include <cctype>
 #include <map>
 #include <memory>
+#include <regex>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,8 @@ public:
 
 private:
 	PluginMgr() = default;
+
+	static const std::regex& versionRegex(const Plugin* plugin);
 };
 
 } // namespace unpackertool
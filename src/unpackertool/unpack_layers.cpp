@@ -0,0 +1,72 @@
+/**
+ * @file src/unpackertool/unpack_layers.cpp
+ * @brief Unpacking of all layers of a packed file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <iostream>
+
+#include "unpack_layers.h"
+
+namespace retdec {
+namespace unpackertool {
+
+/**
+ * Unpack all layers of the packed file. The unpacked image is detected again
+ * after every successful unpacking until no plugin matches it.
+ *
+ * @param inputFile The packed file.
+ * @param outputFile The file where the image without all the unpacked layers is stored.
+ * @param detectPackers Detection of packers of one layer.
+ * @param unpackLayer Unpacking of one layer.
+ *
+ * @return Exit code of unpacking of the first layer if nothing was unpacked,
+ * EXIT_CODE_OK otherwise.
+ */
+ExitCode unpackLayers(const std::string& inputFile, const std::string& outputFile,
+		const PackerDetector& detectPackers, const LayerUnpacker& unpackLayer)
+{
+	const std::string layerFile = outputFile + ".tmp";
+	std::string currentFile = inputFile;
+
+	std::size_t unpackedLayers = 0;
+	ExitCode ret = EXIT_CODE_NOTHING_TO_DO;
+	while (unpackedLayers < MAX_UNPACKED_LAYERS)
+	{
+		std::vector<retdec::cpdetect::DetectResult> detectedPackers;
+		if (!detectPackers(currentFile, detectedPackers))
+		{
+			ret = EXIT_CODE_PREPROCESSING_ERROR;
+			break;
+		}
+
+		// Plugins must not write into the file they are reading, so every
+		// layer is unpacked into a temporary file first.
+		ret = unpackLayer(currentFile, layerFile, detectedPackers);
+		if (ret != EXIT_CODE_OK)
+			break;
+
+		std::remove(outputFile.c_str());
+		if (std::rename(layerFile.c_str(), outputFile.c_str()) != 0)
+		{
+			std::cerr << "Unable to create output file '" << outputFile << "'!" << std::endl;
+			ret = EXIT_CODE_UNPACKING_FAILED;
+			break;
+		}
+
+		currentFile = outputFile;
+		++unpackedLayers;
+	}
+
+	// Remove the leftovers of the failed unpacking (if any).
+	std::remove(layerFile.c_str());
+
+	if (unpackedLayers > 1)
+		std::cout << "Unpacked " << unpackedLayers << " layers of '" << inputFile << "'." << std::endl;
+
+	return unpackedLayers ? EXIT_CODE_OK : ret;
+}
+
+} // namespace unpackertool
+} // namespace retdec
@@ -0,0 +1,49 @@
+/**
+ * @file src/unpackertool/unpack_layers.h
+ * @brief Unpacking of all layers of a packed file.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef UNPACKERTOOL_UNPACK_LAYERS_H
+#define UNPACKERTOOL_UNPACK_LAYERS_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "retdec/cpdetect/cptypes.h"
+
+namespace retdec {
+namespace unpackertool {
+
+/**
+ * Possible exit codes of the unpacker as program.
+ */
+enum ExitCode
+{
+	EXIT_CODE_OK = 0, ///< Unpacker ended successfully.
+	EXIT_CODE_NOTHING_TO_DO, ///< There was not found matching plugin.
+	EXIT_CODE_UNPACKING_FAILED, ///< At least one plugin failed at the unpacking of the file.
+	EXIT_CODE_PREPROCESSING_ERROR ///< Error with preprocessing of input file before unpacking.
+};
+
+/**
+ * Maximal number of layers unpacked from one file. Protects against samples
+ * which unpack into themselves.
+ */
+const std::size_t MAX_UNPACKED_LAYERS = 32;
+
+/// Detects packers of the given file. Returns @c false if the file cannot be processed.
+using PackerDetector = std::function<bool(const std::string&, std::vector<retdec::cpdetect::DetectResult>&)>;
+
+/// Unpacks one layer of the input file with the detected packers into the output file.
+using LayerUnpacker = std::function<ExitCode(const std::string&, const std::string&, const std::vector<retdec::cpdetect::DetectResult>&)>;
+
+ExitCode unpackLayers(const std::string& inputFile, const std::string& outputFile,
+		const PackerDetector& detectPackers, const LayerUnpacker& unpackLayer);
+
+} // namespace unpackertool
+} // namespace retdec
+
+#endif
@@ -13,28 +13,20 @@
 #include "arg_handler.h"
 #include "retdec/unpacker/plugin.h"
 #include "plugin_mgr.h"
+#include "unpack_layers.h"
 
 using namespace retdec::utils;
 using namespace retdec::unpacker;
 using namespace retdec::unpackertool;
 
-/**
- * Possible exit codes of the unpacker as program.
- */
-enum ExitCode
-{
-	EXIT_CODE_OK = 0, ///< Unpacker ended successfully.
-	EXIT_CODE_NOTHING_TO_DO, ///< There was not found matching plugin.
-	EXIT_CODE_UNPACKING_FAILED, ///< At least one plugin failed at the unpacking of the file.
-	EXIT_CODE_PREPROCESSING_ERROR ///< Error with preprocessing of input file before unpacking.
-};
-
 bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
 {
 	using namespace retdec::cpdetect;
 	using namespace retdec::fileformat;
 
 	DetectParams detectionParams(SearchType::MOST_SIMILAR, true, true);
+	// Only packers are needed to choose a plugin.
+	detectionParams.packersOnly = true;
 
 	ToolInformation toolInfo;
 	switch (detectFileFormat(inputFile))
@@ -138,12 +130,12 @@ ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 	{
 		std::string inputFile = handler.getRawInputs()[0];
 		std::string outputFile = handler["output"]->used ? handler["output"]->input : std::string{inputFile}.append("-unpacked");
-		std::vector<retdec::cpdetect::DetectResult> detectedPackers;
-
-		if (!detectPackers(inputFile, detectedPackers))
-			return EXIT_CODE_PREPROCESSING_ERROR;
-
-		return unpackFile(inputFile, outputFile, brute, detectedPackers);
+		return unpackLayers(inputFile, outputFile, detectPackers,
+				[brute](const std::string& layerInput, const std::string& layerOutput,
+						const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+				{
+					return unpackFile(layerInput, layerOutput, brute, detectedPackers);
+				});
 	}
 	// Nothing else, just print the help
 	else
@@ -171,6 +163,7 @@ int main(int argc, char** argv)
 			"\n"
 			"Unpacking group:\n"
 			"   PACKED_FILE            Specifies the packed file, which is needed to be unpacked.\n"
+			"                          All the layers of the file are unpacked.\n"
 			"   -o|--output FILE       Optional. Specifies the output file of unpacking as FILE.\n"
 			"                          Default value is 'PACKED_FILE-unpacked'.\n"
 			"\n"
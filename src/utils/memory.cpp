@@ -4,16 +4,24 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
 #include "retdec/utils/memory.h"
 #include "retdec/utils/os.h"
 
 #ifdef OS_WINDOWS
 	#include <windows.h>
+	#include <psapi.h>
 #elif defined(OS_MACOS)
 	#include <sys/types.h>
 	#include <sys/sysctl.h>
+	#include <mach/mach.h>
 #else
 	#include <sys/sysinfo.h>
+	#include <unistd.h>
 #endif
 
 #ifdef OS_POSIX
@@ -25,6 +33,51 @@ namespace utils {
 
 namespace {
 
+/// Fraction of the memory budget from which optional caches are dropped.
+const double DROP_CACHES_THRESHOLD = 0.70;
+
+/// Fraction of the memory budget from which optional phases are skipped.
+const double SKIP_OPTIONAL_THRESHOLD = 0.85;
+
+/// Fraction of the memory budget from which the partial result is emitted.
+const double EMIT_PARTIAL_THRESHOLD = 0.95;
+
+/// Memory budget (in bytes), @c 0 means no budget.
+std::atomic<std::size_t> budgetLimit(0);
+
+/// The highest stage of the memory budget reached so far.
+std::atomic<int> budgetStage(static_cast<int>(MemoryBudget::Stage::Normal));
+
+/// Custom sampler of the memory usage (if any).
+MemoryBudget::UsageSampler budgetSampler;
+
+/// Mutex guarding @c budgetSampler.
+std::mutex budgetSamplerMutex;
+
+/**
+* @brief Returns the stage corresponding to the given memory usage.
+*/
+MemoryBudget::Stage computeStage(std::size_t usage, std::size_t limit) {
+	auto fraction = static_cast<double>(usage) / limit;
+	if (fraction >= EMIT_PARTIAL_THRESHOLD) {
+		return MemoryBudget::Stage::EmitPartial;
+	} else if (fraction >= SKIP_OPTIONAL_THRESHOLD) {
+		return MemoryBudget::Stage::SkipOptional;
+	} else if (fraction >= DROP_CACHES_THRESHOLD) {
+		return MemoryBudget::Stage::DropCaches;
+	}
+	return MemoryBudget::Stage::Normal;
+}
+
+/**
+* @brief Returns the current memory usage, either from the custom sampler or
+*        from the system.
+*/
+std::size_t sampleMemoryUsage() {
+	std::lock_guard<std::mutex> lock(budgetSamplerMutex);
+	return budgetSampler ? budgetSampler() : getMemoryUsage();
+}
+
 #ifdef OS_POSIX
 
 /**
@@ -53,6 +106,20 @@ std::size_t getTotalSystemMemoryOnWindows() {
 	return succeeded ? memoryStatus.ullTotalPhys : 0;
 }
 
+/**
+* @brief Implementation of @c getMemoryUsage() on Windows.
+*/
+std::size_t getMemoryUsageOnWindows() {
+	// The limit of a job applies to the committed memory, so return it.
+	PROCESS_MEMORY_COUNTERS_EX counters;
+	bool succeeded = GetProcessMemoryInfo(
+		GetCurrentProcess(),
+		reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters),
+		sizeof(counters)
+	);
+	return succeeded ? counters.PrivateUsage : 0;
+}
+
 /**
 * @brief Assigns the current process into a new job and returns a handle to
 *     that job.
@@ -109,6 +176,20 @@ std::size_t getTotalSystemMemoryOnMacOS() {
 	return rc != -1 ? value : 0;
 }
 
+/**
+* @brief Implementation of @c getMemoryUsage() on MacOS.
+*/
+std::size_t getMemoryUsageOnMacOS() {
+	// Return the resident set size. Unlike on Linux, the size of the address
+	// space is not used because MacOS does not enforce RLIMIT_AS and the
+	// address space includes the large shared region of system libraries.
+	mach_task_basic_info info;
+	mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+	auto rc = task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+		reinterpret_cast<task_info_t>(&info), &count);
+	return rc == KERN_SUCCESS ? info.resident_size : 0;
+}
+
 /**
 * @brief Implementation of @c limitSystemMemory() on MacOS.
 */
@@ -127,6 +208,23 @@ std::size_t getTotalSystemMemoryOnLinux() {
     return rc == 0 ? system_info.totalram : 0;
 }
 
+/**
+* @brief Implementation of @c getMemoryUsage() on Linux.
+*/
+std::size_t getMemoryUsageOnLinux() {
+	// Return the size of the address space because it is what the kernel
+	// checks against the limit set by limitSystemMemory() (RLIMIT_AS). The
+	// resident set size may be much smaller, so the budget stages would not be
+	// reached before the limit is hit. The size of the address space is the
+	// first field in /proc/self/statm (in pages).
+	std::ifstream statm("/proc/self/statm");
+	std::size_t size = 0;
+	if (!(statm >> size)) {
+		return 0;
+	}
+	return size * sysconf(_SC_PAGESIZE);
+}
+
 /**
 * @brief Implementation of @c limitSystemMemory() on Linux.
 */
@@ -153,6 +251,24 @@ std::size_t getTotalSystemMemory() {
 #endif
 }
 
+/**
+* @brief Returns the current memory usage of the process (in bytes).
+*
+* It is the metric limited by @c limitSystemMemory(): the size of the address
+* space on Linux and the size of the committed memory on Windows. On MacOS,
+* which does not enforce the limit, it is the resident set size. When the usage
+* cannot be obtained, it returns @c 0.
+*/
+std::size_t getMemoryUsage() {
+#ifdef OS_WINDOWS
+	return getMemoryUsageOnWindows();
+#elif defined(OS_MACOS)
+	return getMemoryUsageOnMacOS();
+#else
+	return getMemoryUsageOnLinux();
+#endif
+}
+
 /**
 * @brief Limits system memory to the given size (in bytes).
 *
@@ -189,5 +305,94 @@ bool limitSystemMemoryToHalfOfTotalSystemMemory() {
 	return limitSystemMemory(totalSize / 2);
 }
 
+/**
+* @brief Sets the memory budget to the given size (in bytes).
+*
+* When @a limit is @c 0, there is no budget. Setting the budget does not limit
+* the memory by itself; use @c limitSystemMemory() for that.
+*/
+void MemoryBudget::setLimit(std::size_t limit) {
+	budgetLimit = limit;
+}
+
+/**
+* @brief Returns the memory budget (in bytes), @c 0 if there is no budget.
+*/
+std::size_t MemoryBudget::getLimit() {
+	return budgetLimit;
+}
+
+/**
+* @brief Returns @c true if a memory budget has been set, @c false otherwise.
+*/
+bool MemoryBudget::isLimited() {
+	return getLimit() > 0;
+}
+
+/**
+* @brief Sets a custom sampler of the memory usage.
+*
+* By default, the usage is obtained by @c getMemoryUsage(). An empty @a
+* sampler restores the default.
+*/
+void MemoryBudget::setUsageSampler(UsageSampler sampler) {
+	std::lock_guard<std::mutex> lock(budgetSamplerMutex);
+	budgetSampler = std::move(sampler);
+}
+
+/**
+* @brief Removes the budget, the custom sampler, and resets the stage to
+*        Stage::Normal.
+*/
+void MemoryBudget::reset() {
+	setLimit(0);
+	setUsageSampler(UsageSampler());
+	budgetStage = static_cast<int>(Stage::Normal);
+}
+
+/**
+* @brief Samples the memory usage and returns the current stage.
+*
+* This function is thread safe. It reads the memory usage of the process, so
+* it should not be called in tight loops.
+*/
+MemoryBudget::Stage MemoryBudget::getStage() {
+	auto limit = getLimit();
+	if (limit == 0) {
+		return Stage::Normal;
+	}
+
+	auto stage = static_cast<int>(computeStage(sampleMemoryUsage(), limit));
+	auto reached = budgetStage.load();
+	while (stage > reached && !budgetStage.compare_exchange_weak(reached, stage)) {
+		// The stage has been changed by another thread, try again.
+	}
+	return static_cast<Stage>(std::max(stage, reached));
+}
+
+/**
+* @brief Returns @c true if optional caches should be dropped, @c false
+*        otherwise.
+*/
+bool MemoryBudget::shouldDropCaches() {
+	return getStage() >= Stage::DropCaches;
+}
+
+/**
+* @brief Returns @c true if optional phases should be skipped, @c false
+*        otherwise.
+*/
+bool MemoryBudget::shouldSkipOptionalPhases() {
+	return getStage() >= Stage::SkipOptional;
+}
+
+/**
+* @brief Returns @c true if the result obtained so far should be emitted
+*        without running further phases, @c false otherwise.
+*/
+bool MemoryBudget::shouldEmitPartialResult() {
+	return getStage() >= Stage::EmitPartial;
+}
+
 } // namespace utils
 } // namespace retdec
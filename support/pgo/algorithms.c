@@ -0,0 +1,79 @@
+/*
+ * Loops, arrays, recursion, and string handling.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void bubble_sort(int *a, int n)
+{
+	for (int i = 0; i < n - 1; ++i) {
+		for (int j = 0; j < n - i - 1; ++j) {
+			if (a[j] > a[j + 1]) {
+				int tmp = a[j];
+				a[j] = a[j + 1];
+				a[j + 1] = tmp;
+			}
+		}
+	}
+}
+
+static int binary_search(const int *a, int n, int key)
+{
+	int lo = 0;
+	int hi = n - 1;
+	while (lo <= hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (a[mid] == key) {
+			return mid;
+		} else if (a[mid] < key) {
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+	return -1;
+}
+
+static unsigned fib(unsigned n)
+{
+	return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+static unsigned hash_string(const char *s)
+{
+	unsigned h = 5381;
+	while (*s) {
+		h = h * 33 + (unsigned char)*s++;
+	}
+	return h;
+}
+
+static void reverse(char *s)
+{
+	size_t len = strlen(s);
+	for (size_t i = 0; i < len / 2; ++i) {
+		char tmp = s[i];
+		s[i] = s[len - i - 1];
+		s[len - i - 1] = tmp;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	int a[16];
+	for (int i = 0; i < 16; ++i) {
+		a[i] = rand() % 100;
+	}
+	bubble_sort(a, 16);
+	printf("index: %d\n", binary_search(a, 16, argc));
+	printf("fib: %u\n", fib((unsigned)argc + 10));
+
+	char buf[64];
+	strncpy(buf, argv[0], sizeof(buf) - 1);
+	buf[sizeof(buf) - 1] = '\0';
+	reverse(buf);
+	printf("%s %u\n", buf, hash_string(buf));
+	return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Switches, state machines, function pointers, and bit manipulation.
+ */
+
+#include <stdio.h>
+
+enum state { START, NUMBER, WORD, OTHER };
+
+static int count_tokens(const char *s)
+{
+	enum state st = START;
+	int tokens = 0;
+	for (; *s; ++s) {
+		enum state next;
+		if (*s >= '0' && *s <= '9') {
+			next = NUMBER;
+		} else if ((*s >= 'a' && *s <= 'z') || (*s >= 'A' && *s <= 'Z')) {
+			next = WORD;
+		} else {
+			next = OTHER;
+		}
+		if (next != st && next != OTHER) {
+			++tokens;
+		}
+		st = next;
+	}
+	return tokens;
+}
+
+static const char *day_name(int day)
+{
+	switch (day) {
+		case 0: return "Monday";
+		case 1: return "Tuesday";
+		case 2: return "Wednesday";
+		case 3: return "Thursday";
+		case 4: return "Friday";
+		case 5: return "Saturday";
+		case 6: return "Sunday";
+		default: return "unknown";
+	}
+}
+
+static unsigned popcount(unsigned x)
+{
+	unsigned c = 0;
+	while (x) {
+		x &= x - 1;
+		++c;
+	}
+	return c;
+}
+
+static unsigned rotl(unsigned x, unsigned n)
+{
+	return (x << (n & 31)) | (x >> ((32 - n) & 31));
+}
+
+static int add(int a, int b) { return a + b; }
+static int sub(int a, int b) { return a - b; }
+static int mul(int a, int b) { return a * b; }
+
+int main(int argc, char **argv)
+{
+	int (*ops[])(int, int) = {add, sub, mul};
+	int acc = argc;
+	for (int i = 0; i < 9; ++i) {
+		acc = ops[i % 3](acc, i + 1);
+	}
+	printf("%d %s\n", acc, day_name(acc % 8));
+	printf("%u %u\n", popcount((unsigned)acc), rotl((unsigned)acc, 7));
+	printf("tokens: %d\n", count_tokens(argv[0]));
+	return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Structures, pointers, dynamic memory, and floating-point arithmetic.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+struct node {
+	int key;
+	double value;
+	struct node *left;
+	struct node *right;
+};
+
+static struct node *insert(struct node *root, int key, double value)
+{
+	if (root == NULL) {
+		struct node *n = malloc(sizeof(*n));
+		if (n == NULL) {
+			exit(1);
+		}
+		n->key = key;
+		n->value = value;
+		n->left = n->right = NULL;
+		return n;
+	}
+	if (key < root->key) {
+		root->left = insert(root->left, key, value);
+	} else {
+		root->right = insert(root->right, key, value);
+	}
+	return root;
+}
+
+static double sum(const struct node *root)
+{
+	return root ? root->value + sum(root->left) + sum(root->right) : 0.0;
+}
+
+static void destroy(struct node *root)
+{
+	if (root) {
+		destroy(root->left);
+		destroy(root->right);
+		free(root);
+	}
+}
+
+static double norm(const double *v, int n)
+{
+	double s = 0.0;
+	for (int i = 0; i < n; ++i) {
+		s += v[i] * v[i];
+	}
+	return sqrt(s);
+}
+
+int main(int argc, char **argv)
+{
+	struct node *root = NULL;
+	for (int i = 0; i < 32; ++i) {
+		root = insert(root, rand() % 1000, i / 3.0);
+	}
+	printf("sum: %f\n", sum(root));
+	destroy(root);
+
+	double v[3] = {argc, 2.5, -1.25};
+	printf("norm: %f\n", norm(v, 3));
+	return argv[0] == NULL;
+}
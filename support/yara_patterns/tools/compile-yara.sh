@@ -21,15 +21,34 @@ printErrorAndDie()
 #     $2 - output file
 compileFiles()
 {
-	ERR_OUT="$("$CC" -w "$1"/*.yara "$2" 2>&1)"
+	compileRules "$2" "$1"/*.yara
+
+	# Packer rules are also compiled alone for packer-only detection
+	# (used by the unpacker), stored as e.g. pe/packers/x86.yarac. They are
+	# kept in a subdirectory so that they are not loaded together with the
+	# full databases (e.g. for fat Mach-O files).
+	if [ -f "$1/packers.yara" ]; then
+		compileRules "$(dirname "$2")/packers/$(basename "$2")" "$1/packers.yara"
+	fi
+}
+
+# Compile yara rules.
+#     $1 - output file
+#     $2... - input files
+compileRules()
+{
+	OUT_FILE="$1"
+	shift
+
+	ERR_OUT="$("$CC" -w "$@" "$OUT_FILE" 2>&1)"
 	if [ $? -ne 0 ]; then
-		printErrorAndDie "yarac failed during compilation of file $1"
+		printErrorAndDie "yarac failed during compilation of file $OUT_FILE"
 	fi
 
 	# Check for errors in output - yarac returns 0 when it should not.
 	case "$ERR_OUT" in
 		*error*)
-			printErrorAndDie "yarac failed during compilation of file $1"
+			printErrorAndDie "yarac failed during compilation of file $OUT_FILE"
 			;;
 	esac
 }
@@ -72,9 +91,9 @@ OUT="$OUT/share/retdec/support/generic/yara_patterns/tools"
 rm -rf "$OUT"
 
 # Prepare directory structure.
-mkdir -p "$OUT/pe"
-mkdir -p "$OUT/elf"
-mkdir -p "$OUT/macho"
+mkdir -p "$OUT/pe/packers"
+mkdir -p "$OUT/elf/packers"
+mkdir -p "$OUT/macho/packers"
 
 ###############################################################################
 
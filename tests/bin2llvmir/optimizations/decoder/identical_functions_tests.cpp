@@ -0,0 +1,262 @@
+/**
+* @file tests/bin2llvmir/optimizations/decoder/identical_functions_tests.cpp
+* @brief Tests for the @c IdenticalFunctions folding.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/optimizations/decoder/identical_functions.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c IdenticalFunctions folding.
+ *
+ * Inputs look like the output of the decoder for a binary with known
+ * duplicates: the same code placed at different addresses, with LLVM to ASM
+ * mapping and control flow pseudo calls whose targets are absolute addresses.
+ */
+class IdenticalFunctionsTests: public LlvmIrTests
+{
+	protected:
+		Config createConfig()
+		{
+			auto c = Config::empty(module.get());
+			c.setLlvmToAsmGlobalVariable(getGlobalByName("pc"));
+			c.setLlvmCallPseudoFunction(getFunctionByName("__pseudo_call"));
+			c.setLlvmBranchPseudoFunction(getFunctionByName("__pseudo_branch"));
+			c.setLlvmCondBranchPseudoFunction(
+					getFunctionByName("__pseudo_cond_branch"));
+			return c;
+		}
+
+		void insertFunction(
+				Config& c,
+				const std::string& name,
+				retdec::utils::Address start,
+				retdec::utils::Address end)
+		{
+			c.insertFunction(getFunctionByName(name), start, end);
+		}
+};
+
+TEST_F(IdenticalFunctionsTests, duplicatesAreReplacedByStubsCallingCanonicalFunction)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		@pc = global i32 0
+		declare void @__pseudo_call(i32)
+		declare void @__pseudo_branch(i32)
+		declare void @__pseudo_cond_branch(i1, i32)
+		define i32 @fnc1() {
+			store volatile i32 4096, i32* @pc
+			%a = load i32, i32* @eax
+			%b = add i32 %a, 1
+			store i32 %b, i32* @eax
+			store volatile i32 4099, i32* @pc
+			%c = icmp eq i32 %b, 0
+			call void @__pseudo_cond_branch(i1 %c, i32 4096)
+			store volatile i32 4101, i32* @pc
+			call void @__pseudo_call(i32 12288)
+			ret i32 0
+		}
+		define i32 @fnc2() {
+			store volatile i32 8192, i32* @pc
+			%a = load i32, i32* @eax
+			%b = add i32 %a, 1
+			store i32 %b, i32* @eax
+			store volatile i32 8195, i32* @pc
+			%c = icmp eq i32 %b, 0
+			call void @__pseudo_cond_branch(i1 %c, i32 8192)
+			store volatile i32 8197, i32* @pc
+			call void @__pseudo_call(i32 12288)
+			ret i32 0
+		}
+		define i32 @fnc3() {
+			store volatile i32 12288, i32* @pc
+			ret i32 0
+		}
+	)");
+	auto c = createConfig();
+	insertFunction(c, "fnc1", 0x1000, 0x1005);
+	insertFunction(c, "fnc2", 0x2000, 0x2005);
+	insertFunction(c, "fnc3", 0x3000, 0x3000);
+
+	auto folded = IdenticalFunctions(module.get(), &c).fold();
+
+	std::string exp = R"(
+		@eax = global i32 0
+		@pc = global i32 0
+		declare void @__pseudo_call(i32)
+		declare void @__pseudo_branch(i32)
+		declare void @__pseudo_cond_branch(i1, i32)
+		define i32 @fnc1() {
+			store volatile i32 4096, i32* @pc
+			%a = load i32, i32* @eax
+			%b = add i32 %a, 1
+			store i32 %b, i32* @eax
+			store volatile i32 4099, i32* @pc
+			%c = icmp eq i32 %b, 0
+			call void @__pseudo_cond_branch(i1 %c, i32 4096)
+			store volatile i32 4101, i32* @pc
+			call void @__pseudo_call(i32 12288)
+			ret i32 0
+		}
+		define i32 @fnc2() {
+		entry:
+			store volatile i32 8192, i32* @pc
+			%0 = call i32 @fnc1()
+			ret i32 %0
+		}
+		define i32 @fnc3() {
+			store volatile i32 12288, i32* @pc
+			ret i32 0
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_EQ(1, folded);
+	EXPECT_EQ("fnc1", c.getConfigFunction(0x2000)->getAliasedFunctionName());
+	EXPECT_FALSE(c.getConfigFunction(0x1000)->isAlias());
+	EXPECT_FALSE(c.getConfigFunction(0x3000)->isAlias());
+}
+
+TEST_F(IdenticalFunctionsTests, functionsUsingDifferentDataAreNotFolded)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		@pc = global i32 0
+		declare void @__pseudo_call(i32)
+		declare void @__pseudo_branch(i32)
+		declare void @__pseudo_cond_branch(i1, i32)
+		define i32 @fnc1() {
+			store volatile i32 4096, i32* @pc
+			%a = inttoptr i32 20480 to i32*
+			%b = load i32, i32* %a
+			store i32 %b, i32* @eax
+			ret i32 0
+		}
+		define i32 @fnc2() {
+			store volatile i32 8192, i32* @pc
+			%a = inttoptr i32 20484 to i32*
+			%b = load i32, i32* %a
+			store i32 %b, i32* @eax
+			ret i32 0
+		}
+	)");
+	auto c = createConfig();
+	insertFunction(c, "fnc1", 0x1000, 0x1005);
+	insertFunction(c, "fnc2", 0x2000, 0x2005);
+
+	auto folded = IdenticalFunctions(module.get(), &c).fold();
+
+	EXPECT_EQ(0, folded);
+	EXPECT_FALSE(getFunctionByName("fnc2")->isDeclaration());
+	EXPECT_FALSE(c.getConfigFunction(0x2000)->isAlias());
+}
+
+TEST_F(IdenticalFunctionsTests, functionEnteredFromOtherFunctionInsideItsBodyIsNotFolded)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		@pc = global i32 0
+		declare void @__pseudo_call(i32)
+		declare void @__pseudo_branch(i32)
+		declare void @__pseudo_cond_branch(i1, i32)
+		define i32 @fnc1() {
+			store volatile i32 4096, i32* @pc
+			store i32 1, i32* @eax
+			store volatile i32 4101, i32* @pc
+			ret i32 0
+		}
+		define i32 @fnc2() {
+			store volatile i32 8192, i32* @pc
+			store i32 1, i32* @eax
+			store volatile i32 8197, i32* @pc
+			ret i32 0
+		}
+		define i32 @fnc3() {
+			store volatile i32 12288, i32* @pc
+			call void @__pseudo_branch(i32 8197)
+			ret i32 0
+		}
+	)");
+	auto c = createConfig();
+	insertFunction(c, "fnc1", 0x1000, 0x1005);
+	insertFunction(c, "fnc2", 0x2000, 0x2005);
+	insertFunction(c, "fnc3", 0x3000, 0x3004);
+
+	auto folded = IdenticalFunctions(module.get(), &c).fold();
+
+	EXPECT_EQ(0, folded);
+	EXPECT_FALSE(c.getConfigFunction(0x2000)->isAlias());
+}
+
+TEST_F(IdenticalFunctionsTests, functionsWithoutConfigAreNotFolded)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		@pc = global i32 0
+		declare void @__pseudo_call(i32)
+		declare void @__pseudo_branch(i32)
+		declare void @__pseudo_cond_branch(i1, i32)
+		define i32 @fnc1() {
+			store i32 1, i32* @eax
+			ret i32 0
+		}
+		define i32 @fnc2() {
+			store i32 1, i32* @eax
+			ret i32 0
+		}
+	)");
+	auto c = createConfig();
+
+	auto folded = IdenticalFunctions(module.get(), &c).fold();
+
+	EXPECT_EQ(0, folded);
+}
+
+TEST_F(IdenticalFunctionsTests, syscallSitesOfDuplicatesAreRemoved)
+{
+	parseInput(R"(
+		@eax = global i32 0
+		@pc = global i32 0
+		declare void @__pseudo_call(i32)
+		declare void @__pseudo_branch(i32)
+		declare void @__pseudo_cond_branch(i1, i32)
+		define i32 @fnc1() {
+			store volatile i32 4096, i32* @pc
+			store i32 1, i32* @eax
+			store volatile i32 4101, i32* @pc
+			ret i32 0
+		}
+		define i32 @fnc2() {
+			store volatile i32 8192, i32* @pc
+			store i32 1, i32* @eax
+			store volatile i32 8197, i32* @pc
+			ret i32 0
+		}
+	)");
+	auto c = createConfig();
+	insertFunction(c, "fnc1", 0x1000, 0x1005);
+	insertFunction(c, "fnc2", 0x2000, 0x2005);
+	SyscallSites sites;
+	sites.addSite(0x1005, 1);
+	sites.addSite(0x2005, 1);
+
+	auto folded = IdenticalFunctions(module.get(), &c, &sites).fold();
+
+	EXPECT_EQ(1, folded);
+	ASSERT_EQ(1, sites.size());
+	EXPECT_EQ(0x1005, sites.getSites().begin()->first);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
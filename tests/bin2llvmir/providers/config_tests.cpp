@@ -394,6 +394,37 @@ TEST_F(ConfigTests, isRegisterReturnFalseForAllOtherObjects)
 	EXPECT_FALSE(config.isRegister(a2));
 }
 
+TEST_F(ConfigTests, isRegisterReflectsRegistersInsertedAfterQuery)
+{
+	parseInput(R"(
+		@r = global i32 0
+	)");
+	auto config = Config::empty(module.get());
+	Value* v = getValueByName("r");
+	EXPECT_FALSE(config.isRegister(v));
+
+	auto s = retdec::config::Storage::inRegister("r");
+	config.getConfig().registers.insert(retdec::config::Object("r", s));
+
+	EXPECT_TRUE(config.isRegister(v));
+}
+
+TEST_F(ConfigTests, isRegisterReflectsRenamedValues)
+{
+	parseInput(R"(
+		@r = global i32 0
+	)");
+	auto s = retdec::config::Storage::inRegister("r");
+	auto config = Config::empty(module.get());
+	config.getConfig().registers.insert(retdec::config::Object("r", s));
+	Value* v = getValueByName("r");
+	EXPECT_TRUE(config.isRegister(v));
+
+	v->setName("gv");
+
+	EXPECT_FALSE(config.isRegister(v));
+}
+
 //
 // isFlagRegister()
 //
@@ -853,6 +884,69 @@ TEST_F(ConfigTests, getLlvmStackVariableReturnsNullptrWhenStackVariableNotFound)
 	EXPECT_EQ(nullptr, sv2);
 }
 
+TEST_F(ConfigTests, getLlvmStackVariableReturnsStackVariableWithLowestName)
+{
+	parseInput(R"(
+		define void @fnc() {
+			%stack_b = alloca i32
+			%stack_a = alloca i32
+			ret void
+		}
+	)");
+	auto* llvmFnc = getFunctionByName("fnc");
+	auto* llvmSv = getValueByName("stack_a");
+	auto config = Config::empty(module.get());
+	auto s = retdec::config::Storage::onStack(8);
+	auto cf = retdec::config::Function("fnc");
+	cf.locals.insert(retdec::config::Object("stack_b", s));
+	cf.locals.insert(retdec::config::Object("stack_a", s));
+	config.getConfig().functions.insert(cf);
+
+	EXPECT_EQ(llvmSv, config.getLlvmStackVariable(llvmFnc, 8));
+}
+
+TEST_F(ConfigTests, getLlvmStackVariableDoesNotReturnErasedStackVariable)
+{
+	parseInput(R"(
+		define void @fnc() {
+			%stack = alloca i32
+			ret void
+		}
+	)");
+	auto* llvmFnc = getFunctionByName("fnc");
+	auto* llvmSv = cast<AllocaInst>(getValueByName("stack"));
+	auto config = Config::empty(module.get());
+	auto s = retdec::config::Storage::onStack(8);
+	auto cf = retdec::config::Function("fnc");
+	cf.locals.insert(retdec::config::Object("stack", s));
+	config.getConfig().functions.insert(cf);
+	EXPECT_EQ(llvmSv, config.getLlvmStackVariable(llvmFnc, 8));
+
+	llvmSv->eraseFromParent();
+
+	EXPECT_EQ(nullptr, config.getLlvmStackVariable(llvmFnc, 8));
+}
+
+TEST_F(ConfigTests, getLlvmStackVariableFindsStackVariableInsertedAfterQuery)
+{
+	parseInput(R"(
+		define void @fnc() {
+			%stack = alloca i32
+			ret void
+		}
+	)");
+	auto* llvmFnc = getFunctionByName("fnc");
+	auto* llvmSv = cast<AllocaInst>(getValueByName("stack"));
+	auto config = Config::empty(module.get());
+	config.insertFunction(llvmFnc);
+	EXPECT_EQ(nullptr, config.getLlvmStackVariable(llvmFnc, 8));
+
+	config.insertStackVariable(llvmSv, 8);
+
+	EXPECT_EQ(llvmSv, config.getLlvmStackVariable(llvmFnc, 8));
+	EXPECT_TRUE(config.isStackVariable(llvmSv));
+}
+
 //
 // getStackVariableOffset()
 //
@@ -1050,10 +1144,10 @@ class ConfigProviderTests: public LlvmIrTests
 
 TEST_F(ConfigProviderTests, addConfigJsonStringAddsConfigForModule)
 {
-	auto* r1 = ConfigProvider::addConfigJsonString(module.get(), "{}");
-	auto* r2 = ConfigProvider::getConfig(module.get());
+	auto* r1 = providers.configs.addConfigJsonString(module.get(), "{}");
+	auto* r2 = providers.configs.getConfig(module.get());
 	Config* r3 = nullptr;
-	bool b = ConfigProvider::getConfig(module.get(), r3);
+	bool b = providers.configs.getConfig(module.get(), r3);
 
 	EXPECT_NE(nullptr, r1);
 	EXPECT_EQ(r1, r2);
@@ -1063,17 +1157,17 @@ TEST_F(ConfigProviderTests, addConfigJsonStringAddsConfigForModule)
 
 TEST_F(ConfigProviderTests, addConfigFileThrowsExceptionWhenBadPathProvided)
 {
-	ASSERT_ANY_THROW(ConfigProvider::addConfigFile(module.get(), "/this/is/a/bad/path"));
+	ASSERT_ANY_THROW(providers.configs.addConfigFile(module.get(), "/this/is/a/bad/path"));
 }
 
 TEST_F(ConfigProviderTests, clearRemovesAllData)
 {
-	ConfigProvider::addConfigJsonString(module.get(), "{}");
-	auto* r1 = ConfigProvider::getConfig(module.get());
+	providers.configs.addConfigJsonString(module.get(), "{}");
+	auto* r1 = providers.configs.getConfig(module.get());
 	EXPECT_NE(nullptr, r1);
 
-	ConfigProvider::clear();
-	auto* r2 = ConfigProvider::getConfig(module.get());
+	providers.configs.clear();
+	auto* r2 = providers.configs.getConfig(module.get());
 	EXPECT_EQ(nullptr, r2);
 }
 
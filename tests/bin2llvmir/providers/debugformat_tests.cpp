@@ -42,15 +42,15 @@ TEST_F(DebugFormatProviderTests, addDebugFormatAddsDebugFormatForModule)
 	{
 		throw std::runtime_error("failed to load RawDataImage");
 	}
-	auto* r1 = DebugFormatProvider::addDebugFormat(
+	auto* r1 = providers.debugFormats.addDebugFormat(
 			module.get(),
 			image.get(),
 			"",
 			0x0,
 			nullptr);
-	auto* r2 = DebugFormatProvider::getDebugFormat(module.get());
+	auto* r2 = providers.debugFormats.getDebugFormat(module.get());
 	DebugFormat* r3 = nullptr;
-	bool b = DebugFormatProvider::getDebugFormat(module.get(), r3);
+	bool b = providers.debugFormats.getDebugFormat(module.get(), r3);
 
 	EXPECT_NE(nullptr, r1);
 	EXPECT_EQ(r1, r2);
@@ -60,7 +60,7 @@ TEST_F(DebugFormatProviderTests, addDebugFormatAddsDebugFormatForModule)
 
 TEST_F(DebugFormatProviderTests, addDebugFormatReturnNullptrIfFileImageNotProvided)
 {
-	auto* r1 = DebugFormatProvider::addDebugFormat(
+	auto* r1 = providers.debugFormats.addDebugFormat(
 			module.get(),
 			nullptr,
 			"",
@@ -84,17 +84,17 @@ TEST_F(DebugFormatProviderTests, clearRemovesAllData)
 	{
 		throw std::runtime_error("failed to load RawDataImage");
 	}
-	DebugFormatProvider::addDebugFormat(
+	providers.debugFormats.addDebugFormat(
 			module.get(),
 			image.get(),
 			"",
 			0x0,
 			nullptr);
-	auto* r1 = DebugFormatProvider::getDebugFormat(module.get());
+	auto* r1 = providers.debugFormats.getDebugFormat(module.get());
 	EXPECT_NE(nullptr, r1);
 
-	DebugFormatProvider::clear();
-	auto* r2 = DebugFormatProvider::getDebugFormat(module.get());
+	providers.debugFormats.clear();
+	auto* r2 = providers.debugFormats.getDebugFormat(module.get());
 	EXPECT_EQ(nullptr, r2);
 }
 
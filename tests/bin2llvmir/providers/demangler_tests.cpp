@@ -29,10 +29,10 @@ TEST_F(DemanglerProviderTests, addDemanglerAddsDemanglerForModule)
 	tool.setIsGcc();
 	retdec::config::ToolInfoContainer tools;
 	tools.insert(tool);
-	auto* r1 = DemanglerProvider::addDemangler(module.get(), tools);
-	auto* r2 = DemanglerProvider::getDemangler(module.get());
+	auto* r1 = providers.demanglers.addDemangler(module.get(), tools);
+	auto* r2 = providers.demanglers.getDemangler(module.get());
 	retdec::demangler::CDemangler* r3 = nullptr;
-	bool b = DemanglerProvider::getDemangler(module.get(), r3);
+	bool b = providers.demanglers.getDemangler(module.get(), r3);
 
 	EXPECT_NE(nullptr, r1);
 	EXPECT_EQ(r1, r2);
@@ -46,11 +46,11 @@ TEST_F(DemanglerProviderTests, getDemanglerReturnsNullptrForUnknownModule)
 	tool.setIsGcc();
 	retdec::config::ToolInfoContainer tools;
 	tools.insert(tool);
-	DemanglerProvider::addDemangler(module.get(), tools);
+	providers.demanglers.addDemangler(module.get(), tools);
 	parseInput(""); // creates a different module
-	auto* r1 = DemanglerProvider::getDemangler(module.get());
+	auto* r1 = providers.demanglers.getDemangler(module.get());
 	retdec::demangler::CDemangler* r2 = nullptr;
-	bool b = DemanglerProvider::getDemangler(module.get(), r2);
+	bool b = providers.demanglers.getDemangler(module.get(), r2);
 
 	EXPECT_EQ(nullptr, r1);
 	EXPECT_EQ(nullptr, r2);
@@ -69,7 +69,7 @@ TEST_F(DemanglerProviderTests, addedDemanglerWorks)
 		}
 	)");
 	Value* f = getValueByName("_ZN9wikipedia7article8print_toERSo");
-	auto* d = DemanglerProvider::addDemangler(module.get(), tools);
+	auto* d = providers.demanglers.addDemangler(module.get(), tools);
 	std::string name = d->demangleToString(f->getName());
 
 	EXPECT_EQ("wikipedia::article::print_to(std::ostream &)", name);
@@ -81,12 +81,12 @@ TEST_F(DemanglerProviderTests, clearRemovesAllData)
 	tool.setIsGcc();
 	retdec::config::ToolInfoContainer tools;
 	tools.insert(tool);
-	DemanglerProvider::addDemangler(module.get(), tools);
-	auto* r1 = DemanglerProvider::getDemangler(module.get());
+	providers.demanglers.addDemangler(module.get(), tools);
+	auto* r1 = providers.demanglers.getDemangler(module.get());
 	EXPECT_NE(nullptr, r1);
 
-	DemanglerProvider::clear();
-	auto* r2 = DemanglerProvider::getDemangler(module.get());
+	providers.demanglers.clear();
+	auto* r2 = providers.demanglers.getDemangler(module.get());
 	EXPECT_EQ(nullptr, r2);
 }
 
@@ -378,10 +378,10 @@ TEST_F(FileImageProviderTests, addFileImageAddsFileImageForModule)
 	}
 	std::shared_ptr<RawDataFormat> formatShared(std::move(format));
 	auto c = Config::empty(module.get());
-	auto* r1 = FileImageProvider::addFileImage(module.get(), formatShared, &c);
-	auto* r2 = FileImageProvider::getFileImage(module.get());
+	auto* r1 = providers.fileImages.addFileImage(module.get(), formatShared, &c);
+	auto* r2 = providers.fileImages.getFileImage(module.get());
 	FileImage* r3 = nullptr;
-	bool b = FileImageProvider::getFileImage(module.get(), r3);
+	bool b = providers.fileImages.getFileImage(module.get(), r3);
 
 	EXPECT_NE(nullptr, r1);
 	EXPECT_EQ(r1, r2);
@@ -397,7 +397,7 @@ TEST_F(FileImageProviderTests, addFileImageThrowsForModuleWhenBadPathProvided)
 {
 	std::string path = "/this/is/a/bad/path";
 	auto c = Config::empty(module.get());
-	ASSERT_ANY_THROW(FileImageProvider::addFileImage(module.get(), path, &c));
+	ASSERT_ANY_THROW(providers.fileImages.addFileImage(module.get(), path, &c));
 }
 
 TEST_F(FileImageProviderTests, clearRemovesAllData)
@@ -410,12 +410,12 @@ TEST_F(FileImageProviderTests, clearRemovesAllData)
 	}
 	std::shared_ptr<RawDataFormat> formatShared(std::move(format));
 	auto c = Config::empty(module.get());
-	FileImageProvider::addFileImage(module.get(), formatShared, &c);
-	auto* r1 = FileImageProvider::getFileImage(module.get());
+	providers.fileImages.addFileImage(module.get(), formatShared, &c);
+	auto* r1 = providers.fileImages.getFileImage(module.get());
 	EXPECT_NE(nullptr, r1);
 
-	FileImageProvider::clear();
-	auto* r2 = FileImageProvider::getFileImage(module.get());
+	providers.fileImages.clear();
+	auto* r2 = providers.fileImages.getFileImage(module.get());
 	EXPECT_EQ(nullptr, r2);
 }
 
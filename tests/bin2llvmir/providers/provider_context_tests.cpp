@@ -0,0 +1,364 @@
+/**
+* @file tests/bin2llvmir/providers/tests/provider_context_tests.cpp
+* @brief Tests for the @c ProviderContext.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <thread>
+#include <vector>
+
+#include <llvm/AsmParser/Parser.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include "retdec/bin2llvmir/optimizations/asm_inst_remover/asm_inst_remover.h"
+#include "retdec/bin2llvmir/optimizations/inst_opt/inst_opt.h"
+#include "retdec/bin2llvmir/optimizations/stack_pointer_ops/stack_pointer_ops.h"
+#include "retdec/bin2llvmir/optimizations/volatilize/volatilize.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * Pass which only remembers the context and the config it got.
+ */
+class ContextProbe : public ModulePass
+{
+	public:
+		static char ID;
+		ContextProbe(ProviderContext*& context, Config*& config) :
+				ModulePass(ID),
+				_context(context),
+				_config(config)
+		{
+
+		}
+
+		virtual bool runOnModule(Module& m) override
+		{
+			_context = ProviderContext::get(*this);
+			_config = _context ? _context->configs.getConfig(&m) : nullptr;
+			return false;
+		}
+
+	private:
+		ProviderContext*& _context;
+		Config*& _config;
+};
+
+char ContextProbe::ID = 0;
+
+/**
+ * Module with LLVM to ASM mapping on which @c runPipeline() does some work in
+ * each of its passes.
+ */
+const char* pipelineInput = R"(
+	@esp = global i32 0
+	@eax = global i32 0
+	@specialGv = internal global i32 0
+	define i32 @func() {
+		store i32 4096, i32* @specialGv
+		%a = load i32, i32* @eax
+		%b = load i32, i32* @eax
+		%c = xor i32 %a, %b
+		store i32 %c, i32* @eax
+		store i32 8192, i32* @specialGv
+		%d = load i32, i32* @esp
+		%e = add i32 %d, 4
+		store i32 %e, i32* @esp
+		%f = load i32, i32* @eax
+		ret i32 %f
+	}
+	!0 = !{ !"specialGv" }
+	!llvmToAsmGlobalVariableName = !{ !0 }
+)";
+
+/**
+ * Run a pipeline of passes which use providers and ASM instructions from the
+ * given context @a pc on module @a m.
+ */
+void runPipeline(Module& m, ProviderContext& pc)
+{
+	auto* c = pc.configs.addConfigJsonString(&m, "{}");
+	c->getConfig().registers.insert(retdec::config::Object(
+			"esp",
+			retdec::config::Storage::inRegister("esp")));
+	c->setLlvmToAsmGlobalVariable(m.getNamedGlobal("specialGv"));
+
+	legacy::PassManager pm;
+	pm.add(new ProviderContextPass(pc));
+	pm.add(new Volatilize());
+	pm.add(new InstOpt());
+	pm.add(new StackPointerOpsRemove());
+	pm.add(new AsmInstructionRemover());
+	pm.add(new Volatilize());
+	pm.run(m);
+}
+
+/**
+ * Parse @a pipelineInput in its own LLVM context and run @c runPipeline() on
+ * it with its own provider context.
+ * @return Resulting module printed as LLVM IR.
+ */
+std::string runPipelineInNewContext()
+{
+	LLVMContext ctx;
+	SMDiagnostic err;
+	auto m = parseAssemblyString(pipelineInput, err, ctx);
+	if (m == nullptr)
+	{
+		return std::string();
+	}
+
+	ProviderContext pc;
+	runPipeline(*m, pc);
+
+	std::string str;
+	raw_string_ostream os(str);
+	m->print(os, nullptr);
+	return os.str();
+}
+
+/**
+ * @brief Tests for the @c ProviderContext.
+ */
+class ProviderContextTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(ProviderContextTests, getReturnsNullptrForPassOutsideOfPassManager)
+{
+	Volatilize pass;
+
+	EXPECT_EQ(nullptr, ProviderContext::get(pass));
+}
+
+TEST_F(ProviderContextTests, contextIsAvailableToPassesInItsPassManager)
+{
+	parseInput("");
+	auto* c = providers.configs.addConfigJsonString(module.get(), "{}");
+	ProviderContext* seenContext = nullptr;
+	Config* seenConfig = nullptr;
+
+	legacy::PassManager pm;
+	pm.add(new ProviderContextPass(providers));
+	pm.add(new ContextProbe(seenContext, seenConfig));
+	pm.run(*module);
+
+	EXPECT_EQ(&providers, seenContext);
+	EXPECT_EQ(c, seenConfig);
+}
+
+TEST_F(ProviderContextTests, passManagerWithoutContextPassGivesNoContext)
+{
+	parseInput("");
+	ProviderContext* seenContext = &providers;
+	Config* seenConfig = nullptr;
+
+	legacy::PassManager pm;
+	pm.add(new ContextProbe(seenContext, seenConfig));
+	pm.run(*module);
+
+	EXPECT_EQ(nullptr, seenContext);
+	EXPECT_EQ(nullptr, seenConfig);
+}
+
+TEST_F(ProviderContextTests, passStatesAreKeptInContextBetweenRuns)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @func() {
+			store i32 0, i32* @r
+			ret void
+		}
+	)");
+
+	legacy::PassManager pm1;
+	pm1.add(new ProviderContextPass(providers));
+	pm1.add(new Volatilize());
+	pm1.run(*module);
+
+	EXPECT_FALSE(providers.volatilize.doVolatilization);
+
+	legacy::PassManager pm2;
+	pm2.add(new ProviderContextPass(providers));
+	pm2.add(new Volatilize());
+	pm2.run(*module);
+
+	std::string exp = R"(
+		@r = global i32 0
+		define void @func() {
+			store i32 0, i32* @r
+			ret void
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_TRUE(providers.volatilize.doVolatilization);
+}
+
+TEST_F(ProviderContextTests, clearResetsProvidersAndPassStates)
+{
+	parseInput("");
+	providers.configs.addConfigJsonString(module.get(), "{}");
+	providers.syscallSites.addSyscallSites(module.get());
+	providers.providersInitialized = true;
+	providers.volatilize.doVolatilization = false;
+
+	providers.clear();
+
+	EXPECT_EQ(nullptr, providers.configs.getConfig(module.get()));
+	EXPECT_EQ(nullptr, providers.syscallSites.getSyscallSites(module.get()));
+	EXPECT_FALSE(providers.providersInitialized);
+	EXPECT_TRUE(providers.volatilize.doVolatilization);
+}
+
+TEST_F(ProviderContextTests, llvmToAsmGlobalVariableIsCachedInActiveContext)
+{
+	parseInput(pipelineInput);
+	auto* gv = getGlobalByName("specialGv");
+	providers.configs.addConfigJsonString(module.get(), "{}");
+
+	legacy::PassManager pm;
+	pm.add(new ProviderContextPass(providers));
+	pm.add(new InstOpt());
+	pm.run(*module);
+
+	EXPECT_EQ(nullptr, ProviderContext::getActive());
+	ASSERT_EQ(1, providers.llvmToAsmGlobals.count(module.get()));
+	EXPECT_EQ(gv, providers.llvmToAsmGlobals[module.get()]);
+}
+
+TEST_F(ProviderContextTests, pipelineRemovesLlvmToAsmGlobalVariableFromCache)
+{
+	parseInput(pipelineInput);
+
+	runPipeline(*module, providers);
+
+	std::string exp = R"(
+		@esp = global i32 0
+		@eax = global i32 0
+		define i32 @func() {
+			%v0_1000 = load i32, i32* @eax
+			store i32 0, i32* @eax
+			%v0_2000 = load i32, i32* @esp
+			%v1_2000 = add i32 %v0_2000, 4
+			%v2_2000 = load i32, i32* @eax
+			ret i32 %v2_2000
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_EQ(0, providers.llvmToAsmGlobals.count(module.get()));
+	EXPECT_EQ(nullptr, AsmInstruction::getLlvmToAsmGlobalVariable(module.get()));
+}
+
+TEST_F(ProviderContextTests, pipelinesWithDifferentContextsCanRunConcurrently)
+{
+	const std::size_t threadCount = 2;
+	const std::size_t runCount = 20;
+
+	auto expected = runPipelineInNewContext();
+	ASSERT_FALSE(expected.empty());
+
+	auto decompile = [&](std::vector<std::string>& outputs)
+	{
+		for (std::size_t i = 0; i < runCount; ++i)
+		{
+			outputs.push_back(runPipelineInNewContext());
+		}
+	};
+
+	std::vector<std::vector<std::string>> results(threadCount);
+	std::vector<std::thread> threads;
+	for (auto& outputs : results)
+	{
+		threads.emplace_back(decompile, std::ref(outputs));
+	}
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	for (auto& outputs : results)
+	{
+		ASSERT_EQ(runCount, outputs.size());
+		for (auto& output : outputs)
+		{
+			EXPECT_EQ(expected, output);
+		}
+	}
+}
+
+TEST_F(ProviderContextTests, decompilationsWithDifferentContextsCanRunConcurrently)
+{
+	const std::size_t threadCount = 4;
+
+	struct Result
+	{
+		ProviderContext* expectedContext = nullptr;
+		ProviderContext* seenContext = nullptr;
+		Config* expectedConfig = nullptr;
+		Config* seenConfig = nullptr;
+		bool volatilized = false;
+	};
+	std::vector<Result> results(threadCount);
+
+	auto decompile = [](Result& res)
+	{
+		LLVMContext ctx;
+		SMDiagnostic err;
+		auto m = parseAssemblyString(R"(
+			@r = global i32 0
+			define void @func() {
+				store i32 0, i32* @r
+				ret void
+			}
+		)", err, ctx);
+		if (m == nullptr)
+		{
+			return;
+		}
+
+		ProviderContext pc;
+		res.expectedContext = &pc;
+		res.expectedConfig = pc.configs.addConfigJsonString(m.get(), "{}");
+
+		legacy::PassManager pm;
+		pm.add(new ProviderContextPass(pc));
+		pm.add(new ContextProbe(res.seenContext, res.seenConfig));
+		pm.add(new Volatilize());
+		pm.run(*m);
+
+		auto* s = cast<StoreInst>(m->getFunction("func")->front().begin());
+		res.volatilized = s->isVolatile() && !pc.volatilize.doVolatilization;
+	};
+
+	std::vector<std::thread> threads;
+	for (auto& res : results)
+	{
+		threads.emplace_back(decompile, std::ref(res));
+	}
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	for (auto& res : results)
+	{
+		EXPECT_NE(nullptr, res.expectedContext);
+		EXPECT_EQ(res.expectedContext, res.seenContext);
+		EXPECT_NE(nullptr, res.expectedConfig);
+		EXPECT_EQ(res.expectedConfig, res.seenConfig);
+		EXPECT_TRUE(res.volatilized);
+	}
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,91 @@
+/**
+* @file tests/bin2llvmir/providers/tests/syscall_sites_tests.cpp
+* @brief Tests for the @c SyscallSitesProvider.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/providers/syscall_sites.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c SyscallSitesProvider pass.
+ */
+class SyscallSitesProviderTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(SyscallSitesProviderTests, addSyscallSitesAddsEmptySitesForModule)
+{
+	auto* r1 = providers.syscallSites.addSyscallSites(module.get());
+	auto* r2 = providers.syscallSites.getSyscallSites(module.get());
+	SyscallSites* r3 = nullptr;
+	bool b = providers.syscallSites.getSyscallSites(module.get(), r3);
+
+	EXPECT_NE(nullptr, r1);
+	EXPECT_EQ(r1, r2);
+	EXPECT_EQ(r1, r3);
+	EXPECT_TRUE(b);
+	EXPECT_TRUE(r1->empty());
+}
+
+TEST_F(SyscallSitesProviderTests, getSyscallSitesReturnsNullptrForUnknownModule)
+{
+	providers.syscallSites.addSyscallSites(module.get());
+	parseInput(""); // creates a different module
+	auto* r1 = providers.syscallSites.getSyscallSites(module.get());
+	SyscallSites* r2 = nullptr;
+	bool b = providers.syscallSites.getSyscallSites(module.get(), r2);
+
+	EXPECT_EQ(nullptr, r1);
+	EXPECT_EQ(nullptr, r2);
+	EXPECT_FALSE(b);
+}
+
+TEST_F(SyscallSitesProviderTests, addedSitesAreOrderedByAddress)
+{
+	auto* s = providers.syscallSites.addSyscallSites(module.get());
+	s->addSite(0x2000, 2);
+	s->addSite(0x1000, 1);
+	s->addSite(0x2000, 3);
+
+	ASSERT_EQ(2, s->size());
+	auto it = s->getSites().begin();
+	EXPECT_EQ(0x1000, it->first);
+	EXPECT_EQ(1, it->second);
+	++it;
+	EXPECT_EQ(0x2000, it->first);
+	EXPECT_EQ(3, it->second);
+}
+
+TEST_F(SyscallSitesProviderTests, addSyscallSitesResetsExistingSites)
+{
+	auto* s1 = providers.syscallSites.addSyscallSites(module.get());
+	s1->addSite(0x1000, 1);
+	auto* s2 = providers.syscallSites.addSyscallSites(module.get());
+
+	EXPECT_EQ(s1, s2);
+	EXPECT_TRUE(s2->empty());
+}
+
+TEST_F(SyscallSitesProviderTests, clearRemovesAllData)
+{
+	providers.syscallSites.addSyscallSites(module.get());
+	auto* r1 = providers.syscallSites.getSyscallSites(module.get());
+	EXPECT_NE(nullptr, r1);
+
+	providers.syscallSites.clear();
+	auto* r2 = providers.syscallSites.getSyscallSites(module.get());
+	EXPECT_EQ(nullptr, r2);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
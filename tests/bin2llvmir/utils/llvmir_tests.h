@@ -19,13 +19,8 @@
 #include "retdec/llvm-support/tests/llvmir_tests.h"
 #include "retdec/llvm-support/utils.h"
 #include "retdec/utils/string.h"
-#include "retdec/bin2llvmir/providers/abi.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
-#include "retdec/bin2llvmir/providers/config.h"
-#include "retdec/bin2llvmir/providers/debugformat.h"
-#include "retdec/bin2llvmir/providers/demangler.h"
-#include "retdec/bin2llvmir/providers/fileimage.h"
-#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/instruction.h"
 #include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
 #include "retdec/loader/loader.h"
@@ -40,28 +35,13 @@ namespace tests {
 class LlvmIrTests : public retdec::llvm_support::tests::LlvmIrTests
 {
 	protected:
-		/**
-		 * There are some static data accessible via providers that are common
-		 * to entire bin2llvmirl. This methods clears all of it.
-		 */
-		void clearAllStaticData()
-		{
-			AbiProvider::clear();
-			ConfigProvider::clear();
-			DebugFormatProvider::clear();
-			DemanglerProvider::clear();
-			FileImageProvider::clear();
-			AsmInstruction::clear();
-			LtiProvider::clear();
-		}
-
 		/**
 		 * Run before test -- make sure test have clear environment.
 		 */
 		virtual void SetUp() override
 		{
 			retdec::llvm_support::tests::LlvmIrTests::SetUp();
-			clearAllStaticData();
+			providers.clear();
 		}
 
 		/**
@@ -70,7 +50,7 @@ class LlvmIrTests : public retdec::llvm_support::tests::LlvmIrTests
 		virtual void TearDown() override
 		{
 			retdec::llvm_support::tests::LlvmIrTests::TearDown();
-			clearAllStaticData();
+			providers.clear();
 		}
 
 		std::shared_ptr<retdec::fileformat::RawDataFormat> createFormat()
@@ -98,6 +78,10 @@ class LlvmIrTests : public retdec::llvm_support::tests::LlvmIrTests
 
 			return image;
 		}
+
+	protected:
+		/// Providers used by the tests.
+		ProviderContext providers;
 };
 
 } // namespace tests
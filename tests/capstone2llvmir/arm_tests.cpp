@@ -1601,6 +1601,65 @@ TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_MOV_s_r_r)
 	EXPECT_NO_VALUE_CALLED();
 }
 
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_MOV_r_r_eq_true)
+{
+	SKIP_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R0, 0x1},
+		{ARM_REG_R1, 0x12345678},
+		{ARM_REG_CPSR_Z, true},
+	});
+
+	auto* f = emulate("moveq r0, r1");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R0, ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_R0, 0x12345678},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+	EXPECT_EQ(1, f->size()); // select, no branch
+}
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_MOV_r_r_eq_false)
+{
+	SKIP_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R0, 0x1},
+		{ARM_REG_R1, 0x12345678},
+		{ARM_REG_CPSR_Z, false},
+	});
+
+	auto* f = emulate("moveq r0, r1");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R0, ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_R0, 0x1},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+	EXPECT_EQ(1, f->size()); // select, no branch
+}
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_MOV_s_r_r_eq_false)
+{
+	SKIP_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R1, 0xff000000},
+		{ARM_REG_CPSR_Z, false},
+	});
+
+	emulate("movseq r0, r1");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_CPSR_Z});
+	EXPECT_NO_REGISTERS_STORED();
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
 //
 // ARM_INS_MOVT
 //
@@ -1687,6 +1746,131 @@ TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_MVN_s_r_r)
 	EXPECT_NO_VALUE_CALLED();
 }
 
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_MVN_r_r_ne_true)
+{
+	SKIP_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R0, 0x1},
+		{ARM_REG_R1, 0xf0f0f0f0},
+		{ARM_REG_CPSR_Z, false},
+	});
+
+	emulate("mvnne r0, r1");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R0, ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_R0, 0x0f0f0f0f},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
+//
+// ARM_INS_IT
+//
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_IT_same_cond_true)
+{
+	ONLY_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R1, 0x1230},
+		{ARM_REG_CPSR_Z, true},
+	});
+
+	auto* f = emulate("itt eq; addeq r0, r1, #4; addeq r2, r1, #8");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_R0, 0x1234},
+		{ARM_REG_R2, 0x1238},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+	EXPECT_EQ(3, f->size()); // before, one shared body, after
+}
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_IT_same_cond_false)
+{
+	ONLY_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R1, 0x1230},
+		{ARM_REG_CPSR_Z, false},
+	});
+
+	auto* f = emulate("itt eq; addeq r0, r1, #4; addeq r2, r1, #8");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_CPSR_Z});
+	EXPECT_NO_REGISTERS_STORED();
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+	EXPECT_EQ(3, f->size()); // before, one shared body, after
+}
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_IT_then_else)
+{
+	ONLY_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R1, 0x1230},
+		{ARM_REG_CPSR_Z, false},
+	});
+
+	emulate("ite eq; addeq r0, r1, #4; addne r2, r1, #8");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_R2, 0x1238},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_IT_flags_changed_in_block)
+{
+	ONLY_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R1, 0x1230},
+		{ARM_REG_CPSR_Z, true},
+	});
+
+	// cmp clears Z, so the condition of add must be evaluated again.
+	emulate("itt eq; cmpeq r1, #1; addeq r0, r1, #4");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_CPSR_N, false},
+		{ARM_REG_CPSR_Z, false},
+		{ARM_REG_CPSR_C, true},
+		{ARM_REG_CPSR_V, false},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
+TEST_P(Capstone2LlvmIrTranslatorArmTests, ARM_INS_IT_mov)
+{
+	ONLY_MODE_THUMB;
+
+	setRegisters({
+		{ARM_REG_R0, 0x1},
+		{ARM_REG_R1, 0x1230},
+		{ARM_REG_CPSR_Z, false},
+	});
+
+	emulate("ite eq; moveq r0, r1; movne r0, #0");
+
+	EXPECT_JUST_REGISTERS_LOADED({ARM_REG_R0, ARM_REG_R1, ARM_REG_CPSR_Z});
+	EXPECT_JUST_REGISTERS_STORED({
+		{ARM_REG_R0, 0x0},
+	});
+	EXPECT_NO_MEMORY_LOADED_STORED();
+	EXPECT_NO_VALUE_CALLED();
+}
+
 //
 // ARM_INS_NOP
 //
@@ -9379,6 +9379,90 @@ TEST_P(Capstone2LlvmIrTranslatorX86Tests, X86_INS_FSTP)
 	});
 }
 
+//
+// Statically known x87 TOP
+//
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, X86_INS_FLD_known_top)
+{
+	ALL_MODES;
+
+	setMemory({
+		{0x1234, 3.14},
+	});
+
+	getX86Translator()->setX87TopAtStart(0);
+	emulate("fld qword ptr [0x1234]");
+
+	EXPECT_NO_REGISTERS_LOADED();
+	EXPECT_JUST_REGISTERS_STORED({
+		{X86_REG_ST0, 3.14},
+		{X87_REG_TAG0, ANY},
+		{X87_REG_TOP, 0x7},
+	});
+	EXPECT_JUST_MEMORY_LOADED({0x1234});
+	EXPECT_NO_MEMORY_STORED();
+	EXPECT_TRUE(getX86Translator()->getX87DataStoreFunction()->use_empty());
+	EXPECT_TRUE(getX86Translator()->getX87TagStoreFunction()->use_empty());
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, X86_INS_FLD_FSTP_known_top)
+{
+	ALL_MODES;
+
+	setMemory({
+		{0x1234, 3.14},
+		{0x123c, 2.72},
+	});
+
+	getX86Translator()->setX87TopAtStart(0);
+	emulate("fld qword ptr [0x1234]; fld qword ptr [0x123c]; fstp qword ptr [0x1244]");
+
+	EXPECT_JUST_REGISTERS_LOADED({X86_REG_ST1});
+	EXPECT_JUST_REGISTERS_STORED({
+		{X86_REG_ST0, 3.14},
+		{X86_REG_ST1, 2.72},
+		{X87_REG_TAG0, ANY},
+		{X87_REG_TAG1, ANY},
+		{X87_REG_TOP, 0x7},
+	});
+	EXPECT_JUST_MEMORY_LOADED({0x1234, 0x123c});
+	EXPECT_JUST_MEMORY_STORED({
+		{0x1244, 2.72},
+	});
+	EXPECT_TRUE(getX86Translator()->getX87DataLoadFunction()->use_empty());
+	EXPECT_TRUE(getX86Translator()->getX87DataStoreFunction()->use_empty());
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, X86_INS_FLD_top_known_after_fninit)
+{
+	ALL_MODES;
+
+	setMemory({
+		{0x1234, 3.14},
+	});
+
+	emulate("fninit; fld qword ptr [0x1234]");
+
+	EXPECT_REGISTERS_STORED({X86_REG_ST0, X87_REG_TAG0, X87_REG_TOP});
+	EXPECT_TRUE(getX86Translator()->getX87DataStoreFunction()->use_empty());
+	EXPECT_TRUE(getX86Translator()->getX87TagStoreFunction()->use_empty());
+}
+
+TEST_P(Capstone2LlvmIrTranslatorX86Tests, X86_INS_FLD_top_not_known_after_call)
+{
+	ALL_MODES;
+
+	setMemory({
+		{0x1234, 3.14},
+	});
+
+	getX86Translator()->setX87TopAtStart(0);
+	emulate("call 0x1000; fld qword ptr [0x1234]");
+
+	EXPECT_FALSE(getX86Translator()->getX87DataStoreFunction()->use_empty());
+}
+
 //
 // X86_INS_FMUL
 //
@@ -229,6 +229,34 @@ TEST_F(BaseAssociativeContainerTests, AssociativeInsertWorks)
 	EXPECT_EQ(fnc4.getStart(), fncs.getElementById(fnc1.getName())->getStart());
 }
 
+TEST_F(BaseAssociativeContainerTests, AssociativeStampChangesWhenContentChanges)
+{
+	auto stamp = fncs.getStamp();
+	fncs.getElementById(fnc1.getName());
+	EXPECT_EQ(stamp, fncs.getStamp());
+
+	fncs.insert(Function("fnc3"));
+	EXPECT_LT(stamp, fncs.getStamp());
+
+	stamp = fncs.getStamp();
+	fncs.erase("fnc3");
+	EXPECT_LT(stamp, fncs.getStamp());
+
+	stamp = fncs.getStamp();
+	fncs.clear();
+	EXPECT_LT(stamp, fncs.getStamp());
+}
+
+TEST_F(BaseAssociativeContainerTests, AssociativeCopyHasDifferentStamp)
+{
+	auto copy = fncs;
+	EXPECT_NE(fncs.getStamp(), copy.getStamp());
+
+	auto stamp = fncs.getStamp();
+	fncs = copy;
+	EXPECT_LT(stamp, fncs.getStamp());
+}
+
 //
 //=============================================================================
 //  BaseAssociativeContainerTests
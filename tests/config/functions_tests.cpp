@@ -30,6 +30,18 @@ TEST_F(FunctionTests, TestSetIsMethods)
 
 }
 
+TEST_F(FunctionTests, AliasedFunctionNameIsSerializedAndMakesFunctionAlias)
+{
+	Function fnc("dup");
+	EXPECT_FALSE(fnc.isAlias());
+
+	fnc.setAliasedFunctionName("canonical");
+	auto loaded = Function::fromJsonValue(fnc.getJsonValue());
+
+	EXPECT_TRUE(loaded.isAlias());
+	EXPECT_EQ("canonical", loaded.getAliasedFunctionName());
+}
+
 //
 //=============================================================================
 //  FunctionContainerTests
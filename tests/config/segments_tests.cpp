@@ -0,0 +1,63 @@
+/**
+ * @file tests/config/segments_tests.cpp
+ * @brief Tests for the @c segments module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/config/segments.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace config {
+namespace tests {
+
+class SegmentTests : public Test
+{
+
+};
+
+TEST_F(SegmentTests, NewSegmentHasNoByteStatistics)
+{
+	Segment seg(0x1000);
+
+	EXPECT_FALSE(seg.hasByteStatistics());
+	EXPECT_FALSE(seg.getJsonValue().isMember("entropy"));
+	EXPECT_FALSE(seg.getJsonValue().isMember("chiSquare"));
+}
+
+TEST_F(SegmentTests, ByteStatisticsAreSerializedAndDeserialized)
+{
+	Segment seg(0x1000);
+	seg.setEnd(0x1fff);
+	seg.setName(".text");
+	seg.setEntropy(7.5);
+	seg.setChiSquare(1234.5);
+
+	auto val = seg.getJsonValue();
+	EXPECT_DOUBLE_EQ(7.5, val["entropy"].asDouble());
+	EXPECT_DOUBLE_EQ(1234.5, val["chiSquare"].asDouble());
+
+	auto copy = Segment::fromJsonValue(val);
+	EXPECT_EQ(".text", copy.getName());
+	EXPECT_TRUE(copy.hasByteStatistics());
+	EXPECT_DOUBLE_EQ(7.5, copy.getEntropy());
+	EXPECT_DOUBLE_EQ(1234.5, copy.getChiSquare());
+}
+
+TEST_F(SegmentTests, SegmentWithoutByteStatisticsIsDeserialized)
+{
+	Segment seg(0x1000);
+	seg.setEnd(0x1fff);
+
+	auto copy = Segment::fromJsonValue(seg.getJsonValue());
+	EXPECT_FALSE(copy.hasByteStatistics());
+	EXPECT_EQ(0x1000, copy.getStart());
+	EXPECT_EQ(0x1fff, copy.getEnd());
+}
+
+} // namespace tests
+} // namespace config
+} // namespace retdec
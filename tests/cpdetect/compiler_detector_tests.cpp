@@ -0,0 +1,147 @@
+/**
+* @file tests/cpdetect/compiler_detector_tests.cpp
+* @brief Tests for the @c compiler_detector module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/compiler_detector/elf_compiler.h"
+#include "retdec/fileformat/file_format/elf/elf_format.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+
+namespace {
+
+/**
+ * 32-bit x86 ELF executable with "UPX!" in its code and
+ * "GCC: (GNU) 4.8.2" in its .comment section
+ */
+const unsigned char elfBytes[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x01, 0x00, 0x28, 0x00,
+0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+0x00, 0x80, 0x04, 0x08, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x90, 0x90, 0x90, 0x90, 0xeb, 0x04, 0x55, 0x50, 0x58, 0x21, 0x31, 0xc0,
+0x40, 0xcd, 0x80, 0x00, 0x47, 0x43, 0x43, 0x3a, 0x20, 0x28, 0x47, 0x4e, 0x55, 0x29, 0x20, 0x34,
+0x2e, 0x38, 0x2e, 0x32, 0x00, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x63, 0x6f, 0x6d,
+0x6d, 0x65, 0x6e, 0x74, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x00, 0x54, 0x80, 0x04, 0x08, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
+
+} // anonymous namespace
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+ * Tests for the @c compiler_detector module
+ */
+class CompilerDetectorTests : public Test
+{
+	private:
+		std::stringstream elfStringStream;
+	protected:
+		ElfFormat *parser;
+	public:
+		CompilerDetectorTests()
+		{
+			elfStringStream << std::string(elfBytes, elfBytes + sizeof(elfBytes));
+			parser = new ElfFormat(elfStringStream);
+		}
+
+		~CompilerDetectorTests()
+		{
+			delete parser;
+		}
+
+		ToolInformation detect(bool packersOnly)
+		{
+			ToolInformation toolInfo;
+			DetectParams params(SearchType::MOST_SIMILAR, false, false);
+			params.packersOnly = packersOnly;
+			ElfCompiler detector(*parser, params, toolInfo);
+			detector.getAllInformation();
+			return toolInfo;
+		}
+
+		bool isDetected(const ToolInformation &toolInfo, const std::string &name)
+		{
+			for(const auto &tool : toolInfo.detectedTools)
+			{
+				if(tool.name == name)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+};
+
+TEST_F(CompilerDetectorTests, CorrectParsing)
+{
+	EXPECT_EQ(true, parser->isInValidState());
+	EXPECT_EQ(4, parser->getNumberOfSections());
+}
+
+TEST_F(CompilerDetectorTests, FullDetectionFindsCompilerAndPacker)
+{
+	const auto toolInfo = detect(false);
+	EXPECT_EQ(true, isDetected(toolInfo, "GCC"));
+	EXPECT_EQ(true, isDetected(toolInfo, "UPX"));
+}
+
+TEST_F(CompilerDetectorTests, PackerOnlyDetectionFindsOnlyPackers)
+{
+	const auto toolInfo = detect(true);
+	EXPECT_EQ(true, isDetected(toolInfo, "UPX"));
+	EXPECT_EQ(false, isDetected(toolInfo, "GCC"));
+	for(const auto &tool : toolInfo.detectedTools)
+	{
+		EXPECT_EQ(true, tool.isPacker()) << tool.name;
+	}
+	EXPECT_EQ(true, toolInfo.detectedLanguages.empty());
+}
+
+TEST_F(CompilerDetectorTests, PackerOnlyDetectionFindsSamePackersAsFullDetection)
+{
+	const auto fullInfo = detect(false);
+	const auto packersInfo = detect(true);
+
+	std::vector<std::string> fullPackers, packers;
+	for(const auto &tool : fullInfo.detectedTools)
+	{
+		if(tool.isPacker())
+		{
+			fullPackers.push_back(tool.name + " " + tool.versionInfo);
+		}
+	}
+	for(const auto &tool : packersInfo.detectedTools)
+	{
+		packers.push_back(tool.name + " " + tool.versionInfo);
+	}
+	EXPECT_EQ(fullPackers, packers);
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,167 @@
+/**
+* @file tests/cpdetect/search_tests.cpp
+* @brief Tests for the @c search module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/compiler_detector/search/search.h"
+#include "retdec/fileformat/file_format/elf/elf_format.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+
+namespace {
+
+/**
+ * 32-bit x86 ELF executable
+ */
+const unsigned char elfBytes[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x01, 0x00, 0x28, 0x00,
+0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+0x00, 0x80, 0x04, 0x08, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x90, 0x90, 0x90, 0x90, 0xeb, 0x04, 0x55, 0x50, 0x58, 0x21, 0x31, 0xc0,
+0x40, 0xcd, 0x80, 0x00, 0x47, 0x43, 0x43, 0x3a, 0x20, 0x28, 0x47, 0x4e, 0x55, 0x29, 0x20, 0x34,
+0x2e, 0x38, 0x2e, 0x32, 0x00, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x63, 0x6f, 0x6d,
+0x6d, 0x65, 0x6e, 0x74, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x00, 0x54, 0x80, 0x04, 0x08, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
+
+} // anonymous namespace
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+ * Tests for the @c search module
+ */
+class SearchTests : public Test
+{
+	private:
+		std::stringstream elfStringStream;
+	protected:
+		ElfFormat *parser;
+		Search *search;
+	public:
+		SearchTests()
+		{
+			elfStringStream << std::string(elfBytes, elfBytes + sizeof(elfBytes));
+			parser = new ElfFormat(elfStringStream);
+			search = new Search(*parser);
+		}
+
+		~SearchTests()
+		{
+			delete search;
+			delete parser;
+		}
+
+		/**
+		 * Create pattern from content of file
+		 * @param offset Offset of first nibble of pattern
+		 * @param length Number of nibbles in pattern
+		 * @param variant Selects nibbles which are changed or replaced
+		 *    by wildcards
+		 */
+		std::string createPattern(std::size_t offset, std::size_t length, std::size_t variant)
+		{
+			auto pattern = search->getNibbles().substr(offset, length);
+			for(std::size_t i = 0; i < pattern.length(); ++i)
+			{
+				if(variant && (i + variant) % (variant + 2) == 0)
+				{
+					pattern[i] = (i % 2) ? '-' : '?';
+				}
+				else if(variant && (i * variant) % 7 == 3)
+				{
+					pattern[i] = (pattern[i] == '0') ? '1' : '0';
+				}
+			}
+
+			return pattern;
+		}
+
+		void expectSameSimilarity(const std::string &pattern, std::size_t startOffset, std::size_t stopOffset)
+		{
+			SCOPED_TRACE(pattern + " in " + std::to_string(startOffset) + "-" + std::to_string(stopOffset));
+			const Search::SimilarityPattern simPattern(pattern);
+			Similarity nibbleSim, packedSim;
+			const auto nibbleResult = search->areaSimilarity(pattern, nibbleSim, startOffset, stopOffset);
+			const auto packedResult = search->areaSimilarity(simPattern, packedSim, startOffset, stopOffset);
+			ASSERT_EQ(nibbleResult, packedResult);
+			if(nibbleResult)
+			{
+				EXPECT_EQ(nibbleSim.same, packedSim.same);
+				EXPECT_EQ(nibbleSim.total, packedSim.total);
+				EXPECT_EQ(nibbleSim.ratio, packedSim.ratio);
+			}
+
+			// Minimal ratio only rejects areas which are not similar enough
+			for(const auto minRatio : {0.25, 0.5, 0.75, 1.0})
+			{
+				Similarity minSim;
+				const auto minResult = search->areaSimilarity(simPattern, minSim, startOffset, stopOffset, minRatio);
+				EXPECT_EQ(nibbleResult && nibbleSim.ratio >= minRatio, minResult) << minRatio;
+				if(minResult)
+				{
+					EXPECT_EQ(nibbleSim.same, minSim.same);
+					EXPECT_EQ(nibbleSim.total, minSim.total);
+				}
+			}
+		}
+};
+
+TEST_F(SearchTests, CorrectParsing)
+{
+	EXPECT_EQ(true, search->isFileLoaded());
+	EXPECT_EQ(true, search->isFileSupported());
+}
+
+TEST_F(SearchTests, PackedPatternIsOnlyCreatedWithoutSlashes)
+{
+	EXPECT_EQ(true, Search::SimilarityPattern("9090--90EB??").isPacked());
+	EXPECT_EQ(false, Search::SimilarityPattern("9090/90").isPacked());
+}
+
+TEST_F(SearchTests, PackedAreaSimilarityEqualsNibbleByNibbleSimilarity)
+{
+	const auto fileLength = search->getNibbles().length();
+	for(std::size_t length : {1, 2, 7, 8, 9, 16, 17, 30})
+	{
+		for(std::size_t offset = 0; offset + length <= fileLength; offset += 37)
+		{
+			for(std::size_t variant = 0; variant < 4; ++variant)
+			{
+				const auto pattern = createPattern(offset, length, variant);
+				expectSameSimilarity(pattern, 0, 0);
+				expectSameSimilarity(pattern, 0x40, 0x40);
+				expectSameSimilarity(pattern, 0x50, 0x70);
+				expectSameSimilarity(pattern, 0, sizeof(elfBytes) - 1);
+				expectSameSimilarity(pattern, sizeof(elfBytes) - 8, sizeof(elfBytes) - 1);
+			}
+		}
+	}
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,117 @@
+/**
+* @file tests/fileformat/byte_statistics_tests.cpp
+* @brief Tests for the @c byte_statistics module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/byte_statistics/byte_statistics.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c byte_statistics module
+ */
+class ByteStatisticsTests : public Test
+{
+	protected:
+		ByteStatistics stats;
+};
+
+TEST_F(ByteStatisticsTests, EmptyStatistics)
+{
+	EXPECT_TRUE(stats.isEmpty());
+	EXPECT_EQ(0, stats.getSize());
+	EXPECT_EQ(0.0, stats.getEntropy());
+	EXPECT_EQ(0.0, stats.getChiSquare());
+	EXPECT_EQ(ByteStatistics::Content::UNKNOWN, stats.getLikelyContent());
+	EXPECT_FALSE(stats.isLikelyPacked());
+}
+
+TEST_F(ByteStatisticsTests, HistogramIsAccumulatedOverUpdates)
+{
+	const std::vector<unsigned char> first = {0x00, 0x01, 0x01};
+	const std::vector<unsigned char> second = {0x01, 0xFF};
+	stats.update(first.data(), first.size());
+	stats.update(second.data(), second.size());
+
+	EXPECT_EQ(5, stats.getSize());
+	EXPECT_EQ(1, stats.getHistogram()[0x00]);
+	EXPECT_EQ(3, stats.getHistogram()[0x01]);
+	EXPECT_EQ(1, stats.getHistogram()[0xFF]);
+
+	stats.clear();
+	EXPECT_TRUE(stats.isEmpty());
+	EXPECT_EQ(0, stats.getHistogram()[0x01]);
+}
+
+TEST_F(ByteStatisticsTests, ConstantDataArePlain)
+{
+	const std::vector<unsigned char> data(4096, 0x90);
+	stats.update(data.data(), data.size());
+
+	EXPECT_DOUBLE_EQ(0.0, stats.getEntropy());
+	EXPECT_DOUBLE_EQ(255.0 * data.size(), stats.getChiSquare());
+	EXPECT_EQ(ByteStatistics::Content::PLAIN, stats.getLikelyContent());
+	EXPECT_FALSE(stats.isLikelyPacked());
+}
+
+TEST_F(ByteStatisticsTests, UniformDataAreEncrypted)
+{
+	std::vector<unsigned char> data;
+	for(unsigned i = 0; i < 16 * 256; ++i)
+	{
+		data.push_back(static_cast<unsigned char>(i * 167));
+	}
+	stats.update(data.data(), data.size());
+
+	EXPECT_DOUBLE_EQ(8.0, stats.getEntropy());
+	EXPECT_DOUBLE_EQ(0.0, stats.getChiSquare());
+	EXPECT_EQ(ByteStatistics::Content::ENCRYPTED, stats.getLikelyContent());
+	EXPECT_TRUE(stats.isLikelyPacked());
+}
+
+TEST_F(ByteStatisticsTests, SkewedHighEntropyDataAreCompressed)
+{
+	// All byte values are present, but the low half is twice as frequent as
+	// the high half, which is typical for output of compressors.
+	std::vector<unsigned char> data;
+	for(unsigned i = 0; i < 64; ++i)
+	{
+		for(unsigned j = 0; j < 256; ++j)
+		{
+			data.push_back(static_cast<unsigned char>(j));
+			if(j < 128)
+			{
+				data.push_back(static_cast<unsigned char>(j));
+			}
+		}
+	}
+	stats.update(data.data(), data.size());
+
+	EXPECT_GT(stats.getEntropy(), 7.9);
+	EXPECT_GT(stats.getChiSquare(), 330.5);
+	EXPECT_EQ(ByteStatistics::Content::COMPRESSED, stats.getLikelyContent());
+	EXPECT_TRUE(stats.isLikelyPacked());
+}
+
+TEST_F(ByteStatisticsTests, SmallDataAreUnknown)
+{
+	const std::vector<unsigned char> data = {0x12, 0x34, 0x56};
+	stats.update(data.data(), data.size());
+
+	EXPECT_EQ(ByteStatistics::Content::UNKNOWN, stats.getLikelyContent());
+	EXPECT_EQ("unknown", contentToString(stats.getLikelyContent()));
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
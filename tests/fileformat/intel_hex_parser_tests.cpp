@@ -0,0 +1,260 @@
+/**
+* @file tests/fileformat/intel_hex_parser_tests.cpp
+* @brief Tests for the @c intel_hex_parser module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/intel_hex/intel_hex_parser/intel_hex_parser.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+namespace {
+
+/**
+ * Creates one Intel HEX record including its checksum
+ */
+std::string makeRecord(unsigned recordType, unsigned address,
+		const std::vector<unsigned char> &data, const std::string &newline = "\n")
+{
+	char buf[3];
+	unsigned checksum = data.size() + (address >> 8) + (address & 0xFF) + recordType;
+	std::string result = ":";
+
+	std::snprintf(buf, sizeof(buf), "%02X", static_cast<unsigned>(data.size()));
+	result += buf;
+	std::snprintf(buf, sizeof(buf), "%02X", (address >> 8) & 0xFF);
+	result += buf;
+	std::snprintf(buf, sizeof(buf), "%02X", address & 0xFF);
+	result += buf;
+	std::snprintf(buf, sizeof(buf), "%02X", recordType);
+	result += buf;
+	for(auto byte : data)
+	{
+		// Mix upper and lower case digits.
+		std::snprintf(buf, sizeof(buf), byte % 2 ? "%02x" : "%02X", byte);
+		result += buf;
+		checksum += byte;
+	}
+	std::snprintf(buf, sizeof(buf), "%02X", (0 - checksum) & 0xFF);
+	result += buf;
+
+	return result + newline;
+}
+
+/**
+ * Builds sections from records returned by IntelHexTokenizer, which is how
+ * sections used to be built before records were decoded in a single pass.
+ */
+bool tokenizerParse(const std::string &input, std::vector<IntelHexSection> &sections)
+{
+	std::istringstream stream(input);
+	IntelHexTokenizer tokenizer;
+	tokenizer.setInputStream(stream);
+
+	bool mode = true;
+	unsigned long long upper = 0, segment = 0, index = 0;
+	retdec::utils::Address actualAddress = 0;
+	IntelHexSection actual;
+	actual.address = 0;
+
+	while(true)
+	{
+		auto token = tokenizer.getToken();
+		switch(token.recordType)
+		{
+			case IntelHexToken::REC_TYPE::RT_DATA:
+			{
+				retdec::utils::Address address = mode
+					? (upper << 16) | IntelHexParser::strToInt(token.address)
+					: segment * 16 + IntelHexParser::strToInt(token.address);
+				if(address - (actualAddress - 1) != 1)
+				{
+					if(actualAddress)
+					{
+						sections.push_back(actual);
+						++index;
+					}
+					actualAddress = address;
+					actual.address = address;
+					actual.index = index;
+					actual.data.clear();
+				}
+				for(std::size_t i = 0; i < token.data.size(); i += 2)
+				{
+					actual.data.push_back(IntelHexParser::strToInt(token.data.substr(i, 2)));
+					actualAddress += 1;
+				}
+				break;
+			}
+			case IntelHexToken::REC_TYPE::RT_EXT_LINADDR:
+				mode = true;
+				upper = IntelHexParser::strToInt(token.data);
+				break;
+			case IntelHexToken::REC_TYPE::RT_EXT_SEGADDR:
+				mode = false;
+				segment = IntelHexParser::strToInt(token.data);
+				break;
+			case IntelHexToken::REC_TYPE::RT_START_SEGADDR:
+			case IntelHexToken::REC_TYPE::RT_START_LINADDR:
+				break;
+			case IntelHexToken::REC_TYPE::RT_EOFILE:
+				sections.push_back(actual);
+				return true;
+			default:
+				return false;
+		}
+	}
+}
+
+/**
+ * Parses @a input by IntelHexParser
+ */
+bool parserParse(const std::string &input, IntelHexParser &parser)
+{
+	std::istringstream stream(input);
+	return parser.parseStream(stream);
+}
+
+} // anonymous namespace
+
+/**
+ * Tests for the @c intel_hex_parser module
+ */
+class IntelHexParserTests : public Test
+{
+	protected:
+		void expectSameSectionsAsTokenizer(const std::string &input)
+		{
+			std::vector<IntelHexSection> expected;
+			ASSERT_TRUE(tokenizerParse(input, expected));
+
+			IntelHexParser parser;
+			ASSERT_TRUE(parserParse(input, parser)) << parser.errorDesc;
+			ASSERT_EQ(expected.size(), parser.sections.size());
+			for(std::size_t i = 0; i < expected.size(); ++i)
+			{
+				EXPECT_EQ(expected[i].index, parser.sections[i].index);
+				EXPECT_EQ(expected[i].address, parser.sections[i].address);
+				EXPECT_EQ(expected[i].data, parser.sections[i].data);
+			}
+		}
+
+		std::string parseError(const std::string &input)
+		{
+			IntelHexParser parser;
+			EXPECT_FALSE(parserParse(input, parser));
+			return parser.errorDesc;
+		}
+};
+
+TEST_F(IntelHexParserTests, SectionsMatchTokenizerFor32BitAddresses)
+{
+	std::string input = makeRecord(4, 0, {0xFF, 0xFF});
+	input += makeRecord(0, 0x0100, {0x21, 0x46, 0x01, 0x36, 0x01, 0x21});
+	input += makeRecord(0, 0x0106, {0x47, 0x01, 0x36});
+	input += makeRecord(0, 0x0000, {0x02, 0x00, 0x23});
+	input += makeRecord(5, 0, {0xFF, 0xFF, 0x00, 0x01});
+	input += makeRecord(1, 0, {});
+
+	expectSameSectionsAsTokenizer(input);
+
+	IntelHexParser parser;
+	ASSERT_TRUE(parserParse(input, parser));
+	ASSERT_EQ(2, parser.sections.size());
+	EXPECT_EQ(0xFFFF0100, parser.sections[0].address);
+	EXPECT_EQ(9, parser.sections[0].data.size());
+	EXPECT_EQ(0xFFFF0000, parser.sections[1].address);
+	EXPECT_EQ(3, parser.sections[1].data.size());
+	EXPECT_TRUE(parser.hasEntryPoint());
+	EXPECT_EQ(0xFFFF0001, parser.getEntryPoint());
+}
+
+TEST_F(IntelHexParserTests, SectionsMatchTokenizerFor20BitSegments)
+{
+	std::string input = makeRecord(2, 0, {0x12, 0x00}, "\r\n");
+	input += makeRecord(0, 0x0010, {0x01, 0x02, 0x03, 0x04}, "\r\n");
+	input += makeRecord(0, 0x0014, {0x05, 0x06}, "\r\n");
+	input += makeRecord(2, 0, {0x12, 0x01}, "\r\n");
+	input += makeRecord(0, 0x0006, {0x07}, "\r\n");
+	input += makeRecord(3, 0, {0x12, 0x00, 0x00, 0x10}, "\r\n");
+	input += makeRecord(1, 0, {}, "\r\n");
+
+	expectSameSectionsAsTokenizer(input);
+
+	IntelHexParser parser;
+	ASSERT_TRUE(parserParse(input, parser));
+	ASSERT_EQ(1, parser.sections.size());
+	EXPECT_EQ(0x12010, parser.sections[0].address);
+	EXPECT_EQ(7, parser.sections[0].data.size());
+	EXPECT_EQ(0x12010, parser.getEntryPoint());
+}
+
+TEST_F(IntelHexParserTests, SectionsMatchTokenizerForInputLargerThanReadBlock)
+{
+	std::string input;
+	unsigned address = 0;
+	for(unsigned i = 0; i < 0x2000; ++i)
+	{
+		if(i % 0x1000 == 0)
+		{
+			input += makeRecord(4, 0, {0x00, static_cast<unsigned char>(i / 0x1000)});
+			address = 0;
+		}
+		// Leave a gap after every 100th record to start a new section.
+		if(i % 100 == 99)
+		{
+			address += 0x10;
+		}
+
+		std::vector<unsigned char> data(16);
+		for(unsigned j = 0; j < data.size(); ++j)
+		{
+			data[j] = static_cast<unsigned char>(i * 7 + j);
+		}
+		input += makeRecord(0, address, data);
+		address += data.size();
+	}
+	input += makeRecord(1, 0, {});
+
+	ASSERT_GT(input.size(), 0x10000);
+	expectSameSectionsAsTokenizer(input);
+}
+
+TEST_F(IntelHexParserTests, EmptyFileHasOneEmptySection)
+{
+	IntelHexParser parser;
+	ASSERT_TRUE(parserParse(":00000001FF\n", parser));
+	ASSERT_EQ(1, parser.sections.size());
+	EXPECT_TRUE(parser.sections[0].data.empty());
+	EXPECT_FALSE(parser.hasEntryPoint());
+}
+
+TEST_F(IntelHexParserTests, InvalidRecordsAreReported)
+{
+	EXPECT_EQ("Starting semicolon missing.", parseError("00000001FF\n"));
+	EXPECT_EQ("Starting semicolon missing.", parseError(""));
+	EXPECT_EQ("Invalid byte count sequence.", parseError(":@$000001FF\n"));
+	EXPECT_EQ("Invalid address sequence.", parseError(":0000PP01FF\n"));
+	EXPECT_EQ("Invalid record type sequence.", parseError(":000000XXFF\n"));
+	EXPECT_EQ("Invalid record type sequence.", parseError(":00000006FA\n"));
+	EXPECT_EQ("Invalid data sequence.", parseError(":04000005FFFF!!01F8\n"));
+	EXPECT_EQ("Invalid data sequence.", parseError(":04000005FFFF"));
+	EXPECT_EQ("Invalid checksum.", parseError(":04000005FFFF0001F9\n"));
+	EXPECT_EQ("Invalid newline sequence.", parseError(":04000005FFFF0001F80000"));
+	EXPECT_EQ("Invalid newline sequence.", parseError(":04000005FFFF0001F8\n"));
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
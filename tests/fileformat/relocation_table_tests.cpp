@@ -0,0 +1,108 @@
+/**
+* @file tests/fileformat/relocation_table_tests.cpp
+* @brief Tests for the @c relocation_table module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/relocation_table/relocation_table.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c relocation_table module
+ */
+class RelocationTableTests : public Test
+{
+	protected:
+		Relocation makeRelocation(const std::string &name, const std::vector<std::uint8_t> &mask)
+		{
+			Relocation relocation;
+			relocation.setName(name);
+			relocation.setMask(mask);
+			return relocation;
+		}
+
+		RelocationTable table;
+};
+
+TEST_F(RelocationTableTests, EmptyNameAndMaskByDefault)
+{
+	Relocation relocation;
+
+	EXPECT_TRUE(relocation.hasEmptyName());
+	EXPECT_EQ("", relocation.getName());
+	EXPECT_TRUE(relocation.getMask().empty());
+
+	relocation.setName("R_386_32");
+	relocation.setName("");
+	EXPECT_TRUE(relocation.hasEmptyName());
+}
+
+TEST_F(RelocationTableTests, SameNamesAndMasksAreSharedInTable)
+{
+	auto first = makeRelocation("R_386_32", {0xFF, 0xFF, 0xFF, 0xFF});
+	auto second = makeRelocation("R_386_32", {0xFF, 0xFF, 0xFF, 0xFF});
+	auto third = makeRelocation("R_386_PC32", {0xFF, 0xFF, 0x00, 0x00});
+	table.addRelocation(first);
+	table.addRelocation(second);
+	table.addRelocation(third);
+
+	ASSERT_EQ(3, table.getNumberOfRelocations());
+	EXPECT_EQ(&table.getRelocation(0)->getName(), &table.getRelocation(1)->getName());
+	EXPECT_EQ(&table.getRelocation(0)->getMask(), &table.getRelocation(1)->getMask());
+	EXPECT_NE(&table.getRelocation(0)->getName(), &table.getRelocation(2)->getName());
+	EXPECT_NE(&table.getRelocation(0)->getMask(), &table.getRelocation(2)->getMask());
+	EXPECT_EQ("R_386_PC32", table.getRelocation(2)->getName());
+	EXPECT_EQ(std::vector<std::uint8_t>({0xFF, 0xFF, 0x00, 0x00}), table.getRelocation(2)->getMask());
+}
+
+TEST_F(RelocationTableTests, TablesDoNotShareNames)
+{
+	RelocationTable otherTable;
+	auto first = makeRelocation("R_386_32", {});
+	auto second = makeRelocation("R_386_32", {});
+	table.addRelocation(first);
+	otherTable.addRelocation(second);
+
+	EXPECT_EQ(table.getRelocation(0)->getName(), otherTable.getRelocation(0)->getName());
+	EXPECT_NE(&table.getRelocation(0)->getName(), &otherTable.getRelocation(0)->getName());
+}
+
+TEST_F(RelocationTableTests, RelocationOutlivesItsTable)
+{
+	Relocation copy;
+	{
+		auto tmpTable = std::make_unique<RelocationTable>();
+		auto relocation = makeRelocation("R_ARM_ABS32", {0x01, 0x02});
+		tmpTable->addRelocation(relocation);
+		copy = *tmpTable->getRelocation(0);
+	}
+
+	EXPECT_EQ("R_ARM_ABS32", copy.getName());
+	EXPECT_EQ(std::vector<std::uint8_t>({0x01, 0x02}), copy.getMask());
+}
+
+TEST_F(RelocationTableTests, ClearRemovesRelocations)
+{
+	auto relocation = makeRelocation("R_386_32", {0xFF});
+	table.addRelocation(relocation);
+	table.clear();
+
+	EXPECT_FALSE(table.hasRelocations());
+	EXPECT_FALSE(table.hasRelocation("R_386_32"));
+	EXPECT_EQ("R_386_32", relocation.getName());
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -0,0 +1,120 @@
+/**
+* @file tests/fileformat/similarity_hash_tests.cpp
+* @brief Tests for the @c similarity_hash module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/similarity_hash/similarity_hash.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+namespace {
+
+/**
+ * Creates pseudo-random data of the given size
+ */
+std::vector<unsigned char> createData(std::size_t size, std::uint32_t seed)
+{
+	std::vector<unsigned char> data(size);
+	for(auto &byte : data)
+	{
+		seed = seed * 1103515245 + 12345;
+		byte = static_cast<unsigned char>(seed >> 16);
+	}
+	return data;
+}
+
+/**
+ * Computes digest of @a data
+ */
+std::string digestOf(const std::vector<unsigned char> &data)
+{
+	SimilarityHash hash;
+	hash.update(data.data(), data.size());
+	return hash.getDigest();
+}
+
+} // anonymous namespace
+
+/**
+ * Tests for the @c similarity_hash module
+ */
+class SimilarityHashTests : public Test
+{
+	protected:
+		std::size_t distance(const std::string &digest1, const std::string &digest2)
+		{
+			std::size_t result = 0;
+			EXPECT_TRUE(similarityHashDistance(digest1, digest2, result));
+			return result;
+		}
+};
+
+TEST_F(SimilarityHashTests, TooShortOrUniformDataHaveNoDigest)
+{
+	EXPECT_EQ("", digestOf({}));
+	EXPECT_EQ("", digestOf(createData(SimilarityHash::MIN_DATA_SIZE - 1, 1)));
+	EXPECT_EQ("", digestOf(std::vector<unsigned char>(4096, 0x90)));
+}
+
+TEST_F(SimilarityHashTests, DigestHasExpectedLength)
+{
+	EXPECT_EQ(SimilarityHash::DIGEST_LENGTH, digestOf(createData(4096, 1)).length());
+}
+
+TEST_F(SimilarityHashTests, DigestDoesNotDependOnSplittingOfData)
+{
+	const auto data = createData(10000, 2);
+	SimilarityHash hash;
+	hash.update(data.data(), 3);
+	hash.update(data.data() + 3, 1000);
+	hash.update(data.data() + 1003, data.size() - 1003);
+
+	EXPECT_EQ(data.size(), hash.getSize());
+	EXPECT_EQ(digestOf(data), hash.getDigest());
+
+	hash.clear();
+	EXPECT_EQ(0, hash.getSize());
+	EXPECT_EQ("", hash.getDigest());
+}
+
+TEST_F(SimilarityHashTests, SimilarDataHaveSmallerDistanceThanUnrelatedData)
+{
+	const auto original = createData(20000, 3);
+	auto modified = original;
+	for(std::size_t i = 0; i < modified.size(); i += 500)
+	{
+		modified[i] ^= 0xFF;
+	}
+	const auto unrelated = createData(20000, 4);
+
+	const auto originalDigest = digestOf(original);
+	EXPECT_EQ(0, distance(originalDigest, originalDigest));
+	const auto similarDistance = distance(originalDigest, digestOf(modified));
+	const auto unrelatedDistance = distance(originalDigest, digestOf(unrelated));
+	EXPECT_LT(similarDistance, unrelatedDistance);
+	EXPECT_EQ(similarDistance, distance(digestOf(modified), originalDigest));
+}
+
+TEST_F(SimilarityHashTests, InvalidDigestsHaveNoDistance)
+{
+	const auto digest = digestOf(createData(4096, 5));
+	std::size_t result = 42;
+	EXPECT_FALSE(similarityHashDistance(digest, "", result));
+	EXPECT_FALSE(similarityHashDistance(digest.substr(2), digest, result));
+	EXPECT_FALSE(similarityHashDistance(digest, "Z" + digest.substr(1), result));
+	EXPECT_EQ(42, result);
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -0,0 +1,235 @@
+/**
+* @file tests/fileinfo/detection_fields_tests.cpp
+* @brief Tests for the @c detection_fields module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <json/json.h>
+
+#include "retdec/fileformat/utils/format_detection.h"
+#include "fileinfo/file_detector/detection_fields.h"
+#include "fileinfo/file_detector/detector_factory.h"
+#include "fileinfo/file_presentation/config_presentation.h"
+#include "fileinfo/file_presentation/getters/simple_getter/header_json_getter.h"
+#include "fileinfo/file_presentation/json_presentation.h"
+
+using namespace ::testing;
+using namespace retdec::cpdetect;
+using namespace retdec::fileformat;
+
+namespace {
+
+/**
+ * 32-bit x86 ELF executable with "UPX!" in its code and
+ * "GCC: (GNU) 4.8.2" in its .comment section
+ */
+const unsigned char elfBytes[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x01, 0x00, 0x28, 0x00,
+0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+0x00, 0x80, 0x04, 0x08, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x90, 0x90, 0x90, 0x90, 0xeb, 0x04, 0x55, 0x50, 0x58, 0x21, 0x31, 0xc0,
+0x40, 0xcd, 0x80, 0x00, 0x47, 0x43, 0x43, 0x3a, 0x20, 0x28, 0x47, 0x4e, 0x55, 0x29, 0x20, 0x34,
+0x2e, 0x38, 0x2e, 0x32, 0x00, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x63, 0x6f, 0x6d,
+0x6d, 0x65, 0x6e, 0x74, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x06, 0x00, 0x00, 0x00, 0x54, 0x80, 0x04, 0x08, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x64, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
+
+const char inputFile[] = "retdec-tests-fileinfo-input.elf";
+const char configFile[] = "retdec-tests-fileinfo-config.json";
+
+/**
+ * Output of detection presented as JSON and as config file
+ */
+struct DetectionOutput
+{
+	Json::Value json;
+	std::string config;
+};
+
+} // anonymous namespace
+
+namespace fileinfo {
+namespace tests {
+
+/**
+ * Tests for the @c detection_fields module
+ */
+class DetectionFieldsTests : public Test
+{
+	protected:
+		virtual void SetUp() override
+		{
+			std::ofstream file(inputFile, std::ios::binary);
+			file.write(reinterpret_cast<const char*>(elfBytes), sizeof(elfBytes));
+		}
+
+		virtual void TearDown() override
+		{
+			std::remove(inputFile);
+			std::remove(configFile);
+		}
+
+		/**
+		 * Detect information about input file like fileinfo does and
+		 * present it in verbose JSON and in config file
+		 */
+		DetectionOutput detect(DetectionStages stages, LoadFlags loadFlags)
+		{
+			DetectionOutput output;
+			const auto format = detectFileFormat(inputFile);
+			FileInformation fileinfo;
+			fileinfo.setPathToFile(inputFile);
+			fileinfo.setFileFormatEnum(format);
+
+			DetectParams searchPar(SearchType::EXACT_MATCH, true, false);
+			std::unique_ptr<FileDetector> detector(createFileDetector(inputFile, format, fileinfo, searchPar, loadFlags));
+			if(!detector || !detector->getFileParser()->isInValidState())
+			{
+				return output;
+			}
+			detector->setDetectionStages(stages);
+			detector->getAllInformation();
+
+			std::stringstream json;
+			auto *coutBuffer = std::cout.rdbuf(json.rdbuf());
+			JsonPresentation(fileinfo, true).present();
+			std::cout.rdbuf(coutBuffer);
+			Json::CharReaderBuilder builder;
+			std::string errors;
+			Json::parseFromStream(builder, json, &output.json, &errors);
+
+			std::remove(configFile);
+			{
+				ConfigPresentation config(fileinfo, configFile);
+				config.present();
+			}
+			std::ifstream config(configFile);
+			output.config.assign(std::istreambuf_iterator<char>(config), std::istreambuf_iterator<char>());
+
+			return output;
+		}
+
+		/**
+		 * Get keys of JSON output which present given field
+		 */
+		std::vector<std::string> getJsonKeys(const std::string &field)
+		{
+			const std::map<std::string, std::vector<std::string>> fieldKeys =
+			{
+				{"format",       {"fileFormat"}},
+				{"class",        {"fileClass"}},
+				{"type",         {"fileType"}},
+				{"architecture", {"architecture"}},
+				{"endianness",   {"endianness"}},
+				{"bits",         {"numberOfBitsInOneWord"}},
+				{"entry-point",  {"entryPoint"}},
+				{"image-base",   {"imageBaseAddress"}},
+				{"compiler",     {"tools", "languages", "packed"}},
+				{"rich-header",  {"richHeader"}},
+				{"overlay",      {"overlay"}},
+				{"pdb",          {"pdbInfo"}},
+				{"resources",    {"resourceTable"}},
+				{"manifest",     {"manifest"}},
+				{"imports",      {"importTable"}},
+				{"exports",      {"exportTable"}},
+				{"hashes",       {"crc32", "md5", "sha256", "entropy", "chiSquare", "likelyContent", "similarityHash"}},
+				{"sections",     {"sectionTable"}},
+				{"segments",     {"segmentTable"}},
+				{"symbols",      {"symbolTables"}},
+				{"relocations",  {"relocationTables"}},
+				{"dotnet",       {"dotnetInfo"}},
+				{"certificates", {"certificateTable"}},
+				{"loader",       {"loaderInfo", "loaderError"}},
+				{"strings",      {"strings"}}
+			};
+
+			if(field == "header")
+			{
+				FileInformation fileinfo;
+				std::vector<std::string> desc, info;
+				HeaderJsonGetter(fileinfo).loadInformation(desc, info);
+				return desc;
+			}
+
+			auto keys = fieldKeys.find(field);
+			return keys == fieldKeys.end() ? std::vector<std::string>() : keys->second;
+		}
+};
+
+TEST_F(DetectionFieldsTests, UnknownFieldIsRejected)
+{
+	DetectionStages stages = ALL_STAGES;
+	LoadFlags loadFlags = LoadFlags::NONE;
+
+	EXPECT_EQ(false, resolveDetectionFields("format,unknown", stages, loadFlags));
+	EXPECT_EQ(ALL_STAGES, stages);
+	EXPECT_EQ(LoadFlags::NONE, loadFlags);
+}
+
+TEST_F(DetectionFieldsTests, ConfigNeedsImports)
+{
+	DetectionStages stages = ALL_STAGES;
+	LoadFlags loadFlags = LoadFlags::NONE;
+
+	ASSERT_EQ(true, resolveDetectionFields("config", stages, loadFlags));
+	EXPECT_EQ(STAGE_IMPORTS, stages & STAGE_IMPORTS);
+	EXPECT_EQ(STAGE_COMPILER, stages & STAGE_COMPILER);
+	EXPECT_EQ(0, loadFlags & NO_VERBOSE_HASHES);
+}
+
+TEST_F(DetectionFieldsTests, EachFieldIsSameAsWithoutFields)
+{
+	const auto loadFlags = LoadFlags::DETECT_STRINGS;
+	const auto full = detect(ALL_STAGES, loadFlags);
+	ASSERT_EQ(true, full.json.isObject());
+	ASSERT_EQ(false, full.config.empty());
+
+	for(const auto &field : getDetectionFieldNames())
+	{
+		auto stages = ALL_STAGES;
+		auto fieldLoadFlags = loadFlags;
+		ASSERT_EQ(true, resolveDetectionFields(field, stages, fieldLoadFlags)) << field;
+		const auto output = detect(stages, fieldLoadFlags);
+		ASSERT_EQ(true, output.json.isObject()) << field;
+
+		if(field == "config")
+		{
+			EXPECT_EQ(full.config, output.config);
+			continue;
+		}
+
+		const auto keys = getJsonKeys(field);
+		EXPECT_EQ(false, keys.empty()) << "no JSON keys for field " << field;
+		for(const auto &key : keys)
+		{
+			EXPECT_EQ(full.json[key], output.json[key]) << field << ": " << key;
+		}
+	}
+}
+
+} // namespace tests
+} // namespace fileinfo
@@ -9,6 +9,7 @@
 
 #include "llvmir2hll/analysis/alias_analysis/alias_analysis_mock.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/address_op_expr.h"
 #include "retdec/llvmir2hll/ir/array_index_op_expr.h"
 #include "retdec/llvmir2hll/ir/array_type.h"
@@ -18,6 +19,7 @@
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/deref_op_expr.h"
 #include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
 #include "retdec/llvmir2hll/ir/pointer_type.h"
 #include "retdec/llvmir2hll/ir/return_stmt.h"
 #include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
@@ -92,10 +94,11 @@ ReturnStmtWithNoReturnValueNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(returnStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
-	EXPECT_EQ(VarSet(), data->getDirReadVars());
-	EXPECT_EQ(VarSet(), data->getDirWrittenVars());
-	EXPECT_EQ(VarSet(), data->getDirAccessedVars());
+	//  - variables: iterators
+	EXPECT_EQ(VarSet(), VarSet(data->dir_read_begin(), data->dir_read_end()));
+	EXPECT_EQ(VarSet(),
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
+	EXPECT_EQ(VarSet(), VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(0, data->getNumOfDirReadVars());
 	EXPECT_EQ(0, data->getNumOfDirWrittenVars());
@@ -137,15 +140,18 @@ VarDefStmtWithNoInitializerNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(varDefStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
 	refDirWrittenVars.insert(varA);
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varA);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(0, data->getNumOfDirReadVars());
 	EXPECT_EQ(1, data->getNumOfDirWrittenVars());
@@ -195,15 +201,18 @@ VarDefStmtWithConstIntInitializerNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(varDefStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
 	refDirWrittenVars.insert(varA);
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varA);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(0, data->getNumOfDirReadVars());
 	EXPECT_EQ(1, data->getNumOfDirWrittenVars());
@@ -256,17 +265,20 @@ VarDefStmtInitializedWithGlobalVariableNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(varDefStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
 	refDirReadVars.insert(varG);
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
 	refDirWrittenVars.insert(varA);
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varA);
 	refDirAllVars.insert(varG);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(1, data->getNumOfDirReadVars());
 	EXPECT_EQ(1, data->getNumOfDirWrittenVars());
@@ -323,15 +335,18 @@ ReturnStmtReturningAddressOfVariableNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(returnStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
 	refDirReadVars.insert(varG);
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varG);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(1, data->getNumOfDirReadVars());
 	EXPECT_EQ(0, data->getNumOfDirWrittenVars());
@@ -385,15 +400,18 @@ ReturnStmtReturningDerefOfVariableNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(returnStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
 	refDirReadVars.insert(varG);
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varG);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(1, data->getNumOfDirReadVars());
 	EXPECT_EQ(0, data->getNumOfDirWrittenVars());
@@ -445,15 +463,18 @@ FunctionCallNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(callStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
 	refDirReadVars.insert(testFunc->getAsVar());
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(testFunc->getAsVar());
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(1, data->getNumOfDirReadVars());
 	EXPECT_EQ(0, data->getNumOfDirWrittenVars());
@@ -509,15 +530,18 @@ ArrayAccessNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(assignA01));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
 	refDirReadVars.insert(varA);
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varA);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(1, data->getNumOfDirReadVars());
 	EXPECT_EQ(0, data->getNumOfDirWrittenVars());
@@ -572,15 +596,18 @@ StructAccessNoCache) {
 
 	ShPtr<ValueData> data(va->getValueData(assignA01));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
 	refDirReadVars.insert(varA);
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varA);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 	//  - variables: counts
 	EXPECT_EQ(1, data->getNumOfDirReadVars());
 	EXPECT_EQ(0, data->getNumOfDirWrittenVars());
@@ -632,15 +659,18 @@ Caching) {
 
 	ShPtr<ValueData> data(va->getValueData(varDefStmt));
 	// Directly read/written variables.
-	//  - variables: get*()
+	//  - variables: iterators
 	VarSet refDirReadVars;
-	EXPECT_EQ(refDirReadVars, data->getDirReadVars());
+	EXPECT_EQ(refDirReadVars,
+		VarSet(data->dir_read_begin(), data->dir_read_end()));
 	VarSet refDirWrittenVars;
 	refDirWrittenVars.insert(varA);
-	EXPECT_EQ(refDirWrittenVars, data->getDirWrittenVars());
+	EXPECT_EQ(refDirWrittenVars,
+		VarSet(data->dir_written_begin(), data->dir_written_end()));
 	VarSet refDirAllVars;
 	refDirAllVars.insert(varA);
-	EXPECT_EQ(refDirAllVars, data->getDirAccessedVars());
+	EXPECT_EQ(refDirAllVars,
+		VarSet(data->dir_all_begin(), data->dir_all_end()));
 
 	// Change the module.
 	//
@@ -653,7 +683,9 @@ Caching) {
 	ShPtr<ValueData> dataAfterChange(va->getValueData(varDefStmt));
 	VarSet refDirWrittenVarsAfterChange;
 	refDirWrittenVarsAfterChange.insert(varA);
-	EXPECT_EQ(refDirWrittenVarsAfterChange, dataAfterChange->getDirWrittenVars()) <<
+	EXPECT_EQ(refDirWrittenVarsAfterChange,
+		VarSet(dataAfterChange->dir_written_begin(),
+			dataAfterChange->dir_written_end())) <<
 		"before clearing the cache, there should still be `a`";
 
 	va->clearCache();
@@ -662,10 +694,66 @@ Caching) {
 	VarSet refDirWrittenVarsAfterCacheClear;
 	refDirWrittenVarsAfterCacheClear.insert(varB);
 	EXPECT_EQ(refDirWrittenVarsAfterCacheClear,
-		dataAfterCacheClear->getDirWrittenVars()) <<
+		VarSet(dataAfterCacheClear->dir_written_begin(),
+			dataAfterCacheClear->dir_written_end())) <<
 		"after clearing the cache, there should be `b`";
 }
 
+TEST_F(ValueAnalysisTests,
+IteratorsAndNumberOfUsesAgreeWithSetsOfVariables) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = a + b * a
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA,
+		AddOpExpr::create(varA, MulOpExpr::create(varB, varA))));
+	testFunc->setBody(assignA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueData> data(va->getValueData(assignA));
+	VarSet readVars(data->dir_read_begin(), data->dir_read_end());
+	EXPECT_EQ(VarSet({varA, varB}), readVars);
+	EXPECT_EQ(2, data->getNumOfDirReadVars());
+	VarSet writtenVars(data->dir_written_begin(), data->dir_written_end());
+	EXPECT_EQ(VarSet({varA}), writtenVars);
+	VarSet allVars(data->dir_all_begin(), data->dir_all_end());
+	EXPECT_EQ(VarSet({varA, varB}), allVars);
+	EXPECT_EQ(3, data->getDirNumOfUses(varA));
+	EXPECT_EQ(1, data->getDirNumOfUses(varB));
+
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(32)));
+	EXPECT_EQ(0, data->getDirNumOfUses(varC));
+	EXPECT_FALSE(data->isDirAccessed(varC));
+}
+
+TEST_F(ValueAnalysisTests,
+DataComputedAfterCacheClearAreEqualToDataComputedBefore) {
+	// Set-up the module.
+	//
+	// def test():
+	//    a = b
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA, varB));
+	testFunc->setBody(assignA);
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	// Make the variables get different numbers after the cache is cleared.
+	va->getValueData(varB);
+	ShPtr<ValueData> dataBeforeClear(va->getValueData(assignA));
+	va->clearCache();
+	ShPtr<ValueData> dataAfterClear(va->getValueData(assignA));
+
+	EXPECT_EQ(*dataBeforeClear, *dataAfterClear);
+	EXPECT_NE(*dataBeforeClear, *va->getValueData(varB));
+}
+
 TEST_F(ValueAnalysisTests,
 AfterStatementChangeAndCacheUpdateCorrectResultsAreReturned) {
 	// Set-up the module.
@@ -686,7 +774,9 @@ AfterStatementChangeAndCacheUpdateCorrectResultsAreReturned) {
 
 	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
 
-	VarSet readVarsInReturnA(va->getValueData(returnA)->getDirReadVars());
+	ShPtr<ValueData> returnAData(va->getValueData(returnA));
+	VarSet readVarsInReturnA(returnAData->dir_read_begin(),
+		returnAData->dir_read_end());
 	EXPECT_EQ(1, readVarsInReturnA.size());
 	EXPECT_EQ(varA, *readVarsInReturnA.begin());
 
@@ -695,7 +785,9 @@ AfterStatementChangeAndCacheUpdateCorrectResultsAreReturned) {
 	// version of `returnA`.
 	returnA->replace(varA, varB);
 	va->removeFromCache(returnA);
-	VarSet newReadVarsInReturnA(va->getValueData(returnA)->getDirReadVars());
+	ShPtr<ValueData> newReturnAData(va->getValueData(returnA));
+	VarSet newReadVarsInReturnA(newReturnAData->dir_read_begin(),
+		newReturnAData->dir_read_end());
 	EXPECT_EQ(1, newReadVarsInReturnA.size());
 	EXPECT_EQ(varB, *newReadVarsInReturnA.begin());
 }
@@ -735,20 +827,23 @@ MayBeReadNoCaching) {
 	// Indirectly read variables.
 	VarSet refMayBeReadVars;
 	refMayBeReadVars.insert(varA);
-	EXPECT_EQ(refMayBeReadVars, data->getMayBeReadVars());
+	EXPECT_EQ(refMayBeReadVars,
+		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_EQ(refMayBeReadVars,
 		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_TRUE(data->mayBeIndirRead(varA));
 	// Indirectly written variables.
 	VarSet refMayBeWrittenVars;
-	EXPECT_EQ(refMayBeWrittenVars, data->getMayBeWrittenVars());
+	EXPECT_EQ(refMayBeWrittenVars,
+		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_EQ(refMayBeWrittenVars,
 		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_FALSE(data->mayBeIndirWritten(varA));
 	// Indirectly accessed variables.
 	VarSet refMayBeAccessedVars;
 	refMayBeAccessedVars.insert(varA);
-	EXPECT_EQ(refMayBeAccessedVars, data->getMayBeAccessedVars());
+	EXPECT_EQ(refMayBeAccessedVars,
+		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_EQ(refMayBeAccessedVars,
 		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_TRUE(data->mayBeIndirAccessed(varA));
@@ -789,21 +884,24 @@ MayBeWrittenNoCaching) {
 	ShPtr<ValueData> data(va->getValueData(assignP1));
 	// Indirectly read variables.
 	VarSet refMayBeReadVars;
-	EXPECT_EQ(refMayBeReadVars, data->getMayBeReadVars());
+	EXPECT_EQ(refMayBeReadVars,
+		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_EQ(refMayBeReadVars,
 		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_FALSE(data->mayBeIndirRead(varA));
 	// Indirectly written variables.
 	VarSet refMayBeWrittenVars;
 	refMayBeWrittenVars.insert(varA);
-	EXPECT_EQ(refMayBeWrittenVars, data->getMayBeWrittenVars());
+	EXPECT_EQ(refMayBeWrittenVars,
+		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_EQ(refMayBeWrittenVars,
 		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_TRUE(data->mayBeIndirWritten(varA));
 	// Indirectly accessed variables.
 	VarSet refMayBeAccessedVars;
 	refMayBeAccessedVars.insert(varA);
-	EXPECT_EQ(refMayBeAccessedVars, data->getMayBeAccessedVars());
+	EXPECT_EQ(refMayBeAccessedVars,
+		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_EQ(refMayBeAccessedVars,
 		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_TRUE(data->mayBeIndirAccessed(varA));
@@ -842,18 +940,21 @@ MustBeReadNoCaching) {
 	// Indirectly read variables.
 	VarSet refMustBeReadVars;
 	refMustBeReadVars.insert(varA);
-	EXPECT_EQ(refMustBeReadVars, data->getMustBeReadVars());
+	EXPECT_EQ(refMustBeReadVars,
+		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	EXPECT_EQ(refMustBeReadVars,
 		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	// Indirectly written variables.
 	VarSet refMustBeWrittenVars;
-	EXPECT_EQ(refMustBeWrittenVars, data->getMustBeWrittenVars());
+	EXPECT_EQ(refMustBeWrittenVars,
+		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	EXPECT_EQ(refMustBeWrittenVars,
 		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	// Indirectly accessed variables.
 	VarSet refMustBeAccessedVars;
 	refMustBeAccessedVars.insert(varA);
-	EXPECT_EQ(refMustBeAccessedVars, data->getMustBeAccessedVars());
+	EXPECT_EQ(refMustBeAccessedVars,
+		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 	EXPECT_EQ(refMustBeAccessedVars,
 		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 }
@@ -891,19 +992,22 @@ MustBeWrittenNoCaching) {
 	ShPtr<ValueData> data(va->getValueData(assignP1));
 	// Indirectly read variables.
 	VarSet refMustBeReadVars;
-	EXPECT_EQ(refMustBeReadVars, data->getMustBeReadVars());
+	EXPECT_EQ(refMustBeReadVars,
+		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	EXPECT_EQ(refMustBeReadVars,
 		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	// Indirectly written variables.
 	VarSet refMustBeWrittenVars;
 	refMustBeWrittenVars.insert(varA);
-	EXPECT_EQ(refMustBeWrittenVars, data->getMustBeWrittenVars());
+	EXPECT_EQ(refMustBeWrittenVars,
+		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	EXPECT_EQ(refMustBeWrittenVars,
 		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	// Indirectly accessed variables.
 	VarSet refMustBeAccessedVars;
 	refMustBeAccessedVars.insert(varA);
-	EXPECT_EQ(refMustBeAccessedVars, data->getMustBeAccessedVars());
+	EXPECT_EQ(refMustBeAccessedVars,
+		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 	EXPECT_EQ(refMustBeAccessedVars,
 		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 }
@@ -953,19 +1057,22 @@ MustBeReadNestedDereferencesNoCaching) {
 	VarSet refMustBeReadVars;
 	refMustBeReadVars.insert(varA);
 	refMustBeReadVars.insert(varP);
-	EXPECT_EQ(refMustBeReadVars, data->getMustBeReadVars());
+	EXPECT_EQ(refMustBeReadVars,
+		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	EXPECT_EQ(refMustBeReadVars,
 		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	// Indirectly written variables.
 	VarSet refMustBeWrittenVars;
-	EXPECT_EQ(refMustBeWrittenVars, data->getMustBeWrittenVars());
+	EXPECT_EQ(refMustBeWrittenVars,
+		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	EXPECT_EQ(refMustBeWrittenVars,
 		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	// Indirectly accessed variables.
 	VarSet refMustBeAccessedVars;
 	refMustBeAccessedVars.insert(varA);
 	refMustBeAccessedVars.insert(varP);
-	EXPECT_EQ(refMustBeAccessedVars, data->getMustBeAccessedVars());
+	EXPECT_EQ(refMustBeAccessedVars,
+		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 	EXPECT_EQ(refMustBeAccessedVars,
 		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 }
@@ -1019,14 +1126,16 @@ MayBeReadNestedDereferencesNoCaching) {
 	VarSet refMayBeReadVars;
 	refMayBeReadVars.insert(varA);
 	refMayBeReadVars.insert(varP);
-	EXPECT_EQ(refMayBeReadVars, data->getMayBeReadVars());
+	EXPECT_EQ(refMayBeReadVars,
+		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_EQ(refMayBeReadVars,
 		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_TRUE(data->mayBeIndirRead(varA));
 	EXPECT_TRUE(data->mayBeIndirRead(varP));
 	// Indirectly written variables.
 	VarSet refMayBeWrittenVars;
-	EXPECT_EQ(refMayBeWrittenVars, data->getMayBeWrittenVars());
+	EXPECT_EQ(refMayBeWrittenVars,
+		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_EQ(refMayBeWrittenVars,
 		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_FALSE(data->mayBeIndirWritten(varA));
@@ -1035,7 +1144,8 @@ MayBeReadNestedDereferencesNoCaching) {
 	VarSet refMayBeAccessedVars;
 	refMayBeAccessedVars.insert(varA);
 	refMayBeAccessedVars.insert(varP);
-	EXPECT_EQ(refMayBeAccessedVars, data->getMayBeAccessedVars());
+	EXPECT_EQ(refMayBeAccessedVars,
+		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_EQ(refMayBeAccessedVars,
 		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_TRUE(data->mayBeIndirAccessed(varA));
@@ -1086,20 +1196,23 @@ MustBeWrittenNestedDereferencesNoCaching) {
 	// Indirectly read variables.
 	VarSet refMustBeReadVars;
 	refMustBeReadVars.insert(varP);
-	EXPECT_EQ(refMustBeReadVars, data->getMustBeReadVars());
+	EXPECT_EQ(refMustBeReadVars,
+		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	EXPECT_EQ(refMustBeReadVars,
 		VarSet(data->must_be_read_begin(), data->must_be_read_end()));
 	// Indirectly written variables.
 	VarSet refMustBeWrittenVars;
 	refMustBeWrittenVars.insert(varA);
-	EXPECT_EQ(refMustBeWrittenVars, data->getMustBeWrittenVars());
+	EXPECT_EQ(refMustBeWrittenVars,
+		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	EXPECT_EQ(refMustBeWrittenVars,
 		VarSet(data->must_be_written_begin(), data->must_be_written_end()));
 	// Indirectly accessed variables.
 	VarSet refMustBeAccessedVars;
 	refMustBeAccessedVars.insert(varA);
 	refMustBeAccessedVars.insert(varP);
-	EXPECT_EQ(refMustBeAccessedVars, data->getMustBeAccessedVars());
+	EXPECT_EQ(refMustBeAccessedVars,
+		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 	EXPECT_EQ(refMustBeAccessedVars,
 		VarSet(data->must_be_accessed_begin(), data->must_be_accessed_end()));
 }
@@ -1152,7 +1265,8 @@ MayBeWrittenNestedDereferencesNoCaching) {
 	// Indirectly read variables.
 	VarSet refMayBeReadVars;
 	refMayBeReadVars.insert(varP);
-	EXPECT_EQ(refMayBeReadVars, data->getMayBeReadVars());
+	EXPECT_EQ(refMayBeReadVars,
+		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_EQ(refMayBeReadVars,
 		VarSet(data->may_be_read_begin(), data->may_be_read_end()));
 	EXPECT_FALSE(data->mayBeIndirRead(varA));
@@ -1160,7 +1274,8 @@ MayBeWrittenNestedDereferencesNoCaching) {
 	// Indirectly written variables.
 	VarSet refMayBeWrittenVars;
 	refMayBeWrittenVars.insert(varA);
-	EXPECT_EQ(refMayBeWrittenVars, data->getMayBeWrittenVars());
+	EXPECT_EQ(refMayBeWrittenVars,
+		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_EQ(refMayBeWrittenVars,
 		VarSet(data->may_be_written_begin(), data->may_be_written_end()));
 	EXPECT_TRUE(data->mayBeIndirWritten(varA));
@@ -1169,7 +1284,8 @@ MayBeWrittenNestedDereferencesNoCaching) {
 	VarSet refMayBeAccessedVars;
 	refMayBeAccessedVars.insert(varA);
 	refMayBeAccessedVars.insert(varP);
-	EXPECT_EQ(refMayBeAccessedVars, data->getMayBeAccessedVars());
+	EXPECT_EQ(refMayBeAccessedVars,
+		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_EQ(refMayBeAccessedVars,
 		VarSet(data->may_be_accessed_begin(), data->may_be_accessed_end()));
 	EXPECT_TRUE(data->mayBeIndirAccessed(varA));
@@ -1397,6 +1397,109 @@ NumConstFloatBitCastExprToIntTypeTypeTest) {
 		"but the expression was not evaluated";
 }
 
+//
+// Tests for returned constants and memoization.
+//
+
+TEST_F(CArithmExprEvaluatorTests,
+EvaluationOfConstantReturnsSameConstant) {
+	ShPtr<ConstInt> inputExpr(ConstInt::create(2, 64));
+
+	ShPtr<ArithmExprEvaluator> evaluator(CArithmExprEvaluator::create());
+	EXPECT_EQ(inputExpr, evaluator->evaluate(inputExpr));
+}
+
+TEST_F(CArithmExprEvaluatorTests,
+ModifiedExpressionIsEvaluatedAgain) {
+	SCOPED_TRACE("2 + 3   ->   5, then 10 + 3   ->   13");
+	ShPtr<AddOpExpr> inputExpr(AddOpExpr::create(
+		ConstInt::create(2, 64),
+		ConstInt::create(3, 64)
+	));
+
+	ShPtr<ArithmExprEvaluator> evaluator(CArithmExprEvaluator::create());
+	ASSERT_TRUE(ConstInt::create(5, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr)));
+
+	inputExpr->setFirstOperand(ConstInt::create(10, 64));
+	EXPECT_TRUE(ConstInt::create(13, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr)));
+}
+
+TEST_F(CArithmExprEvaluatorTests,
+ExpressionWithConstantModifiedInPlaceIsEvaluatedAgain) {
+	SCOPED_TRACE("2 + 3   ->   5, then -2 + 3   ->   1");
+	ShPtr<ConstInt> firstOp(ConstInt::create(2, 64));
+	ShPtr<AddOpExpr> inputExpr(AddOpExpr::create(
+		firstOp,
+		ConstInt::create(3, 64)
+	));
+
+	ShPtr<ArithmExprEvaluator> evaluator(CArithmExprEvaluator::create());
+	ASSERT_TRUE(ConstInt::create(5, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr)));
+
+	firstOp->flipSign();
+	EXPECT_TRUE(ConstInt::create(1, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr)));
+}
+
+TEST_F(CArithmExprEvaluatorTests,
+SameExpressionWithOtherVarValuesIsEvaluatedAgain) {
+	SCOPED_TRACE("a(2) + 3   ->   5, then a(4) + 3   ->   7, then a + 3   ->   not evaluated");
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(64, true)));
+	ShPtr<AddOpExpr> inputExpr(AddOpExpr::create(
+		varA,
+		ConstInt::create(3, 64)
+	));
+
+	ShPtr<ArithmExprEvaluator> evaluator(CArithmExprEvaluator::create());
+	VarConstMap varConstMap;
+	varConstMap[varA] = ConstInt::create(2, 64);
+	ASSERT_TRUE(ConstInt::create(5, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr, varConstMap)));
+
+	varConstMap[varA] = ConstInt::create(4, 64);
+	EXPECT_TRUE(ConstInt::create(7, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr, varConstMap)));
+
+	EXPECT_FALSE(evaluator->evaluate(inputExpr));
+}
+
+TEST_F(CArithmExprEvaluatorTests,
+ExpressionWithVarReplacedByItsCopyIsEvaluatedAgain) {
+	SCOPED_TRACE("a(2) + 3   ->   5, then a'(no value) + 3   ->   not evaluated");
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(64, true)));
+	ShPtr<AddOpExpr> inputExpr(AddOpExpr::create(
+		varA,
+		ConstInt::create(3, 64)
+	));
+
+	ShPtr<ArithmExprEvaluator> evaluator(CArithmExprEvaluator::create());
+	VarConstMap varConstMap;
+	varConstMap[varA] = ConstInt::create(2, 64);
+	ASSERT_TRUE(ConstInt::create(5, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr, varConstMap)));
+
+	inputExpr->setFirstOperand(varA->copy());
+	EXPECT_FALSE(evaluator->evaluate(inputExpr, varConstMap));
+}
+
+TEST_F(CArithmExprEvaluatorTests,
+RepeatedEvaluationOfUnmodifiedExpressionGivesSameResult) {
+	SCOPED_TRACE("2 + 3   ->   5, twice");
+	ShPtr<AddOpExpr> inputExpr(AddOpExpr::create(
+		ConstInt::create(2, 64),
+		ConstInt::create(3, 64)
+	));
+
+	ShPtr<ArithmExprEvaluator> evaluator(CArithmExprEvaluator::create());
+	ASSERT_TRUE(ConstInt::create(5, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr)));
+	EXPECT_TRUE(ConstInt::create(5, 64)->isEqualTo(
+		evaluator->evaluate(inputExpr)));
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
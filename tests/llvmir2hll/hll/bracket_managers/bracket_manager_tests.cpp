@@ -0,0 +1,118 @@
+/**
+* @file tests/llvmir2hll/hll/bracket_managers/bracket_manager_tests.cpp
+* @brief Implementation of the base class for tests of brackets managers.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/hll/bracket_manager.h"
+#include "llvmir2hll/hll/bracket_managers/bracket_manager_tests.h"
+#include "retdec/llvmir2hll/ir/binary_op_expr.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/cast_expr.h"
+#include "retdec/llvmir2hll/ir/expression.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/ternary_op_expr.h"
+#include "retdec/llvmir2hll/ir/unary_op_expr.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Decides whether brackets are needed around @a expr when the return
+*        statement in the body of @c testFunc is emitted.
+*
+* @param[in] manager Brackets manager under test.
+* @param[in] expr Expression from the returned value.
+*
+* The returned value is traversed in the same way as HLL writers traverse
+* expressions during emission, i.e. @a manager is informed whenever an operand
+* is entered or left.
+*/
+bool BracketManagerTests::areBracketsNeeded(BracketManager &manager,
+		ShPtr<Expression> expr) {
+	ShPtr<ReturnStmt> returnStmt(cast<ReturnStmt>(testFunc->getBody()));
+	EXPECT_TRUE(returnStmt) << "the body of the test function has to be a "
+		"return statement";
+	if (!returnStmt) {
+		return false;
+	}
+
+	bool bracketsAreNeeded = false;
+	EXPECT_TRUE(findAndDecide(manager, returnStmt->getRetVal(), expr,
+		bracketsAreNeeded)) << expr << " is not in the returned value";
+	return bracketsAreNeeded;
+}
+
+/**
+* @brief Searches for @a expr in @a current and decides whether brackets are
+*        needed around it.
+*
+* @return @c true if @a expr has been found, @c false otherwise.
+*/
+bool BracketManagerTests::findAndDecide(BracketManager &manager,
+		ShPtr<Expression> current, ShPtr<Expression> expr,
+		bool &bracketsAreNeeded) {
+	if (current == expr) {
+		bracketsAreNeeded = manager.areBracketsNeeded(expr);
+		return true;
+	}
+
+	if (ShPtr<UnaryOpExpr> unaryOpExpr = cast<UnaryOpExpr>(current)) {
+		return findAndDecideInOperandOf(manager, current,
+			unaryOpExpr->getOperand(), expr, bracketsAreNeeded);
+	} else if (ShPtr<CastExpr> castExpr = cast<CastExpr>(current)) {
+		return findAndDecideInOperandOf(manager, current,
+			castExpr->getOperand(), expr, bracketsAreNeeded);
+	} else if (ShPtr<BinaryOpExpr> binaryOpExpr = cast<BinaryOpExpr>(current)) {
+		if (findAndDecideInOperandOf(manager, current,
+				binaryOpExpr->getFirstOperand(), expr, bracketsAreNeeded)) {
+			return true;
+		}
+		manager.enterSecondOperandOf(binaryOpExpr);
+		bool found = findAndDecide(manager, binaryOpExpr->getSecondOperand(),
+			expr, bracketsAreNeeded);
+		manager.leaveOperandOf(binaryOpExpr);
+		return found;
+	} else if (ShPtr<TernaryOpExpr> ternaryOpExpr = cast<TernaryOpExpr>(current)) {
+		return findAndDecideInOperandOf(manager, current,
+				ternaryOpExpr->getCondition(), expr, bracketsAreNeeded) ||
+			findAndDecideInOperandOf(manager, current,
+				ternaryOpExpr->getTrueValue(), expr, bracketsAreNeeded) ||
+			findAndDecideInOperandOf(manager, current,
+				ternaryOpExpr->getFalseValue(), expr, bracketsAreNeeded);
+	} else if (ShPtr<CallExpr> callExpr = cast<CallExpr>(current)) {
+		if (findAndDecideInOperandOf(manager, current,
+				callExpr->getCalledExpr(), expr, bracketsAreNeeded)) {
+			return true;
+		}
+		for (const auto &arg : callExpr->getArgs()) {
+			if (findAndDecideInOperandOf(manager, current, arg, expr,
+					bracketsAreNeeded)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+* @brief Searches for @a expr in @a operand of @a parent (see
+*        BracketManager::enterOperandOf()).
+*
+* @return @c true if @a expr has been found, @c false otherwise.
+*/
+bool BracketManagerTests::findAndDecideInOperandOf(BracketManager &manager,
+		ShPtr<Expression> parent, ShPtr<Expression> operand,
+		ShPtr<Expression> expr, bool &bracketsAreNeeded) {
+	manager.enterOperandOf(parent);
+	bool found = findAndDecide(manager, operand, expr, bracketsAreNeeded);
+	manager.leaveOperandOf(parent);
+	return found;
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
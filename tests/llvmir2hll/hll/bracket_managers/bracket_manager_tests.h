@@ -0,0 +1,41 @@
+/**
+* @file tests/llvmir2hll/hll/bracket_managers/bracket_manager_tests.h
+* @brief Base class for tests of brackets managers.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef BACKEND_BIR_HLL_BRACKET_MANAGERS_TESTS_BRACKET_MANAGER_TESTS_H
+#define BACKEND_BIR_HLL_BRACKET_MANAGERS_TESTS_BRACKET_MANAGER_TESTS_H
+
+#include <gtest/gtest.h>
+
+#include "llvmir2hll/ir/tests_with_module.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class BracketManager;
+class Expression;
+
+namespace tests {
+
+/**
+* @brief Base class for tests of brackets managers.
+*/
+class BracketManagerTests: public TestsWithModule {
+protected:
+	bool areBracketsNeeded(BracketManager &manager, ShPtr<Expression> expr);
+
+private:
+	bool findAndDecide(BracketManager &manager, ShPtr<Expression> current,
+		ShPtr<Expression> expr, bool &bracketsAreNeeded);
+	bool findAndDecideInOperandOf(BracketManager &manager,
+		ShPtr<Expression> parent, ShPtr<Expression> operand,
+		ShPtr<Expression> expr, bool &bracketsAreNeeded);
+};
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
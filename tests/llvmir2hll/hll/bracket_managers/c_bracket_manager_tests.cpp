@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/hll/bracket_managers/c_bracket_manager.h"
+#include "llvmir2hll/hll/bracket_managers/bracket_manager_tests.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/address_op_expr.h"
 #include "retdec/llvmir2hll/ir/and_op_expr.h"
@@ -41,7 +42,6 @@
 #include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
 #include "retdec/llvmir2hll/ir/sub_op_expr.h"
 #include "retdec/llvmir2hll/ir/ternary_op_expr.h"
-#include "llvmir2hll/ir/tests_with_module.h"
 #include "retdec/llvmir2hll/ir/variable.h"
 
 using namespace ::testing;
@@ -53,11 +53,11 @@ namespace tests {
 /**
 * @brief Tests for the @c c_bracket_manager module.
 */
-class CBracketManagerTests: public TestsWithModule {};
+class CBracketManagerTests: public BracketManagerTests {};
 
 TEST_F(CBracketManagerTests,
 ManagerHasNonEmptyID) {
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
 	EXPECT_TRUE(!cBrackets.getId().empty()) <<
 		"the manager should have a non-empty ID";
@@ -82,11 +82,11 @@ MulAdd) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -116,13 +116,13 @@ MulDivMul) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr2));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr1)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr1)) <<
 		"not expected brackets around " << mulOpExpr1;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr2)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr2)) <<
 		"not expected brackets around " << mulOpExpr2;
 }
 
@@ -147,11 +147,11 @@ MulDiv) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -176,11 +176,11 @@ DivMul) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, mulOpExpr)) <<
 		"expected brackets around " << mulOpExpr;
 }
 
@@ -205,11 +205,11 @@ DivDivBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExprABC));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExprABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExprABC)) <<
 		"not expected brackets around " << divOpExprABC;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(divOpExprBC)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, divOpExprBC)) <<
 		"expected brackets around " << divOpExprBC;
 }
 
@@ -234,11 +234,11 @@ DivDivBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExprABC));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExprAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExprAB)) <<
 		"not expected brackets around " << divOpExprABC;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExprABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExprABC)) <<
 		"not expected brackets around " << divOpExprABC;
 }
 
@@ -261,11 +261,11 @@ NotEqBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(eqOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, notOpExpr)) <<
 		"not expected brackets around " << notOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
 }
 
@@ -288,11 +288,11 @@ EqNotBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(eqOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, notOpExpr)) <<
 		"not expected brackets around " << notOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
 }
 
@@ -345,21 +345,21 @@ NotEqGtEqGtLtEqLtNeqFirst) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(neqOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, notOpExpr)) <<
 		"not expected brackets around " << notOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, eqOpExpr)) <<
 		"expected brackets around " << eqOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(gtEqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, gtEqOpExpr)) <<
 		"not expected brackets around " << gtEqOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(gtOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, gtOpExpr)) <<
 		"not expected brackets around " << gtOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(ltEqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, ltEqOpExpr)) <<
 		"not expected brackets around " << ltEqOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(neqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, neqOpExpr)) <<
 		"not expected brackets around " << neqOpExpr;
 }
 
@@ -412,21 +412,21 @@ NotEqGtEqGtLtEqLtNeqSecond) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(notOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, notOpExpr)) <<
 		"expected brackets around " << notOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, eqOpExpr)) <<
 		"expected brackets around " << eqOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(gtEqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, gtEqOpExpr)) <<
 		"not expected brackets around " << gtEqOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(gtOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, gtOpExpr)) <<
 		"expected brackets around " << gtOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(ltEqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, ltEqOpExpr)) <<
 		"expected brackets around " << ltEqOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, ltOpExpr)) <<
 		"expected brackets around " << ltOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(neqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, neqOpExpr)) <<
 		"expected brackets around " << neqOpExpr;
 }
 
@@ -466,17 +466,17 @@ DivAddSub) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExprBC)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExprBC)) <<
 		"not expected brackets around " << addOpExprBC;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(subOpExprAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, subOpExprAB)) <<
 		"not expected brackets around " << subOpExprAB;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExprBCAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExprBCAB)) <<
 		"not expected brackets around " << addOpExprBCAB;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(addOpExprABCAB)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, addOpExprABCAB)) <<
 		"expected brackets around " << addOpExprABCAB;
 }
 
@@ -501,13 +501,13 @@ AddrDerefUnar) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addressOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(negOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, negOpExpr)) <<
 		"not expected brackets around " << negOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, derefOpExpr)) <<
 		"not expected brackets around " << derefOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addressOpExpr)) <<
 		"not expected brackets around " << addressOpExpr;
 }
 
@@ -528,11 +528,11 @@ AddrBeforeArrayIndex) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, varA)) <<
 		"not expected brackets around " << varA;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, addressOpExpr)) <<
 		"expected brackets around " << addressOpExpr;
 }
 
@@ -553,9 +553,9 @@ AddrAfterArrayIndex) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addressOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(arrayIndexOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, arrayIndexOpExpr)) <<
 		"not expected brackets around " << arrayIndexOpExpr;
 }
 
@@ -594,17 +594,17 @@ AddrDerefAndGtLtEq) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(andOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(andOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, andOpExpr)) <<
 		"not expected brackets around " << andOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, derefOpExpr)) <<
 		"not expected brackets around " << derefOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addressOpExpr)) <<
 		"not expected brackets around " << addressOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(ltEqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, ltEqOpExpr)) <<
 		"expected brackets around " << ltEqOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(gtOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, gtOpExpr)) <<
 		"expected brackets around " << gtOpExpr;
 }
 
@@ -675,27 +675,27 @@ OneOperatorFromOnePrecedenceRowFirst) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(orOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, derefOpExpr)) <<
 		"not expected brackets around " << derefOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(modOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, modOpExpr)) <<
 		"not expected brackets around " << modOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(bitShrOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, bitShrOpExpr)) <<
 		"not expected brackets around " << bitShrOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(bitAndOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, bitAndOpExpr)) <<
 		"not expected brackets around " << bitAndOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(bitXorOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, bitXorOpExpr)) <<
 		"not expected brackets around " << bitXorOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(bitOrOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, bitOrOpExpr)) <<
 		"not expected brackets around " << bitOrOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(andOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, andOpExpr)) <<
 		"not expected brackets around " << andOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(orOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, orOpExpr)) <<
 		"not expected brackets around " << orOpExpr;
 }
 
@@ -767,27 +767,27 @@ OneOperatorFromOnePrecedenceRowSecond) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addressOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(orOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, orOpExpr)) <<
 		"expected brackets around " << orOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(andOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, andOpExpr)) <<
 		"expected brackets around " << andOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(neqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, neqOpExpr)) <<
 		"not expected brackets around " << neqOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(bitOrOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, bitOrOpExpr)) <<
 		"expected brackets around " << bitOrOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(bitXorOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, bitXorOpExpr)) <<
 		"expected brackets around " << bitXorOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(bitAndOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, bitAndOpExpr)) <<
 		"expected brackets around " << bitAndOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(bitShlOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, bitShlOpExpr)) <<
 		"expected brackets around " << bitShlOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, divOpExpr)) <<
 		"expected brackets around " << divOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addressOpExpr)) <<
 		"not expected brackets around " << addressOpExpr;
 }
 
@@ -818,13 +818,13 @@ TernaryOpBracketsAreNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(ternaryOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(ternaryOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, ternaryOpExpr)) <<
 		"not expected brackets around " << ternaryOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
 }
 
@@ -860,15 +860,15 @@ TernaryOpBracketsAreNeededFalseCond) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(modOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(modOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, modOpExpr)) <<
 		"not expected brackets around " << modOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(ternaryOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, ternaryOpExpr)) <<
 		"expected brackets around " << ternaryOpExpr;
 }
 
@@ -904,15 +904,15 @@ TernaryOpBracketsAreNeededTrueCond) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(modOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(modOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, modOpExpr)) <<
 		"not expected brackets around " << modOpExpr;
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(ternaryOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, ternaryOpExpr)) <<
 		"expected brackets around " << ternaryOpExpr;
 }
 
@@ -935,9 +935,9 @@ CastBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
 }
 
@@ -960,9 +960,9 @@ CastBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(intToPtrCastExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
 }
 
@@ -985,9 +985,9 @@ CastBeforeArrayIndexBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(intToPtrCastExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, intToPtrCastExpr)) <<
 		"expected brackets around " << intToPtrCastExpr;
 }
 
@@ -1010,9 +1010,9 @@ CastBeforeStructIndexBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(structIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(intToPtrCastExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, intToPtrCastExpr)) <<
 		"expected brackets around " << intToPtrCastExpr;
 }
 
@@ -1040,9 +1040,9 @@ CallExprWithArgumentsBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
 }
 
@@ -1075,11 +1075,11 @@ CallExprInExpressionWithArgumentsBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(subOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, subOpExpr)) <<
 		"not expected brackets around " << subOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(callExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, callExpr)) <<
 		"not expected brackets around " << callExpr;
 }
 
@@ -1102,11 +1102,11 @@ CallExprOfArrayIndexBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, varA)) <<
 		"not expected brackets around " << varA;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(arrayIndexOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, arrayIndexOpExpr)) <<
 		"not expected brackets around " << arrayIndexOpExpr;
 }
 
@@ -1129,9 +1129,9 @@ CalledExprIsCastBracketsAreNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(castExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, castExpr)) <<
 		"expected brackets around " << castExpr;
 }
 
@@ -1152,9 +1152,9 @@ CalledExprIsDerefBracketsAreNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, derefOpExpr)) <<
 		"expected brackets around " << derefOpExpr;
 }
 
@@ -1177,9 +1177,9 @@ ArrayIndexOpExprBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
 }
 
@@ -1197,9 +1197,9 @@ ArrayIndexOpExprBracketsNotNeededIfJustVariableIsIndexed) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, varA)) <<
 		"not expected brackets around " << varA;
 }
 
@@ -1227,11 +1227,11 @@ ArrayIndexOpExprInExpressionBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(subOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, subOpExpr)) <<
 		"not expected brackets around " << subOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(arrayIndexOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, arrayIndexOpExpr)) <<
 		"not expected brackets around " << arrayIndexOpExpr;
 }
 
@@ -1260,11 +1260,11 @@ StructIndexOpExprInExpressionBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -1282,9 +1282,9 @@ StructIndexOpExprBracketsNotNeededIfJustVariableIsIndexed) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(structIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, varA)) <<
 		"not expected brackets around " << varA;
 }
 
@@ -1305,11 +1305,11 @@ MulAssign) {
 	);
 	auto returnStmt = ReturnStmt::create(mulOpExpr);
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(assignOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, assignOpExpr)) <<
 		"expected brackets around " << assignOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -1326,11 +1326,11 @@ AssignAssignBracketsNotNeeded) {
 	auto assignABC = AssignOpExpr::create(varA, assignBC);
 	auto returnStmt = ReturnStmt::create(assignABC);
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(assignABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, assignABC)) <<
 		"not expected brackets around " << assignABC;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(assignBC)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, assignBC)) <<
 		"not expected brackets around " << assignBC;
 }
 
@@ -1351,11 +1351,11 @@ MulComma) {
 	);
 	auto returnStmt = ReturnStmt::create(mulOpExpr);
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_TRUE(cBrackets.areBracketsNeeded(commaOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(cBrackets, commaOpExpr)) <<
 		"expected brackets around " << commaOpExpr;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -1372,11 +1372,11 @@ CommaCommaBracketsNotNeeded) {
 	auto commaABC = CommaOpExpr::create(commaAB, varC);
 	auto returnStmt = ReturnStmt::create(commaABC);
 	testFunc->setBody(returnStmt);
-	CBracketManager cBrackets(module);
+	CBracketManager cBrackets;
 
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(commaABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, commaABC)) <<
 		"not expected brackets around " << commaABC;
-	EXPECT_FALSE(cBrackets.areBracketsNeeded(commaAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(cBrackets, commaAB)) <<
 		"not expected brackets around " << commaAB;
 }
 
@@ -29,7 +29,7 @@ class NoBracketManagerTests: public TestsWithModule {};
 
 TEST_F(NoBracketManagerTests,
 ManagerHasNonEmptyID) {
-	NoBracketManager noBrackets(module);
+	NoBracketManager noBrackets;
 
 	EXPECT_TRUE(!noBrackets.getId().empty()) <<
 		"the manager should have a non-empty ID";
@@ -54,7 +54,7 @@ MulAdd) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	NoBracketManager noBracketManager(module);
+	NoBracketManager noBracketManager;
 
 	EXPECT_TRUE(noBracketManager.areBracketsNeeded(addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
@@ -88,7 +88,7 @@ MulDivMul) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr2));
 	testFunc->setBody(returnStmt);
-	NoBracketManager noBracketManager(module);
+	NoBracketManager noBracketManager;
 
 	EXPECT_TRUE(noBracketManager.areBracketsNeeded(divOpExpr)) <<
 		"expected brackets around " << divOpExpr;
@@ -119,7 +119,7 @@ MulDiv) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	NoBracketManager noBracketManager(module);
+	NoBracketManager noBracketManager;
 
 	EXPECT_TRUE(noBracketManager.areBracketsNeeded(divOpExpr)) <<
 		"expected brackets around " << divOpExpr;
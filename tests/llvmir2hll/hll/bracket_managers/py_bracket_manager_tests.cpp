@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/hll/bracket_managers/py_bracket_manager.h"
+#include "llvmir2hll/hll/bracket_managers/bracket_manager_tests.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/address_op_expr.h"
 #include "retdec/llvmir2hll/ir/and_op_expr.h"
@@ -40,7 +41,6 @@
 #include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
 #include "retdec/llvmir2hll/ir/sub_op_expr.h"
 #include "retdec/llvmir2hll/ir/ternary_op_expr.h"
-#include "llvmir2hll/ir/tests_with_module.h"
 #include "retdec/llvmir2hll/ir/variable.h"
 
 using namespace ::testing;
@@ -52,11 +52,11 @@ namespace tests {
 /**
 * @brief Tests for the @c py_bracket_manager module.
 */
-class PyBracketManagerTests: public TestsWithModule {};
+class PyBracketManagerTests: public BracketManagerTests {};
 
 TEST_F(PyBracketManagerTests,
 ManagerHasNonEmptyID) {
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
 	EXPECT_TRUE(!pyBrackets.getId().empty()) <<
 		"the manager should have a non-empty ID";
@@ -81,11 +81,11 @@ MulAdd) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -115,13 +115,13 @@ MulDivMul) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr2));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr1)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr1)) <<
 		"not expected brackets around " << mulOpExpr1;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr2)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr2)) <<
 		"not expected brackets around " << mulOpExpr2;
 }
 
@@ -146,11 +146,11 @@ MulDiv) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -175,11 +175,11 @@ DivMul) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"expected brackets around " << mulOpExpr;
 }
 
@@ -204,11 +204,11 @@ DivDivBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExprABC));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExprABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExprABC)) <<
 		"not expected brackets around " << divOpExprABC;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(divOpExprBC)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, divOpExprBC)) <<
 		"expected brackets around " << divOpExprBC;
 }
 
@@ -233,11 +233,11 @@ DivDivBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExprABC));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExprAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExprAB)) <<
 		"not expected brackets around " << divOpExprABC;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExprABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExprABC)) <<
 		"not expected brackets around " << divOpExprABC;
 }
 
@@ -260,11 +260,11 @@ NotEqBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(eqOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, notOpExpr)) <<
 		"not expected brackets around " << notOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
 }
 
@@ -288,11 +288,11 @@ EqNotBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(eqOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, notOpExpr)) <<
 		"expected brackets around " << notOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
 }
 
@@ -345,21 +345,21 @@ NotEqGtEqGtLtEqLtNeqBracketsAreNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(neqOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, notOpExpr)) <<
 		"not expected brackets around " << notOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(gtEqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, gtEqOpExpr)) <<
 		"not expected brackets around " << gtEqOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(gtOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, gtOpExpr)) <<
 		"not expected brackets around " << gtOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(ltEqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, ltEqOpExpr)) <<
 		"not expected brackets around " << ltEqOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(neqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, neqOpExpr)) <<
 		"not expected brackets around " << neqOpExpr;
 }
 
@@ -412,21 +412,21 @@ NotEqGtEqGtLtEqLtNeqBracketsAreNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(notOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(notOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, notOpExpr)) <<
 		"expected brackets around " << notOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, eqOpExpr)) <<
 		"expected brackets around " << eqOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(gtEqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, gtEqOpExpr)) <<
 		"expected brackets around " << gtEqOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(gtOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, gtOpExpr)) <<
 		"expected brackets around " << gtOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(ltEqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, ltEqOpExpr)) <<
 		"expected brackets around " << ltEqOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, ltOpExpr)) <<
 		"expected brackets around " << ltOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(neqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, neqOpExpr)) <<
 		"expected brackets around " << neqOpExpr;
 }
 
@@ -466,17 +466,17 @@ DivAddSub) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(divOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExprBC)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExprBC)) <<
 		"not expected brackets around " << addOpExprBC;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(subOpExprAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, subOpExprAB)) <<
 		"not expected brackets around " << subOpExprAB;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExprBCAB)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExprBCAB)) <<
 		"not expected brackets around " << addOpExprBCAB;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, divOpExpr)) <<
 		"not expected brackets around " << divOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(addOpExprABCAB)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, addOpExprABCAB)) <<
 		"expected brackets around " << addOpExprABCAB;
 }
 
@@ -501,13 +501,13 @@ AddrDerefUnar) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addressOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(negOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, negOpExpr)) <<
 		"not expected brackets around " << negOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, derefOpExpr)) <<
 		"not expected brackets around " << derefOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addressOpExpr)) <<
 		"not expected brackets around " << addressOpExpr;
 }
 
@@ -528,11 +528,11 @@ AddrBeforeArrayIndex) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, varA)) <<
 		"not expected brackets around " << varA;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, addressOpExpr)) <<
 		"expected brackets around " << addressOpExpr;
 }
 
@@ -553,9 +553,9 @@ AddrAfterArrayIndex) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addressOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(arrayIndexOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, arrayIndexOpExpr)) <<
 		"not expected brackets around " << arrayIndexOpExpr;
 }
 
@@ -594,17 +594,17 @@ AddrDerefAndGtLtEq) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(andOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(andOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, andOpExpr)) <<
 		"not expected brackets around " << andOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, derefOpExpr)) <<
 		"not expected brackets around " << derefOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addressOpExpr)) <<
 		"not expected brackets around " << addressOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(ltEqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, ltEqOpExpr)) <<
 		"expected brackets around " << ltEqOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(gtOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, gtOpExpr)) <<
 		"expected brackets around " << gtOpExpr;
 }
 
@@ -675,27 +675,27 @@ OneOperatorFromOnePrecedenceRowBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(orOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, derefOpExpr)) <<
 		"not expected brackets around " << derefOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(modOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, modOpExpr)) <<
 		"not expected brackets around " << modOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(bitShrOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, bitShrOpExpr)) <<
 		"not expected brackets around " << bitShrOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(bitAndOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, bitAndOpExpr)) <<
 		"not expected brackets around " << bitAndOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(bitXorOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, bitXorOpExpr)) <<
 		"not expected brackets around " << bitXorOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(bitOrOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, bitOrOpExpr)) <<
 		"not expected brackets around " << bitOrOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(eqOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, eqOpExpr)) <<
 		"not expected brackets around " << eqOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(andOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, andOpExpr)) <<
 		"not expected brackets around " << andOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(orOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, orOpExpr)) <<
 		"not expected brackets around " << orOpExpr;
 }
 
@@ -767,27 +767,27 @@ OneOperatorFromOnePrecedenceRowBracketsNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addressOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(orOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, orOpExpr)) <<
 		"expected brackets around " << orOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(andOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, andOpExpr)) <<
 		"expected brackets around " << andOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(neqOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, neqOpExpr)) <<
 		"expected brackets around " << neqOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(bitOrOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, bitOrOpExpr)) <<
 		"expected brackets around " << bitOrOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(bitXorOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, bitXorOpExpr)) <<
 		"expected brackets around " << bitXorOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(bitAndOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, bitAndOpExpr)) <<
 		"expected brackets around " << bitAndOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(bitShlOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, bitShlOpExpr)) <<
 		"expected brackets around " << bitShlOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(divOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, divOpExpr)) <<
 		"expected brackets around " << divOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addressOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addressOpExpr)) <<
 		"not expected brackets around " << addressOpExpr;
 }
 
@@ -818,13 +818,13 @@ TernaryOpBracketsAreNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(ternaryOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(ternaryOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, ternaryOpExpr)) <<
 		"not expected brackets around " << ternaryOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
 }
 
@@ -860,15 +860,15 @@ TernaryOpBracketsAreNeededFalseCond) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(modOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(modOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, modOpExpr)) <<
 		"not expected brackets around " << modOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(ternaryOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, ternaryOpExpr)) <<
 		"expected brackets around " << ternaryOpExpr;
 }
 
@@ -904,15 +904,15 @@ TernaryOpBracketsAreNeededTrueCond) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(modOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(ltOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, ltOpExpr)) <<
 		"not expected brackets around " << ltOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(modOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, modOpExpr)) <<
 		"not expected brackets around " << modOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(ternaryOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, ternaryOpExpr)) <<
 		"expected brackets around " << ternaryOpExpr;
 }
 
@@ -941,11 +941,11 @@ NotSupportedOperatorBracketsNeededInsideExpr) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(intToPtrCastExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
 }
 
@@ -975,11 +975,11 @@ NotSupportedOperatorBracketsNeededCast) {
 
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"expected brackets around " << addOpExpr;
 }
 
@@ -1007,9 +1007,9 @@ CallExprWithArgumentsBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
 }
 
@@ -1042,11 +1042,11 @@ CallExprInExpressionWithArgumentsBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(subOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, subOpExpr)) <<
 		"not expected brackets around " << subOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(callExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, callExpr)) <<
 		"not expected brackets around " << callExpr;
 }
 
@@ -1069,11 +1069,11 @@ CallExprOfArrayIndexBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, varA)) <<
 		"not expected brackets around " << varA;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(arrayIndexOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, arrayIndexOpExpr)) <<
 		"not expected brackets around " << arrayIndexOpExpr;
 }
 
@@ -1094,9 +1094,9 @@ CalledExprIsDerefBracketsAreNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(derefOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, derefOpExpr)) <<
 		"expected brackets around " << derefOpExpr;
 }
 
@@ -1119,9 +1119,9 @@ ArrayIndexOpExprBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
 }
 
@@ -1139,9 +1139,9 @@ ArrayIndexOpExprBracketsNotNeededIfJustVariableIsIndexed) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(arrayIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, varA)) <<
 		"not expected brackets around " << varA;
 }
 
@@ -1169,11 +1169,11 @@ ArrayIndexOpExprInExpressionBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(mulOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(subOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, subOpExpr)) <<
 		"not expected brackets around " << subOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(arrayIndexOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, arrayIndexOpExpr)) <<
 		"not expected brackets around " << arrayIndexOpExpr;
 }
 
@@ -1202,11 +1202,11 @@ StructIndexOpExprInExpressionBracketsNotNeeded) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(addOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(addOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, addOpExpr)) <<
 		"not expected brackets around " << addOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -1224,9 +1224,9 @@ StructIndexOpExprBracketsNotNeededIfJustVariableIsIndexed) {
 	));
 	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(structIndexOpExpr));
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(varA)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, varA)) <<
 		"not expected brackets around " << varA;
 }
 
@@ -1247,11 +1247,11 @@ MulAssign) {
 	);
 	auto returnStmt = ReturnStmt::create(mulOpExpr);
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_TRUE(pyBrackets.areBracketsNeeded(assignOpExpr)) <<
+	EXPECT_TRUE(areBracketsNeeded(pyBrackets, assignOpExpr)) <<
 		"expected brackets around " << assignOpExpr;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(mulOpExpr)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, mulOpExpr)) <<
 		"not expected brackets around " << mulOpExpr;
 }
 
@@ -1268,11 +1268,11 @@ AssignAssignBracketsNotNeeded) {
 	auto assignABC = AssignOpExpr::create(varA, assignBC);
 	auto returnStmt = ReturnStmt::create(assignABC);
 	testFunc->setBody(returnStmt);
-	PyBracketManager pyBrackets(module);
+	PyBracketManager pyBrackets;
 
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(assignABC)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, assignABC)) <<
 		"not expected brackets around " << assignABC;
-	EXPECT_FALSE(pyBrackets.areBracketsNeeded(assignBC)) <<
+	EXPECT_FALSE(areBracketsNeeded(pyBrackets, assignBC)) <<
 		"not expected brackets around " << assignBC;
 }
 
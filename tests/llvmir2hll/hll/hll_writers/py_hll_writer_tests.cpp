@@ -8,10 +8,28 @@
 
 #include "retdec/llvmir2hll/hll/hll_writers/py_hll_writer.h"
 #include "llvmir2hll/hll/hll_writers/hll_writer_tests.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/address_op_expr.h"
+#include "retdec/llvmir2hll/ir/and_op_expr.h"
+#include "retdec/llvmir2hll/ir/array_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/call_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/const_string.h"
+#include "retdec/llvmir2hll/ir/deref_op_expr.h"
+#include "retdec/llvmir2hll/ir/div_op_expr.h"
+#include "retdec/llvmir2hll/ir/ext_cast_expr.h"
 #include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/or_op_expr.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/ternary_op_expr.h"
+#include "retdec/llvmir2hll/ir/trunc_cast_expr.h"
 #include "retdec/llvmir2hll/ir/variable.h"
 #include "retdec/utils/string.h"
 
@@ -98,6 +116,300 @@ EmitsWideStringLiteralAs8BitStringLiteral) {
 	ASSERT_TRUE(contains(code, "wprintf(\"wide string\")")) << code;
 }
 
+//
+// Emission of brackets.
+//
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsOnlyAroundOperandsThatNeedThem) {
+	//
+	// void test() {
+	//     return a * (b + c) - d;
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	auto varD = Variable::create("d", IntType::create(32));
+	auto returnStmt = ReturnStmt::create(
+		SubOpExpr::create(
+			MulOpExpr::create(
+				varA,
+				AddOpExpr::create(varB, varC)
+			),
+			varD
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return a * (b + c) - d\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsAroundOperandOfCompoundOperatorWhenTheyAreNeededInRhs) {
+	//
+	// void test() {
+	//     a = a - (b - c);
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	module->addGlobalVar(varA);
+	auto assignStmt = AssignStmt::create(
+		varA,
+		SubOpExpr::create(
+			varA,
+			SubOpExpr::create(varB, varC)
+		)
+	);
+	testFunc->setBody(assignStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "a -= (b - c)\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsInNestedBinaryExpressionsAsBefore) {
+	//
+	// void test() {
+	//     return (a + b) * (c - d) / e - (b - c);
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	auto varD = Variable::create("d", IntType::create(32));
+	auto varE = Variable::create("e", IntType::create(32));
+	auto returnStmt = ReturnStmt::create(
+		SubOpExpr::create(
+			DivOpExpr::create(
+				MulOpExpr::create(
+					AddOpExpr::create(varA, varB),
+					SubOpExpr::create(varC, varD)
+				),
+				varE
+			),
+			SubOpExpr::create(varB, varC)
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return (a + b) * (c - d) / e - (b - c)\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsInNestedLogicalExpressionsAsBefore) {
+	//
+	// void test() {
+	//     return a < b && (c || d);
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(1));
+	auto varD = Variable::create("d", IntType::create(1));
+	auto returnStmt = ReturnStmt::create(
+		AndOpExpr::create(
+			LtOpExpr::create(varA, varB),
+			OrOpExpr::create(varC, varD)
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return a < b and (c or d)\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsAroundTernaryOperatorAsBefore) {
+	//
+	// void test() {
+	//     return (a < b ? c + d : c ? d : a) * e;
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	auto varD = Variable::create("d", IntType::create(32));
+	auto varE = Variable::create("e", IntType::create(32));
+	auto returnStmt = ReturnStmt::create(
+		MulOpExpr::create(
+			TernaryOpExpr::create(
+				LtOpExpr::create(varA, varB),
+				AddOpExpr::create(varC, varD),
+				TernaryOpExpr::create(varC, varD, varA)
+			),
+			varE
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return (c + d if a < b else d if c else a) * e\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsInCallsAsBefore) {
+	//
+	// void test() {
+	//     return g(a + b, c ? d : a) + (*p)(a);
+	// }
+	//
+	auto gFunc = addFuncDecl("g");
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	auto varD = Variable::create("d", IntType::create(32));
+	auto varP = Variable::create("p", IntType::create(32));
+	ExprVector gArgs;
+	gArgs.push_back(AddOpExpr::create(varA, varB));
+	gArgs.push_back(TernaryOpExpr::create(varC, varD, varA));
+	ExprVector pArgs;
+	pArgs.push_back(varA);
+	auto returnStmt = ReturnStmt::create(
+		AddOpExpr::create(
+			CallExpr::create(gFunc->getAsVar(), gArgs),
+			CallExpr::create(DerefOpExpr::create(varP), pArgs)
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return g(a + b, d if c else a) + (*p)(a)\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsInArrayAccessesAsBefore) {
+	//
+	// void test() {
+	//     return (&a)[b + c] * &d[e];
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	auto varD = Variable::create("d", IntType::create(32));
+	auto varE = Variable::create("e", IntType::create(32));
+	auto returnStmt = ReturnStmt::create(
+		MulOpExpr::create(
+			ArrayIndexOpExpr::create(
+				AddressOpExpr::create(varA),
+				AddOpExpr::create(varB, varC)
+			),
+			AddressOpExpr::create(
+				ArrayIndexOpExpr::create(varD, varE)
+			)
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return (&a)[b + c] * &d[e]\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsInStructAccessesAsBefore) {
+	//
+	// void test() {
+	//     return (*p).e1 + a.e0.e1;
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varP = Variable::create("p", IntType::create(32));
+	auto returnStmt = ReturnStmt::create(
+		AddOpExpr::create(
+			StructIndexOpExpr::create(
+				DerefOpExpr::create(varP),
+				ConstInt::create(1, 32)
+			),
+			StructIndexOpExpr::create(
+				StructIndexOpExpr::create(varA, ConstInt::create(0, 32)),
+				ConstInt::create(1, 32)
+			)
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return (*p)['1'] + a['0']['1']\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsAroundOperandsOfIgnoredCastsAsBefore) {
+	//
+	// void test() {
+	//     return (int16_t)(a + b) * (int64_t)(c - d);
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	auto varD = Variable::create("d", IntType::create(32));
+	auto returnStmt = ReturnStmt::create(
+		MulOpExpr::create(
+			TruncCastExpr::create(
+				AddOpExpr::create(varA, varB),
+				IntType::create(16)
+			),
+			ExtCastExpr::create(
+				SubOpExpr::create(varC, varD),
+				IntType::create(64)
+			)
+		)
+	);
+	testFunc->setBody(returnStmt);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "return (a + b) * (c - d)\n")) << code;
+}
+
+TEST_F(PyHLLWriterTests,
+EmitsBracketsAroundOperandsOfCompoundOperatorsAsBefore) {
+	//
+	// void test() {
+	//     a = a * (b + c);
+	//     a = b * c + a;
+	// }
+	//
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varC = Variable::create("c", IntType::create(32));
+	module->addGlobalVar(varA);
+	auto assignStmt1 = AssignStmt::create(
+		varA,
+		MulOpExpr::create(
+			varA,
+			AddOpExpr::create(varB, varC)
+		)
+	);
+	auto assignStmt2 = AssignStmt::create(
+		varA,
+		AddOpExpr::create(
+			MulOpExpr::create(varB, varC),
+			varA
+		)
+	);
+	assignStmt1->setSuccessor(assignStmt2);
+	testFunc->setBody(assignStmt1);
+
+	auto code = emitCodeForCurrentModule();
+
+	ASSERT_TRUE(contains(code, "a *= (b + c)\n")) << code;
+	ASSERT_TRUE(contains(code, "a += b * c\n")) << code;
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -14,6 +14,7 @@
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/function_builder.h"
+#include "retdec/llvmir2hll/ir/global_var_def.h"
 #include "retdec/llvmir2hll/ir/int_type.h"
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/ir/variable.h"
@@ -231,6 +232,101 @@ HasGlobalVarReturnsFalseWhenGlobalVarDoesNotExist) {
 	ASSERT_FALSE(module->hasGlobalVar("nonexisting"));
 }
 
+//
+// getGlobalVarByName()
+//
+
+TEST_F(ModuleTests,
+GetGlobalVarByNameReturnsGlobalVarAfterItWasRenamed) {
+	auto var = addGlobalVar("g");
+	ASSERT_EQ(var, module->getGlobalVarByName("g"));
+
+	var->setName("h");
+
+	ASSERT_EQ(var, module->getGlobalVarByName("h"));
+	ASSERT_FALSE(module->getGlobalVarByName("g"));
+}
+
+TEST_F(ModuleTests,
+GetGlobalVarByNameReturnsNextGlobalVarWithSameNameWhenFirstOneIsRemoved) {
+	auto var1 = addGlobalVar("g");
+	auto var2 = addGlobalVar("g");
+	ASSERT_EQ(var1, module->getGlobalVarByName("g"));
+
+	module->removeGlobalVar(var1);
+
+	ASSERT_EQ(var2, module->getGlobalVarByName("g"));
+}
+
+//
+// getGlobalVars(), removeGlobalVar()
+//
+
+TEST_F(ModuleTests,
+RemovedGlobalVarIsNoLongerGlobalAndOrderOfOtherGlobalVarsIsKept) {
+	auto var1 = addGlobalVar("a");
+	auto var2 = addGlobalVar("b");
+	auto var3 = addGlobalVar("c");
+
+	module->removeGlobalVar(var2);
+
+	ASSERT_FALSE(module->isGlobalVar(var2));
+	ASSERT_FALSE(module->hasGlobalVar("b"));
+	ASSERT_EQ(VarSet({var1, var3}), module->getGlobalVars());
+	std::vector<ShPtr<Variable>> vars;
+	for (auto i = module->global_var_begin(), e = module->global_var_end();
+			i != e; ++i) {
+		vars.push_back((*i)->getVar());
+	}
+	ASSERT_EQ(std::vector<ShPtr<Variable>>({var1, var3}), vars);
+}
+
+TEST_F(ModuleTests,
+AddingExistingGlobalVarOnlyReplacesItsInitializer) {
+	auto var = addGlobalVar("g");
+	auto init = ConstInt::create(1, 32);
+
+	module->addGlobalVar(var, init);
+
+	ASSERT_EQ(1, module->getGlobalVars().size());
+	ASSERT_EQ(init, module->getInitForGlobalVar(var));
+}
+
+//
+// getFuncByName()
+//
+
+TEST_F(ModuleTests,
+GetFuncByNameReturnsFuncAfterItWasRenamed) {
+	auto func = addFuncDecl("my_func");
+	ASSERT_EQ(func, module->getFuncByName("my_func"));
+
+	func->setName("other_func");
+
+	ASSERT_EQ(func, module->getFuncByName("other_func"));
+	ASSERT_FALSE(module->hasFuncWithName("my_func"));
+}
+
+TEST_F(ModuleTests,
+GetFuncByNameReturnsNullPointerForRemovedFunc) {
+	auto func = addFuncDecl("my_func");
+	ASSERT_EQ(func, module->getFuncByName("my_func"));
+
+	module->removeFunc(func);
+
+	ASSERT_FALSE(module->getFuncByName("my_func"));
+	ASSERT_FALSE(module->funcExists(func));
+}
+
+TEST_F(ModuleTests,
+GetFuncByNameReturnsFuncAddedAfterPreviousLookup) {
+	ASSERT_FALSE(module->getFuncByName("my_func"));
+
+	auto func = addFuncDecl("my_func");
+
+	ASSERT_EQ(func, module->getFuncByName("my_func"));
+}
+
 //
 // correspondsToFunc()
 //
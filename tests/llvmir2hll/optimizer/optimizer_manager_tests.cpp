@@ -0,0 +1,122 @@
+/**
+* @file tests/llvmir2hll/optimizer/optimizer_manager_tests.cpp
+* @brief Tests for the @c optimizer_manager module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "llvmir2hll/analysis/tests_with_value_analysis.h"
+#include "llvmir2hll/hll/hll_writers/hll_writer_tests.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/strict_arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/hll/hll_writers/c_hll_writer.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer.h"
+#include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
+#include "retdec/utils/memory.h"
+#include "retdec/utils/string.h"
+
+using namespace ::testing;
+
+using retdec::utils::contains;
+using retdec::utils::MemoryBudget;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c optimizer_manager module.
+*/
+class OptimizerManagerTests: public HLLWriterTests {
+protected:
+	virtual void SetUp() override;
+	virtual void TearDown() override;
+
+	void addSelfAssignToTestFunc();
+	void optimizeCurrentModule();
+};
+
+void OptimizerManagerTests::SetUp() {
+	HLLWriterTests::SetUp();
+
+	writer = CHLLWriter::create(codeStream);
+}
+
+void OptimizerManagerTests::TearDown() {
+	MemoryBudget::reset();
+
+	HLLWriterTests::TearDown();
+}
+
+/**
+* @brief Sets the body of the testing function to
+*
+* @code
+* a = a
+* return
+* @endcode
+*/
+void OptimizerManagerTests::addSelfAssignToTestFunc() {
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	testFunc->setBody(AssignStmt::create(varA, varA, ReturnStmt::create()));
+}
+
+/**
+* @brief Runs SelfAssignOptimizer over the current module by using the
+*        optimizer manager.
+*/
+void OptimizerManagerTests::optimizeCurrentModule() {
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	OptimizerManager optimizerManager(StringSet({"SelfAssign"}), StringSet(),
+		writer, va, OptimCallInfoObtainer::create(),
+		StrictArithmExprEvaluator::create(), false);
+	optimizerManager.optimize(module);
+}
+
+TEST_F(OptimizerManagerTests,
+OptimizationsAreRunWhenThereIsNoMemoryBudget) {
+	addSelfAssignToTestFunc();
+
+	optimizeCurrentModule();
+
+	ASSERT_TRUE(isa<ReturnStmt>(testFunc->getBody())) <<
+		"expected ReturnStmt, got " << testFunc->getBody();
+}
+
+TEST_F(OptimizerManagerTests,
+OptimizationsAreRunWhenMemoryUsageIsFarFromBudget) {
+	MemoryBudget::setLimit(1000);
+	MemoryBudget::setUsageSampler([]() { return std::size_t(100); });
+	addSelfAssignToTestFunc();
+
+	optimizeCurrentModule();
+
+	ASSERT_TRUE(isa<ReturnStmt>(testFunc->getBody())) <<
+		"expected ReturnStmt, got " << testFunc->getBody();
+}
+
+TEST_F(OptimizerManagerTests,
+BudgetedRunEmitsPartiallyOptimizedCodeWhenBudgetIsExhausted) {
+	MemoryBudget::setLimit(1000);
+	MemoryBudget::setUsageSampler([]() { return std::size_t(990); });
+	addSelfAssignToTestFunc();
+
+	optimizeCurrentModule();
+	auto code = emitCodeForCurrentModule();
+
+	// The optimization has been skipped, but the code is still emitted.
+	ASSERT_TRUE(isa<AssignStmt>(testFunc->getBody())) <<
+		"expected AssignStmt, got " << testFunc->getBody();
+	ASSERT_TRUE(contains(code, "void test(void) {")) << code;
+	ASSERT_TRUE(contains(code, "a = a;")) << code;
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
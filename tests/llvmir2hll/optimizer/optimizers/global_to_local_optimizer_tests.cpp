@@ -4,10 +4,19 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "llvmir2hll/analysis/tests_with_value_analysis.h"
 #include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
 #include "retdec/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/global_to_local_optimizer.h"
 
@@ -20,7 +29,37 @@ namespace tests {
 /**
 * @brief Tests for the @c global_to_local_optimizer module.
 */
-class GlobalToLocalOptimizerTests: public TestsWithModule {};
+class GlobalToLocalOptimizerTests: public TestsWithModule {
+protected:
+	ShPtr<Variable> addRegisterGlobalVar(const std::string &name);
+	void optimizeCurrentModule();
+};
+
+/**
+* @brief Adds a global variable with the given name to the module, like the
+*        ones created for registers in decompiled binaries.
+*/
+ShPtr<Variable> GlobalToLocalOptimizerTests::addRegisterGlobalVar(
+		const std::string &name) {
+	auto var = Variable::create(name, IntType::create(32));
+	module->addGlobalVar(var);
+	return var;
+}
+
+/**
+* @brief Runs GlobalToLocalOptimizer over the current module.
+*
+* The body of the testing function is set to a return statement because the
+* optimization traverses CFGs of all functions, which requires at least one
+* statement.
+*/
+void GlobalToLocalOptimizerTests::optimizeCurrentModule() {
+	testFunc->setBody(ReturnStmt::create());
+
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+	Optimizer::optimize<GlobalToLocalOptimizer>(module, va,
+		OptimCallInfoObtainer::create());
+}
 
 TEST_F(GlobalToLocalOptimizerTests,
 OptimizerHasNonEmptyID) {
@@ -33,6 +72,124 @@ OptimizerHasNonEmptyID) {
 		"the optimizer should have a non-empty ID";
 }
 
+TEST_F(GlobalToLocalOptimizerTests,
+GlobalVarUsedInNoFunctionIsRemoved) {
+	// Set-up the module.
+	//
+	// int eax;
+	//
+	// void test() {
+	//     return;
+	// }
+	//
+	addRegisterGlobalVar("eax");
+
+	optimizeCurrentModule();
+
+	ASSERT_FALSE(module->hasGlobalVar("eax"));
+}
+
+TEST_F(GlobalToLocalOptimizerTests,
+GlobalVarWhoseValueIsReturnedFromTwoFunctionsIsKept) {
+	// Set-up the module.
+	//
+	// int eax;
+	//
+	// int f1() {
+	//     eax = 1;
+	//     return eax;
+	// }
+	//
+	// int f2() {
+	//     return eax;
+	// }
+	//
+	auto eax = addRegisterGlobalVar("eax");
+	auto f1 = addFuncDef("f1");
+	f1->setBody(AssignStmt::create(eax, ConstInt::create(1, 32),
+		ReturnStmt::create(eax)));
+	auto f2 = addFuncDef("f2");
+	f2->setBody(ReturnStmt::create(eax));
+
+	optimizeCurrentModule();
+
+	ASSERT_TRUE(module->isGlobalVar(eax));
+}
+
+TEST_F(GlobalToLocalOptimizerTests,
+ManyRegisterGlobalVarsUsedOnlyUselesslyAreConvertedToLocalVarsOfFunctionsUsingThem) {
+	// Set-up the module.
+	//
+	// int r0, r1, ..., rN;
+	//
+	// void f0() {
+	//     r0 = 0;
+	//     r1 = r0;
+	// }
+	//
+	// void f1() {
+	//     r1 = 1;
+	//     r2 = r1;
+	// }
+	//
+	// ...
+	//
+	const std::size_t NUM_OF_VARS = 200;
+	std::vector<ShPtr<Variable>> vars;
+	for (std::size_t i = 0; i <= NUM_OF_VARS; ++i) {
+		vars.push_back(addRegisterGlobalVar("r" + std::to_string(i)));
+	}
+	std::vector<ShPtr<Function>> funcs;
+	for (std::size_t i = 0; i < NUM_OF_VARS; ++i) {
+		auto func = addFuncDef("f" + std::to_string(i));
+		func->setBody(
+			AssignStmt::create(vars[i], ConstInt::create(i, 32),
+			AssignStmt::create(vars[i + 1], vars[i]))
+		);
+		funcs.push_back(func);
+	}
+
+	optimizeCurrentModule();
+
+	ASSERT_FALSE(module->hasGlobalVars());
+	for (std::size_t i = 0; i < NUM_OF_VARS; ++i) {
+		StringSet localVarNames;
+		for (const auto &var : funcs[i]->getLocalVars()) {
+			localVarNames.insert(var->getName());
+		}
+		ASSERT_EQ(StringSet({vars[i]->getName(), vars[i + 1]->getName()}),
+			localVarNames) << "function " << funcs[i]->getName();
+	}
+}
+
+TEST_F(GlobalToLocalOptimizerTests,
+ManyRegisterGlobalVarsWhereOnlyOneIsUsefulKeepOnlyTheUsefulOneGlobal) {
+	// Set-up the module.
+	//
+	// int eax;
+	// int r0, r1, ..., rN;
+	//
+	// int f0() {
+	//     r0 = 0;
+	//     return eax;
+	// }
+	//
+	// ...
+	//
+	const std::size_t NUM_OF_VARS = 200;
+	auto eax = addRegisterGlobalVar("eax");
+	for (std::size_t i = 0; i < NUM_OF_VARS; ++i) {
+		auto var = addRegisterGlobalVar("r" + std::to_string(i));
+		auto func = addFuncDef("f" + std::to_string(i));
+		func->setBody(AssignStmt::create(var, ConstInt::create(i, 32),
+			ReturnStmt::create(eax)));
+	}
+
+	optimizeCurrentModule();
+
+	ASSERT_EQ(VarSet({eax}), module->getGlobalVars());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
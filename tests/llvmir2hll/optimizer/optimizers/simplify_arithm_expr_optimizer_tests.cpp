@@ -9,6 +9,7 @@
 #include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/strict_arithm_expr_evaluator.h"
 #include "retdec/llvmir2hll/ir/add_op_expr.h"
 #include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
 #include "retdec/llvmir2hll/ir/const_float.h"
 #include "retdec/llvmir2hll/ir/const_int.h"
 #include "retdec/llvmir2hll/ir/eq_op_expr.h"
@@ -223,6 +224,82 @@ BiggerAddAndSubAndMulExpression) {
 		"got `" << outConstInt << "`";
 }
 
+TEST_F(SimplifyArithmExprOptimizerTests,
+ReplacedOperandsAreSimplifiedBeforeTheirParent) {
+	// return (a + 0) - (a * 1);
+	//
+	// Optimized to return 0.
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<SubOpExpr> returnExpr(
+		SubOpExpr::create(
+			AddOpExpr::create(varA, ConstInt::create(0, 32)),
+			MulOpExpr::create(varA, ConstInt::create(1, 32))
+	));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(returnExpr));
+	testFunc->setBody(returnStmt);
+
+	optimize(module);
+
+	ShPtr<ConstInt> outConstInt(cast<ConstInt>(returnStmt->getRetVal()));
+	ASSERT_TRUE(outConstInt) <<
+		"expected `ConstInt`, "
+		"got `" << returnStmt->getRetVal() << "`";
+	EXPECT_TRUE(outConstInt->isZero()) <<
+		"expected `0`, "
+		"got `" << outConstInt << "`";
+}
+
+TEST_F(SimplifyArithmExprOptimizerTests,
+ExpressionsNestedInCallArgumentsAreSimplified) {
+	// return test((a - 5) + 6);
+	//
+	// Optimized to return test(a + 1).
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	ShPtr<AddOpExpr> argExpr(
+		AddOpExpr::create(
+			SubOpExpr::create(varA, ConstInt::create(5, 64)),
+			ConstInt::create(6, 64)
+	));
+	ShPtr<CallExpr> callExpr(CallExpr::create(
+		testFunc->getAsVar(), ExprVector{argExpr}));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(callExpr));
+	testFunc->setBody(returnStmt);
+
+	optimize(module);
+
+	ShPtr<AddOpExpr> outAddOpExpr(cast<AddOpExpr>(callExpr->getArg(1)));
+	ASSERT_TRUE(outAddOpExpr) <<
+		"expected `AddOpExpr`, "
+		"got `" << callExpr->getArg(1) << "`";
+	EXPECT_EQ(varA, outAddOpExpr->getFirstOperand());
+	ShPtr<ConstInt> outOp2(cast<ConstInt>(outAddOpExpr->getSecondOperand()));
+	ASSERT_TRUE(outOp2) <<
+		"expected `ConstInt`, "
+		"got `" << outAddOpExpr->getSecondOperand() << "`";
+	EXPECT_EQ(1, outOp2->getValue().getSExtValue());
+}
+
+TEST_F(SimplifyArithmExprOptimizerTests,
+AlreadySimpleExpressionIsLeftUntouched) {
+	// return a + b;
+	//
+	// Not optimized.
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	ShPtr<AddOpExpr> returnExpr(AddOpExpr::create(varA, varB));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(returnExpr));
+	testFunc->setBody(returnStmt);
+
+	optimize(module);
+
+	EXPECT_EQ(returnExpr, returnStmt->getRetVal());
+	EXPECT_EQ(varA, returnExpr->getFirstOperand());
+	EXPECT_EQ(varB, returnExpr->getSecondOperand());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
@@ -0,0 +1,366 @@
+/**
+* @file tests/llvmir2hll/support/expr_types_fixer_tests.cpp
+* @brief Tests for the @c expr_types_fixer module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/expr_types_analysis.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/div_op_expr.h"
+#include "retdec/llvmir2hll/ir/ext_cast_expr.h"
+#include "retdec/llvmir2hll/ir/function_builder.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/mod_op_expr.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/var_def_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/expr_types_fixer.h"
+#include "retdec/llvmir2hll/utils/ir.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c expr_types_fixer module.
+*/
+class ExprTypesFixerTests: public TestsWithModule {
+protected:
+	/// Expressions of the program created by createProgram().
+	struct Program {
+		VarVector vars;
+		ExprVector consts;
+	};
+
+protected:
+	bool isSignedVar(ShPtr<Variable> var);
+	bool isSignedConst(ShPtr<Expression> expr);
+	Program createProgram(ShPtr<Function> func);
+	void setProbablyTypesInOneRound(ShPtr<Module> module);
+};
+
+/**
+* @brief Returns @c true if @a var is of a signed integer type.
+*/
+bool ExprTypesFixerTests::isSignedVar(ShPtr<Variable> var) {
+	ShPtr<IntType> type(cast<IntType>(var->getType()));
+	return type && type->isSigned();
+}
+
+/**
+* @brief Returns @c true if @a expr is a (possibly casted) signed integer
+*        constant.
+*/
+bool ExprTypesFixerTests::isSignedConst(ShPtr<Expression> expr) {
+	ShPtr<ConstInt> constant(cast<ConstInt>(skipCasts(expr)));
+	return constant && constant->isSigned();
+}
+
+/**
+* @brief Creates a program mixing all kinds of tags in @a func.
+*
+* @code
+* void test() {
+*     b = a;
+*     c = b / 3;        // signed division
+*     d = zext(c);
+*     uint32_t e = 7;
+*     f = sext(e);
+*     g = a < e;        // signed comparison
+*     h = b % 4;        // unsigned remainder
+*     i = k;            // k is signed
+*     j = sext(k);
+* }
+* @endcode
+*/
+ExprTypesFixerTests::Program ExprTypesFixerTests::createProgram(
+		ShPtr<Function> func) {
+	Program program;
+	for (const auto &name : {"a", "b", "c", "e", "h", "i", "k"}) {
+		program.vars.push_back(Variable::create(name,
+			IntType::create(32, std::string(name) == "k")));
+	}
+	for (const auto &name : {"d", "f", "g", "j"}) {
+		program.vars.push_back(Variable::create(name,
+			IntType::create(64, false)));
+	}
+	for (const auto &var : program.vars) {
+		func->addLocalVar(var);
+	}
+	auto findVar = [&](const std::string &name) {
+		for (const auto &var : program.vars) {
+			if (var->getName() == name) {
+				return var;
+			}
+		}
+		return ShPtr<Variable>();
+	};
+	program.consts.push_back(ConstInt::create(3, 32, false));
+	program.consts.push_back(ConstInt::create(7, 32, false));
+	program.consts.push_back(ConstInt::create(4, 32, false));
+
+	ShPtr<AssignStmt> assignJ(AssignStmt::create(findVar("j"),
+		ExtCastExpr::create(findVar("k"), IntType::create(64, false),
+			ExtCastExpr::Variant::SExt)));
+	ShPtr<AssignStmt> assignI(AssignStmt::create(findVar("i"), findVar("k"),
+		assignJ));
+	ShPtr<AssignStmt> assignH(AssignStmt::create(findVar("h"),
+		ModOpExpr::create(findVar("b"), program.consts[2],
+			ModOpExpr::Variant::UMod), assignI));
+	ShPtr<AssignStmt> assignG(AssignStmt::create(findVar("g"),
+		LtOpExpr::create(findVar("a"), findVar("e"), LtOpExpr::Variant::SCmp),
+		assignH));
+	ShPtr<AssignStmt> assignF(AssignStmt::create(findVar("f"),
+		ExtCastExpr::create(findVar("e"), IntType::create(64, false),
+			ExtCastExpr::Variant::SExt), assignG));
+	ShPtr<VarDefStmt> defE(VarDefStmt::create(findVar("e"), program.consts[1],
+		assignF));
+	ShPtr<AssignStmt> assignD(AssignStmt::create(findVar("d"),
+		ExtCastExpr::create(findVar("c"), IntType::create(64, false),
+			ExtCastExpr::Variant::ZExt), defE));
+	ShPtr<AssignStmt> assignC(AssignStmt::create(findVar("c"),
+		DivOpExpr::create(findVar("b"), program.consts[0],
+			DivOpExpr::Variant::SDiv), assignD));
+	ShPtr<AssignStmt> assignB(AssignStmt::create(findVar("b"), findVar("a"),
+		assignC));
+	func->setBody(assignB);
+	return program;
+}
+
+/**
+* @brief Sets the probable types the way the fixer did it before the
+*        statistics were counted only once.
+*
+* The statistics were recomputed until no type changed. However, the analysis
+* did not visit any statement in the second round, so only the first round did
+* something.
+*/
+void ExprTypesFixerTests::setProbablyTypesInOneRound(ShPtr<Module> module) {
+	ShPtr<ExprTypesAnalysis> exprTypesAnalysis(ExprTypesAnalysis::create());
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		ExprTypesAnalysis::ExprTagsMap exprTagsMap =
+				exprTypesAnalysis->analyzeExprTypes(module);
+		for (const auto &p : exprTagsMap) {
+			ShPtr<Expression> expr = p.first;
+			std::size_t isSigned = exprTypesAnalysis->getCountOfTag(
+				expr, ExprTypesAnalysis::ExprTag::Signed);
+			std::size_t isUnsigned = exprTypesAnalysis->getCountOfTag(
+				expr, ExprTypesAnalysis::ExprTag::Unsigned);
+			if (ShPtr<Variable> var = cast<Variable>(expr)) {
+				if (ShPtr<IntType> type = cast<IntType>(var->getType())) {
+					if ((isSigned > isUnsigned) && type->isUnsigned()) {
+						changed = true;
+						var->setType(IntType::create(type->getSize(), true));
+					} else if ((isSigned <= isUnsigned) && type->isSigned()) {
+						changed = true;
+						var->setType(IntType::create(type->getSize(), false));
+					}
+				}
+			} else if (ShPtr<ConstInt> constant = cast<ConstInt>(expr)) {
+				if ((isSigned > isUnsigned) && constant->isUnsigned()) {
+					changed = true;
+					llvm::APSInt val = constant->getValue();
+					val.setIsSigned(true);
+					Expression::replaceExpression(expr, ConstInt::create(val));
+				} else if ((isSigned <= isUnsigned) && constant->isSigned()) {
+					changed = true;
+					llvm::APSInt val = constant->getValue();
+					val.setIsUnsigned(true);
+					Expression::replaceExpression(expr, ConstInt::create(val));
+				}
+			}
+		}
+	}
+}
+
+TEST_F(ExprTypesFixerTests,
+VariableWithoutTagsKeepsItsType) {
+	// void test() {
+	//     int32_t a = zext(b);
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32, true)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32, false)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varB);
+	testFunc->setBody(AssignStmt::create(varA,
+		ExtCastExpr::create(varB, IntType::create(32, false))));
+
+	ExprTypesFixer::fixTypes(module);
+
+	EXPECT_TRUE(isSignedVar(varA));
+	EXPECT_FALSE(isSignedVar(varB));
+}
+
+TEST_F(ExprTypesFixerTests,
+VariableUsedInSignedExtensionBecomesSigned) {
+	// void test() {
+	//     uint64_t c = sext(a);
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32, false)));
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(64, false)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varC);
+	testFunc->setBody(AssignStmt::create(varC,
+		ExtCastExpr::create(varA, IntType::create(64, false),
+			ExtCastExpr::Variant::SExt)));
+
+	ExprTypesFixer::fixTypes(module);
+
+	EXPECT_TRUE(isSignedVar(varA));
+	EXPECT_FALSE(isSignedVar(varC));
+}
+
+TEST_F(ExprTypesFixerTests,
+SignedVariableUsedOnlyAsUnsignedBecomesUnsigned) {
+	// void test() {
+	//     uint64_t c = zext(a);
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32, true)));
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(64, false)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varC);
+	testFunc->setBody(AssignStmt::create(varC,
+		ExtCastExpr::create(varA, IntType::create(64, false),
+			ExtCastExpr::Variant::ZExt)));
+
+	ExprTypesFixer::fixTypes(module);
+
+	EXPECT_FALSE(isSignedVar(varA));
+}
+
+TEST_F(ExprTypesFixerTests,
+SignednessIsNotPropagatedThroughAssignments) {
+	// void test() {
+	//     b = a;
+	//     c = b;
+	//     d = sext(a);
+	// }
+	//
+	// a is signed because of the sign extension. The statistics are computed
+	// before a becomes signed, so b and c stay unsigned.
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32, false)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32, false)));
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(32, false)));
+	ShPtr<Variable> varD(Variable::create("d", IntType::create(64, false)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varB);
+	testFunc->addLocalVar(varC);
+	testFunc->addLocalVar(varD);
+	ShPtr<AssignStmt> assignD(AssignStmt::create(varD,
+		ExtCastExpr::create(varA, IntType::create(64, false),
+			ExtCastExpr::Variant::SExt)));
+	ShPtr<AssignStmt> assignC(AssignStmt::create(varC, varB, assignD));
+	ShPtr<AssignStmt> assignB(AssignStmt::create(varB, varA, assignC));
+	testFunc->setBody(assignB);
+
+	ExprTypesFixer::fixTypes(module);
+
+	EXPECT_TRUE(isSignedVar(varA));
+	EXPECT_FALSE(isSignedVar(varB));
+	EXPECT_FALSE(isSignedVar(varC));
+	EXPECT_FALSE(isSignedVar(varD));
+}
+
+TEST_F(ExprTypesFixerTests,
+UnsignedUseKeepsAssignedVariableUnsigned) {
+	// void test() {
+	//     b = a;
+	//     uint64_t c = zext(b);
+	//     uint64_t d = sext(a);
+	// }
+	//
+	// b gets only an unsigned tag (from the zero extension), so it stays
+	// unsigned.
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32, false)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32, false)));
+	ShPtr<Variable> varC(Variable::create("c", IntType::create(64, false)));
+	ShPtr<Variable> varD(Variable::create("d", IntType::create(64, false)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varB);
+	testFunc->addLocalVar(varC);
+	testFunc->addLocalVar(varD);
+	ShPtr<AssignStmt> assignD(AssignStmt::create(varD,
+		ExtCastExpr::create(varA, IntType::create(64, false),
+			ExtCastExpr::Variant::SExt)));
+	ShPtr<AssignStmt> assignC(AssignStmt::create(varC,
+		ExtCastExpr::create(varB, IntType::create(64, false),
+			ExtCastExpr::Variant::ZExt), assignD));
+	ShPtr<AssignStmt> assignB(AssignStmt::create(varB, varA, assignC));
+	testFunc->setBody(assignB);
+
+	ExprTypesFixer::fixTypes(module);
+
+	EXPECT_TRUE(isSignedVar(varA));
+	EXPECT_FALSE(isSignedVar(varB));
+}
+
+TEST_F(ExprTypesFixerTests,
+ConstantInSignedDivisionIsReplacedWithSignedConstant) {
+	// void test() {
+	//     b = a / 2; // signed division
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32, false)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32, false)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varB);
+	ShPtr<DivOpExpr> divExpr(DivOpExpr::create(varA,
+		ConstInt::create(2, 32, false), DivOpExpr::Variant::SDiv));
+	testFunc->setBody(AssignStmt::create(varB, divExpr));
+
+	ExprTypesFixer::fixTypes(module);
+
+	EXPECT_TRUE(isSignedVar(varA));
+	EXPECT_TRUE(isSignedVar(varB));
+	ShPtr<ConstInt> outConst(cast<ConstInt>(divExpr->getSecondOperand()));
+	ASSERT_TRUE(outConst) <<
+		"expected ConstInt, got " << divExpr->getSecondOperand();
+	EXPECT_TRUE(outConst->isSigned());
+	EXPECT_EQ(2, outConst->getValue().getSExtValue());
+}
+
+TEST_F(ExprTypesFixerTests,
+TypesAreSameAsWhenStatisticsAreRecomputedInRounds) {
+	Program program(createProgram(testFunc));
+	ShPtr<Module> refModule(std::make_shared<Module>(&llvmModule,
+		llvmModule.getModuleIdentifier(), semanticsMock, configMock));
+	ShPtr<Function> refFunc(FunctionBuilder("test")
+		.definitionWithEmptyBody()
+		.build());
+	refModule->addFunc(refFunc);
+	Program refProgram(createProgram(refFunc));
+	// Constants are replaced, so their parents have to be searched for the
+	// new ones after the fix.
+	ShPtr<DivOpExpr> divExpr(cast<DivOpExpr>(
+		cast<AssignStmt>(testFunc->getBody()->getSuccessor())->getRhs()));
+	ShPtr<DivOpExpr> refDivExpr(cast<DivOpExpr>(
+		cast<AssignStmt>(refFunc->getBody()->getSuccessor())->getRhs()));
+
+	ExprTypesFixer::fixTypes(module);
+	setProbablyTypesInOneRound(refModule);
+
+	ASSERT_EQ(refProgram.vars.size(), program.vars.size());
+	for (std::size_t i = 0, e = program.vars.size(); i < e; ++i) {
+		EXPECT_EQ(isSignedVar(refProgram.vars[i]),
+			isSignedVar(program.vars[i])) << program.vars[i]->getName();
+	}
+	EXPECT_EQ(isSignedConst(refDivExpr->getSecondOperand()),
+		isSignedConst(divExpr->getSecondOperand()));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
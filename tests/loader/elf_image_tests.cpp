@@ -0,0 +1,231 @@
+/**
+ * @file tests/loader/elf_image_tests.cpp
+ * @brief Tests for the @c elf_image module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/types/sec_seg/section.h"
+#include "retdec/loader/loader/elf/elf_image.h"
+#include "retdec/loader/loader/segment_data_source.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace loader {
+namespace tests {
+
+/**
+ * ELF image without any file format, which exposes placement of segments
+ * and patching of relocated values.
+ */
+class ElfImageMock : public ElfImage
+{
+public:
+	ElfImageMock() : ElfImage(nullptr) {}
+
+	virtual retdec::utils::Endianness getEndianness() const override
+	{
+		return endianness;
+	}
+
+	void addDataSegment(std::uint64_t address, std::vector<std::uint8_t>& data)
+	{
+		llvm::StringRef dataRef(reinterpret_cast<const char*>(data.data()), data.size());
+		insertSegment(std::make_unique<Segment>(nullptr, address, data.size(), std::make_unique<SegmentDataSource>(dataRef)));
+	}
+
+	using ElfImage::RelocationPatcher;
+	using ElfImage::addSegment;
+	using ElfImage::flushRemovedSegments;
+	using ElfImage::sortSegments;
+
+	retdec::utils::Endianness endianness = retdec::utils::Endianness::LITTLE;
+};
+
+class ElfImageTests : public Test
+{
+public:
+	const retdec::fileformat::Section* makeSection(const std::string& name)
+	{
+		// BSS sections do not need any data from the file
+		auto section = std::make_unique<retdec::fileformat::Section>();
+		section->setType(retdec::fileformat::SecSeg::Type::BSS);
+		section->setName(name);
+		sections.push_back(std::move(section));
+		return sections.back().get();
+	}
+
+	void expectSegment(std::size_t index, const std::string& name, std::uint64_t address, std::uint64_t size)
+	{
+		const auto* segment = image.getSegment(index);
+		ASSERT_NE(nullptr, segment);
+		EXPECT_EQ(name, segment->getName());
+		EXPECT_EQ(address, segment->getAddress());
+		EXPECT_EQ(size, segment->getSize());
+	}
+
+	std::vector<std::unique_ptr<retdec::fileformat::Section>> sections;
+	ElfImageMock image;
+};
+
+TEST_F(ElfImageTests,
+NonOverlappingSegmentsAreKept) {
+	image.addSegment(makeSection(".b"), 0x2000, 0x100);
+	image.addSegment(makeSection(".a"), 0x1000, 0x100);
+	image.flushRemovedSegments();
+	image.sortSegments();
+
+	ASSERT_EQ(2, image.getNumberOfSegments());
+	expectSegment(0, ".a", 0x1000, 0x100);
+	expectSegment(1, ".b", 0x2000, 0x100);
+}
+
+TEST_F(ElfImageTests,
+OverlappedStartAndEndAreShrunk) {
+	image.addSegment(makeSection(".a"), 0x1000, 0x100);
+	image.addSegment(makeSection(".b"), 0x1200, 0x100);
+	image.addSegment(makeSection(".c"), 0x1080, 0x200);
+	image.flushRemovedSegments();
+	image.sortSegments();
+
+	ASSERT_EQ(3, image.getNumberOfSegments());
+	expectSegment(0, ".a", 0x1000, 0x80);
+	expectSegment(1, ".c", 0x1080, 0x200);
+	expectSegment(2, ".b", 0x1280, 0x80);
+}
+
+TEST_F(ElfImageTests,
+FullyOverlappedSegmentsAreRemoved) {
+	image.addSegment(makeSection(".a"), 0x1000, 0x100);
+	image.addSegment(makeSection(".b"), 0x1100, 0x100);
+	image.addSegment(makeSection(".c"), 0x1300, 0x100);
+	image.addSegment(makeSection(".d"), 0x1000, 0x200);
+	image.flushRemovedSegments();
+	image.sortSegments();
+
+	ASSERT_EQ(2, image.getNumberOfSegments());
+	expectSegment(0, ".d", 0x1000, 0x200);
+	expectSegment(1, ".c", 0x1300, 0x100);
+}
+
+TEST_F(ElfImageTests,
+SegmentInMiddleSplitsOverlappedOne) {
+	image.addSegment(makeSection(".a"), 0x1000, 0x300);
+	image.addSegment(makeSection(".b"), 0x1100, 0x100);
+	image.flushRemovedSegments();
+	image.sortSegments();
+
+	ASSERT_EQ(3, image.getNumberOfSegments());
+	expectSegment(0, ".a", 0x1000, 0x100);
+	expectSegment(1, ".b", 0x1100, 0x100);
+	expectSegment(2, ".a", 0x1200, 0x100);
+}
+
+TEST_F(ElfImageTests,
+SplitSegmentCanBeOverlappedAgain) {
+	image.addSegment(makeSection(".a"), 0x1000, 0x300);
+	image.addSegment(makeSection(".b"), 0x1100, 0x100);
+	image.addSegment(makeSection(".c"), 0x1180, 0x100);
+	image.flushRemovedSegments();
+	image.sortSegments();
+
+	ASSERT_EQ(4, image.getNumberOfSegments());
+	expectSegment(0, ".a", 0x1000, 0x100);
+	expectSegment(1, ".b", 0x1100, 0x80);
+	expectSegment(2, ".c", 0x1180, 0x100);
+	expectSegment(3, ".a", 0x1280, 0x80);
+}
+
+TEST_F(ElfImageTests,
+ManySectionsArePlacedWithoutOverlaps) {
+	const std::size_t count = 20000;
+	for (std::size_t i = 0; i < count; ++i)
+		image.addSegment(makeSection(".text." + std::to_string(i)), 0x10000 + (count - i) * 0x10, 0x10);
+
+	// Every second section gets fully overlapped by a later one
+	for (std::size_t i = 1; i < count; i += 2)
+		image.addSegment(makeSection(".data." + std::to_string(i)), 0x10000 + (count - i) * 0x10, 0x10);
+
+	image.flushRemovedSegments();
+	image.sortSegments();
+
+	ASSERT_EQ(count, image.getNumberOfSegments());
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const auto* segment = image.getSegment(i);
+		std::size_t section = count - 1 - i;
+		EXPECT_EQ(0x10000 + (i + 1) * 0x10, segment->getAddress());
+		EXPECT_EQ(0x10, segment->getSize());
+		EXPECT_EQ((section % 2 ? ".data." : ".text.") + std::to_string(section), segment->getName());
+	}
+}
+
+TEST_F(ElfImageTests,
+PatcherReadsAndWritesLittleEndianValues) {
+	std::vector<std::uint8_t> data = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+	image.addDataSegment(0x1000, data);
+	ElfImageMock::RelocationPatcher patcher(&image);
+
+	std::uint64_t value;
+	ASSERT_TRUE(patcher.get(4, 0x1002, value));
+	EXPECT_EQ(0x66554433, value);
+
+	ASSERT_TRUE(patcher.set(2, 0x1000, 0xBEEF));
+	EXPECT_EQ(0xEF, data[0]);
+	EXPECT_EQ(0xBE, data[1]);
+	EXPECT_EQ(0x33, data[2]);
+}
+
+TEST_F(ElfImageTests,
+PatcherReadsAndWritesBigEndianValues) {
+	std::vector<std::uint8_t> data = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+	image.endianness = retdec::utils::Endianness::BIG;
+	image.addDataSegment(0x1000, data);
+	ElfImageMock::RelocationPatcher patcher(&image);
+
+	std::uint64_t value;
+	ASSERT_TRUE(patcher.get(4, 0x1002, value));
+	EXPECT_EQ(0x33445566, value);
+
+	ASSERT_TRUE(patcher.set(4, 0x1004, 0xDEADBEEF));
+	EXPECT_EQ(std::vector<std::uint8_t>({0x11, 0x22, 0x33, 0x44, 0xDE, 0xAD, 0xBE, 0xEF}), data);
+}
+
+TEST_F(ElfImageTests,
+PatcherFailsOutsideOfSegmentData) {
+	std::vector<std::uint8_t> data = {0x11, 0x22, 0x33, 0x44};
+	image.addDataSegment(0x1000, data);
+	image.addSegment(makeSection(".bss"), 0x2000, 0x100);
+	ElfImageMock::RelocationPatcher patcher(&image);
+
+	std::uint64_t value = 0;
+	EXPECT_FALSE(patcher.get(4, 0x1002, value));
+	EXPECT_FALSE(patcher.set(4, 0x1001, 0));
+	EXPECT_FALSE(patcher.get(4, 0x2000, value));
+	EXPECT_FALSE(patcher.get(4, 0x3000, value));
+	EXPECT_EQ(std::vector<std::uint8_t>({0x11, 0x22, 0x33, 0x44}), data);
+}
+
+TEST_F(ElfImageTests,
+PatcherSwitchesBetweenSegments) {
+	std::vector<std::uint8_t> first = {0x01, 0x00, 0x00, 0x00};
+	std::vector<std::uint8_t> second = {0x02, 0x00, 0x00, 0x00};
+	image.addDataSegment(0x1000, first);
+	image.addDataSegment(0x2000, second);
+	ElfImageMock::RelocationPatcher patcher(&image);
+
+	std::uint64_t value;
+	ASSERT_TRUE(patcher.get(4, 0x1000, value));
+	EXPECT_EQ(1, value);
+	ASSERT_TRUE(patcher.get(4, 0x2000, value));
+	EXPECT_EQ(2, value);
+	ASSERT_TRUE(patcher.set(4, 0x1000, 3));
+	EXPECT_EQ(3, first[0]);
+	EXPECT_EQ(2, second[0]);
+}
+
+} // namespace tests
+} // namespace loader
+} // namespace retdec
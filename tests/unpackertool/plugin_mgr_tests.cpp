@@ -0,0 +1,67 @@
+/**
+* @file tests/unpackertool/plugin_mgr_tests.cpp
+* @brief Tests for the @c plugin_mgr module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/unpacker/plugin.h"
+#include "unpackertool/plugin_mgr.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace unpackertool {
+namespace tests {
+
+class PluginMgrTests : public Test
+{
+protected:
+	std::vector<std::string> matchingNames(const std::string& packerName, const std::string& packerVersion)
+	{
+		std::vector<std::string> names;
+		for (const auto& plugin : PluginMgr::matchingPlugins(packerName, packerVersion))
+			names.push_back(plugin->getInfo()->name);
+		return names;
+	}
+};
+
+TEST_F(PluginMgrTests,
+PackerNameIsMatchedCaseInsensitively) {
+	EXPECT_EQ(std::vector<std::string>{"UPX"}, matchingNames("upx", "3.91"));
+	EXPECT_EQ(std::vector<std::string>{"MPRESS"}, matchingNames("mPrEsS", "2.19"));
+}
+
+TEST_F(PluginMgrTests,
+UnknownPackerHasNoPlugin) {
+	EXPECT_TRUE(matchingNames("ASPack", "2.12").empty());
+	EXPECT_TRUE(matchingNames("ASPack", WILDCARD_ALL_VERSIONS).empty());
+}
+
+TEST_F(PluginMgrTests,
+WildcardMatchesAllVersions) {
+	EXPECT_EQ(std::vector<std::string>{"MPRESS"}, matchingNames("MPRESS", WILDCARD_ALL_VERSIONS));
+}
+
+TEST_F(PluginMgrTests,
+VersionIsMatchedAgainstPluginPattern) {
+	EXPECT_EQ(std::vector<std::string>{"MPRESS"}, matchingNames("MPRESS", "1.07"));
+	EXPECT_EQ(std::vector<std::string>{"MPRESS"}, matchingNames("MPRESS", "2.19"));
+	EXPECT_TRUE(matchingNames("MPRESS", "3.00").empty());
+	EXPECT_TRUE(matchingNames("MPRESS", "unknown").empty());
+}
+
+TEST_F(PluginMgrTests,
+RepeatedLookupsGiveSameResults) {
+	for (int i = 0; i < 3; ++i)
+	{
+		EXPECT_EQ(std::vector<std::string>{"MPRESS"}, matchingNames("MPRESS", "2.19"));
+		EXPECT_TRUE(matchingNames("MPRESS", "0.99").empty());
+		EXPECT_EQ(std::vector<std::string>{"UPX"}, matchingNames("UPX", "3.91"));
+	}
+}
+
+} // namespace tests
+} // namespace unpackertool
+} // namespace retdec
@@ -0,0 +1,155 @@
+/**
+* @file tests/unpackertool/unpack_layers_tests.cpp
+* @brief Tests for the @c unpack_layers module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "unpackertool/unpack_layers.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace unpackertool {
+namespace tests {
+
+/**
+ * Files in these tests contain the number of layers packed in them. Each
+ * unpacked layer contains the number decreased by one.
+ */
+class UnpackLayersTests : public Test
+{
+protected:
+	const std::string inputFile = "unpack_layers_tests_input";
+	const std::string outputFile = "unpack_layers_tests_output";
+
+	std::size_t detections = 0;
+	std::size_t unpackings = 0;
+
+	virtual void TearDown() override
+	{
+		std::remove(inputFile.c_str());
+		std::remove(outputFile.c_str());
+	}
+
+	void writeLayers(const std::string& file, int layers)
+	{
+		std::ofstream(file) << layers;
+	}
+
+	int readLayers(const std::string& file)
+	{
+		int layers = -1;
+		std::ifstream(file) >> layers;
+		return layers;
+	}
+
+	bool exists(const std::string& file)
+	{
+		return std::ifstream(file).good();
+	}
+
+	PackerDetector detector()
+	{
+		return [this](const std::string& file, std::vector<retdec::cpdetect::DetectResult>& packers)
+		{
+			++detections;
+			if (readLayers(file) > 0)
+			{
+				packers.emplace_back();
+				packers.back().name = "Fake";
+			}
+			return true;
+		};
+	}
+
+	/// Unpacker which removes one layer. If @a selfUnpacking is set, the
+	/// unpacked file is the same as the packed one.
+	LayerUnpacker unpacker(bool selfUnpacking = false)
+	{
+		return [this, selfUnpacking](const std::string& in, const std::string& out,
+				const std::vector<retdec::cpdetect::DetectResult>& packers)
+		{
+			if (packers.empty())
+				return EXIT_CODE_NOTHING_TO_DO;
+
+			++unpackings;
+			auto layers = readLayers(in);
+			writeLayers(out, selfUnpacking ? layers : layers - 1);
+			return EXIT_CODE_OK;
+		};
+	}
+};
+
+TEST_F(UnpackLayersTests,
+AllLayersAreUnpacked) {
+	writeLayers(inputFile, 3);
+
+	EXPECT_EQ(EXIT_CODE_OK, unpackLayers(inputFile, outputFile, detector(), unpacker()));
+
+	EXPECT_EQ(0, readLayers(outputFile));
+	EXPECT_EQ(3, readLayers(inputFile));
+	EXPECT_EQ(4, detections);
+	EXPECT_EQ(3, unpackings);
+	EXPECT_FALSE(exists(outputFile + ".tmp"));
+}
+
+TEST_F(UnpackLayersTests,
+FileWithoutPackerIsNotUnpacked) {
+	writeLayers(inputFile, 0);
+
+	EXPECT_EQ(EXIT_CODE_NOTHING_TO_DO, unpackLayers(inputFile, outputFile, detector(), unpacker()));
+
+	EXPECT_FALSE(exists(outputFile));
+	EXPECT_EQ(1, detections);
+	EXPECT_EQ(0, unpackings);
+}
+
+TEST_F(UnpackLayersTests,
+DetectionErrorOfFirstLayerIsReported) {
+	auto failingDetector = [](const std::string&, std::vector<retdec::cpdetect::DetectResult>&)
+	{
+		return false;
+	};
+
+	EXPECT_EQ(EXIT_CODE_PREPROCESSING_ERROR, unpackLayers(inputFile, outputFile, failingDetector, unpacker()));
+
+	EXPECT_FALSE(exists(outputFile));
+	EXPECT_EQ(0, unpackings);
+}
+
+TEST_F(UnpackLayersTests,
+FailureOfLaterLayerKeepsAlreadyUnpackedLayers) {
+	writeLayers(inputFile, 3);
+	auto failingUnpacker = [this](const std::string& in, const std::string& out,
+			const std::vector<retdec::cpdetect::DetectResult>& packers)
+	{
+		if (readLayers(in) == 2)
+			return EXIT_CODE_UNPACKING_FAILED;
+		return unpacker()(in, out, packers);
+	};
+
+	EXPECT_EQ(EXIT_CODE_OK, unpackLayers(inputFile, outputFile, detector(), failingUnpacker));
+
+	EXPECT_EQ(2, readLayers(outputFile));
+	EXPECT_FALSE(exists(outputFile + ".tmp"));
+}
+
+TEST_F(UnpackLayersTests,
+SelfUnpackingFileStopsAfterMaximalNumberOfLayers) {
+	writeLayers(inputFile, 1);
+
+	EXPECT_EQ(EXIT_CODE_OK, unpackLayers(inputFile, outputFile, detector(), unpacker(true)));
+
+	EXPECT_EQ(1, readLayers(outputFile));
+	EXPECT_EQ(MAX_UNPACKED_LAYERS, detections);
+	EXPECT_EQ(MAX_UNPACKED_LAYERS, unpackings);
+}
+
+} // namespace tests
+} // namespace unpackertool
+} // namespace retdec
@@ -4,11 +4,18 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <cstdlib>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "retdec/utils/memory.h"
 #include "retdec/utils/os.h"
 
+#ifdef OS_LINUX
+	#include <unistd.h>
+#endif
+
 using namespace ::testing;
 
 namespace retdec {
@@ -28,6 +35,7 @@ protected:
 
 	virtual void TearDown() override {
 		limitSystemMemory(totalSystemMemory);
+		MemoryBudget::reset();
 	}
 
 private:
@@ -73,6 +81,104 @@ LimitSystemMemoryToHalfOfTotalSystemMemoryReturnsTrue) {
 	ASSERT_TRUE(limitSystemMemoryToHalfOfTotalSystemMemory());
 }
 
+TEST_F(MemoryTests,
+GetMemoryUsageReturnsNonZeroSize) {
+	ASSERT_GT(getMemoryUsage(), 0);
+}
+
+TEST_F(MemoryTests,
+MemoryBudgetStageIsNormalWhenNoBudgetIsSet) {
+	MemoryBudget::setUsageSampler([]() { return std::size_t(1000); });
+
+	ASSERT_FALSE(MemoryBudget::isLimited());
+	ASSERT_EQ(MemoryBudget::Stage::Normal, MemoryBudget::getStage());
+	ASSERT_FALSE(MemoryBudget::shouldDropCaches());
+}
+
+TEST_F(MemoryTests,
+MemoryBudgetStageRisesAsUsageGetsCloserToBudget) {
+	std::size_t usage = 0;
+	MemoryBudget::setUsageSampler([&usage]() { return usage; });
+	MemoryBudget::setLimit(1000);
+
+	usage = 500;
+	EXPECT_EQ(MemoryBudget::Stage::Normal, MemoryBudget::getStage());
+	usage = 750;
+	EXPECT_EQ(MemoryBudget::Stage::DropCaches, MemoryBudget::getStage());
+	EXPECT_TRUE(MemoryBudget::shouldDropCaches());
+	EXPECT_FALSE(MemoryBudget::shouldSkipOptionalPhases());
+	usage = 900;
+	EXPECT_EQ(MemoryBudget::Stage::SkipOptional, MemoryBudget::getStage());
+	EXPECT_TRUE(MemoryBudget::shouldSkipOptionalPhases());
+	EXPECT_FALSE(MemoryBudget::shouldEmitPartialResult());
+	usage = 990;
+	EXPECT_EQ(MemoryBudget::Stage::EmitPartial, MemoryBudget::getStage());
+	EXPECT_TRUE(MemoryBudget::shouldEmitPartialResult());
+}
+
+TEST_F(MemoryTests,
+MemoryBudgetStageDoesNotDropWhenUsageDrops) {
+	std::size_t usage = 900;
+	MemoryBudget::setUsageSampler([&usage]() { return usage; });
+	MemoryBudget::setLimit(1000);
+	ASSERT_EQ(MemoryBudget::Stage::SkipOptional, MemoryBudget::getStage());
+
+	usage = 100;
+
+	ASSERT_EQ(MemoryBudget::Stage::SkipOptional, MemoryBudget::getStage());
+}
+
+TEST_F(MemoryTests,
+MemoryBudgetResetRemovesBudgetAndResetsStage) {
+	MemoryBudget::setUsageSampler([]() { return std::size_t(1000); });
+	MemoryBudget::setLimit(1000);
+	ASSERT_EQ(MemoryBudget::Stage::EmitPartial, MemoryBudget::getStage());
+
+	MemoryBudget::reset();
+
+	ASSERT_FALSE(MemoryBudget::isLimited());
+	ASSERT_EQ(MemoryBudget::Stage::Normal, MemoryBudget::getStage());
+}
+
+#ifdef OS_LINUX
+/**
+* @brief Sets both the budget and the hard limit slightly above the current
+*        memory usage and allocates memory until the hard limit is hit.
+*
+* Exits with @c 0 if the budget reached Stage::EmitPartial before the hard
+* limit was hit, with a non-zero code otherwise.
+*/
+void allocateUntilHardLimitIsHit() {
+	const std::size_t ChunkSize = 1024 * 1024;
+	auto limit = getMemoryUsage() + 64 * ChunkSize;
+	MemoryBudget::setLimit(limit);
+	if (!limitSystemMemory(limit)) {
+		_exit(2);
+	}
+
+	// Reserve the space upfront so that only the chunks hit the limit.
+	std::vector<void *> chunks;
+	chunks.reserve(1024);
+	auto stageBeforeHardLimit = MemoryBudget::Stage::Normal;
+	while (chunks.size() < chunks.capacity()) {
+		auto chunk = std::malloc(ChunkSize);
+		if (!chunk) {
+			break;
+		}
+		chunks.push_back(chunk);
+		stageBeforeHardLimit = MemoryBudget::getStage();
+	}
+	_exit(stageBeforeHardLimit == MemoryBudget::Stage::EmitPartial ? 0 : 1);
+}
+
+TEST_F(MemoryTests,
+MemoryBudgetReachesEmitPartialStageBeforeHardLimitIsHit) {
+	// The hard limit is set in a child process, so it does not affect the
+	// other tests.
+	EXPECT_EXIT(allocateUntilHardLimitIsHit(), ExitedWithCode(0), "");
+}
+#endif
+
 } // namespace tests
 } // namespace utils
 } // namespace retdec